@@ -55,4 +55,7 @@
 // sugar
 #include "ControlZOHSimulation.hpp"
 #include "ControlLsodarSimulation.hpp"
+#include "ControlMatrixRecorder.hpp"
+#include "ControlRingBufferRecorder.hpp"
+#include "ControlBinaryFileRecorder.hpp"
 
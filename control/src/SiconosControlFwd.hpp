@@ -8,6 +8,10 @@
 DEFINE_SPTR(ControlSimulation)
 DEFINE_SPTR(ControlZOHSimulation)
 DEFINE_SPTR(ControlLsodarSimulation)
+DEFINE_SPTR(ControlSimulationRecorder)
+DEFINE_SPTR(ControlMatrixRecorder)
+DEFINE_SPTR(ControlRingBufferRecorder)
+DEFINE_SPTR(ControlBinaryFileRecorder)
 DEFINE_SPTR(ControlManager)
 
 DEFINE_SPTR(Sensor)
@@ -0,0 +1,117 @@
+/* Siconos is a program dedicated to modeling, simulation and control
+ * of non smooth dynamical systems.
+ *
+ * Copyright 2020 INRIA.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+*/
+
+#include "ControlBinaryFileRecorder.hpp"
+#include "SimpleMatrix.hpp"
+#include "RuntimeException.hpp"
+
+#include <algorithm>
+#include <cstring>
+
+/** magic string at the beginning of the files of ControlBinaryFileRecorder */
+static const char recorderMagic[8] = {'S', 'C', 'R', 'E', 'C', '0', '1', '\0'};
+
+ControlBinaryFileRecorder::ControlBinaryFileRecorder(const std::string& filename, unsigned chunkRows):
+  _filename(filename), _chunkRows(std::max(chunkRows, 1u))
+{}
+
+ControlBinaryFileRecorder::~ControlBinaryFileRecorder()
+{
+  // no exception from here
+  if(_file.is_open() && !_chunk.empty())
+    _file.write(reinterpret_cast<const char*>(_chunk.data()), _chunk.size() * sizeof(double));
+}
+
+void ControlBinaryFileRecorder::initializeStorage(unsigned nRowsHint)
+{
+  if(_file.is_open())
+    _file.close();
+  _file.open(_filename.c_str(), std::ios::out | std::ios::binary | std::ios::trunc);
+  if(!_file)
+    RuntimeException::selfThrow("ControlBinaryFileRecorder - cannot open the file " + _filename);
+
+  unsigned legendSize = _legend.size();
+  _file.write(recorderMagic, sizeof(recorderMagic));
+  _file.write(reinterpret_cast<const char*>(&_nCols), sizeof(unsigned));
+  _file.write(reinterpret_cast<const char*>(&legendSize), sizeof(unsigned));
+  _file.write(_legend.c_str(), legendSize);
+
+  _chunk.clear();
+  _chunk.reserve(_chunkRows * _nCols);
+}
+
+void ControlBinaryFileRecorder::write(const double* values)
+{
+  _chunk.insert(_chunk.end(), values, values + _nCols);
+  if(_chunk.size() >= _chunkRows * _nCols)
+    flush();
+}
+
+void ControlBinaryFileRecorder::flush()
+{
+  if(!_chunk.empty())
+  {
+    _file.write(reinterpret_cast<const char*>(_chunk.data()), _chunk.size() * sizeof(double));
+    _chunk.clear();
+  }
+  _file.flush();
+  if(!_file)
+    RuntimeException::selfThrow("ControlBinaryFileRecorder - error while writing the file " + _filename);
+}
+
+void ControlBinaryFileRecorder::finalize()
+{
+  if(_file.is_open())
+  {
+    flush();
+    _file.close();
+  }
+}
+
+SP::SimpleMatrix ControlBinaryFileRecorder::read(const std::string& filename, std::string* legend)
+{
+  std::ifstream file(filename.c_str(), std::ios::in | std::ios::binary);
+  if(!file)
+    RuntimeException::selfThrow("ControlBinaryFileRecorder::read - cannot open the file " + filename);
+
+  char magic[sizeof(recorderMagic)];
+  unsigned nCols = 0;
+  unsigned legendSize = 0;
+  file.read(magic, sizeof(magic));
+  file.read(reinterpret_cast<char*>(&nCols), sizeof(unsigned));
+  file.read(reinterpret_cast<char*>(&legendSize), sizeof(unsigned));
+  if(!file || std::memcmp(magic, recorderMagic, sizeof(magic)) != 0 || nCols == 0)
+    RuntimeException::selfThrow("ControlBinaryFileRecorder::read - " + filename + " is not a recorder file");
+
+  std::string names(legendSize, ' ');
+  file.read(&names[0], legendSize);
+  if(legend)
+    *legend = names;
+
+  std::vector<double> values;
+  std::vector<double> row(nCols);
+  while(file.read(reinterpret_cast<char*>(row.data()), nCols * sizeof(double)))
+    values.insert(values.end(), row.begin(), row.end());
+
+  unsigned nRows = values.size() / nCols;
+  SP::SimpleMatrix data(new SimpleMatrix(nRows, nCols));
+  for(unsigned i = 0; i < nRows; ++i)
+    for(unsigned j = 0; j < nCols; ++j)
+      (*data)(i, j) = values[i * nCols + j];
+  return data;
+}
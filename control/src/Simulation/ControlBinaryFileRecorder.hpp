@@ -0,0 +1,96 @@
+/* Siconos is a program dedicated to modeling, simulation and control
+ * of non smooth dynamical systems.
+ *
+ * Copyright 2020 INRIA.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+*/
+
+/*! \file ControlBinaryFileRecorder.hpp
+  \brief Recorder streaming the data of a ControlSimulation to a binary file
+*/
+
+#ifndef ControlBinaryFileRecorder_h
+#define ControlBinaryFileRecorder_h
+
+#include "ControlSimulationRecorder.hpp"
+
+#include <fstream>
+#include <string>
+#include <vector>
+
+/** Recorder streaming the rows to a binary file, by chunks of rows.
+ *
+ * The file contains a header (a magic string, the number of columns,
+ * the legend) followed by the rows, stored as native doubles. It can be
+ * read back with ControlBinaryFileRecorder::read().
+ */
+class ControlBinaryFileRecorder : public ControlSimulationRecorder
+{
+private:
+  /** serialization hooks */
+  ACCEPT_SERIALIZATION(ControlBinaryFileRecorder);
+
+  /** default constructor */
+  ControlBinaryFileRecorder() {};
+
+protected:
+
+  /** name of the file */
+  std::string _filename;
+
+  /** number of rows per chunk */
+  unsigned _chunkRows;
+
+  /** rows not yet written to the file */
+  std::vector<double> _chunk;
+
+  /** the output file, not serialized: a restored recorder does not write */
+  std::ofstream _file;
+
+  /** write the pending rows to the file */
+  void flush();
+
+  virtual void initializeStorage(unsigned nRowsHint);
+
+  virtual void write(const double* values);
+
+public:
+
+  /** Constructor
+   * \param filename the name of the file
+   * \param chunkRows number of rows buffered before each write to the file
+   */
+  ControlBinaryFileRecorder(const std::string& filename, unsigned chunkRows = 1024);
+
+  /** destructor, flushes the pending rows */
+  virtual ~ControlBinaryFileRecorder();
+
+  /** write the pending rows and close the file */
+  virtual void finalize();
+
+  /** \return the name of the file */
+  inline const std::string& filename() const
+  {
+    return _filename;
+  };
+
+  /** read a file written by a ControlBinaryFileRecorder
+   * \param filename the name of the file
+   * \param legend if not null, filled with the legend of the columns
+   * \return the recorded data
+   */
+  static SP::SimpleMatrix read(const std::string& filename, std::string* legend = nullptr);
+};
+
+#endif
@@ -0,0 +1,41 @@
+/* Siconos is a program dedicated to modeling, simulation and control
+ * of non smooth dynamical systems.
+ *
+ * Copyright 2020 INRIA.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+*/
+
+#include "ControlMatrixRecorder.hpp"
+#include "SimpleMatrix.hpp"
+
+#include <algorithm>
+
+void ControlMatrixRecorder::initializeStorage(unsigned nRowsHint)
+{
+  _dataM.reset(new SimpleMatrix(std::max(nRowsHint, 1u), _nCols));
+}
+
+void ControlMatrixRecorder::write(const double* values)
+{
+  SimpleMatrix& data = *_dataM;
+  if(_nRecorded >= data.size(0))
+    data.resize(2 * data.size(0), _nCols);
+  for(unsigned j = 0; j < _nCols; ++j)
+    data(_nRecorded, j) = values[j];
+}
+
+void ControlMatrixRecorder::finalize()
+{
+  _dataM->resize(_nRecorded, _nCols);
+}
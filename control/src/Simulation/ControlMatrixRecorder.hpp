@@ -0,0 +1,58 @@
+/* Siconos is a program dedicated to modeling, simulation and control
+ * of non smooth dynamical systems.
+ *
+ * Copyright 2020 INRIA.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+*/
+
+/*! \file ControlMatrixRecorder.hpp
+  \brief Recorder keeping the data of a ControlSimulation in a matrix
+*/
+
+#ifndef ControlMatrixRecorder_h
+#define ControlMatrixRecorder_h
+
+#include "ControlSimulationRecorder.hpp"
+
+/** Recorder keeping all the rows in a matrix (default recorder) */
+class ControlMatrixRecorder : public ControlSimulationRecorder
+{
+private:
+  /** serialization hooks */
+  ACCEPT_SERIALIZATION(ControlMatrixRecorder);
+
+protected:
+
+  /** the recorded data */
+  SP::SimpleMatrix _dataM;
+
+  virtual void initializeStorage(unsigned nRowsHint);
+
+  virtual void write(const double* values);
+
+public:
+
+  /** default constructor */
+  ControlMatrixRecorder() {};
+
+  /** shrink the matrix to the number of recorded rows */
+  virtual void finalize();
+
+  virtual SP::SimpleMatrix data()
+  {
+    return _dataM;
+  };
+};
+
+#endif
@@ -0,0 +1,57 @@
+/* Siconos is a program dedicated to modeling, simulation and control
+ * of non smooth dynamical systems.
+ *
+ * Copyright 2020 INRIA.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+*/
+
+#include "ControlRingBufferRecorder.hpp"
+#include "SimpleMatrix.hpp"
+#include "RuntimeException.hpp"
+
+#include <algorithm>
+
+ControlRingBufferRecorder::ControlRingBufferRecorder(unsigned capacity):
+  _capacity(capacity)
+{
+  if(capacity == 0)
+    RuntimeException::selfThrow("ControlRingBufferRecorder - the capacity must be at least 1");
+}
+
+void ControlRingBufferRecorder::initializeStorage(unsigned nRowsHint)
+{
+  _buffer.assign(std::min(nRowsHint, _capacity) * _nCols, 0.);
+}
+
+void ControlRingBufferRecorder::write(const double* values)
+{
+  unsigned slot = _nRecorded % _capacity;
+  if((slot + 1) * _nCols > _buffer.size())
+    _buffer.resize((slot + 1) * _nCols);
+  std::copy(values, values + _nCols, _buffer.begin() + slot * _nCols);
+}
+
+SP::SimpleMatrix ControlRingBufferRecorder::data()
+{
+  unsigned nRows = std::min(_nRecorded, _capacity);
+  unsigned first = _nRecorded > _capacity ? _nRecorded % _capacity : 0;
+  SP::SimpleMatrix data(new SimpleMatrix(nRows, _nCols));
+  for(unsigned i = 0; i < nRows; ++i)
+  {
+    const double* row = &_buffer[((first + i) % _capacity) * _nCols];
+    for(unsigned j = 0; j < _nCols; ++j)
+      (*data)(i, j) = row[j];
+  }
+  return data;
+}
@@ -0,0 +1,69 @@
+/* Siconos is a program dedicated to modeling, simulation and control
+ * of non smooth dynamical systems.
+ *
+ * Copyright 2020 INRIA.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+*/
+
+/*! \file ControlRingBufferRecorder.hpp
+  \brief Recorder keeping the last rows of data of a ControlSimulation
+*/
+
+#ifndef ControlRingBufferRecorder_h
+#define ControlRingBufferRecorder_h
+
+#include "ControlSimulationRecorder.hpp"
+
+#include <vector>
+
+/** Recorder keeping only the last rows, in a bounded ring buffer */
+class ControlRingBufferRecorder : public ControlSimulationRecorder
+{
+private:
+  /** serialization hooks */
+  ACCEPT_SERIALIZATION(ControlRingBufferRecorder);
+
+  /** default constructor */
+  ControlRingBufferRecorder() {};
+
+protected:
+
+  /** maximum number of rows kept */
+  unsigned _capacity;
+
+  /** ring buffer, row-major */
+  std::vector<double> _buffer;
+
+  virtual void initializeStorage(unsigned nRowsHint);
+
+  virtual void write(const double* values);
+
+public:
+
+  /** Constructor
+   * \param capacity the maximum number of rows kept
+   */
+  ControlRingBufferRecorder(unsigned capacity);
+
+  /** \return the last capacity() rows (at most), oldest first */
+  virtual SP::SimpleMatrix data();
+
+  /** \return the maximum number of rows kept */
+  inline unsigned capacity() const
+  {
+    return _capacity;
+  };
+};
+
+#endif
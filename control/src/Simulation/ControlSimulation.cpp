@@ -25,6 +25,7 @@
 #include "Actuator.hpp"
 #include "Observer.hpp"
 #include "ControlSimulation.hpp"
+#include "ControlMatrixRecorder.hpp"
 #include "ControlSimulation_impl.hpp"
 
 ControlSimulation::ControlSimulation(double t0, double T, double h):
@@ -80,7 +81,12 @@ void ControlSimulation::initialize()
       }
     }
   }
-  _dataM.reset(new SimpleMatrix(_N, _nDim + 1)); // we save the system state
+  // we save the time and the system state
+  if(!_recorder)
+    _recorder.reset(new ControlMatrixRecorder());
+  _recorder->initialize(_nDim + 1, _dataLegend, _N);
+  _dataRow.reset(new SiconosVector(_nDim + 1));
+  _dataM.reset();
 }
 
 void ControlSimulation::setTheta(unsigned int newTheta)
@@ -132,10 +138,12 @@ void ControlSimulation::addObserver(SP::Observer observer, const double h)
   _CM->addObserverPtr(observer, td);
 }
 
-void ControlSimulation::storeData(unsigned indx)
+void ControlSimulation::storeData(double time, bool last)
 {
+  SiconosVector& row = *_dataRow;
+  row(0) = time;
   unsigned startingColumn = 1;
-  startingColumn = storeAllStates(indx, startingColumn, *_DSG0, *_IG0, *_dataM);
+  startingColumn = storeAllStates(startingColumn, *_DSG0, *_IG0, row);
 
   if(!_saveOnlyMainSimulation)
   {
@@ -146,7 +154,7 @@ void ControlSimulation::storeData(unsigned indx)
       if((*it)->getInternalNSDS())
       {
         Topology& topo = *(*it)->getInternalNSDS()->topology();
-        startingColumn = storeAllStates(indx, startingColumn, *topo.dSG(0), *topo.indexSet0(), *_dataM);
+        startingColumn = storeAllStates(startingColumn, *topo.dSG(0), *topo.indexSet0(), row);
       }
     }
     const Observers& allObservers = _CM->getObservers();
@@ -155,10 +163,12 @@ void ControlSimulation::storeData(unsigned indx)
       if((*it)->getInternalNSDS())
       {
         Topology& topo = *(*it)->getInternalNSDS()->topology();
-        startingColumn = storeAllStates(indx, startingColumn, *topo.dSG(0), *topo.indexSet0(), *_dataM);
+        startingColumn = storeAllStates(startingColumn, *topo.dSG(0), *topo.indexSet0(), row);
       }
     }
   }
+
+  _recorder->record(row, last);
 }
 
 
@@ -75,9 +75,15 @@ protected:
   /** If true, do not show progress of the simulation */
   bool _silent;
 
-  /** Matrix for saving result */
+  /** Matrix for saving result (data of the recorder, available after run()) */
   SP::SimpleMatrix _dataM;
 
+  /** The recorder of the data, a ControlMatrixRecorder by default */
+  SP::ControlSimulationRecorder _recorder;
+
+  /** Buffer for a full row of data */
+  SP::SiconosVector _dataRow;
+
   /** Legend for the columns in the matrix _dataM*/
   std::string _dataLegend;
 
@@ -139,10 +145,27 @@ public:
    */
   void addObserver(SP::Observer observer, const double h);
 
-  /** store the simulation data in a row of the matrix
-   * \param indx the current row index
+  /** give the current simulation data to the recorder
+   * \param time the current time
+   * \param last true for the last row of the simulation
+   */
+  void storeData(double time, bool last = false);
+
+  /** Set the recorder of the simulation data, must be called before initialize()
+   * \param recorder the new recorder
+   */
+  inline void setRecorder(SP::ControlSimulationRecorder recorder)
+  {
+    _recorder = recorder;
+  };
+
+  /** Return the recorder of the simulation data
+   * \return the recorder
    */
-  void storeData(unsigned indx);
+  inline SP::ControlSimulationRecorder recorder() const
+  {
+    return _recorder;
+  };
 
   /** Return the Simulation
    * \return the simulation for the main simulation
@@ -168,8 +191,8 @@ public:
     return _nsds;
   }
 
-  /** Return the data matrix
-   * \return the data matrix
+  /** Return the data matrix, once run() is done
+   * \return the data matrix, null if the recorder does not keep the data in memory
    */
   inline SP::SimpleMatrix data() const
   {
@@ -0,0 +1,91 @@
+/* Siconos is a program dedicated to modeling, simulation and control
+ * of non smooth dynamical systems.
+ *
+ * Copyright 2020 INRIA.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+*/
+
+#include "ControlSimulationRecorder.hpp"
+#include "SiconosVector.hpp"
+#include "RuntimeException.hpp"
+
+#include <cassert>
+#include <sstream>
+
+void ControlSimulationRecorder::setDecimation(unsigned d)
+{
+  if(d == 0)
+    RuntimeException::selfThrow("ControlSimulationRecorder::setDecimation - the decimation factor must be at least 1");
+  _decimation = d;
+}
+
+void ControlSimulationRecorder::setSelection(const std::vector<unsigned>& columns)
+{
+  _selection = columns;
+}
+
+void ControlSimulationRecorder::initialize(unsigned nCols, const std::string& legend, unsigned nRowsHint)
+{
+  _nFullCols = nCols;
+  _nOffered = 0;
+  _nRecorded = 0;
+  if(_selection.empty())
+  {
+    _nCols = nCols;
+    _legend = legend;
+  }
+  else
+  {
+    std::vector<std::string> names;
+    std::istringstream iss(legend);
+    std::string name;
+    while(iss >> name)
+      names.push_back(name);
+
+    _nCols = _selection.size();
+    _legend.clear();
+    for(unsigned i = 0; i < _nCols; ++i)
+    {
+      if(_selection[i] >= nCols)
+        RuntimeException::selfThrow("ControlSimulationRecorder::initialize - a selected column is out of range");
+      if(i > 0)
+        _legend.append(" ");
+      _legend.append(_selection[i] < names.size() ? names[_selection[i]] : "column" + std::to_string(_selection[i]));
+    }
+  }
+  _values.resize(_nCols);
+  initializeStorage(nRowsHint / _decimation + 1);
+}
+
+void ControlSimulationRecorder::record(const SiconosVector& row, bool last)
+{
+  assert(row.size() == _nFullCols);
+  bool keep = last || (_nOffered % _decimation == 0);
+  ++_nOffered;
+  if(!keep)
+    return;
+
+  if(_selection.empty())
+  {
+    for(unsigned j = 0; j < _nCols; ++j)
+      _values[j] = row(j);
+  }
+  else
+  {
+    for(unsigned j = 0; j < _nCols; ++j)
+      _values[j] = row(_selection[j]);
+  }
+  write(_values.data());
+  ++_nRecorded;
+}
@@ -0,0 +1,150 @@
+/* Siconos is a program dedicated to modeling, simulation and control
+ * of non smooth dynamical systems.
+ *
+ * Copyright 2020 INRIA.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+*/
+
+/*! \file ControlSimulationRecorder.hpp
+  \brief Base class for the recorders of the data produced by a ControlSimulation
+*/
+
+#ifndef ControlSimulationRecorder_h
+#define ControlSimulationRecorder_h
+
+#include "SiconosPointers.hpp"
+#include "SiconosAlgebraTypeDef.hpp"
+#include "SiconosControlFwd.hpp"
+#include "SiconosFwd.hpp"
+
+#include <string>
+#include <vector>
+
+/** Base class for the recorders of a ControlSimulation.
+ *
+ * At each stored time step, the ControlSimulation gives a full row
+ * (time, then all the states, see ControlSimulation::dataLegend()) to
+ * record(). Only one row every decimation() rows (plus the last one) is
+ * kept, and only the columns given by setSelection() (all by default);
+ * the retained values are passed to write(), which is implemented by the
+ * derived classes.
+ */
+class ControlSimulationRecorder
+{
+private:
+  /** serialization hooks */
+  ACCEPT_SERIALIZATION(ControlSimulationRecorder);
+
+protected:
+
+  /** keep one row every _decimation rows */
+  unsigned _decimation = 1;
+
+  /** recorded columns of the full row, all if empty */
+  std::vector<unsigned> _selection;
+
+  /** number of columns of the full row */
+  unsigned _nFullCols = 0;
+
+  /** number of recorded columns */
+  unsigned _nCols = 0;
+
+  /** legend of the recorded columns */
+  std::string _legend;
+
+  /** number of rows given to record() */
+  unsigned _nOffered = 0;
+
+  /** number of rows written */
+  unsigned _nRecorded = 0;
+
+  /** buffer for the selected values of a row */
+  std::vector<double> _values;
+
+  /** allocate the storage, once the number of recorded columns is known
+   * \param nRowsHint estimation of the number of rows to be recorded
+   */
+  virtual void initializeStorage(unsigned nRowsHint) = 0;
+
+  /** write a row
+   * \param values the _nCols recorded values
+   */
+  virtual void write(const double* values) = 0;
+
+public:
+
+  /** default constructor */
+  ControlSimulationRecorder() {};
+
+  /** destructor */
+  virtual ~ControlSimulationRecorder() {};
+
+  /** \return the decimation factor */
+  inline unsigned decimation() const
+  {
+    return _decimation;
+  };
+
+  /** keep one row every d rows (the last row is always kept)
+   * \param d the decimation factor, at least 1
+   */
+  void setDecimation(unsigned d);
+
+  /** record only some columns of the full row (0 is the time)
+   * \param columns the indices of the recorded columns
+   */
+  void setSelection(const std::vector<unsigned>& columns);
+
+  /** prepare the recording, called by ControlSimulation::initialize()
+   * \param nCols number of columns of the full row
+   * \param legend legend of the full row, as space separated names
+   * \param nRowsHint estimation of the number of rows given to record()
+   */
+  void initialize(unsigned nCols, const std::string& legend, unsigned nRowsHint);
+
+  /** record a full row, subject to the decimation
+   * \param row the full row
+   * \param last true for the last row of the simulation (always recorded)
+   */
+  void record(const SiconosVector& row, bool last = false);
+
+  /** called at the end of the simulation */
+  virtual void finalize() {};
+
+  /** \return the recorded data as a matrix, if available in memory */
+  virtual SP::SimpleMatrix data()
+  {
+    return SP::SimpleMatrix();
+  };
+
+  /** \return the number of recorded columns */
+  inline unsigned nCols() const
+  {
+    return _nCols;
+  };
+
+  /** \return the legend of the recorded columns */
+  inline const std::string& legend() const
+  {
+    return _legend;
+  };
+
+  /** \return the number of rows recorded so far */
+  inline unsigned numberOfRecordedRows() const
+  {
+    return _nRecorded;
+  };
+};
+
+#endif
@@ -102,15 +102,14 @@ static inline std::pair<unsigned, std::string> getNumberOfStates(DynamicalSystem
   return std::make_pair(nb, legend);
 }
 
-/** store all the states of the graph in a matrix
- * \param indx row index in the matrix
+/** store all the states of the graph in a row of data
  * \param startColumn the starting column
  * \param DSG0 the graph of DynamicalSystem
  * \param IG0 the graph of Interaction
- * \param data the matrix where to save the data
+ * \param data the row where to save the data
  * \return the last written column
  */
-static inline unsigned storeAllStates(unsigned indx, unsigned startColumn, DynamicalSystemsGraph& DSG0, InteractionsGraph& IG0, SimpleMatrix& data)
+static inline unsigned storeAllStates(unsigned startColumn, DynamicalSystemsGraph& DSG0, InteractionsGraph& IG0, SiconosVector& data)
 {
   DynamicalSystemsGraph::VIterator dsvi, dsvdend;
   unsigned column = startColumn;
@@ -120,7 +119,7 @@ static inline unsigned storeAllStates(unsigned indx, unsigned startColumn, Dynam
     SiconosVector& x = *DSG0.bundle(*dsvi)->x();
     for (unsigned j = 0; j < x.size(); ++i, ++j)
     {
-      data(indx, i) = x(j);
+      data(i) = x(j);
     }
     column += x.size();
 
@@ -129,7 +128,7 @@ static inline unsigned storeAllStates(unsigned indx, unsigned startColumn, Dynam
       SiconosVector& u = *DSG0.u[*dsvi];
       for (unsigned j = 0; j < u.size(); ++i, ++j)
       {
-        data(indx, i) = u(j);
+        data(i) = u(j);
       }
       column += u.size();
     }
@@ -139,7 +138,7 @@ static inline unsigned storeAllStates(unsigned indx, unsigned startColumn, Dynam
       SiconosVector& e = *DSG0.e[*dsvi];
       for (unsigned j = 0; j < e.size(); ++i, ++j)
       {
-        data(indx, i) = e(j);
+        data(i) = e(j);
       }
       column += e.size();
     }
@@ -153,14 +152,14 @@ static inline unsigned storeAllStates(unsigned indx, unsigned startColumn, Dynam
     SiconosVector& y = *IG0.bundle(*ivi)->y(0);
     for (unsigned j = 0; j < y.size(); ++i, ++j)
     {
-      data(indx, i) = y(j);
+      data(i) = y(j);
     }
     column += y.size();
 
     SiconosVector& lambda = *IG0.bundle(*ivi)->lambda(0);
     for (unsigned j = 0; j < lambda.size(); ++i, ++j)
     {
-      data(indx, i) = lambda(j);
+      data(i) = lambda(j);
     }
     column += lambda.size();
   }
@@ -22,6 +22,8 @@
 #include "LinearSensor.hpp"
 #include "PID.hpp"
 #include "ioMatrix.hpp"
+#include "ControlRingBufferRecorder.hpp"
+#include "ControlBinaryFileRecorder.hpp"
 
 #define CPPUNIT_ASSERT_NOT_EQUAL(message, alpha, omega)      \
             if ((alpha) == (omega)) CPPUNIT_FAIL(message);
@@ -100,3 +102,60 @@ void PIDTest::testPIDLsodar()
   std::cout << "------- Integration done, error = " << (data - dataRef).normInf() << " -------" <<std::endl;
   CPPUNIT_ASSERT_EQUAL_MESSAGE("testPIDLsodar : ", (data - dataRef).normInf() < _tol, true);
 }
+
+void PIDTest::testPIDRecorders()
+{
+  SimpleMatrix dataRef(1, 1);
+  ioMatrix::read("PID.ref", "ascii", dataRef);
+  unsigned nRows = dataRef.size(0);
+
+  // whole data streamed to a file, with small chunks
+  init();
+  SP::ControlZOHSimulation simFile(new ControlZOHSimulation(_t0, _T, _h));
+  simFile->addDynamicalSystem(_DS);
+  simFile->addSensor(_sensor, _h);
+  simFile->addActuator(_PIDcontroller, _h);
+  SP::ControlBinaryFileRecorder fileRecorder(new ControlBinaryFileRecorder("PIDRecorder.bin", 7));
+  simFile->setRecorder(fileRecorder);
+  simFile->initialize();
+  simFile->run();
+  CPPUNIT_ASSERT_EQUAL_MESSAGE("testPIDRecorders : ", !simFile->data(), true);
+  std::string legend;
+  SP::SimpleMatrix dataFile = ControlBinaryFileRecorder::read("PIDRecorder.bin", &legend);
+  CPPUNIT_ASSERT_EQUAL_MESSAGE("testPIDRecorders : ", legend == simFile->dataLegend(), true);
+  CPPUNIT_ASSERT_EQUAL_MESSAGE("testPIDRecorders : ", dataFile->size(0) == nRows, true);
+  std::cout << "------- File recorder, error = " << (*dataFile - dataRef).normInf() << " -------" <<std::endl;
+  CPPUNIT_ASSERT_EQUAL_MESSAGE("testPIDRecorders : ", (*dataFile - dataRef).normInf() < _tol, true);
+
+  // last rows of the time and the first state, one row out of 3
+  init();
+  SP::ControlZOHSimulation simRing(new ControlZOHSimulation(_t0, _T, _h));
+  simRing->addDynamicalSystem(_DS);
+  simRing->addSensor(_sensor, _h);
+  simRing->addActuator(_PIDcontroller, _h);
+  unsigned capacity = 50;
+  unsigned decimation = 3;
+  SP::ControlRingBufferRecorder ringRecorder(new ControlRingBufferRecorder(capacity));
+  ringRecorder->setDecimation(decimation);
+  std::vector<unsigned> columns = {0, 1};
+  ringRecorder->setSelection(columns);
+  simRing->setRecorder(ringRecorder);
+  simRing->initialize();
+  simRing->run();
+  SimpleMatrix& dataRing = *simRing->data();
+  CPPUNIT_ASSERT_EQUAL_MESSAGE("testPIDRecorders : ", dataRing.size(0) == capacity, true);
+  CPPUNIT_ASSERT_EQUAL_MESSAGE("testPIDRecorders : ", dataRing.size(1) == 2, true);
+  // rows 0, 3, 6, ... and the last one were recorded
+  std::vector<unsigned> recordedRows;
+  for(unsigned i = 0; i < nRows - 1; i += decimation)
+    recordedRows.push_back(i);
+  if(recordedRows.back() != nRows - 1)
+    recordedRows.push_back(nRows - 1);
+  unsigned first = recordedRows.size() - capacity;
+  double error = 0.;
+  for(unsigned i = 0; i < capacity; ++i)
+    for(unsigned j = 0; j < 2; ++j)
+      error = std::max(error, fabs(dataRing(i, j) - dataRef(recordedRows[first + i], columns[j])));
+  std::cout << "------- Ring buffer recorder, error = " << error << " -------" <<std::endl;
+  CPPUNIT_ASSERT_EQUAL_MESSAGE("testPIDRecorders : ", error < _tol, true);
+}
@@ -39,12 +39,14 @@ private:
 
   CPPUNIT_TEST(testPIDZOH);
   CPPUNIT_TEST(testPIDLsodar);
+  CPPUNIT_TEST(testPIDRecorders);
 
   CPPUNIT_TEST_SUITE_END();
 
   void init();
   void testPIDZOH();
   void testPIDLsodar();
+  void testPIDRecorders();
   // Members
 
   unsigned int _n;
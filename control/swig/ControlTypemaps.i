@@ -24,3 +24,7 @@ DEFINE_TYPEMAPS(ControlSimulation);
 DEFINE_TYPEMAPS(ControlLsodarSimulation);
 DEFINE_TYPEMAPS(ControlZOHSimulation);
 DEFINE_TYPEMAPS(ControlManager);
+DEFINE_TYPEMAPS(ControlSimulationRecorder);
+DEFINE_TYPEMAPS(ControlMatrixRecorder);
+DEFINE_TYPEMAPS(ControlRingBufferRecorder);
+DEFINE_TYPEMAPS(ControlBinaryFileRecorder);
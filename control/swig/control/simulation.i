@@ -7,4 +7,8 @@ PY_FULL_REGISTER(ControlSimulation, Control);
 PY_FULL_REGISTER(ControlLsodarSimulation, Control);
 PY_FULL_REGISTER(ControlZOHSimulation, Control);
 PY_FULL_REGISTER(ControlManager, Control);
+PY_FULL_REGISTER(ControlSimulationRecorder, Control);
+PY_FULL_REGISTER(ControlMatrixRecorder, Control);
+PY_FULL_REGISTER(ControlRingBufferRecorder, Control);
+PY_FULL_REGISTER(ControlBinaryFileRecorder, Control);
 
@@ -30,6 +30,13 @@ if(WITH_${COMPONENT}_TESTING)
     target_compile_options(dr_rodas PRIVATE "-w")
     new_test(SOURCES dr_seulex.f)
     target_compile_options(dr_seulex PRIVATE "-w")
+
+    begin_tests(optim_misc/test)
+    if(WITH_OPENMP)
+      new_test(SOURCES n2qn1_threads_test.c DEPS OpenMP::OpenMP_C)
+    else()
+      new_test(SOURCES n2qn1_threads_test.c)
+    endif()
   endif()
 
 endif()
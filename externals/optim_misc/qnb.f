@@ -6,6 +6,9 @@
       dimension iz(*),rz(*)
       logical plantage, modifx, reverse
       double precision gpmopt
+c     saved state, one copy per thread (concurrent minimizations)
+c$omp threadprivate(gpmopt,i,indic,modifx,nd,nga,ni,nibloc,nindi,nw,nww,
+c$omp&nww1,plantage,s)
       if(reverse) indic=4
       if(reverse .and. mode.gt.7) go to 1111
       if (imp.gt.0) then
@@ -121,6 +124,12 @@
       double precision zero, pi
       logical reverse
       parameter (zero = 0.d0, one = 1.d0, pi = 3.1415927d+0)
+c     saved state, one copy per thread (concurrent minimizations)
+c$omp threadprivate(acc1,alfa,beta,bi,c,dd,delta,df,dga,di,dnr,fa,
+c$omp&gdxmin,gg,gi,gpm,gpm1,i,i1,iecri,ii,indic,indic1,indic2,ir,isign,
+c$omp&itr,k,k1,k2,logic,moda,modbnd,nc,nca,ncs,nfun,nh,np,nr,nr1,nrp1,
+c$omp&ol,oltodo,opt,prop,r,ro,roa,rocand,romax,romin,sc,shs,theta,wi,
+c$omp&wii,wiii,xi,ys,z)
  1001 format (" n2qn1: termine par voeu de l'utilisateur")
  1002 format (" >>> n2qn1: appel incoherent")
  1024 format (1x)
@@ -567,6 +576,9 @@ c        call simul (indic,n,x,f,ga,izs,rzs,dzs)
       double precision tesf,tesd,tg,fg,fpg,td,ta,fa,fpa,d2,f,fp,ffn,fd,
      &fpd,z,z1,test
       logical reverse
+c     saved state, one copy per thread (concurrent minimizations)
+c$omp threadprivate(d2,fa,fd,ffn,fg,fn,fp,fpa,fpd,fpg,i,indic,indica,
+c$omp&indicd,moda,ta,td,tesd,tesf,test,tg,z,z1)
  1000 format (5x,"nlis0   ",4x,"fpn=",1pd10.3," d2=",d9.2,
      &"  tmin=",d9.2," tmax=",d9.2)
  1001 format (/5x,"nlis0",3x,"fin sur tmin",8x,
@@ -0,0 +1,145 @@
+/* Concurrent n2qn1 minimizations.
+ *
+ * Several bound-constrained problems are solved with n2qn1 in reverse
+ * communication mode, first one after the other, then one per thread with
+ * the threads stepping in turn, so that each call of n2qn1 runs between
+ * the calls of the other minimizations. The results must be the same.
+ */
+#include <math.h>
+#include <stdio.h>
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#define N 4
+#define NB_PROBLEMS 4
+
+void n2qn1_(int* n, double* x, double* f, double* g, double* dxmin, double* df1,
+            double* epsabs, int* imp, int *io, int* mode, int* iter, int * nsim,
+            double* binf, double* bsup, int* iz, double* rz, int * reverse);
+
+/* A shifted Rosenbrock function, the minimum of problem k is out of the
+ * bounds for k odd. */
+static void fun(int k, double* x, double* f, double* g)
+{
+  double c = 0.5 + 0.25 * k;
+  *f = 0.;
+  for(int i = 0; i < N; i++)
+    g[i] = 0.;
+  for(int i = 0; i < N - 1; i++)
+  {
+    double a = x[i + 1] - x[i] * x[i];
+    double b = c - x[i];
+    *f += 10. * a * a + b * b;
+    g[i] += -40. * x[i] * a - 2. * b;
+    g[i + 1] += 20. * a;
+  }
+}
+
+typedef struct
+{
+  double x[N], f, g[N], dxmin[N], df1, epsabs, binf[N], bsup[N];
+  double rz[N * (N + 9) / 2 + 1];
+  int iz[2 * N + 1];
+  int n, imp, io, mode, iter, nsim, reverse;
+} minimization;
+
+static void start(int k, minimization* m)
+{
+  m->n = N;
+  for(int i = 0; i < N; i++)
+  {
+    m->binf[i] = -1.;
+    m->bsup[i] = (k % 2) ? 0.6 : 2.;
+    m->dxmin[i] = 1e-8;
+    m->x[i] = -0.5 + 0.1 * i;
+  }
+  fun(k, m->x, &m->f, m->g);
+  m->df1 = m->f;
+  m->epsabs = 1e-12;
+  m->imp = 0;
+  m->io = 6;
+  m->mode = 1;
+  m->iter = 500;
+  m->nsim = 3 * m->iter;
+  m->reverse = 1;
+  n2qn1_(&m->n, m->x, &m->f, m->g, m->dxmin, &m->df1, &m->epsabs, &m->imp, &m->io,
+         &m->mode, &m->iter, &m->nsim, m->binf, m->bsup, m->iz, m->rz, &m->reverse);
+}
+
+/* one reverse communication step, returns 0 once the minimization is over */
+static int step(int k, minimization* m)
+{
+  if(m->mode <= 7)
+    return 0;
+  fun(k, m->x, &m->f, m->g);
+  n2qn1_(&m->n, m->x, &m->f, m->g, m->dxmin, &m->df1, &m->epsabs, &m->imp, &m->io,
+         &m->mode, &m->iter, &m->nsim, m->binf, m->bsup, m->iz, m->rz, &m->reverse);
+  return 1;
+}
+
+int main(void)
+{
+#ifndef _OPENMP
+  printf("n2qn1_threads_test: built without OpenMP, nothing to test.\n");
+  return 0;
+#else
+  minimization ref[NB_PROBLEMS], m[NB_PROBLEMS];
+  int running[NB_PROBLEMS];
+  int info = 0;
+
+  for(int k = 0; k < NB_PROBLEMS; k++)
+  {
+    start(k, &ref[k]);
+    while(step(k, &ref[k]));
+    printf("problem %i: mode = %i, f = %g\n", k, ref[k].mode, ref[k].f);
+  }
+
+  #pragma omp parallel num_threads(NB_PROBLEMS)
+  {
+    int k = omp_get_thread_num();
+    if(omp_get_num_threads() == NB_PROBLEMS)
+    {
+      start(k, &m[k]);
+      running[k] = 1;
+      int any = 1;
+      while(any)
+      {
+        /* the threads call n2qn1 in turn */
+        for(int turn = 0; turn < NB_PROBLEMS; turn++)
+        {
+          if(turn == k && running[k])
+            running[k] = step(k, &m[k]);
+          #pragma omp barrier
+        }
+        any = 0;
+        for(int j = 0; j < NB_PROBLEMS; j++)
+          any |= running[j];
+        #pragma omp barrier
+      }
+    }
+    else
+    {
+      #pragma omp single
+      {
+        printf("n2qn1_threads_test: %i threads instead of %i.\n",
+               omp_get_num_threads(), NB_PROBLEMS);
+        info = 1;
+      }
+    }
+  }
+  if(info)
+    return info;
+
+  for(int k = 0; k < NB_PROBLEMS; k++)
+  {
+    printf("problem %i in thread %i: mode = %i, f = %g\n", k, k, m[k].mode, m[k].f);
+    if(m[k].mode != ref[k].mode || m[k].f != ref[k].f)
+      info = 1;
+    for(int i = 0; i < N; i++)
+      if(m[k].x[i] != ref[k].x[i])
+        info = 1;
+  }
+  return info;
+#endif
+}
@@ -44,6 +44,15 @@ SICONOS_IO_REGISTER_WITH_BASES(BlockMatrix,(SiconosMatrix),
   (_tabRow))
 SICONOS_IO_REGISTER(SiconosMatrix,
   (_num))
+SICONOS_IO_REGISTER(FiniteDifferenceJacobian,
+  (_autoDetectPattern)
+  (_epsilon)
+  (_groups)
+  (_lastEvaluationsNumber)
+  (_nCols)
+  (_nRows)
+  (_parallel)
+  (_pattern))
 SICONOS_IO_REGISTER(GraphProperties,
   (symmetric))
 SICONOS_IO_REGISTER(DynamicalSystemProperties,
@@ -73,10 +82,12 @@ SICONOS_IO_REGISTER(MatrixIntegrator,
   (_OSI)
   (_TD)
   (_isConst)
+  (_k)
   (_mat)
   (_nsds)
   (_plugin)
-  (_sim))
+  (_sim)
+  (_useExpm))
 SICONOS_IO_REGISTER_WITH_BASES(DynamicalSystemsGraph,(_DynamicalSystemsGraph),
   (Ad)
   (AdInt)
@@ -137,7 +148,10 @@ SICONOS_IO_REGISTER_WITH_BASES(MixedComplementarityConditionNSL,(NonSmoothLaw),
 SICONOS_IO_REGISTER(PluggedObject,
   (_pluginName))
 SICONOS_IO_REGISTER_WITH_BASES(NewtonEuler3DR,(NewtonEuler1DR),
-)
+  (_jacobianState)
+  (_jacobianUpdateTolerance)
+  (_lazyJacobianUpdate)
+  (_skippedJacobianUpdates))
 SICONOS_IO_REGISTER_WITH_BASES(FirstOrderLinearTIR,(FirstOrderR),
   (_e))
 SICONOS_IO_REGISTER(NonSmoothDynamicalSystem,
@@ -242,7 +256,10 @@ SICONOS_IO_REGISTER_WITH_BASES(LagrangianRheonomousR,(LagrangianR),
   (_hDot)
   (_pluginhDot))
 SICONOS_IO_REGISTER_WITH_BASES(FirstOrderNonLinearR,(FirstOrderR),
-)
+  (_jacglambdaFD)
+  (_jacgxFD)
+  (_jachlambdaFD)
+  (_jachxFD))
 SICONOS_IO_REGISTER(Interaction,
   (__count)
   (_has2Bodies)
@@ -281,6 +298,7 @@ SICONOS_IO_REGISTER_WITH_BASES(FirstOrderNonLinearDS,(DynamicalSystem),
   (_fold)
   (_invM)
   (_jacobianfx)
+  (_jacobianfxFD)
   (_pluginJacxf)
   (_pluginM)
   (_pluginf)
@@ -298,6 +316,7 @@ SICONOS_IO_REGISTER(DynamicalSystem,
   (_z))
 SICONOS_IO_REGISTER_WITH_BASES(LagrangianScleronomousR,(LagrangianR),
   (_dotjacqhXqdot)
+  (_jachqFD)
   (_plugindotjacqh))
 SICONOS_IO_REGISTER_WITH_BASES(LagrangianLinearTIDS,(LagrangianDS),
   (_C)
@@ -421,6 +440,7 @@ SICONOS_IO_REGISTER_WITH_BASES(EventDriven,(Simulation),
   (_isNewtonConverge)
   (_istate)
   (_localizeEventMaxIter)
+  (_localizeEventsOnCandidates)
   (_newtonMaxIteration)
   (_newtonNbIterations)
   (_newtonResiduDSMax)
@@ -519,6 +539,7 @@ SICONOS_IO_REGISTER_WITH_BASES(TimeSteppingDirectProjection,(TimeStepping),
 SICONOS_IO_REGISTER_WITH_BASES(LinearOSNS,(OneStepNSProblem),
   (_M)
   (_keepLambdaAndYState)
+  (_numericsMatrixOrdering)
   (_q)
   (_w)
   (_z))
@@ -616,6 +637,7 @@ SICONOS_IO_REGISTER(OSNSMatrix,
   (_M2)
   (_dimColumn)
   (_dimRow)
+  (_ordering)
   (_storageType))
 SICONOS_IO_REGISTER_WITH_BASES(OSNSMatrixProjectOnConstraints,(OSNSMatrix),
 )
@@ -1001,6 +1023,7 @@ SICONOS_IO_REGISTER(ControlSimulation,
   (_T)
   (_dataLegend)
   (_dataM)
+  (_dataRow)
   (_elapsedTime)
   (_h)
   (_nDim)
@@ -1008,10 +1031,29 @@ SICONOS_IO_REGISTER(ControlSimulation,
   (_processIntegrator)
   (_processSimulation)
   (_processTD)
+  (_recorder)
   (_saveOnlyMainSimulation)
   (_silent)
   (_t0)
   (_theta))
+SICONOS_IO_REGISTER_WITH_BASES(ControlMatrixRecorder,(ControlSimulationRecorder),
+  (_dataM))
+SICONOS_IO_REGISTER_WITH_BASES(ControlRingBufferRecorder,(ControlSimulationRecorder),
+  (_buffer)
+  (_capacity))
+SICONOS_IO_REGISTER_WITH_BASES(ControlBinaryFileRecorder,(ControlSimulationRecorder),
+  (_chunk)
+  (_chunkRows)
+  (_filename))
+SICONOS_IO_REGISTER(ControlSimulationRecorder,
+  (_decimation)
+  (_legend)
+  (_nCols)
+  (_nFullCols)
+  (_nOffered)
+  (_nRecorded)
+  (_selection)
+  (_values))
 SICONOS_IO_REGISTER_WITH_BASES(ActuatorEvent,(Event),
   (_actuator))
 SICONOS_IO_REGISTER_WITH_BASES(SensorEvent,(Event),
@@ -1068,6 +1110,9 @@ void siconos_io_register_generated_Control(Archive& ar)
   ar.register_type(static_cast<PID*>(nullptr));
   ar.register_type(static_cast<LinearSMCOT2*>(nullptr));
   ar.register_type(static_cast<LinearSMCimproved*>(nullptr));
+  ar.register_type(static_cast<ControlMatrixRecorder*>(nullptr));
+  ar.register_type(static_cast<ControlRingBufferRecorder*>(nullptr));
+  ar.register_type(static_cast<ControlBinaryFileRecorder*>(nullptr));
   ar.register_type(static_cast<ActuatorEvent*>(nullptr));
   ar.register_type(static_cast<SensorEvent*>(nullptr));
   ar.register_type(static_cast<LinearSensor*>(nullptr));
@@ -1081,6 +1126,7 @@ void siconos_io_register_generated_Kernel(Archive& ar)
   ar.register_type(static_cast<SiconosMemory*>(nullptr));
   ar.register_type(static_cast<BlockVector*>(nullptr));
   ar.register_type(static_cast<BlockMatrix*>(nullptr));
+  ar.register_type(static_cast<FiniteDifferenceJacobian*>(nullptr));
   ar.register_type(static_cast<GraphProperties*>(nullptr));
   ar.register_type(static_cast<DynamicalSystemProperties*>(nullptr));
   ar.register_type(static_cast<InteractionProperties*>(nullptr));
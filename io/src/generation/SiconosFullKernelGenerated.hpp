@@ -21,6 +21,15 @@ SICONOS_IO_REGISTER_WITH_BASES(BlockMatrix,(SiconosMatrix),
   (_tabRow))
 SICONOS_IO_REGISTER(SiconosMatrix,
   (_num))
+SICONOS_IO_REGISTER(FiniteDifferenceJacobian,
+  (_autoDetectPattern)
+  (_epsilon)
+  (_groups)
+  (_lastEvaluationsNumber)
+  (_nCols)
+  (_nRows)
+  (_parallel)
+  (_pattern))
 SICONOS_IO_REGISTER(GraphProperties,
   (symmetric))
 SICONOS_IO_REGISTER(DynamicalSystemProperties,
@@ -50,10 +59,12 @@ SICONOS_IO_REGISTER(MatrixIntegrator,
   (_OSI)
   (_TD)
   (_isConst)
+  (_k)
   (_mat)
   (_nsds)
   (_plugin)
-  (_sim))
+  (_sim)
+  (_useExpm))
 SICONOS_IO_REGISTER_WITH_BASES(DynamicalSystemsGraph,(_DynamicalSystemsGraph),
   (Ad)
   (AdInt)
@@ -114,7 +125,10 @@ SICONOS_IO_REGISTER_WITH_BASES(MixedComplementarityConditionNSL,(NonSmoothLaw),
 SICONOS_IO_REGISTER(PluggedObject,
   (_pluginName))
 SICONOS_IO_REGISTER_WITH_BASES(NewtonEuler3DR,(NewtonEuler1DR),
-)
+  (_jacobianState)
+  (_jacobianUpdateTolerance)
+  (_lazyJacobianUpdate)
+  (_skippedJacobianUpdates))
 SICONOS_IO_REGISTER_WITH_BASES(FirstOrderLinearTIR,(FirstOrderR),
   (_e))
 SICONOS_IO_REGISTER(NonSmoothDynamicalSystem,
@@ -219,7 +233,10 @@ SICONOS_IO_REGISTER_WITH_BASES(LagrangianRheonomousR,(LagrangianR),
   (_hDot)
   (_pluginhDot))
 SICONOS_IO_REGISTER_WITH_BASES(FirstOrderNonLinearR,(FirstOrderR),
-)
+  (_jacglambdaFD)
+  (_jacgxFD)
+  (_jachlambdaFD)
+  (_jachxFD))
 SICONOS_IO_REGISTER(Interaction,
   (__count)
   (_has2Bodies)
@@ -258,6 +275,7 @@ SICONOS_IO_REGISTER_WITH_BASES(FirstOrderNonLinearDS,(DynamicalSystem),
   (_fold)
   (_invM)
   (_jacobianfx)
+  (_jacobianfxFD)
   (_pluginJacxf)
   (_pluginM)
   (_pluginf)
@@ -275,6 +293,7 @@ SICONOS_IO_REGISTER(DynamicalSystem,
   (_z))
 SICONOS_IO_REGISTER_WITH_BASES(LagrangianScleronomousR,(LagrangianR),
   (_dotjacqhXqdot)
+  (_jachqFD)
   (_plugindotjacqh))
 SICONOS_IO_REGISTER_WITH_BASES(LagrangianLinearTIDS,(LagrangianDS),
   (_C)
@@ -398,6 +417,7 @@ SICONOS_IO_REGISTER_WITH_BASES(EventDriven,(Simulation),
   (_isNewtonConverge)
   (_istate)
   (_localizeEventMaxIter)
+  (_localizeEventsOnCandidates)
   (_newtonMaxIteration)
   (_newtonNbIterations)
   (_newtonResiduDSMax)
@@ -496,6 +516,7 @@ SICONOS_IO_REGISTER_WITH_BASES(TimeSteppingDirectProjection,(TimeStepping),
 SICONOS_IO_REGISTER_WITH_BASES(LinearOSNS,(OneStepNSProblem),
   (_M)
   (_keepLambdaAndYState)
+  (_numericsMatrixOrdering)
   (_q)
   (_w)
   (_z))
@@ -593,6 +614,7 @@ SICONOS_IO_REGISTER(OSNSMatrix,
   (_M2)
   (_dimColumn)
   (_dimRow)
+  (_ordering)
   (_storageType))
 SICONOS_IO_REGISTER_WITH_BASES(OSNSMatrixProjectOnConstraints,(OSNSMatrix),
 )
@@ -630,6 +652,7 @@ void siconos_io_register_generated_Kernel(Archive& ar)
   ar.register_type(static_cast<SiconosMemory*>(nullptr));
   ar.register_type(static_cast<BlockVector*>(nullptr));
   ar.register_type(static_cast<BlockMatrix*>(nullptr));
+  ar.register_type(static_cast<FiniteDifferenceJacobian*>(nullptr));
   ar.register_type(static_cast<GraphProperties*>(nullptr));
   ar.register_type(static_cast<DynamicalSystemProperties*>(nullptr));
   ar.register_type(static_cast<InteractionProperties*>(nullptr));
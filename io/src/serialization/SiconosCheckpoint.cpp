@@ -0,0 +1,599 @@
+/* Siconos is a program dedicated to modeling, simulation and control
+ * of non smooth dynamical systems.
+ *
+ * Copyright 2020 INRIA.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+*/
+
+#include "SiconosCheckpoint.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+
+#include "Simulation.hpp"
+#include "NonSmoothDynamicalSystem.hpp"
+#include "EventsManager.hpp"
+#include "Event.hpp"
+#include "LagrangianDS.hpp"
+#include "NewtonEulerDS.hpp"
+#include "FirstOrderNonLinearDS.hpp"
+#include "Interaction.hpp"
+#include "LinearOSNS.hpp"
+#include "GlobalFrictionContact.hpp"
+#include "SimulationGraphs.hpp"
+#include "SiconosMemory.hpp"
+#include "SiconosVector.hpp"
+#include "RuntimeException.hpp"
+
+// #define DEBUG_NOCOLOR
+// #define DEBUG_STDOUT
+// #define DEBUG_MESSAGES
+#include "debug.h"
+
+static const char checkpointMagic[8] = {'S', 'I', 'C', 'O', 'C', 'H', 'K', '1'};
+
+typedef SiconosCheckpoint::Block Block;
+
+static void pushVector(std::vector<Block>& blocks, unsigned int kind,
+                       unsigned long id, unsigned int slot,
+                       SP::SiconosVector v)
+{
+  if(!v)
+    return;
+  Block b = {kind, slot, id, 0, std::vector<double>(v->size())};
+  for(unsigned int i = 0; i < v->size(); ++i)
+    b.data[i] = v->getValue(i);
+  blocks.push_back(std::move(b));
+}
+
+/* the vectors of a memory, newest first */
+static void pushMemory(std::vector<Block>& blocks, unsigned int kind,
+                       unsigned long id, unsigned int slot,
+                       const SiconosMemory& m)
+{
+  if(m.size() == 0)
+    return;
+  unsigned int n = m.nbVectorsInMemory();
+  Block b = {kind, slot, id, n, std::vector<double>()};
+  for(unsigned int k = 0; k < n; ++k)
+  {
+    const SiconosVector& v = m.getSiconosVector(k);
+    for(unsigned int i = 0; i < v.size(); ++i)
+      b.data.push_back(v.getValue(i));
+  }
+  blocks.push_back(std::move(b));
+}
+
+static void pushWorkVectors(std::vector<Block>& blocks, unsigned int kind,
+                            unsigned long id, SP::VectorOfVectors work)
+{
+  if(!work)
+    return;
+  for(unsigned int k = 0; k < work->size(); ++k)
+    pushVector(blocks, kind, id, k, (*work)[k]);
+}
+
+static void setVector(const Block& b, SP::SiconosVector v)
+{
+  if(!v || v->size() != b.data.size())
+    RuntimeException::selfThrow("SiconosCheckpoint::restore - vector not found or of wrong size");
+  for(unsigned int i = 0; i < v->size(); ++i)
+    v->setValue(i, b.data[i]);
+}
+
+static void setMemory(const Block& b, SiconosMemory& m)
+{
+  unsigned int n = b.aux;
+  unsigned int vecSize = (m.size() > 0) ? m[0].size() : 0;
+  if(n > m.size() || b.data.size() != n * vecSize)
+    RuntimeException::selfThrow("SiconosCheckpoint::restore - memory not found or of wrong size");
+
+  SiconosMemory tmp(m.size(), vecSize);
+  SiconosVector v(vecSize);
+  for(unsigned int k = n; k-- > 0;)
+  {
+    for(unsigned int i = 0; i < vecSize; ++i)
+      v.setValue(i, b.data[k * vecSize + i]);
+    tmp.swap(v);
+  }
+  m = tmp;
+}
+
+/* the size of the vectors of a OSNS changes with the active set */
+static void resizeAndSetVector(const Block& b, SP::SiconosVector v)
+{
+  if(!v)
+    RuntimeException::selfThrow("SiconosCheckpoint::restore - vector of a one step nonsmooth problem not found");
+  if(v->size() != b.data.size())
+    v->resize(b.data.size());
+  setVector(b, v);
+}
+
+static void setWorkVector(const Block& b, SP::VectorOfVectors work)
+{
+  if(!work || b.slot >= work->size())
+    RuntimeException::selfThrow("SiconosCheckpoint::restore - work vector not found");
+  setVector(b, (*work)[b.slot]);
+}
+
+/* the vertices of a graph, sorted by the number() of their bundles */
+template <class G>
+static std::vector<typename G::VDescriptor> sortedVertices(G& g)
+{
+  std::vector<std::pair<size_t, typename G::VDescriptor> > numbered;
+  typename G::VIterator vi, viend;
+  for(std::tie(vi, viend) = g.vertices(); vi != viend; ++vi)
+    numbered.push_back(std::make_pair(g.bundle(*vi)->number(), *vi));
+  std::sort(numbered.begin(), numbered.end(),
+            [](const std::pair<size_t, typename G::VDescriptor>& a,
+               const std::pair<size_t, typename G::VDescriptor>& b)
+  {
+    return a.first < b.first;
+  });
+  std::vector<typename G::VDescriptor> vertices;
+  for(unsigned int i = 0; i < numbered.size(); ++i)
+    vertices.push_back(numbered[i].second);
+  return vertices;
+}
+
+SiconosCheckpoint::SiconosCheckpoint(SP::Simulation sim): _sim(sim)
+{
+  if(!_sim)
+    RuntimeException::selfThrow("SiconosCheckpoint - null simulation");
+}
+
+SiconosCheckpoint::~SiconosCheckpoint()
+{
+  if(_writer.joinable())
+    _writer.join();
+}
+
+std::vector<Block> SiconosCheckpoint::snapshot() const
+{
+  DEBUG_BEGIN("SiconosCheckpoint::snapshot()\n");
+  std::vector<Block> blocks;
+  SP::NonSmoothDynamicalSystem nsds = _sim->nonSmoothDynamicalSystem();
+
+  // --- dynamical systems ---
+  SP::DynamicalSystemsGraph dsg = nsds->dynamicalSystems();
+  std::vector<DynamicalSystemsGraph::VDescriptor> dsVertices = sortedVertices(*dsg);
+  for(unsigned long id = 0; id < dsVertices.size(); ++id)
+  {
+    SP::DynamicalSystem ds = dsg->bundle(dsVertices[id]);
+    pushVector(blocks, DS_X, id, 0, ds->x());
+    pushVector(blocks, DS_R, id, 0, ds->r());
+    pushMemory(blocks, DS_X_MEMORY, id, 0, ds->xMemory());
+
+    SP::FirstOrderNonLinearDS fods = std::dynamic_pointer_cast<FirstOrderNonLinearDS>(ds);
+    if(fods)
+      pushMemory(blocks, DS_R_MEMORY, id, 0, fods->rMemory());
+
+    SP::SecondOrderDS sods = std::dynamic_pointer_cast<SecondOrderDS>(ds);
+    if(sods)
+    {
+      pushVector(blocks, DS_Q, id, 0, sods->q());
+      pushVector(blocks, DS_VELOCITY, id, 0, sods->velocity());
+      for(unsigned int level = 0; level < 3; ++level)
+        pushVector(blocks, DS_P, id, level, sods->p(level));
+      pushMemory(blocks, DS_Q_MEMORY, id, 0, sods->qMemory());
+      pushMemory(blocks, DS_VELOCITY_MEMORY, id, 0, sods->velocityMemory());
+      pushMemory(blocks, DS_FORCES_MEMORY, id, 0, sods->forcesMemory());
+    }
+
+    SP::LagrangianDS lds = std::dynamic_pointer_cast<LagrangianDS>(ds);
+    // the memories of p are allocated with the other ones
+    if(lds && lds->qMemory().size() > 0)
+      for(unsigned int level = 0; level < 3; ++level)
+        pushMemory(blocks, DS_P_MEMORY, id, level, lds->pMemory(level));
+
+    SP::NewtonEulerDS neds = std::dynamic_pointer_cast<NewtonEulerDS>(ds);
+    if(neds)
+      pushMemory(blocks, DS_DOTQ_MEMORY, id, 0, neds->dotqMemory());
+
+    pushWorkVectors(blocks, DS_WORK, id, dsg->properties(dsVertices[id]).workVectors);
+  }
+
+  // --- interactions ---
+  SP::InteractionsGraph ig = nsds->interactions();
+  std::vector<InteractionsGraph::VDescriptor> interVertices = sortedVertices(*ig);
+  for(unsigned long id = 0; id < interVertices.size(); ++id)
+  {
+    Interaction& inter = *ig->bundle(interVertices[id]);
+    for(unsigned int level = 0; level < inter.y().size(); ++level)
+      pushVector(blocks, INTER_Y, id, level, inter.y(level));
+    for(unsigned int level = 0; level < inter.getYOld().size(); ++level)
+      pushVector(blocks, INTER_Y_OLD, id, level, inter.yOld(level));
+    for(unsigned int level = 0; level < inter.getLambda().size(); ++level)
+      pushVector(blocks, INTER_LAMBDA, id, level, inter.lambda(level));
+    for(unsigned int level = 0; level < inter.getLambdaOld().size(); ++level)
+      pushVector(blocks, INTER_LAMBDA_OLD, id, level, inter.lambdaOld(level));
+    for(unsigned int level = inter.lowerLevelForOutput();
+        level <= inter.upperLevelForOutput(); ++level)
+      pushMemory(blocks, INTER_Y_MEMORY, id, level, inter.yMemory(level));
+    for(unsigned int level = inter.lowerLevelForInput();
+        level <= inter.upperLevelForInput(); ++level)
+      pushMemory(blocks, INTER_LAMBDA_MEMORY, id, level, inter.lambdaMemory(level));
+
+    pushWorkVectors(blocks, INTER_WORK, id, ig->properties(interVertices[id]).workVectors);
+  }
+
+  // --- warm start of the one step nonsmooth problems ---
+  SP::OneStepNSProblems osnsps = _sim->oneStepNSProblems();
+  for(unsigned long id = 0; osnsps && id < osnsps->size(); ++id)
+  {
+    SP::LinearOSNS osnsp = std::dynamic_pointer_cast<LinearOSNS>((*osnsps)[id]);
+    if(!osnsp)
+      continue;
+    pushVector(blocks, OSNS_Z, id, 0, osnsp->z());
+    pushVector(blocks, OSNS_W, id, 0, osnsp->w());
+    std::shared_ptr<GlobalFrictionContact> gfc = std::dynamic_pointer_cast<GlobalFrictionContact>(osnsp);
+    if(gfc)
+      pushVector(blocks, OSNS_GLOBAL_VELOCITIES, id, 0, gfc->globalVelocities());
+  }
+
+  // --- time and events ---
+  Block time = {TIME, 0, 0, 0, std::vector<double>(1, nsds->currentTime())};
+  blocks.push_back(std::move(time));
+
+  EventsManager& em = *_sim->eventsManager();
+  EventsContainer& events = em.events();
+  Block ev = {EVENTS, 0, 0, events.size(), std::vector<double>()};
+  ev.data.push_back(em.getK());
+  for(EventsContainer::iterator it = events.begin(); it != events.end(); ++it)
+  {
+    ev.data.push_back((*it)->getType());
+    ev.data.push_back((*it)->getK());
+    ev.data.push_back((*it)->getDoubleTimeOfEvent());
+  }
+  blocks.push_back(std::move(ev));
+
+  DEBUG_PRINTF("%zu blocks\n", blocks.size());
+  DEBUG_END("SiconosCheckpoint::snapshot()\n");
+  return blocks;
+}
+
+void SiconosCheckpoint::writeFile(const std::string& filename,
+                                  const std::string& base,
+                                  const std::vector<Block>& blocks)
+{
+  std::string tempf = filename + ".tmp";
+  {
+    std::ofstream ofs(tempf.c_str(), std::ios::binary);
+    if(!ofs)
+      RuntimeException::selfThrow("SiconosCheckpoint - cannot open " + tempf);
+
+    uint64_t baseLength = base.size();
+    uint64_t nBlocks = blocks.size();
+    ofs.write(checkpointMagic, sizeof(checkpointMagic));
+    ofs.write(reinterpret_cast<const char*>(&baseLength), sizeof(baseLength));
+    ofs.write(base.data(), baseLength);
+    ofs.write(reinterpret_cast<const char*>(&nBlocks), sizeof(nBlocks));
+    for(const Block& b : blocks)
+    {
+      uint32_t kind = b.kind, slot = b.slot;
+      uint64_t id = b.id, aux = b.aux, n = b.data.size();
+      ofs.write(reinterpret_cast<const char*>(&kind), sizeof(kind));
+      ofs.write(reinterpret_cast<const char*>(&slot), sizeof(slot));
+      ofs.write(reinterpret_cast<const char*>(&id), sizeof(id));
+      ofs.write(reinterpret_cast<const char*>(&aux), sizeof(aux));
+      ofs.write(reinterpret_cast<const char*>(&n), sizeof(n));
+      ofs.write(reinterpret_cast<const char*>(b.data.data()), n * sizeof(double));
+    }
+    if(!ofs)
+      RuntimeException::selfThrow("SiconosCheckpoint - error while writing " + tempf);
+  }
+  // atomic
+  if(std::rename(tempf.c_str(), filename.c_str()) != 0)
+    RuntimeException::selfThrow("SiconosCheckpoint - cannot rename " + tempf);
+}
+
+void SiconosCheckpoint::readFile(const std::string& filename,
+                                 std::string& base,
+                                 std::vector<Block>& blocks)
+{
+  std::ifstream ifs(filename.c_str(), std::ios::binary);
+  if(!ifs)
+    RuntimeException::selfThrow("SiconosCheckpoint - cannot open " + filename);
+
+  char magic[sizeof(checkpointMagic)];
+  ifs.read(magic, sizeof(magic));
+  if(!ifs || std::memcmp(magic, checkpointMagic, sizeof(magic)) != 0)
+    RuntimeException::selfThrow("SiconosCheckpoint - " + filename + " is not a checkpoint file");
+
+  uint64_t baseLength, nBlocks;
+  ifs.read(reinterpret_cast<char*>(&baseLength), sizeof(baseLength));
+  base.resize(baseLength);
+  ifs.read(&base[0], baseLength);
+  ifs.read(reinterpret_cast<char*>(&nBlocks), sizeof(nBlocks));
+
+  blocks.clear();
+  for(uint64_t k = 0; k < nBlocks && ifs; ++k)
+  {
+    uint32_t kind, slot;
+    uint64_t id, aux, n;
+    ifs.read(reinterpret_cast<char*>(&kind), sizeof(kind));
+    ifs.read(reinterpret_cast<char*>(&slot), sizeof(slot));
+    ifs.read(reinterpret_cast<char*>(&id), sizeof(id));
+    ifs.read(reinterpret_cast<char*>(&aux), sizeof(aux));
+    ifs.read(reinterpret_cast<char*>(&n), sizeof(n));
+    if(!ifs)
+      break;
+    Block b = {kind, slot, id, aux, std::vector<double>(n)};
+    ifs.read(reinterpret_cast<char*>(b.data.data()), n * sizeof(double));
+    blocks.push_back(std::move(b));
+  }
+  if(!ifs)
+    RuntimeException::selfThrow("SiconosCheckpoint - " + filename + " is truncated");
+}
+
+void SiconosCheckpoint::backgroundWrite(SiconosCheckpoint* self,
+                                        std::string filename, std::string base,
+                                        std::vector<Block> blocks)
+{
+  try
+  {
+    writeFile(filename, base, blocks);
+  }
+  catch(std::exception& e)
+  {
+    self->_writerError = e.what();
+  }
+  catch(...)
+  {
+    self->_writerError = "SiconosCheckpoint - error while writing " + filename;
+  }
+}
+
+void SiconosCheckpoint::write(const std::string& filename, const std::string& base,
+                              std::vector<Block>&& blocks, bool background)
+{
+  wait();
+  if(background)
+    _writer = std::thread(backgroundWrite, this, filename, base, std::move(blocks));
+  else
+    writeFile(filename, base, blocks);
+}
+
+void SiconosCheckpoint::wait()
+{
+  if(_writer.joinable())
+    _writer.join();
+  if(!_writerError.empty())
+  {
+    std::string error;
+    std::swap(error, _writerError);
+    RuntimeException::selfThrow(error);
+  }
+}
+
+void SiconosCheckpoint::saveFull(const std::string& filename, bool background)
+{
+  std::vector<Block> blocks = snapshot();
+  _base.clear();
+  for(const Block& b : blocks)
+    _base[BlockKey(b.kind, b.id, b.slot)] = b.data;
+  _baseFilename = filename;
+  write(filename, std::string(), std::move(blocks), background);
+}
+
+/* a block is unchanged if the full checkpoint holds the same values
+ * (the number of vectors of a memory is compared through the size) */
+static bool unchanged(const std::map<SiconosCheckpoint::BlockKey, std::vector<double> >& base,
+                      const Block& b)
+{
+  std::map<SiconosCheckpoint::BlockKey, std::vector<double> >::const_iterator it =
+    base.find(SiconosCheckpoint::BlockKey(b.kind, b.id, b.slot));
+  return it != base.end() && it->second.size() == b.data.size()
+         && std::memcmp(it->second.data(), b.data.data(), b.data.size() * sizeof(double)) == 0;
+}
+
+void SiconosCheckpoint::saveDifferential(const std::string& filename, bool background)
+{
+  if(_baseFilename.empty())
+    RuntimeException::selfThrow("SiconosCheckpoint::saveDifferential - a full checkpoint must be saved first");
+
+  std::vector<Block> blocks = snapshot();
+  std::vector<Block> changed;
+  for(Block& b : blocks)
+    if(!unchanged(_base, b))
+      changed.push_back(std::move(b));
+  DEBUG_PRINTF("SiconosCheckpoint::saveDifferential: %zu blocks out of %zu\n",
+               changed.size(), blocks.size());
+  write(filename, _baseFilename, std::move(changed), background);
+}
+
+unsigned int SiconosCheckpoint::numberOfChangedBlocks() const
+{
+  std::vector<Block> blocks = snapshot();
+  unsigned int n = 0;
+  for(const Block& b : blocks)
+    if(!unchanged(_base, b))
+      ++n;
+  return n;
+}
+
+void SiconosCheckpoint::apply(const std::vector<Block>& blocks)
+{
+  SP::NonSmoothDynamicalSystem nsds = _sim->nonSmoothDynamicalSystem();
+
+  SP::DynamicalSystemsGraph dsg = nsds->dynamicalSystems();
+  std::vector<DynamicalSystemsGraph::VDescriptor> dsVertices = sortedVertices(*dsg);
+  SP::InteractionsGraph ig = nsds->interactions();
+  std::vector<InteractionsGraph::VDescriptor> interVertices = sortedVertices(*ig);
+
+  for(const Block& b : blocks)
+  {
+    if(b.kind <= DS_WORK)
+    {
+      if(b.id >= dsVertices.size())
+        RuntimeException::selfThrow("SiconosCheckpoint::restore - unknown dynamical system");
+      DynamicalSystemsGraph::VDescriptor dsv = dsVertices[b.id];
+      SP::DynamicalSystem ds = dsg->bundle(dsv);
+      SP::SecondOrderDS sods = std::dynamic_pointer_cast<SecondOrderDS>(ds);
+      SP::LagrangianDS lds = std::dynamic_pointer_cast<LagrangianDS>(ds);
+      SP::NewtonEulerDS neds = std::dynamic_pointer_cast<NewtonEulerDS>(ds);
+      SP::FirstOrderNonLinearDS fods = std::dynamic_pointer_cast<FirstOrderNonLinearDS>(ds);
+      if((b.kind == DS_Q || b.kind == DS_VELOCITY || b.kind == DS_P
+          || b.kind == DS_Q_MEMORY || b.kind == DS_VELOCITY_MEMORY
+          || b.kind == DS_FORCES_MEMORY) && !sods)
+        RuntimeException::selfThrow("SiconosCheckpoint::restore - second order system expected");
+      if((b.kind == DS_P_MEMORY && !lds) || (b.kind == DS_DOTQ_MEMORY && !neds)
+          || (b.kind == DS_R_MEMORY && !fods) || (b.kind == DS_P && b.slot > 2))
+        RuntimeException::selfThrow("SiconosCheckpoint::restore - wrong type of dynamical system");
+
+      switch(b.kind)
+      {
+      case DS_X: setVector(b, ds->x()); break;
+      case DS_R: setVector(b, ds->r()); break;
+      case DS_Q: setVector(b, sods->q()); break;
+      case DS_VELOCITY: setVector(b, sods->velocity()); break;
+      case DS_P: setVector(b, sods->p(b.slot)); break;
+      case DS_X_MEMORY: setMemory(b, ds->xMemory()); break;
+      case DS_R_MEMORY: setMemory(b, fods->rMemory()); break;
+      case DS_Q_MEMORY: setMemory(b, sods->qMemory()); break;
+      case DS_VELOCITY_MEMORY: setMemory(b, sods->velocityMemory()); break;
+      case DS_FORCES_MEMORY: setMemory(b, sods->forcesMemory()); break;
+      case DS_DOTQ_MEMORY: setMemory(b, neds->dotqMemory()); break;
+      case DS_P_MEMORY:
+        if(lds->qMemory().size() == 0 || b.slot > 2)
+          RuntimeException::selfThrow("SiconosCheckpoint::restore - memory of p not allocated");
+        setMemory(b, lds->pMemory(b.slot));
+        break;
+      case DS_WORK: setWorkVector(b, dsg->properties(dsv).workVectors); break;
+      }
+    }
+    else if(b.kind <= INTER_WORK)
+    {
+      if(b.id >= interVertices.size())
+        RuntimeException::selfThrow("SiconosCheckpoint::restore - unknown interaction");
+      InteractionsGraph::VDescriptor iv = interVertices[b.id];
+      Interaction& inter = *ig->bundle(iv);
+      switch(b.kind)
+      {
+      case INTER_Y:
+        if(b.slot >= inter.y().size())
+          RuntimeException::selfThrow("SiconosCheckpoint::restore - wrong level of y");
+        setVector(b, inter.y(b.slot));
+        break;
+      case INTER_Y_OLD:
+        if(b.slot >= inter.getYOld().size())
+          RuntimeException::selfThrow("SiconosCheckpoint::restore - wrong level of yOld");
+        setVector(b, inter.yOld(b.slot));
+        break;
+      case INTER_LAMBDA:
+        if(b.slot >= inter.getLambda().size())
+          RuntimeException::selfThrow("SiconosCheckpoint::restore - wrong level of lambda");
+        setVector(b, inter.lambda(b.slot));
+        break;
+      case INTER_LAMBDA_OLD:
+        if(b.slot >= inter.getLambdaOld().size())
+          RuntimeException::selfThrow("SiconosCheckpoint::restore - wrong level of lambdaOld");
+        setVector(b, inter.lambdaOld(b.slot));
+        break;
+      case INTER_Y_MEMORY:
+        if(b.slot > inter.upperLevelForOutput())
+          RuntimeException::selfThrow("SiconosCheckpoint::restore - wrong level of yMemory");
+        setMemory(b, inter.yMemory(b.slot));
+        break;
+      case INTER_LAMBDA_MEMORY:
+        if(b.slot > inter.upperLevelForInput())
+          RuntimeException::selfThrow("SiconosCheckpoint::restore - wrong level of lambdaMemory");
+        setMemory(b, inter.lambdaMemory(b.slot));
+        break;
+      case INTER_WORK: setWorkVector(b, ig->properties(iv).workVectors); break;
+      }
+    }
+    else if(b.kind == TIME)
+    {
+      nsds->setCurrentTime(b.data[0]);
+    }
+    else if(b.kind == EVENTS)
+    {
+      // the events are matched by type, in the order of the queue; the
+      // placeholder event of a simulation that has not run yet is dropped
+      EventsManager& em = *_sim->eventsManager();
+      EventsContainer& events = em.events();
+      if(events.size() == b.aux + 1 && events[0]->getType() == -1
+          && (b.aux == 0 || b.data[1] != -1))
+        events.erase(events.begin());
+      if(events.size() != b.aux || b.data.size() != 1 + 3 * b.aux)
+        RuntimeException::selfThrow("SiconosCheckpoint::restore - the event queues do not match");
+      for(unsigned int k = 0; k < events.size(); ++k)
+        if(events[k]->getType() != (int)b.data[1 + 3 * k])
+          RuntimeException::selfThrow("SiconosCheckpoint::restore - the event queues do not match");
+      em.setK(b.data[0]);
+      for(unsigned int k = 0; k < events.size(); ++k)
+      {
+        events[k]->setK(b.data[2 + 3 * k]);
+        events[k]->setTime(b.data[3 + 3 * k]);
+      }
+    }
+    else if(b.kind == OSNS_Z || b.kind == OSNS_W || b.kind == OSNS_GLOBAL_VELOCITIES)
+    {
+      SP::OneStepNSProblems osnsps = _sim->oneStepNSProblems();
+      SP::LinearOSNS osnsp;
+      if(osnsps && b.id < osnsps->size())
+        osnsp = std::dynamic_pointer_cast<LinearOSNS>((*osnsps)[b.id]);
+      if(!osnsp)
+        RuntimeException::selfThrow("SiconosCheckpoint::restore - unknown one step nonsmooth problem");
+      if(b.kind == OSNS_Z)
+        resizeAndSetVector(b, osnsp->z());
+      else if(b.kind == OSNS_W)
+        resizeAndSetVector(b, osnsp->w());
+      else
+      {
+        std::shared_ptr<GlobalFrictionContact> gfc = std::dynamic_pointer_cast<GlobalFrictionContact>(osnsp);
+        if(!gfc)
+          RuntimeException::selfThrow("SiconosCheckpoint::restore - GlobalFrictionContact expected");
+        resizeAndSetVector(b, gfc->globalVelocities());
+      }
+    }
+    else
+      RuntimeException::selfThrow("SiconosCheckpoint::restore - unknown block");
+  }
+}
+
+void SiconosCheckpoint::restore(const std::string& filename)
+{
+  wait();
+  std::string base;
+  std::vector<Block> blocks;
+  readFile(filename, base, blocks);
+
+  if(base.empty())
+  {
+    apply(blocks);
+    _baseFilename = filename;
+    _base.clear();
+    for(const Block& b : blocks)
+      _base[BlockKey(b.kind, b.id, b.slot)] = b.data;
+  }
+  else
+  {
+    std::string baseBase;
+    std::vector<Block> baseBlocks;
+    readFile(base, baseBase, baseBlocks);
+    if(!baseBase.empty())
+      RuntimeException::selfThrow("SiconosCheckpoint::restore - " + base + " is not a full checkpoint");
+    apply(baseBlocks);
+    apply(blocks);
+    _baseFilename = base;
+    _base.clear();
+    for(const Block& b : baseBlocks)
+      _base[BlockKey(b.kind, b.id, b.slot)] = b.data;
+  }
+}
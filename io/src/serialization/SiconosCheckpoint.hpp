@@ -0,0 +1,175 @@
+/* Siconos is a program dedicated to modeling, simulation and control
+ * of non smooth dynamical systems.
+ *
+ * Copyright 2020 INRIA.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+*/
+
+/*! \file SiconosCheckpoint.hpp
+  \brief binary checkpoints of the dynamic state of a Simulation
+*/
+
+#ifndef SICONOSCHECKPOINT_HPP
+#define SICONOSCHECKPOINT_HPP
+
+#include <SiconosFwd.hpp>
+
+#include <map>
+#include <string>
+#include <thread>
+#include <tuple>
+#include <vector>
+
+/** Checkpoints of the dynamic state of a Simulation.
+ *
+ * Contrary to Siconos::save(), which serializes the whole Simulation
+ * (model, integrators, solvers ...), a checkpoint only holds the values
+ * that change during the time integration, in a compact binary layout:
+ *  - the state vectors and memories of the dynamical systems,
+ *  - y, lambda and their memories for the interactions,
+ *  - the work vectors of the OneStepIntegrators (graph properties),
+ *  - z and w of the LinearOSNS (and the global velocities of a
+ *    GlobalFrictionContact), used as a warm start by the solvers,
+ *  - the current time and the event queue of the EventsManager.
+ *
+ * A checkpoint is restored into a Simulation built and initialized in
+ * the same way as the saved one: the dynamical systems (resp. the
+ * interactions) are matched by their rank when sorted by number(), the
+ * one step nonsmooth problems by their index in the Simulation.
+ *
+ * A differential checkpoint only holds the values that differ from the
+ * last full checkpoint written by this object; its restoration reads
+ * the full checkpoint first (its file name is recorded in the header).
+ *
+ * With background = true, the state is copied in memory and the file is
+ * written by a separate thread, so that the simulation can go on; wait()
+ * blocks until the writing is over.
+ */
+class SiconosCheckpoint
+{
+public:
+
+  /** the kinds of the data blocks in a checkpoint file */
+  enum BlockKind
+  {
+    DS_X, DS_R, DS_Q, DS_VELOCITY, DS_P,
+    DS_X_MEMORY, DS_R_MEMORY, DS_Q_MEMORY, DS_VELOCITY_MEMORY,
+    DS_FORCES_MEMORY, DS_DOTQ_MEMORY, DS_P_MEMORY,
+    DS_WORK,
+    INTER_Y, INTER_LAMBDA, INTER_Y_OLD, INTER_LAMBDA_OLD,
+    INTER_Y_MEMORY, INTER_LAMBDA_MEMORY,
+    INTER_WORK,
+    EVENTS, TIME,
+    OSNS_Z, OSNS_W, OSNS_GLOBAL_VELOCITIES
+  };
+
+  /** a data block: kind, object rank, slot (derivative level or work
+   * vector index), auxiliary value (number of vectors of a memory)
+   * and the values */
+  struct Block
+  {
+    unsigned int kind;
+    unsigned int slot;
+    unsigned long id;
+    unsigned long aux;
+    std::vector<double> data;
+  };
+
+  typedef std::tuple<unsigned int, unsigned long, unsigned int> BlockKey;
+
+private:
+
+  /** the checkpointed simulation */
+  SP::Simulation _sim;
+
+  /** blocks of the last full checkpoint, for the differential ones */
+  std::map<BlockKey, std::vector<double> > _base;
+
+  /** file name of the last full checkpoint */
+  std::string _baseFilename;
+
+  /** writer thread of a background checkpoint */
+  std::thread _writer;
+
+  /** error message of the last background writing */
+  std::string _writerError;
+
+  /** copy the dynamic state of the simulation */
+  std::vector<Block> snapshot() const;
+
+  /** write a checkpoint file and its blocks
+   * \param filename the file name
+   * \param base the file name of the full checkpoint (differential only)
+   * \param blocks the blocks to be written
+   */
+  static void writeFile(const std::string& filename, const std::string& base,
+                        const std::vector<Block>& blocks);
+
+  /** read a checkpoint file
+   * \param filename the file name
+   * \param base set to the file name of the full checkpoint, empty for a full one
+   * \param blocks the blocks read
+   */
+  static void readFile(const std::string& filename, std::string& base,
+                       std::vector<Block>& blocks);
+
+  /** body of the writer thread */
+  static void backgroundWrite(SiconosCheckpoint* self, std::string filename,
+                              std::string base, std::vector<Block> blocks);
+
+  /** write the blocks, in background or not */
+  void write(const std::string& filename, const std::string& base,
+             std::vector<Block>&& blocks, bool background);
+
+  /** set the state of the simulation from the blocks */
+  void apply(const std::vector<Block>& blocks);
+
+public:
+
+  /** constructor
+   * \param sim the Simulation (initialized)
+   */
+  SiconosCheckpoint(SP::Simulation sim);
+
+  /** destructor, waits for the background writing */
+  ~SiconosCheckpoint();
+
+  /** write a full checkpoint, which becomes the base of the next
+   * differential ones
+   * \param filename the file name
+   * \param background write the file in a separate thread
+   */
+  void saveFull(const std::string& filename, bool background = false);
+
+  /** write the values that differ from the last full checkpoint
+   * \param filename the file name
+   * \param background write the file in a separate thread
+   */
+  void saveDifferential(const std::string& filename, bool background = false);
+
+  /** wait for the end of a background writing (an exception is thrown
+   * if it failed) */
+  void wait();
+
+  /** restore the simulation from a full or a differential checkpoint
+   * \param filename the file name
+   */
+  void restore(const std::string& filename);
+
+  /** \return the number of blocks (of the current state) that differ
+   * from the last full checkpoint */
+  unsigned int numberOfChangedBlocks() const;
+};
+
+#endif
@@ -94,6 +94,7 @@ REGISTER_BOOST_SERIALIZATION(std::basic_ofstream<char>);
 template <class Archive>
 void siconos_io(Archive& ar, FrictionContact &v, unsigned int version)
 {
+  // _trace is transient (open trace file), see FrictionContact::setTraceFile
   SERIALIZE(v, (_contactProblemDim)(_mu)(_numerics_solver_options), ar);
 
   if (Archive::is_loading::value)
@@ -114,7 +115,7 @@ REGISTER_BOOST_SERIALIZATION(FrictionContact);
 template <class Archive>
 void siconos_io(Archive& ar, GlobalFrictionContact &v, unsigned int version)
 {
-  SERIALIZE(v, (_contactProblemDim)(_sizeGlobalOutput)(_globalVelocities)(_b)(_H)(_mu)(_numerics_solver_options), ar);
+  SERIALIZE(v, (_contactProblemDim)(_sizeGlobalOutput)(_globalVelocities)(_b)(_H)(_matrixFree)(_mu)(_numerics_solver_options), ar);
 
   if (Archive::is_loading::value)
   {
@@ -242,6 +243,9 @@ template<typename Archive>
 void siconos_io(Archive& ar, LsodarOSI& osi, unsigned int version)
 {
   ar & boost::serialization::make_nvp("_intData", osi._intData);
+  ar & boost::serialization::make_nvp("_ml", osi._ml);
+  ar & boost::serialization::make_nvp("_mu", osi._mu);
+  ar & boost::serialization::make_nvp("_userBandwidth", osi._userBandwidth);
 
   if (Archive::is_loading::value)
   {
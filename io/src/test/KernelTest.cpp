@@ -15,6 +15,7 @@
 
 #define DEBUG_MESSAGES 1
 #include "SiconosFull.hpp"
+#include "SiconosCheckpoint.hpp"
 
 #include <boost/archive/binary_iarchive.hpp>
 #include <boost/archive/binary_oarchive.hpp>
@@ -524,3 +525,110 @@ void KernelTest::t9()
     CPPUNIT_ASSERT(false);
   }
 }
+
+/* bouncing ball of t5, with a simulation ready to run */
+static SP::TimeStepping bouncingBallSimulation()
+{
+  unsigned int nDof = 3;
+  double t0 = 0, T = 10, h = 0.005;
+  double R = 0.1, m = 1, g = 9.81;
+
+  SP::SiconosMatrix Mass(new SimpleMatrix(nDof, nDof));
+  (*Mass)(0, 0) = m;
+  (*Mass)(1, 1) = m;
+  (*Mass)(2, 2) = 3. / 5 * m * R * R;
+  SP::SiconosVector q0(new SiconosVector(nDof));
+  SP::SiconosVector v0(new SiconosVector(nDof));
+  (*q0)(0) = 1.0;
+  SP::LagrangianLinearTIDS ball(new LagrangianLinearTIDS(q0, v0, Mass));
+  SP::SiconosVector weight(new SiconosVector(nDof));
+  (*weight)(0) = -m * g;
+  ball->setFExtPtr(weight);
+
+  SP::SimpleMatrix H(new SimpleMatrix(1, nDof));
+  (*H)(0, 0) = 1.0;
+  SP::NonSmoothLaw nslaw(new NewtonImpactNSL(0.9));
+  SP::Relation relation(new LagrangianLinearTIR(H));
+  SP::Interaction inter(new Interaction(nslaw, relation));
+
+  SP::NonSmoothDynamicalSystem bouncingBall(new NonSmoothDynamicalSystem(t0, T));
+  bouncingBall->insertDynamicalSystem(ball);
+  bouncingBall->link(inter, ball);
+
+  SP::MoreauJeanOSI OSI(new MoreauJeanOSI(0.5));
+  SP::TimeDiscretisation t(new TimeDiscretisation(t0, h));
+  SP::OneStepNSProblem osnspb(new LCP());
+  SP::TimeStepping s(new TimeStepping(bouncingBall, t, OSI, osnspb));
+  s->associate(OSI, ball);
+  s->initialize();
+  return s;
+}
+
+static SP::LagrangianDS bouncingBallDS(SP::Simulation s)
+{
+  SP::DynamicalSystemsGraph dsg = s->nonSmoothDynamicalSystem()->dynamicalSystems();
+  return std::static_pointer_cast<LagrangianDS>(dsg->bundle(*(dsg->begin())));
+}
+
+void KernelTest::t10()
+{
+  try
+  {
+    SP::TimeStepping s = bouncingBallSimulation();
+    SiconosCheckpoint checkpoint(s);
+
+    // the ball hits the ground at about t = 0.45
+    for(unsigned int k = 0; k < 100; ++k)
+    {
+      s->computeOneStep();
+      s->nextStep();
+    }
+    checkpoint.saveFull("Kernelt10-full.chk");
+    CPPUNIT_ASSERT(checkpoint.numberOfChangedBlocks() == 0);
+
+    for(unsigned int k = 0; k < 50; ++k)
+    {
+      s->computeOneStep();
+      s->nextStep();
+    }
+    CPPUNIT_ASSERT(checkpoint.numberOfChangedBlocks() > 0);
+    checkpoint.saveDifferential("Kernelt10-diff.chk", true);
+    SiconosVector z = *std::static_pointer_cast<LinearOSNS>(s->oneStepNSProblem(SICONOS_OSNSP_TS_VELOCITY))->z();
+
+    for(unsigned int k = 0; k < 50; ++k)
+    {
+      s->computeOneStep();
+      s->nextStep();
+    }
+    checkpoint.wait();
+    SiconosVector q = *bouncingBallDS(s)->q();
+    SiconosVector v = *bouncingBallDS(s)->velocity();
+
+    // restart from the differential checkpoint with a new simulation
+    SP::TimeStepping s2 = bouncingBallSimulation();
+    SiconosCheckpoint checkpoint2(s2);
+    checkpoint2.restore("Kernelt10-diff.chk");
+    CPPUNIT_ASSERT(std::fabs(s2->startingTime() - 150 * s2->timeStep()) < 1e-12);
+    SiconosVector z2 = *std::static_pointer_cast<LinearOSNS>(s2->oneStepNSProblem(SICONOS_OSNSP_TS_VELOCITY))->z();
+    CPPUNIT_ASSERT(z2.size() == z.size());
+    z2 -= z;
+    CPPUNIT_ASSERT(z2.size() == 0 || z2.normInf() < 1e-12);
+    for(unsigned int k = 0; k < 50; ++k)
+    {
+      s2->computeOneStep();
+      s2->nextStep();
+    }
+    CPPUNIT_ASSERT(std::fabs(s2->startingTime() - s->startingTime()) < 1e-12);
+    SiconosVector dq = *bouncingBallDS(s2)->q();
+    SiconosVector dv = *bouncingBallDS(s2)->velocity();
+    dq -= q;
+    dv -= v;
+    CPPUNIT_ASSERT(dq.normInf() < 1e-12);
+    CPPUNIT_ASSERT(dv.normInf() < 1e-12);
+  }
+  catch(SiconosException e)
+  {
+    cout << e.report() << endl;
+    CPPUNIT_ASSERT(false);
+  }
+}
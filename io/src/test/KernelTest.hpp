@@ -22,6 +22,7 @@ class KernelTest : public CppUnit::TestFixture
 #endif
 
   CPPUNIT_TEST(t9);
+  CPPUNIT_TEST(t10);
 
   CPPUNIT_TEST_SUITE_END();
 
@@ -39,6 +40,7 @@ class KernelTest : public CppUnit::TestFixture
 #endif
 
   void t9();
+  void t10();
 
   std::string BBxml;
 public:
@@ -11,6 +11,7 @@
 #ifdef WITH_SERIALIZATION
 %{
  #include <SiconosRestart.hpp>
+ #include <SiconosCheckpoint.hpp>
 %}
 #endif
 
@@ -24,6 +25,8 @@
 
 #ifdef WITH_SERIALIZATION
 %include "SiconosRestart.hpp"
+%ignore SiconosCheckpoint::Block;
+%include "SiconosCheckpoint.hpp"
 #endif
 #ifdef WITH_MECHANICS
 %include <MechanicsIO.hpp>
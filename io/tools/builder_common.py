@@ -28,6 +28,7 @@ input_headers = {
                   "SiconosJoints.hpp",
                   "SiconosCollision.hpp",
                   "SiconosBulletCollisionManager.hpp",
+                  "SiconosNativeCollisionManager.hpp",
     ],
 
     # fix missing forwards for Control
@@ -39,10 +40,11 @@ input_headers = {
 
 def unwanted(s):
     """ un processed classed or attributes : to be defined explicitely in SiconosFull.hpp"""
-    m = re.search('xml|XML|Xml|MBlockCSR|fPtr|SimpleMatrix|SiconosVector|SiconosGraph|SiconosSharedLibrary|numerics|computeFIntPtr|computeJacobianFIntqPtr|computeJacobianFIntqDotPtr|PrimalFrictionContact|FrictionContact|Lsodar|_moving_plans|_err|Hem5|_bufferY|_spo|_measuredPert|_predictedPert|_blockCSR|NonSmoothDynamicalSystem::ChangeLogIter|_impl', s)
+    m = re.search('xml|XML|Xml|MBlockCSR|fPtr|SimpleMatrix|SiconosVector|SiconosGraph|SiconosSharedLibrary|numerics|computeFIntPtr|computeJacobianFIntqPtr|computeJacobianFIntqDotPtr|PrimalFrictionContact|FrictionContact|Lsodar|_moving_plans|_err|Hem5|_bufferY|_spo|_measuredPert|_predictedPert|_blockCSR|_file$|NonSmoothDynamicalSystem::ChangeLogIter|_impl', s)
     # note _err,_bufferY, _spo, _measuredPert, _predictedPert -> boost::circular_buffer issue with serialization
     # _spo : subpluggedobject
     # _blockCSR -> double * serialization needed by hand (but uneeded anyway for a full restart)
+    # _file -> std::ofstream of ControlBinaryFileRecorder, not serializable
     return m is not None
 
 def get_target(source_dir, header_path):
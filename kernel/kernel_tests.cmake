@@ -34,18 +34,25 @@ if(WITH_${COMPONENT}_TESTING)
   new_test(SOURCES FirstOrderLinearRTest.cpp ${SIMPLE_TEST_MAIN})
   new_test(SOURCES FirstOrderType1RTest.cpp  ${SIMPLE_TEST_MAIN})
   new_test(SOURCES LagrangianLinearTIRTest.cpp  ${SIMPLE_TEST_MAIN})
-  new_test(SOURCES LagrangianScleronomousRTest.cpp  ${SIMPLE_TEST_MAIN})
+  if(WITH_OPENMP)
+    # finite differences jacobians evaluated with several threads
+    new_test(SOURCES LagrangianScleronomousRTest.cpp  ${SIMPLE_TEST_MAIN} DEPS OpenMP::OpenMP_CXX)
+  else()
+    new_test(SOURCES LagrangianScleronomousRTest.cpp  ${SIMPLE_TEST_MAIN})
+  endif()
   new_test(SOURCES LagrangianRheonomousRTest.cpp  ${SIMPLE_TEST_MAIN})
   new_test(SOURCES LagrangianCompliantRTest.cpp  ${SIMPLE_TEST_MAIN})
   new_test(SOURCES LagrangianCompliantLinearTIRTest.cpp  ${SIMPLE_TEST_MAIN})
   new_test(SOURCES LagrangianDSTest.cpp  ${SIMPLE_TEST_MAIN})
   new_test(SOURCES LagrangianLinearTIDSTest.cpp  ${SIMPLE_TEST_MAIN})
   new_test(SOURCES NewtonEulerDSTest.cpp  ${SIMPLE_TEST_MAIN})
+  new_test(SOURCES NewtonEuler3DRTest.cpp  ${SIMPLE_TEST_MAIN})
   new_test(SOURCES NonSmoothDynamicalSystemTest.cpp  ${SIMPLE_TEST_MAIN})
   
   # ---- Simulation tools ---
   begin_tests(src/simulationTools/test DEPS "numerics;CPPUNIT::CPPUNIT")
   new_test(SOURCES OSNSPTest.cpp ${SIMPLE_TEST_MAIN})
+  new_test(SOURCES EventDrivenTest.cpp ${SIMPLE_TEST_MAIN})
   new_test(SOURCES testAVI.cpp ${SIMPLE_TEST_MAIN} DEPS LAPACK::LAPACK)
   if(HAS_FORTRAN)
     new_test(SOURCES ZOHTest.cpp ${SIMPLE_TEST_MAIN} DEPS LAPACK::LAPACK)
@@ -97,6 +97,7 @@ DEFINE_SPTR(Event)
 DEFINE_SPTR(NonSmoothLaw)
 
 DEFINE_SPTR(MatrixIntegrator)
+DEFINE_SPTR(FiniteDifferenceJacobian)
 DEFINE_SPTR(PluggedObject)
 DEFINE_SPTR(SubPluggedObject)
 DEFINE_SPTR_STRUCT(ExtraAdditionalTerms)
@@ -86,6 +86,8 @@ FirstOrderNonLinearDS::FirstOrderNonLinearDS(const FirstOrderNonLinearDS & FONLD
     _pluginM.reset(new PluggedObject(*(FONLDS.getPluginM())));
   if(FONLDS.invM())
     _invM.reset(new SimpleMatrix(*(FONLDS.invM())));
+  if(FONLDS.jacobianfxFD())
+    _jacobianfxFD.reset(new FiniteDifferenceJacobian(*(FONLDS.jacobianfxFD())));
 
   // Memory stuff to me moved to graph/osi
   if(FONLDS.fold())
@@ -217,6 +219,19 @@ void FirstOrderNonLinearDS::setComputeJacobianfxFunction(FPtr1 fct)
   _pluginJacxf->setComputeFunction((void *)fct);
 }
 
+void FirstOrderNonLinearDS::setComputeJacobianfxByFD(bool flag)
+{
+  if(flag)
+  {
+    if(!_jacobianfx)
+      _jacobianfx.reset(new SimpleMatrix(_n, _n));
+    if(!_jacobianfxFD)
+      _jacobianfxFD.reset(new FiniteDifferenceJacobian());
+  }
+  else
+    _jacobianfxFD.reset();
+}
+
 void FirstOrderNonLinearDS::computeM(double time)
 {
   if(_pluginM->fPtr && _M)
@@ -235,6 +250,43 @@ void FirstOrderNonLinearDS::computeJacobianfx(double time, SP::SiconosVector sta
 {
   if(_jacobianfx && _pluginJacxf->fPtr)
     ((FNLDSPtrfct)_pluginJacxf->fPtr)(time, _n, state->getArray(), &(*_jacobianfx)(0, 0), _z->size(), _z->getArray());
+  else if(_jacobianfx && _jacobianfxFD && _f)
+    computeJacobianfxByFD(time, *state);
+}
+
+void FirstOrderNonLinearDS::computeJacobianfxByFD(double time, const SiconosVector& state)
+{
+  DEBUG_BEGIN("FirstOrderNonLinearDS::computeJacobianfxByFD(double time, const SiconosVector& state)\n");
+  FiniteDifferenceJacobian::Function f;
+  bool threadSafe = _pluginf->fPtr;
+  // _f is overwritten by computef, save it
+  SiconosVector fSave(*_f);
+  if(threadSafe)
+  {
+    // direct call to the plugin, each evaluation works on its own copy of z
+    f = [this, time](const SiconosVector& x, SiconosVector& fx)
+    {
+      SiconosVector z(*_z);
+      ((FNLDSPtrfct)_pluginf->fPtr)(time, _n, x.getArray(), fx.getArray(), z.size(), z.getArray());
+    };
+  }
+  else
+  {
+    // computef may be overloaded (from C++ or python): sequential evaluations through _f
+    SP::SiconosVector x(new SiconosVector(_n));
+    f = [this, time, x](const SiconosVector& xIn, SiconosVector& fx)
+    {
+      *x = xIn;
+      computef(time, x);
+      fx = *_f;
+    };
+  }
+  SiconosVector fx(_n);
+  f(state, fx);
+  _jacobianfxFD->compute(f, state, fx, *_jacobianfx, threadSafe);
+  *_f = fSave;
+  DEBUG_EXPR(_jacobianfx->display(););
+  DEBUG_END("FirstOrderNonLinearDS::computeJacobianfxByFD(double time, const SiconosVector& state)\n");
 }
 
 void FirstOrderNonLinearDS::computeRhs(double time)
@@ -24,6 +24,7 @@
 #define FIRSTORDERNONLINEARDS_H
 
 #include "DynamicalSystem.hpp"
+#include "FiniteDifferenceJacobian.hpp"
 
 
 /**  General First Order Non Linear Dynamical Systems - \f$ M(t) \dot{x} = f(x,t,z) + r, \quad x(t_0) = x_0 \f$
@@ -71,7 +72,10 @@
   - \f$f(x,t,z)\f$
   - \f$\nabla_x f(x,t,z)\f$
   - \f$M(t)\f$
-  
+
+  If no plugin is given for \f$\nabla_x f(x,t,z)\f$, it may be approximated by
+  finite differences of f (see setComputeJacobianfxByFD()), exploiting its
+  sparsity pattern when available.
  
  */
 class FirstOrderNonLinearDS : public DynamicalSystem
@@ -127,6 +131,10 @@ protected:
 
   SP::PluggedObject _pluginM;
 
+  /** finite-difference approximation of \f$ \nabla_x f\f$, used
+   * when no plugin is set for the jacobian (nullptr if disabled) */
+  SP::FiniteDifferenceJacobian _jacobianfxFD;
+
   /**  the previous r vectors */
   SiconosMemory _rMemory;
 
@@ -140,6 +148,12 @@ protected:
   /** Reset the PluggedObjects */
   virtual void _zeroPlugin();
 
+  /** compute jacobianfx by finite differences of f
+   *  \param time instant used in the computations
+   *  \param state the point of evaluation
+   */
+  void computeJacobianfxByFD(double time, const SiconosVector& state);
+
 
 public:
 
@@ -273,8 +287,17 @@ public:
   //@{
 
   /** get all the values of the state vector r stored in memory
+   * (not const due to SiconosCheckpoint::restore)
    *  \return a memory vector
    */
+  inline SiconosMemory& rMemory()
+  {
+    return _rMemory;
+  }
+
+  /** get all the values of the state vector r stored in memory
+   *  \return a const memory vector
+   */
   inline const SiconosMemory& rMemory() const
   {
     return _rMemory;
@@ -364,9 +387,26 @@ public:
    */
   virtual void computef(double time, SP::SiconosVector state);
 
+  /** enable (or disable) the approximation of \f$ \nabla_x f\f$ by
+   *  finite differences of f. Only used when no plugin is set to compute
+   *  jacobianfx. The sparsity pattern, the step or the parallel evaluation
+   *  can be set through jacobianfxFD().
+   *  \param flag true to enable
+   */
+  void setComputeJacobianfxByFD(bool flag);
+
+  /** \return the object used to compute jacobianfx by finite
+   * differences (nullptr if not enabled)
+   */
+  inline SP::FiniteDifferenceJacobian jacobianfxFD() const
+  {
+    return _jacobianfxFD;
+  }
+
   /** Default function to compute \f$ \nabla_x f: (x,t) \in R^{n}
    *   \times R \mapsto R^{n \times n} \f$ with x different from
-   *   current saved state.
+   *   current saved state. Uses the plugin if set, else finite differences
+   *   of f if enabled (see setComputeJacobianfxByFD()).
    *  \param time instant used in the computations
    *  \param state a SiconosVector to store the resuting value
    */
@@ -83,54 +83,120 @@ void FirstOrderNonLinearR::computeg(double time, const BlockVector& x, const Sic
   }
 }
 
+void FirstOrderNonLinearR::setComputeJacobiansByFD(bool flag)
+{
+  if(flag)
+  {
+    if(!_jachxFD) _jachxFD.reset(new FiniteDifferenceJacobian());
+    if(!_jachlambdaFD) _jachlambdaFD.reset(new FiniteDifferenceJacobian());
+    if(!_jacgxFD) _jacgxFD.reset(new FiniteDifferenceJacobian());
+    if(!_jacglambdaFD) _jacglambdaFD.reset(new FiniteDifferenceJacobian());
+  }
+  else
+  {
+    _jachxFD.reset();
+    _jachlambdaFD.reset();
+    _jacgxFD.reset();
+    _jacglambdaFD.reset();
+  }
+}
+
+void FirstOrderNonLinearR::computeJacobianByFD(FiniteDifferenceJacobian& fd, bool wrtLambda, bool ofG,
+                                               double time, const BlockVector& x, const SiconosVector& lambda,
+                                               const BlockVector& z, SimpleMatrix& J)
+{
+  DEBUG_BEGIN("FirstOrderNonLinearR::computeJacobianByFD(...)\n");
+  // Each evaluation works on its own copies of x, lambda, z (and r),
+  // so that the variables of the DS are never perturbed.
+  FiniteDifferenceJacobian::Function f =
+    [this, wrtLambda, ofG, time, &x, &lambda, &z](const SiconosVector& v, SiconosVector& out)
+  {
+    BlockVector xc(x);
+    BlockVector zc(z);
+    SiconosVector lambdac(lambda);
+    if(wrtLambda)
+      lambdac = v;
+    else
+      xc = v;
+    if(ofG)
+    {
+      BlockVector rc(x);
+      computeg(time, xc, lambdac, zc, rc);
+      out = rc;
+    }
+    else
+      computeh(time, xc, lambdac, zc, out);
+  };
+
+  SiconosVector v(wrtLambda ? lambda.size() : x.size());
+  if(wrtLambda)
+    v = lambda;
+  else
+    v = x;
+  SiconosVector fv(J.size(0));
+  f(v, fv);
+  // computeh/computeg may be overloaded (python ...), only plugins are assumed to be thread-safe
+  bool threadSafe = ofG ? _pluging->fPtr : _pluginh->fPtr;
+  fd.compute(f, v, fv, J, threadSafe);
+  DEBUG_END("FirstOrderNonLinearR::computeJacobianByFD(...)\n");
+}
+
 void FirstOrderNonLinearR::computeJachx(double time, const BlockVector& x, const SiconosVector& lambda, BlockVector& z, SimpleMatrix& C)
 {
-  if(_pluginJachx)
+  if(_pluginJachx->fPtr)
   {
     auto xp = x.prepareVectorForPlugin();
     auto zp = z.prepareVectorForPlugin();
     ((FONLR_C)_pluginJachx->fPtr)(time, xp->size(), xp->getArray(), lambda.size(), lambda.getArray(), C.getArray(), zp->size(), zp->getArray());
     z = *zp;
   }
+  else if(_jachxFD)
+    computeJacobianByFD(*_jachxFD, false, false, time, x, lambda, z, C);
   else
     RuntimeException::selfThrow("FirstOrderNonLinearR::computeJachx, you need to derive this function in order to use it");
 }
 
 void FirstOrderNonLinearR::computeJachlambda(double time, const BlockVector& x, const SiconosVector& lambda, BlockVector& z, SimpleMatrix& D)
 {
-  if(_pluginJachlambda)
+  if(_pluginJachlambda->fPtr)
   {
     auto xp = x.prepareVectorForPlugin();
     auto zp = z.prepareVectorForPlugin();
     ((FONLR_D)_pluginJachlambda->fPtr)(time, xp->size(), xp->getArray(), lambda.size(), lambda.getArray(), D.getArray(), zp->size(), zp->getArray());
     z = *zp;
   }
+  else if(_jachlambdaFD)
+    computeJacobianByFD(*_jachlambdaFD, true, false, time, x, lambda, z, D);
   else
     RuntimeException::selfThrow("FirstOrderNonLinearR::computeJachlambda, you need to either provide a matrix D or derive this function in order to use it");
 }
 
 void FirstOrderNonLinearR::computeJacglambda(double time, const BlockVector& x, const SiconosVector& lambda, BlockVector& z, SimpleMatrix& B)
 {
-  if(_pluginJacglambda)
+  if(_pluginJacglambda->fPtr)
   {
     auto xp = x.prepareVectorForPlugin();
     auto zp = z.prepareVectorForPlugin();
     ((FONLR_B)_pluginJacglambda->fPtr)(time, xp->size(), xp->getArray(), lambda.size(), lambda.getArray(), B.getArray(), zp->size(), zp->getArray());
     z = *zp;
   }
+  else if(_jacglambdaFD)
+    computeJacobianByFD(*_jacglambdaFD, true, true, time, x, lambda, z, B);
   else
     RuntimeException::selfThrow("FirstOrderNonLinearR::computeJacglambda, you need to either provide a matrix B or derive this function in order to use it");
 }
 
 void FirstOrderNonLinearR::computeJacgx(double time, const BlockVector& x, const SiconosVector& lambda, BlockVector& z, SimpleMatrix& K)
 {
-  if(_pluginJacgx)
+  if(_pluginJacgx->fPtr)
   {
     auto xp = x.prepareVectorForPlugin();
     auto zp = z.prepareVectorForPlugin();
     ((FONLR_K)_pluginJacgx->fPtr)(time, xp->size(), xp->getArray(), lambda.size(), lambda.getArray(), K.getArray(), zp->size(), zp->getArray());
     z = *zp;
   }
+  else if(_jacgxFD)
+    computeJacobianByFD(*_jacgxFD, false, true, time, x, lambda, z, K);
   else
     RuntimeException::selfThrow("FirstOrderNonLinearR::computeJacgx, you need to either provide a matrix K or derive this function in order to use it");
 }
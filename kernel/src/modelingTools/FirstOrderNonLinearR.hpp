@@ -25,6 +25,7 @@
 
 #include "FirstOrderR.hpp"
 #include "Interaction.hpp"
+#include "FiniteDifferenceJacobian.hpp"
 
 /** Pointer to function for plug-in for operators related to input and its gradients.*/
 
@@ -78,6 +79,8 @@
  *  @code (double time, unsigned x_size, double *x, unsigned size_lambda, double* lambda, double *mat, unsigned z_size, double *z) @endcode
  *  where mat is the pointer to the array of values for each Jacobian. This implies that only dense matrix are supported.
  *
+ *  Finally, the jacobians which are neither fixed nor plugged may be approximated by finite differences
+ *  of h and g, see setComputeJacobiansByFD().
  *
  */
 
@@ -88,7 +91,25 @@ protected:
   */
   ACCEPT_SERIALIZATION(FirstOrderNonLinearR);
 
+  /** finite-difference approximations of C, D, K and B (nullptr if disabled) */
+  SP::FiniteDifferenceJacobian _jachxFD;
+  SP::FiniteDifferenceJacobian _jachlambdaFD;
+  SP::FiniteDifferenceJacobian _jacgxFD;
+  SP::FiniteDifferenceJacobian _jacglambdaFD;
 
+  /** compute the jacobian of h (or g) with respect to x (or lambda) by finite differences.
+   * \param fd the finite-difference object to be used
+   * \param wrtLambda true for the jacobian with respect to lambda, false for x
+   * \param ofG true for the jacobian of g, false for h
+   * \param time    current time
+   * \param x       current state variables
+   * \param lambda  current nonsmooth variables
+   * \param z       current auxiliary variable
+   * \param[out] J  jacobian matrix
+   */
+  void computeJacobianByFD(FiniteDifferenceJacobian& fd, bool wrtLambda, bool ofG,
+                           double time, const BlockVector& x, const SiconosVector& lambda,
+                           const BlockVector& z, SimpleMatrix& J);
 
 
 public:
@@ -183,6 +204,37 @@ public:
    */
   virtual void computeInput(double time, Interaction& inter, unsigned int level = 0);
 
+  /** enable (or disable) the approximation by finite differences of
+   *  the jacobians of h and g, for those which are neither fixed nor
+   *  computed by a plugin.
+   *  \param flag true to enable
+   */
+  void setComputeJacobiansByFD(bool flag);
+
+  /** \return the object used to compute C by finite differences (nullptr if not enabled) */
+  inline SP::FiniteDifferenceJacobian jachxFD() const
+  {
+    return _jachxFD;
+  }
+
+  /** \return the object used to compute D by finite differences (nullptr if not enabled) */
+  inline SP::FiniteDifferenceJacobian jachlambdaFD() const
+  {
+    return _jachlambdaFD;
+  }
+
+  /** \return the object used to compute K by finite differences (nullptr if not enabled) */
+  inline SP::FiniteDifferenceJacobian jacgxFD() const
+  {
+    return _jacgxFD;
+  }
+
+  /** \return the object used to compute B by finite differences (nullptr if not enabled) */
+  inline SP::FiniteDifferenceJacobian jacglambdaFD() const
+  {
+    return _jacglambdaFD;
+  }
+
   /** return true if the relation requires the computation of residu
    * \return true if residu are required, false otherwise
    */
@@ -59,15 +59,14 @@ void Lagrangian2d2DR::computeJachq(const BlockVector& q, BlockVector& z)
   double lever_arm_y = G1y-Py ;
   DEBUG_PRINTF("lever_arm_x = %4.2e,\t lever_arm_ y = %4.2e\n", lever_arm_x, lever_arm_y);
 
-  _jachq->setValue(0,0,Nx);
-  _jachq->setValue(0,1,Ny);
-  _jachq->setValue(0,2,lever_arm_y*Nx - lever_arm_x*Ny);
-
-  _jachq->setValue(1,0,Tx);
-  _jachq->setValue(1,1,Ty);
-  _jachq->setValue(1,2,lever_arm_y*Tx - lever_arm_x*Ty);
-
-
+  /* column-major storage of the 2 x 3 (or 2 x 6) dense jacobian */
+  double* jachq = _jachq->getArray();
+  jachq[0] = Nx;
+  jachq[1] = Tx;
+  jachq[2] = Ny;
+  jachq[3] = Ty;
+  jachq[4] = lever_arm_y*Nx - lever_arm_x*Ny;
+  jachq[5] = lever_arm_y*Tx - lever_arm_x*Ty;
 
   if(q.size() ==6)
   {
@@ -75,16 +74,12 @@ void Lagrangian2d2DR::computeJachq(const BlockVector& q, BlockVector& z)
     double G2x = q.getValue(3);
     double G2y = q.getValue(4);
 
-
-    _jachq->setValue(0,3,-Nx);
-    _jachq->setValue(0,4,-Ny);
-    _jachq->setValue(0,5,- ((G2y-Py)*Nx - (G2x-Px)*Ny));
-
-    _jachq->setValue(1,3,-Tx);
-    _jachq->setValue(1,4,-Ty);
-    _jachq->setValue(1,5,-((G2y-Py)*Tx - (G2x-Px)*Ty));
-
-
+    jachq[6] = -Nx;
+    jachq[7] = -Tx;
+    jachq[8] = -Ny;
+    jachq[9] = -Ty;
+    jachq[10] = -((G2y-Py)*Nx - (G2x-Px)*Ny);
+    jachq[11] = -((G2y-Py)*Tx - (G2x-Px)*Ty);
   }
   DEBUG_EXPR(_jachq->display(););
   DEBUG_END("Lagrangian2d2DR::computeJachq(Interaction& inter, SP::BlockVector q0) \n");
@@ -629,18 +629,20 @@ public:
 
   /** get all the values of the state vector q stored in memory.
    * note: not const due to SchatzmanPaoliOSI::initializeWorkVectorsForDS
+   * and SiconosCheckpoint::restore
    *  \return a memory
    */
-  inline const SiconosMemory& qMemory()
+  inline SiconosMemory& qMemory()
   {
     return _qMemory;
   }
 
   /** get all the values of the state vector velocity stored in memory.
    * note: not const due to SchatzmanPaoliOSI::initializeWorkVectorsForDS
+   * and SiconosCheckpoint::restore
    *  \return a memory
    */
-  inline const SiconosMemory& velocityMemory()
+  inline SiconosMemory& velocityMemory()
   {
     return _velocityMemory;
   }
@@ -649,7 +651,7 @@ public:
    * \param level
    *  \return a memory
    */
-  inline const SiconosMemory& pMemory(unsigned int level)
+  inline SiconosMemory& pMemory(unsigned int level)
   {
     return _pMemory[level];
   }
@@ -657,7 +659,7 @@ public:
   /** get forces in memory buff
    *  \return pointer on a SiconosMemory
    */
-  inline const SiconosMemory& forcesMemory()
+  inline SiconosMemory& forcesMemory()
   {
     return _forcesMemory;
   }
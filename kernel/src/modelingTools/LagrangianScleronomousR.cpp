@@ -20,6 +20,7 @@
 
 #include "LagrangianScleronomousR.hpp"
 #include "SiconosAlgebraProd.hpp"  // for matrix-vector prod
+#include "SiconosAlgebraFixedSize.hpp"  // for small dense products
 #include "Interaction.hpp"
 #include "LagrangianDS.hpp"
 
@@ -110,6 +111,35 @@ void LagrangianScleronomousR::computeJachq(const BlockVector& q, BlockVector& z)
     ((FPtr3)(_pluginJachq->fPtr))(qp->size(), &(*qp)(0), _jachq->size(0), &(*_jachq)(0, 0), zp->size(), &(*zp)(0));
     z = *zp;
   }
+  else if(_jachq && _jachqFD)
+  {
+    // Each evaluation works on its own copies of q and z,
+    // so that the variables of the DS are never perturbed.
+    FiniteDifferenceJacobian::Function h = [this, &q, &z](const SiconosVector& qv, SiconosVector& y)
+    {
+      BlockVector qc(q);
+      BlockVector zc(z);
+      qc = qv;
+      computeh(qc, zc, y);
+    };
+    SiconosVector qv(q.size());
+    qv = q;
+    SiconosVector y(_jachq->size(0));
+    h(qv, y);
+    // computeh may be overloaded (python ...), only plugins are assumed to be thread-safe
+    _jachqFD->compute(h, qv, y, *_jachq, _pluginh && _pluginh->fPtr);
+  }
+}
+
+void LagrangianScleronomousR::setComputeJachqByFD(bool flag)
+{
+  if(flag)
+  {
+    if(!_jachqFD)
+      _jachqFD.reset(new FiniteDifferenceJacobian());
+  }
+  else
+    _jachqFD.reset();
 }
 
 void LagrangianScleronomousR::computeDotJachq(const BlockVector& q, BlockVector& z, const BlockVector& qDot)
@@ -152,7 +182,8 @@ void LagrangianScleronomousR::computeOutput(double time, Interaction& inter,  un
     if(derivativeNumber == 1)
     {
       assert(_jachq);
-      prod(*_jachq, *DSlink[LagrangianR::q1], y);
+      if(!fixedSizeProd(*_jachq, *DSlink[LagrangianR::q1], y))
+        prod(*_jachq, *DSlink[LagrangianR::q1], y);
     }
     else if(derivativeNumber == 2)
     {
@@ -186,7 +217,8 @@ void LagrangianScleronomousR::computeInput(double time, Interaction& inter, unsi
   DEBUG_EXPR(lambda.display(););
   DEBUG_EXPR(_jachq->display(););
   // data[name] += trans(G) * lambda
-  prod(lambda, *_jachq, *DSlink[LagrangianR::p0 + level], false);
+  if(!fixedSizeProd(lambda, *_jachq, *DSlink[LagrangianR::p0 + level], false))
+    prod(lambda, *_jachq, *DSlink[LagrangianR::p0 + level], false);
   DEBUG_EXPR(DSlink[LagrangianR::p0 + level]->display(););
   DEBUG_END("void LagrangianScleronomousR::computeInput(double time, Interaction& inter, InteractionProperties& interProp, unsigned int level) \n");
 }
@@ -22,6 +22,7 @@
 #define LagrangianScleronomousR_H
 
 #include "LagrangianR.hpp"
+#include "FiniteDifferenceJacobian.hpp"
 #include "SimpleMatrixFriends.hpp"
 /** \brief   Scleronomic Lagrangian (Non Linear) Relations
 
@@ -122,6 +123,10 @@ protected:
   /** Product of the time--derivative of Jacobian with the velocity qdot */
   SP::SiconosVector _dotjacqhXqdot;
 
+  /** finite-difference approximation of the jacobian of h, used
+   * when no plugin is set for the jacobian (nullptr if disabled) */
+  SP::FiniteDifferenceJacobian _jachqFD;
+
   /** reset all plugins */
   virtual void _zeroPlugin();
 
@@ -177,12 +182,28 @@ public:
   */
   virtual void computeh(const BlockVector& q, BlockVector& z, SiconosVector& y);
 
-  /** to compute the jacobian of h(...). Set attribute _jachq (access: jacqhq())
+  /** to compute the jacobian of h(...). Set attribute _jachq (access: jacqhq()).
+      Uses the plugin if set, else finite differences of h if enabled
+      (see setComputeJachqByFD()).
       \param q coordinates of the dynamical systems involved in the relation
       \param z user defined parameters (optional)
   */
   virtual void computeJachq(const BlockVector& q, BlockVector& z);
 
+  /** enable (or disable) the approximation of the jacobian of h by finite
+   *  differences. Only used when no plugin is set to compute the jacobian.
+   *  \param flag true to enable
+   */
+  void setComputeJachqByFD(bool flag);
+
+  /** \return the object used to compute the jacobian of h by finite
+   * differences (nullptr if not enabled)
+   */
+  inline SP::FiniteDifferenceJacobian jachqFD() const
+  {
+    return _jachqFD;
+  }
+
   /** to compute the time derivative of the Jacobian. Result in _dotjachq (access: dotjachq())
       \param q coordinates of the dynamical systems involved in the relation
       \param z user defined parameters (optional)
@@ -22,6 +22,7 @@
 #include "RotationQuaternion.hpp"
 #include "Interaction.hpp"
 #include "BlockVector.hpp"
+#include "SiconosAlgebraFixedSize.hpp"
 #include <boost/math/quaternion.hpp>
 
 //#define NERI_DEBUG
@@ -34,17 +35,46 @@
 /*
 See devNotes.pdf for details. A detailed documentation is available in DevNotes.pdf: chapter 'NewtonEulerR: computation of \nabla q H'. Subsection 'Case FC3D: using the local frame local velocities'
 */
+void NewtonEuler1DR::contactFrameJacobian(const SiconosVector& q, double sign, unsigned int col)
+{
+  using namespace Siconos::FixedSize;
+
+  /* lever arm matrix (cross product by G-P) */
+  double dx = q.getValue(0) - _Pc1->getValue(0);
+  double dy = q.getValue(1) - _Pc1->getValue(1);
+  double dz = q.getValue(2) - _Pc1->getValue(2);
+  Matrix<3, 3> NPG;
+  NPG(0, 0) = 0.0;
+  NPG(1, 0) = dz;
+  NPG(2, 0) = -dy;
+  NPG(0, 1) = -dz;
+  NPG(1, 1) = 0.0;
+  NPG(2, 1) = dx;
+  NPG(0, 2) = dy;
+  NPG(1, 2) = -dx;
+  NPG(2, 2) = 0.0;
+
+  /* compose with the rotation from the body-fixed frame to the absolute frame */
+  Matrix<3, 3> rotation;
+  Matrix<3, 3> leverArm;
+  computeRotationMatrix(q.getValue(3), q.getValue(4), q.getValue(5), q.getValue(6), rotation.data);
+  prod(NPG, rotation, leverArm);
+
+  /* rotate in the contact frame */
+  unsigned int rows = _jachqT->size(0);
+  const double* frame = _rotationAbsoluteToContactFrame->getArray();
+  double* block = _jachqT->getArray() + col * rows;
+  for(unsigned int k = 0; k < 3 * rows; k++)
+    block[k] = sign * frame[k];
+  if(!fixedSizeGemm(rows, 3, 3, frame, rows, leverArm.data, 3, block + 3 * rows, rows, true))
+    RuntimeException::selfThrow("NewtonEuler1DR::contactFrameJacobian. Unexpected size of the jacobian");
+  if(sign != 1.0)
+    for(unsigned int k = 3 * rows; k < 6 * rows; k++)
+      block[k] *= sign;
+}
+
 void NewtonEuler1DR::NIcomputeJachqTFromContacts(SP::SiconosVector q1)
 {
-  double Nx = _Nc->getValue(0);
-  double Ny = _Nc->getValue(1);
-  double Nz = _Nc->getValue(2);
-  double Px = _Pc1->getValue(0);
-  double Py = _Pc1->getValue(1);
-  double Pz = _Pc1->getValue(2);
-  double G1x = q1->getValue(0);
-  double G1y = q1->getValue(1);
-  double G1z = q1->getValue(2);
 #ifdef NEFC3D_DEBUG
   printf("contact normal:\n");
   _Nc->display();
@@ -53,34 +83,12 @@ void NewtonEuler1DR::NIcomputeJachqTFromContacts(SP::SiconosVector q1)
   printf("center of masse :\n");
   q1->display();
 #endif
-  _rotationAbsoluteToContactFrame->setValue(0, 0, Nx);
-  _rotationAbsoluteToContactFrame->setValue(0, 1, Ny);
-  _rotationAbsoluteToContactFrame->setValue(0, 2, Nz);
-
-  _NPG1->zero();
-
-  (*_NPG1)(0, 0) = 0;
-  (*_NPG1)(0, 1) = -(G1z - Pz);
-  (*_NPG1)(0, 2) = (G1y - Py);
-  (*_NPG1)(1, 0) = (G1z - Pz);
-  (*_NPG1)(1, 1) = 0;
-  (*_NPG1)(1, 2) = -(G1x - Px);
-  (*_NPG1)(2, 0) = -(G1y - Py);
-  (*_NPG1)(2, 1) = (G1x - Px);
-  (*_NPG1)(2, 2) = 0;
-
+  double* frame = _rotationAbsoluteToContactFrame->getArray();
+  frame[0] = _Nc->getValue(0);
+  frame[1] = _Nc->getValue(1);
+  frame[2] = _Nc->getValue(2);
 
-  computeRotationMatrix(q1,_rotationBodyToAbsoluteFrame);
-  prod(*_NPG1, *_rotationBodyToAbsoluteFrame, *_AUX1, true);
-
-  prod(*_rotationAbsoluteToContactFrame, *_AUX1, *_AUX2, true);
-
-
-  for(unsigned int jj = 0; jj < 3; jj++)
-    _jachqT->setValue(0, jj, _rotationAbsoluteToContactFrame->getValue(0, jj));
-
-  for(unsigned int jj = 3; jj < 6; jj++)
-    _jachqT->setValue(0, jj, _AUX2->getValue(0, jj - 3));
+  contactFrameJacobian(*q1, 1.0, 0);
 
 #ifdef NEFC3D_DEBUG
   printf("NewtonEuler1DR jhqt\n");
@@ -90,70 +98,13 @@ void NewtonEuler1DR::NIcomputeJachqTFromContacts(SP::SiconosVector q1)
 
 void NewtonEuler1DR::NIcomputeJachqTFromContacts(SP::SiconosVector q1, SP::SiconosVector q2)
 {
-  double Nx = _Nc->getValue(0);
-  double Ny = _Nc->getValue(1);
-  double Nz = _Nc->getValue(2);
-  double Px = _Pc1->getValue(0);
-  double Py = _Pc1->getValue(1);
-  double Pz = _Pc1->getValue(2);
-  double G1x = q1->getValue(0);
-  double G1y = q1->getValue(1);
-  double G1z = q1->getValue(2);
-
-  _rotationAbsoluteToContactFrame->setValue(0, 0, Nx);
-  _rotationAbsoluteToContactFrame->setValue(0, 1, Ny);
-  _rotationAbsoluteToContactFrame->setValue(0, 2, Nz);
-
-  _NPG1->zero();
-
-  (*_NPG1)(0, 0) = 0;
-  (*_NPG1)(0, 1) = -(G1z - Pz);
-  (*_NPG1)(0, 2) = (G1y - Py);
-  (*_NPG1)(1, 0) = (G1z - Pz);
-  (*_NPG1)(1, 1) = 0;
-  (*_NPG1)(1, 2) = -(G1x - Px);
-  (*_NPG1)(2, 0) = -(G1y - Py);
-  (*_NPG1)(2, 1) = (G1x - Px);
-  (*_NPG1)(2, 2) = 0;
-
-  computeRotationMatrix(q1,_rotationBodyToAbsoluteFrame);
-  prod(*_NPG1, *_rotationBodyToAbsoluteFrame, *_AUX1, true);
-  prod(*_rotationAbsoluteToContactFrame, *_AUX1, *_AUX2, true);
-
-  for(unsigned int jj = 0; jj < 3; jj++)
-    _jachqT->setValue(0, jj, _rotationAbsoluteToContactFrame->getValue(0, jj));
-
-
-  for(unsigned int jj = 3; jj < 6; jj++)
-    _jachqT->setValue(0, jj, _AUX2->getValue(0, jj - 3));
-
-  double G2x = q2->getValue(0);
-  double G2y = q2->getValue(1);
-  double G2z = q2->getValue(2);
-
-  _NPG2->zero();
-  (*_NPG2)(0, 0) = 0;
-  (*_NPG2)(0, 1) = -(G2z - Pz);
-  (*_NPG2)(0, 2) = (G2y - Py);
-  (*_NPG2)(1, 0) = (G2z - Pz);
-  (*_NPG2)(1, 1) = 0;
-  (*_NPG2)(1, 2) = -(G2x - Px);
-  (*_NPG2)(2, 0) = -(G2y - Py);
-  (*_NPG2)(2, 1) = (G2x - Px);
-  (*_NPG2)(2, 2) = 0;
-
-
-
-  computeRotationMatrix(q2,_rotationBodyToAbsoluteFrame);
-  prod(*_NPG2, *_rotationBodyToAbsoluteFrame, *_AUX1, true);
-
-  prod(*_rotationAbsoluteToContactFrame, *_AUX1, *_AUX2, true);
-
-  for(unsigned int jj = 0; jj < 3; jj++)
-    _jachqT->setValue(0, jj + 6, -_rotationAbsoluteToContactFrame->getValue(0, jj));
-
-  for(unsigned int jj = 3; jj < 6; jj++)
-    _jachqT->setValue(0, jj + 6, -_AUX2->getValue(0, jj - 3));
+  double* frame = _rotationAbsoluteToContactFrame->getArray();
+  frame[0] = _Nc->getValue(0);
+  frame[1] = _Nc->getValue(1);
+  frame[2] = _Nc->getValue(2);
+
+  contactFrameJacobian(*q1, 1.0, 0);
+  contactFrameJacobian(*q2, -1.0, 6);
 }
 
 void NewtonEuler1DR::initialize(Interaction& inter)
@@ -165,11 +116,6 @@ void NewtonEuler1DR::initialize(Interaction& inter)
 
   /* VA 12/04/2016 All of what follows should be put in WorkM*/
   _rotationAbsoluteToContactFrame.reset(new SimpleMatrix(1, 3));
-  _rotationBodyToAbsoluteFrame.reset(new SimpleMatrix(3, 3));
-  _AUX1.reset(new SimpleMatrix(3, 3));
-  _AUX2.reset(new SimpleMatrix(1, 3));
-  _NPG1.reset(new SimpleMatrix(3, 3));
-  _NPG2.reset(new SimpleMatrix(3, 3));
   //  _isContact=1;
 }
 
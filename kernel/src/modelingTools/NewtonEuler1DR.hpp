@@ -67,7 +67,8 @@ protected:
    */
   SP::SimpleMatrix _rotationAbsoluteToContactFrame;
 
-  /* Matrix converting */
+  /* Matrix converting. This one and the matrices below are only used
+   * (and allocated) by NewtonEuler5DR */
   SP::SimpleMatrix _rotationBodyToAbsoluteFrame;
 
   /* Cross product matrices that correspond the lever arm from
@@ -107,6 +108,16 @@ protected:
     _Nc = nnc;
   };
 
+  /** Write in the columns [col, col+6) of _jachqT the jacobian of the velocity of the
+   * contact point pc1, expressed in the contact frame, with respect to the velocity of a body
+   * (translation in the absolute frame, rotation in the body frame).
+   * The blocks are computed with the fixed-size kernels of SiconosAlgebraFixedSize.hpp.
+   * \param q the position of the body
+   * \param sign 1.0 for the first body, -1.0 for the second one
+   * \param col the first column of the block in _jachqT
+   */
+  void contactFrameJacobian(const SiconosVector& q, double sign, unsigned int col);
+
 private:
   void NIcomputeJachqTFromContacts(SP::SiconosVector q1);
   void NIcomputeJachqTFromContacts(SP::SiconosVector q1, SP::SiconosVector q2);
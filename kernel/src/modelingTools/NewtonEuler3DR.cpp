@@ -25,6 +25,8 @@
 
 #include "op3x3.h"
 
+#include <cmath>
+
 // #define DEBUG_NOCOLOR
 // #define DEBUG_STDOUT
 // #define DEBUG_MESSAGES
@@ -41,29 +43,13 @@ void NewtonEuler3DR::initialize(Interaction& inter)
   _jachq.reset(new SimpleMatrix(3, qSize));
 
   _rotationAbsoluteToContactFrame.reset(new SimpleMatrix(3, 3));
-  _AUX2.reset(new SimpleMatrix(3, 3));
   //  _isContact=1;
 }
-void NewtonEuler3DR::FC3DcomputeJachqTFromContacts(SP::SiconosVector q1)
+void NewtonEuler3DR::contactFrame()
 {
-  DEBUG_BEGIN("NewtonEuler3DR::FC3DcomputeJachqTFromContacts(SP::SiconosVector q1)\n");
   double Nx = _Nc->getValue(0);
   double Ny = _Nc->getValue(1);
   double Nz = _Nc->getValue(2);
-  double Px = _Pc1->getValue(0);
-  double Py = _Pc1->getValue(1);
-  double Pz = _Pc1->getValue(2);
-  double G1x = q1->getValue(0);
-  double G1y = q1->getValue(1);
-  double G1z = q1->getValue(2);
-
-  DEBUG_PRINT("contact normal:\n");
-  DEBUG_EXPR(_Nc->display(););
-  DEBUG_PRINTF("_Nc->norm2() -1.0 = %e\n",_Nc->norm2()-1.0);
-  DEBUG_PRINT("contact point :\n");
-  DEBUG_EXPR(_Pc1->display(););
-  DEBUG_PRINT("center of mass :\n");
-  DEBUG_EXPR(q1->display(););
 
   assert(_Nc->norm2() >0.0
          && std::abs(_Nc->norm2()-1.0) < 1e-6
@@ -72,113 +58,54 @@ void NewtonEuler3DR::FC3DcomputeJachqTFromContacts(SP::SiconosVector q1)
   double t[6];
   double * pt = t;
 
-
   // 1 - Construction of the local contact frame from the normal vector
 
   if(orthoBaseFromVector(&Nx, &Ny, &Nz, pt, pt + 1, pt + 2, pt + 3, pt + 4, pt + 5))
     RuntimeException::selfThrow("NewtonEuler3DR::FC3DcomputeJachqTFromContacts. Problem in calling orthoBaseFromVector");
 
-
   // 2 - Construction of the rotation matrix from the absolute frame to the local contact frame
-  pt = t;
-  _rotationAbsoluteToContactFrame->setValue(0, 0, Nx);
-  _rotationAbsoluteToContactFrame->setValue(1, 0, *pt);
-  _rotationAbsoluteToContactFrame->setValue(2, 0, *(pt + 3));
-  _rotationAbsoluteToContactFrame->setValue(0, 1, Ny);
-  _rotationAbsoluteToContactFrame->setValue(1, 1, *(pt + 1));
-  _rotationAbsoluteToContactFrame->setValue(2, 1, *(pt + 4));
-  _rotationAbsoluteToContactFrame->setValue(0, 2, Nz);
-  _rotationAbsoluteToContactFrame->setValue(1, 2, *(pt + 2));
-  _rotationAbsoluteToContactFrame->setValue(2, 2, *(pt + 5));
+  //     (column-major storage)
+  double* frame = _rotationAbsoluteToContactFrame->getArray();
+  frame[0] = Nx;
+  frame[1] = t[0];
+  frame[2] = t[3];
+  frame[3] = Ny;
+  frame[4] = t[1];
+  frame[5] = t[4];
+  frame[6] = Nz;
+  frame[7] = t[2];
+  frame[8] = t[5];
   DEBUG_PRINT("_rotationAbsoluteToContactFrame:\n");
   DEBUG_EXPR(_rotationAbsoluteToContactFrame->display(););
+}
 
-  // 3 - Construction of the lever arm matrix in  the absolute frame
-
-  _NPG1->zero();
-  (*_NPG1)(0, 0) = 0;
-  (*_NPG1)(0, 1) = -(G1z - Pz);
-  (*_NPG1)(0, 2) = (G1y - Py);
-  (*_NPG1)(1, 0) = (G1z - Pz);
-  (*_NPG1)(1, 1) = 0;
-  (*_NPG1)(1, 2) = -(G1x - Px);
-  (*_NPG1)(2, 0) = -(G1y - Py);
-  (*_NPG1)(2, 1) = (G1x - Px);
-  (*_NPG1)(2, 2) = 0;
+void NewtonEuler3DR::FC3DcomputeJachqTFromContacts(SP::SiconosVector q1)
+{
+  DEBUG_BEGIN("NewtonEuler3DR::FC3DcomputeJachqTFromContacts(SP::SiconosVector q1)\n");
+  DEBUG_PRINT("contact normal:\n");
+  DEBUG_EXPR(_Nc->display(););
+  DEBUG_PRINTF("_Nc->norm2() -1.0 = %e\n",_Nc->norm2()-1.0);
+  DEBUG_PRINT("contact point :\n");
+  DEBUG_EXPR(_Pc1->display(););
+  DEBUG_PRINT("center of mass :\n");
+  DEBUG_EXPR(q1->display(););
 
-  DEBUG_PRINT("lever arm skew matrix :\n");
-  DEBUG_EXPR(_NPG1->display(););
+  contactFrame();
 
   /* The Jacobian matrix (H) is given by the product
    * H = _rotationAbsoluteToContactFrame
    * for the translation part and
    * H = _rotationAbsoluteToContactFrame * leverArmMatrix * _rotationBodyToAbsoluteFrame
-   * for the rotation part and
+   * for the rotation part
    */
-
-  // 4 - Compute the rotation matrix from the body-fixed frame to the absolute frame
-  computeRotationMatrix(q1,_rotationBodyToAbsoluteFrame);
-  DEBUG_EXPR(_rotationBodyToAbsoluteFrame->display(););
-
-
-  // 5 - compose the body lever arm matrix with the rotation matrix
-  prod(*_NPG1, *_rotationBodyToAbsoluteFrame, *_AUX1, true);
-  DEBUG_EXPR(_rotationBodyToAbsoluteFrame->display(););
-  DEBUG_EXPR(_AUX1->display(););
-
-  // 6 -  Rotate the resulting matric in the contact frame
-  prod(*_rotationAbsoluteToContactFrame, *_AUX1, *_AUX2, true);
-  DEBUG_EXPR(_rotationAbsoluteToContactFrame->display(););
-  DEBUG_EXPR(_AUX2->display(););
-
-  // 7 - fill the Jacobian
-
-  for(unsigned int ii = 0; ii < 3; ii++)
-    for(unsigned int jj = 0; jj < 3; jj++)
-      _jachqT->setValue(ii, jj, _rotationAbsoluteToContactFrame->getValue(ii, jj));
-
-  for(unsigned int ii = 0; ii < 3; ii++)
-    for(unsigned int jj = 3; jj < 6; jj++)
-      _jachqT->setValue(ii, jj, _AUX2->getValue(ii, jj - 3));
+  contactFrameJacobian(*q1, 1.0, 0);
 
   DEBUG_EXPR(_jachqT->display(););
-  // DEBUG_EXPR_WE(
-  //   SP::SimpleMatrix jaux(new SimpleMatrix(*_jachqT));
-  //   jaux->trans();
-  //   SP::SiconosVector v(new SiconosVector(3));
-  //   SP::SiconosVector vRes(new SiconosVector(6));
-  //   v->zero();
-  //   v->setValue(0, 1);
-  //   prod(*jaux, *v, *vRes, true);
-  //   vRes->display();
-  //   v->zero();
-  //   v->setValue(1, 1);
-  //   prod(*jaux, *v, *vRes, true);
-  //   vRes->display();
-  //   v->zero();
-  //   v->setValue(2, 1);
-  //   prod(*jaux, *v, *vRes, true);
-  //   vRes->display();
-  //   );
   DEBUG_END("NewtonEuler3DR::FC3DcomputeJachqTFromContacts(SP::SiconosVector q1)\n");
 }
 
 void NewtonEuler3DR::FC3DcomputeJachqTFromContacts(SP::SiconosVector q1, SP::SiconosVector q2)
 {
-  double Nx = _Nc->getValue(0);
-  double Ny = _Nc->getValue(1);
-  double Nz = _Nc->getValue(2);
-  double Px = _Pc1->getValue(0);
-  double Py = _Pc1->getValue(1);
-  double Pz = _Pc1->getValue(2);
-  double G1x = q1->getValue(0);
-  double G1y = q1->getValue(1);
-  double G1z = q1->getValue(2);
-  double G2x = q2->getValue(0);
-  double G2y = q2->getValue(1);
-  double G2z = q2->getValue(2);
-
-
   DEBUG_PRINT("contact normal:\n");
   DEBUG_EXPR(_Nc->display(););
   DEBUG_PRINT("contact point :\n");
@@ -186,79 +113,9 @@ void NewtonEuler3DR::FC3DcomputeJachqTFromContacts(SP::SiconosVector q1, SP::Sic
   DEBUG_PRINT("center of mass :\n");
   DEBUG_EXPR(q1->display(););
 
-
-
-
-
-  double t[6];
-  double * pt = t;
-  if(orthoBaseFromVector(&Nx, &Ny, &Nz, pt, pt + 1, pt + 2, pt + 3, pt + 4, pt + 5))
-    RuntimeException::selfThrow("NewtonEuler3DR::FC3DcomputeJachqTFromContacts. Problem in calling orthoBaseFromVector");
-  pt = t;
-  _rotationAbsoluteToContactFrame->setValue(0, 0, Nx);
-  _rotationAbsoluteToContactFrame->setValue(1, 0, *pt);
-  _rotationAbsoluteToContactFrame->setValue(2, 0, *(pt + 3));
-  _rotationAbsoluteToContactFrame->setValue(0, 1, Ny);
-  _rotationAbsoluteToContactFrame->setValue(1, 1, *(pt + 1));
-  _rotationAbsoluteToContactFrame->setValue(2, 1, *(pt + 4));
-  _rotationAbsoluteToContactFrame->setValue(0, 2, Nz);
-  _rotationAbsoluteToContactFrame->setValue(1, 2, *(pt + 2));
-  _rotationAbsoluteToContactFrame->setValue(2, 2, *(pt + 5));
-
-  _NPG1->zero();
-
-  (*_NPG1)(0, 0) = 0;
-  (*_NPG1)(0, 1) = -(G1z - Pz);
-  (*_NPG1)(0, 2) = (G1y - Py);
-  (*_NPG1)(1, 0) = (G1z - Pz);
-  (*_NPG1)(1, 1) = 0;
-  (*_NPG1)(1, 2) = -(G1x - Px);
-  (*_NPG1)(2, 0) = -(G1y - Py);
-  (*_NPG1)(2, 1) = (G1x - Px);
-  (*_NPG1)(2, 2) = 0;
-
-  _NPG2->zero();
-
-  (*_NPG2)(0, 0) = 0;
-  (*_NPG2)(0, 1) = -(G2z - Pz);
-  (*_NPG2)(0, 2) = (G2y - Py);
-  (*_NPG2)(1, 0) = (G2z - Pz);
-  (*_NPG2)(1, 1) = 0;
-  (*_NPG2)(1, 2) = -(G2x - Px);
-  (*_NPG2)(2, 0) = -(G2y - Py);
-  (*_NPG2)(2, 1) = (G2x - Px);
-  (*_NPG2)(2, 2) = 0;
-
-
-
-
-
-  computeRotationMatrix(q1,_rotationBodyToAbsoluteFrame);
-  prod(*_NPG1, *_rotationBodyToAbsoluteFrame, *_AUX1, true);
-  prod(*_rotationAbsoluteToContactFrame, *_AUX1, *_AUX2, true);
-
-
-  for(unsigned int ii = 0; ii < 3; ii++)
-    for(unsigned int jj = 0; jj < 3; jj++)
-      _jachqT->setValue(ii, jj, _rotationAbsoluteToContactFrame->getValue(ii, jj));
-
-  for(unsigned int ii = 0; ii < 3; ii++)
-    for(unsigned int jj = 3; jj < 6; jj++)
-      _jachqT->setValue(ii, jj, _AUX2->getValue(ii, jj - 3));
-
-
-  computeRotationMatrix(q2,_rotationBodyToAbsoluteFrame);
-  prod(*_NPG2, *_rotationBodyToAbsoluteFrame, *_AUX1, true);
-  prod(*_rotationAbsoluteToContactFrame, *_AUX1, *_AUX2, true);
-
-  for(unsigned int ii = 0; ii < 3; ii++)
-    for(unsigned int jj = 0; jj < 3; jj++)
-      _jachqT->setValue(ii, jj + 6, -_rotationAbsoluteToContactFrame->getValue(ii, jj));
-
-  for(unsigned int ii = 0; ii < 3; ii++)
-    for(unsigned int jj = 3; jj < 6; jj++)
-      _jachqT->setValue(ii, jj + 6, -_AUX2->getValue(ii, jj - 3));
-
+  contactFrame();
+  contactFrameJacobian(*q1, 1.0, 0);
+  contactFrameJacobian(*q2, -1.0, 6);
 }
 
 void NewtonEuler3DR::computeJachqT(Interaction& inter, SP::BlockVector q0)
@@ -276,3 +133,50 @@ void NewtonEuler3DR::computeJachqT(Interaction& inter, SP::BlockVector q0)
 
 
 }
+
+void NewtonEuler3DR::jacobianState(const BlockVector& q0, std::vector<double>& state) const
+{
+  state.clear();
+  for(unsigned int i = 0; i < 3; i++)
+    state.push_back(_Pc1->getValue(i));
+  for(unsigned int i = 0; i < 3; i++)
+    state.push_back(_Nc->getValue(i));
+  for(unsigned int b = 0; b < q0.numberOfBlocks(); b++)
+  {
+    const SiconosVector& q = *q0.vector(b);
+    for(unsigned int i = 0; i < q.size(); i++)
+      state.push_back(q.getValue(i));
+  }
+}
+
+void NewtonEuler3DR::computeJach(double time, Interaction& inter)
+{
+  DEBUG_BEGIN("NewtonEuler3DR::computeJach(double time, Interaction& inter)\n");
+  if(!_lazyJacobianUpdate)
+  {
+    NewtonEuler1DR::computeJach(time, inter);
+    DEBUG_END("NewtonEuler3DR::computeJach(double time, Interaction& inter)\n");
+    return;
+  }
+
+  VectorOfBlockVectors& DSlink = inter.linkToDSVariables();
+  std::vector<double> state;
+  jacobianState(*DSlink[NewtonEulerR::q0], state);
+
+  bool moved = (state.size() != _jacobianState.size());
+  for(unsigned int i = 0; !moved && i < state.size(); i++)
+    moved = (std::fabs(state[i] - _jacobianState[i]) > _jacobianUpdateTolerance);
+
+  if(moved)
+  {
+    NewtonEuler1DR::computeJach(time, inter);
+    _jacobianState.swap(state);
+  }
+  else
+  {
+    DEBUG_PRINT("contact did not move, jacobians are kept\n");
+    _skippedJacobianUpdates++;
+    computeJachlambda(time, inter);
+  }
+  DEBUG_END("NewtonEuler3DR::computeJach(double time, Interaction& inter)\n");
+}
@@ -29,6 +29,10 @@
  * The OSNSP is build using the matrix jachqT, that is computed from the point if contact pc1, pc2 and Nc.
  * Use this class consists in overload the method computeh, and children class has to set the menber pc1, pc2 and nc.
  *
+ * With setLazyJacobianUpdate(true, tol), the jacobians are kept from one call of computeJach to the next
+ * as long as the contact point, the normal and the positions of the dynamical systems did not move more
+ * than tol (in max norm) since their last computation. This saves the rebuilding of the contact frame for
+ * persistent contacts (e.g. resting stacks); the number of skipped updates is given by skippedJacobianUpdates().
  *
  */
 
@@ -43,8 +47,30 @@ private:
   void FC3DcomputeJachqTFromContacts(SP::SiconosVector q1);
   void FC3DcomputeJachqTFromContacts(SP::SiconosVector q1, SP::SiconosVector q2);
 
+  /** fill _rotationAbsoluteToContactFrame from the normal vector _Nc */
+  void contactFrame();
+
 protected:
 
+  /** true if the jacobians are only updated when the contact moved (see setLazyJacobianUpdate) */
+  bool _lazyJacobianUpdate = false;
+
+  /** tolerance for the lazy update of the jacobians */
+  double _jacobianUpdateTolerance = 0.0;
+
+  /** contact point, normal and positions of the ds (Pc1, Nc, q1, q2) at the last
+   * computation of the jacobians. Empty if they have not been computed yet.*/
+  std::vector<double> _jacobianState;
+
+  /** number of updates of the jacobians skipped in lazy mode */
+  unsigned int _skippedJacobianUpdates = 0;
+
+  /** fill state with Pc1, Nc and the positions in q0
+   * \param q0 the block vector to the dynamical system position
+   * \param[out] state the resulting vector
+   */
+  void jacobianState(const BlockVector& q0, std::vector<double>& state) const;
+
 public:
   NewtonEuler3DR(): NewtonEuler1DR() {}
 
@@ -65,6 +91,48 @@ public:
    */
   virtual void computeJachqT(Interaction& inter, SP::BlockVector q0);
 
+  /** compute all the H Jacobian, or keep the previous ones in lazy mode if the contact did not move.
+   *  \param time the current time
+   *  \param inter interaction that owns the relation
+   */
+  virtual void computeJach(double time, Interaction& inter);
+
+  /** set the lazy update mode of the jacobians
+   * \param flag true to update the jacobians only when the contact moved
+   * \param tol tolerance (max norm) on the displacement of the contact point, the normal
+   * and the positions of the dynamical systems
+   */
+  void setLazyJacobianUpdate(bool flag, double tol = 1e-10)
+  {
+    _lazyJacobianUpdate = flag;
+    _jacobianUpdateTolerance = tol;
+    _jacobianState.clear();
+  }
+
+  /** \return true if the jacobians are updated lazily */
+  inline bool lazyJacobianUpdate() const
+  {
+    return _lazyJacobianUpdate;
+  }
+
+  /** \return the tolerance for the lazy update of the jacobians */
+  inline double jacobianUpdateTolerance() const
+  {
+    return _jacobianUpdateTolerance;
+  }
+
+  /** \return the number of updates of the jacobians skipped in lazy mode */
+  inline unsigned int skippedJacobianUpdates() const
+  {
+    return _skippedJacobianUpdates;
+  }
+
+  /** reset the counter of skipped updates of the jacobians */
+  inline void resetSkippedJacobianUpdates()
+  {
+    _skippedJacobianUpdates = 0;
+  }
+
   ACCEPT_STD_VISITORS();
 };
 #endif // NEWTONEULERRELATIONFC3D_H
@@ -42,7 +42,11 @@ void NewtonEuler5DR::initialize(Interaction& inter)
   _jachq.reset(new SimpleMatrix(5, qSize));
 
   _rotationAbsoluteToContactFrame.reset(new SimpleMatrix(3, 3));
+  _rotationBodyToAbsoluteFrame.reset(new SimpleMatrix(3, 3));
+  _AUX1.reset(new SimpleMatrix(3, 3));
   _AUX2.reset(new SimpleMatrix(3, 3));
+  _NPG1.reset(new SimpleMatrix(3, 3));
+  _NPG2.reset(new SimpleMatrix(3, 3));
   //  _isContact=1;
   DEBUG_END("NewtonEuler5DR::NewtonEuler5DR::initialize(Interaction& inter)\n");
 
@@ -636,7 +636,7 @@ public:
   /** get all the values of the state vector q stored in memory
    *  \return a memory
    */
-  inline const SiconosMemory& qMemory()
+  inline SiconosMemory& qMemory()
   {
     return _qMemory;
   }
@@ -652,7 +652,7 @@ public:
   /** get all the values of the state vector twist stored in memory
    *  \return a memory
    */
-  inline const SiconosMemory& velocityMemory()
+  inline SiconosMemory& velocityMemory()
   {
     return _twistMemory;
   }
@@ -668,12 +668,12 @@ public:
    */
   void swapInMemory();
 
-  inline const SiconosMemory& forcesMemory()
+  inline SiconosMemory& forcesMemory()
   {
     return _forcesMemory;
   }
 
-  inline const SiconosMemory& dotqMemory()
+  inline SiconosMemory& dotqMemory()
   {
     return _dotqMemory;
   }
@@ -23,6 +23,7 @@
 #include "NewtonEulerR.hpp"
 #include "SiconosMatrixSetBlock.hpp"
 #include "SiconosAlgebraProd.hpp"
+#include "SiconosAlgebraFixedSize.hpp"
 #include "Interaction.hpp"
 #include "NewtonEulerDS.hpp"
 
@@ -155,7 +156,8 @@ void NewtonEulerR::computeOutput(double time, Interaction& inter, unsigned int d
       DEBUG_EXPR(_jachqT->display(););
       DEBUG_EXPR((*DSlink[NewtonEulerR::velocity]).display(););
 
-      prod(*_jachqT, *DSlink[NewtonEulerR::velocity], y);
+      if(!fixedSizeProd(*_jachqT, *DSlink[NewtonEulerR::velocity], y))
+        prod(*_jachqT, *DSlink[NewtonEulerR::velocity], y);
 
       DEBUG_EXPR(y.display(););
     }
@@ -194,14 +196,16 @@ void NewtonEulerR::computeInput(double time, Interaction& inter, unsigned int le
   if(level == 1)  /* \warning : we assume that ContactForce is given by lambda[level] */
   {
 
-    prod(lambda, *_jachqT, *_contactForce, true);
+    if(!fixedSizeProd(lambda, *_jachqT, *_contactForce, true))
+      prod(lambda, *_jachqT, *_contactForce, true);
 
     DEBUG_PRINT("NewtonEulerR::computeInput contact force :\n");
     DEBUG_EXPR(_contactForce->display(););
 
     /*data is a pointer of memory associated to a dynamical system*/
     /** false because it consists in doing a sum*/
-    prod(lambda, *_jachqT, *DSlink[NewtonEulerR::p0 + level], false);
+    if(!fixedSizeProd(lambda, *_jachqT, *DSlink[NewtonEulerR::p0 + level], false))
+      prod(lambda, *_jachqT, *DSlink[NewtonEulerR::p0 + level], false);
 
     DEBUG_EXPR(_jachqT->display(););
     DEBUG_EXPR(DSlink[NewtonEulerR::p0 + level]->display(););
@@ -215,13 +219,15 @@ void NewtonEulerR::computeInput(double time, Interaction& inter, unsigned int le
   else if(level == 2)  /* \warning : we assume that ContactForce is given by lambda[level] */
   {
 
-    prod(lambda, *_jachqT, *_contactForce, true);
+    if(!fixedSizeProd(lambda, *_jachqT, *_contactForce, true))
+      prod(lambda, *_jachqT, *_contactForce, true);
     DEBUG_EXPR(_contactForce->display(););
 
     /*data is a pointer of memory associated to a dynamical system*/
     /** false because it consists in doing a sum*/
     assert(DSlink[NewtonEulerR::p0 + level]);
-    prod(lambda, *_jachqT, *DSlink[NewtonEulerR::p0 + level], false);
+    if(!fixedSizeProd(lambda, *_jachqT, *DSlink[NewtonEulerR::p0 + level], false))
+      prod(lambda, *_jachqT, *DSlink[NewtonEulerR::p0 + level], false);
 
     DEBUG_EXPR(_jachqT->display(););
     DEBUG_EXPR(DSlink[NewtonEulerR::p0 + level]->display(););
@@ -248,6 +254,27 @@ void NewtonEulerR::computeJachqT(Interaction& inter, SP::BlockVector q0)
 
   unsigned int k = 0;
   unsigned int ySize = inter.dimension();
+
+  if(_jachq->num() == Siconos::DENSE && _jachqT->num() == Siconos::DENSE)
+  {
+    /* small dense blocks, use the fixed-size kernels */
+    const double* jachq = _jachq->getArray();
+    double* jachqT = _jachqT->getArray();
+    bool done = true;
+    for(unsigned int i =0 ; done && i < q0->numberOfBlocks()  ; i++)
+    {
+      computeT((q0->getAllVect())[i],_T);
+      done = fixedSizeGemm(ySize, 7, 6, jachq + ySize * 7 * i, ySize, _T->getArray(), 7,
+                           jachqT + ySize * 6 * i, ySize, true);
+    }
+    if(done)
+    {
+      DEBUG_EXPR(_jachqT->display());
+      DEBUG_END("NewtonEulerR::computeJachqT(Interaction& inter, SP::BlockVector q0) \n");
+      return;
+    }
+  }
+
   SP::SimpleMatrix auxBloc(new SimpleMatrix(ySize, 7));
   SP::SimpleMatrix auxBloc2(new SimpleMatrix(ySize, 6));
   Index dimIndex(2);
@@ -381,21 +381,23 @@ public:
 
   /** get all the values of the state vector q stored in memory.
    * note: not const due to SchatzmanPaoliOSI::initializeWorkVectorsForDS
+   * and SiconosCheckpoint::restore
    *  \return a memory
    */
-  virtual const SiconosMemory& qMemory() =0;
+  virtual SiconosMemory& qMemory() =0;
 
   /** get all the values of the state vector velocity stored in memory.
    * note: not const due to SchatzmanPaoliOSI::initializeWorkVectorsForDS
+   * and SiconosCheckpoint::restore
    *  \return a memory
    */
-  virtual const SiconosMemory& velocityMemory() =0;
+  virtual SiconosMemory& velocityMemory() =0;
 
 
   /** get forces in memory buff
    *  \return pointer on a SiconosMemory
    */
-  virtual  const SiconosMemory& forcesMemory() =0;
+  virtual  SiconosMemory& forcesMemory() =0;
 
   /** initialize the SiconosMemory objects with a positive size.
    *  \param size the size of the SiconosMemory. must be >= 0
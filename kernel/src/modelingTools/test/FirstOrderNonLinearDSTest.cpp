@@ -227,6 +227,36 @@ void FirstOrderNonLinearDSTest::testSetJacobianfxPtr()
   std::cout << "--> setJacobianfxPtr test ended with success." <<std::endl;
 }
 
+// jacobianfx by finite differences, with detected sparsity pattern
+void FirstOrderNonLinearDSTest::testComputeJacobianfxByFD()
+{
+  std::cout << "--> Test: computeJacobianfxByFD." <<std::endl;
+  SP::FirstOrderNonLinearDS ds1(new FirstOrderNonLinearDS(x0));
+  ds1->setComputeFFunction("TestPlugin", "computef");
+  ds1->setComputeJacobianfxByFD(true);
+  CPPUNIT_ASSERT_EQUAL_MESSAGE("testComputeJacobianfxByFD : ", ds1->jacobianfx() != nullptr, true);
+  double time = 2.;
+  // f = time * x, jacobianfx = time * I
+  SimpleMatrix Jref(3, 3);
+  Jref(0, 0) = time;
+  Jref(1, 1) = time;
+  Jref(2, 2) = time;
+
+  // dense: one evaluation per column
+  ds1->computeJacobianfx(time, ds1->x());
+  CPPUNIT_ASSERT_EQUAL_MESSAGE("testComputeJacobianfxByFD : ", ds1->jacobianfxFD()->lastEvaluationsNumber() == 3, true);
+  CPPUNIT_ASSERT_EQUAL_MESSAGE("testComputeJacobianfxByFD : ", (*ds1->jacobianfx() - Jref).normInf() < 1e-6, true);
+
+  // diagonal pattern: all columns perturbed at once
+  ds1->jacobianfxFD()->setAutoDetectPattern(true);
+  ds1->jacobianfx()->zero();
+  ds1->computeJacobianfx(time, ds1->x());
+  CPPUNIT_ASSERT_EQUAL_MESSAGE("testComputeJacobianfxByFD : ", ds1->jacobianfxFD()->numberOfGroups() == 1, true);
+  CPPUNIT_ASSERT_EQUAL_MESSAGE("testComputeJacobianfxByFD : ", ds1->jacobianfxFD()->lastEvaluationsNumber() == 1, true);
+  CPPUNIT_ASSERT_EQUAL_MESSAGE("testComputeJacobianfxByFD : ", (*ds1->jacobianfx() - Jref).normInf() < 1e-6, true);
+  std::cout << "--> computeJacobianfxByFD test ended with success." <<std::endl;
+}
+
 // init
 void FirstOrderNonLinearDSTest::testInitMemory()
 {
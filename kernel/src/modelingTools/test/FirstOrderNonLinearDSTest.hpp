@@ -46,6 +46,7 @@ private:
   CPPUNIT_TEST(testSetR);
   CPPUNIT_TEST(testSetRPtr);
   CPPUNIT_TEST(testSetJacobianfxPtr);
+  CPPUNIT_TEST(testComputeJacobianfxByFD);
   CPPUNIT_TEST(testInitMemory);
   CPPUNIT_TEST(testSwap);
 
@@ -63,6 +64,7 @@ private:
   void testSetR();
   void testSetRPtr();
   void testSetJacobianfxPtr();
+  void testComputeJacobianfxByFD();
   void testInitMemory();
   void testSwap();
 
@@ -16,6 +16,13 @@
  * limitations under the License.
 */
 #include "LagrangianScleronomousRTest.hpp"
+#include "BlockVector.hpp"
+#include "SimpleMatrix.hpp"
+#include "SSLH.hpp"
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
 
 
 #define CPPUNIT_ASSERT_NOT_EQUAL(message, alpha, omega)      \
@@ -41,3 +48,61 @@ void LagrangianScleronomousRTest::testBuildLagrangianScleronomousR2()
   std::cout << " data Constructor LagrangianScleronomousR ok" <<std::endl;
 }
 
+/* a relation with a plugged h and no plugin for its jacobian */
+class LagrangianScleronomousRWithoutJacobian : public LagrangianScleronomousR
+{
+public:
+  LagrangianScleronomousRWithoutJacobian(const std::string& pluginh)
+  {
+    setComputehFunction(SSLH::getPluginName(pluginh), SSLH::getPluginFunctionName(pluginh));
+  }
+};
+
+// jacobian of h by finite differences, compared with the plugged one,
+// with 1 and several threads
+void LagrangianScleronomousRTest::testComputeJachqByFD()
+{
+  SP::SiconosVector q1(new SiconosVector(3));
+  SP::SiconosVector q2(new SiconosVector(3));
+  for(unsigned int i = 0; i < 3; ++i)
+  {
+    (*q1)(i) = 0.1 * (i + 1);
+    (*q2)(i) = -0.2 * (i + 1);
+  }
+  BlockVector q(q1, q2);
+  BlockVector z(1, 1);
+
+  SP::LagrangianScleronomousR Rref(new LagrangianScleronomousR("TestPlugin:hScleroNL", "TestPlugin:G0ScleroNL"));
+  Rref->setJachqPtr(SP::SimpleMatrix(new SimpleMatrix(3, 6)));
+  Rref->computeJachq(q, z);
+
+  SP::LagrangianScleronomousR R(new LagrangianScleronomousRWithoutJacobian("TestPlugin:hScleroNL"));
+  R->setJachqPtr(SP::SimpleMatrix(new SimpleMatrix(3, 6)));
+  R->setComputeJachqByFD(true);
+
+  // dense (one group per column), then with the detected pattern (2 groups)
+  for(unsigned int withPattern = 0; withPattern < 2; ++withPattern)
+  {
+    R->jachqFD()->setAutoDetectPattern(withPattern);
+    R->jachqFD()->setParallel(false);
+    R->jachq()->zero();
+    R->computeJachq(q, z);
+    CPPUNIT_ASSERT_EQUAL_MESSAGE("testComputeJachqByFD : ", (*R->jachq() - *Rref->jachq()).normInf() < 1e-6, true);
+    SimpleMatrix J1(*R->jachq());
+
+#ifdef _OPENMP
+    int nThreads = omp_get_max_threads();
+    omp_set_num_threads(4);
+#endif
+    R->jachqFD()->setParallel(true);
+    R->jachq()->zero();
+    R->computeJachq(q, z);
+#ifdef _OPENMP
+    omp_set_num_threads(nThreads);
+#endif
+    CPPUNIT_ASSERT_EQUAL_MESSAGE("testComputeJachqByFD : ", R->jachqFD()->lastEvaluationsNumber() == (withPattern ? 2 : 6), true);
+    // same perturbations: the results do not depend on the number of threads
+    CPPUNIT_ASSERT_EQUAL_MESSAGE("testComputeJachqByFD : ", (*R->jachq() - J1).normInf() == 0., true);
+  }
+  std::cout << "--> computeJachqByFD test ended with success." <<std::endl;
+}
@@ -37,12 +37,14 @@ private:
   // tests to be done ...
 
   CPPUNIT_TEST(testBuildLagrangianScleronomousR2);
+  CPPUNIT_TEST(testComputeJachqByFD);
   CPPUNIT_TEST_SUITE_END();
 
   // \todo exception test
 
   void testBuildLagrangianScleronomousR0();
   void testBuildLagrangianScleronomousR2();
+  void testComputeJachqByFD();
 
 public:
   void setUp();
@@ -0,0 +1,154 @@
+/* Siconos is a program dedicated to modeling, simulation and control
+ * of non smooth dynamical systems.
+ *
+ * Copyright 2020 INRIA.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+*/
+#include "NewtonEuler3DRTest.hpp"
+#include "NewtonImpactFrictionNSL.hpp"
+#include "Interaction.hpp"
+#include "SimpleMatrix.hpp"
+
+#include <cmath>
+
+// test suite registration
+CPPUNIT_TEST_SUITE_REGISTRATION(NewtonEuler3DRTest);
+
+
+void NewtonEuler3DRTest::setUp()
+{
+  SP::SiconosVector q0(new SiconosVector(7));
+  q0->zero();
+  (*q0)(2) = 1.0;
+  (*q0)(3) = 1.0;
+
+  SP::SiconosVector velocity0(new SiconosVector(6));
+  velocity0->zero();
+
+  SP::SimpleMatrix inertia(new SimpleMatrix(3, 3));
+  inertia->eye();
+
+  ds.reset(new NewtonEulerDS(q0, velocity0, 1.0, inertia));
+}
+
+
+void NewtonEuler3DRTest::tearDown()
+{}
+
+// contact point below the body, normal rotated by angle around x
+static void setContact(NewtonEuler3DR& relation, double angle)
+{
+  relation.pc1()->setValue(0, 0.1);
+  relation.pc1()->setValue(1, 0.2);
+  relation.pc1()->setValue(2, 0.5);
+  relation.nc()->setValue(0, 0.0);
+  relation.nc()->setValue(1, sin(angle));
+  relation.nc()->setValue(2, cos(angle));
+}
+
+static double distance(const SimpleMatrix& A, const SimpleMatrix& B)
+{
+  double d = 0.;
+  for(unsigned int i = 0; i < A.size(0); i++)
+    for(unsigned int j = 0; j < A.size(1); j++)
+      d = std::max(d, std::fabs(A(i, j) - B(i, j)));
+  return d;
+}
+
+void NewtonEuler3DRTest::testLazyJacobianUpdate()
+{
+  std::cout << "--> Test: lazy jacobian update." <<std::endl;
+
+  SP::NonSmoothLaw nslaw(new NewtonImpactFrictionNSL(0.0, 0.0, 0.5, 3));
+
+  // the relation under test and a reference one, always computed
+  SP::NewtonEuler3DR relation(new NewtonEuler3DR());
+  SP::NewtonEuler3DR reference(new NewtonEuler3DR());
+  Interaction inter(nslaw, relation);
+  Interaction interRef(nslaw, reference);
+  // as done by Topology::link for a single body
+  inter.setDSSizes(ds->dimension());
+  interRef.setDSSizes(ds->dimension());
+  inter.initializeLinkToDsVariables(*ds, *ds);
+  interRef.initializeLinkToDsVariables(*ds, *ds);
+
+  const double tol = 1e-6;
+  relation->setLazyJacobianUpdate(true, tol);
+  CPPUNIT_ASSERT_EQUAL_MESSAGE("testLazyJacobianUpdate : ", relation->lazyJacobianUpdate(), true);
+
+  // first call: computed
+  double angle = 0.3;
+  setContact(*relation, angle);
+  setContact(*reference, angle);
+  relation->computeJach(0., inter);
+  reference->computeJach(0., interRef);
+  CPPUNIT_ASSERT_EQUAL_MESSAGE("testLazyJacobianUpdate : ", relation->skippedJacobianUpdates(), 0u);
+  CPPUNIT_ASSERT_EQUAL_MESSAGE("testLazyJacobianUpdate : ",
+                               distance(*relation->jachqT(), *reference->jachqT()) < 1e-14, true);
+  SimpleMatrix kept(*relation->jachqT());
+
+  // same contact: the jacobians are kept
+  relation->computeJach(0., inter);
+  CPPUNIT_ASSERT_EQUAL_MESSAGE("testLazyJacobianUpdate : ", relation->skippedJacobianUpdates(), 1u);
+  CPPUNIT_ASSERT_EQUAL_MESSAGE("testLazyJacobianUpdate : ",
+                               distance(*relation->jachqT(), kept) == 0., true);
+
+  // the normal moves below the tolerance: the previous jacobians are reused,
+  // although they are not exactly the ones of the new normal
+  angle += 0.1 * tol;
+  setContact(*relation, angle);
+  setContact(*reference, angle);
+  relation->computeJach(0., inter);
+  reference->computeJach(0., interRef);
+  CPPUNIT_ASSERT_EQUAL_MESSAGE("testLazyJacobianUpdate : ", relation->skippedJacobianUpdates(), 2u);
+  CPPUNIT_ASSERT_EQUAL_MESSAGE("testLazyJacobianUpdate : ",
+                               distance(*relation->jachqT(), kept) == 0., true);
+  double d = distance(*relation->jachqT(), *reference->jachqT());
+  CPPUNIT_ASSERT_EQUAL_MESSAGE("testLazyJacobianUpdate : ", d > 0. && d < tol, true);
+
+  // the normal moves above the tolerance: the jacobians are computed again
+  angle += 10. * tol;
+  setContact(*relation, angle);
+  setContact(*reference, angle);
+  relation->computeJach(0., inter);
+  reference->computeJach(0., interRef);
+  CPPUNIT_ASSERT_EQUAL_MESSAGE("testLazyJacobianUpdate : ", relation->skippedJacobianUpdates(), 2u);
+  CPPUNIT_ASSERT_EQUAL_MESSAGE("testLazyJacobianUpdate : ",
+                               distance(*relation->jachqT(), *reference->jachqT()) < 1e-14, true);
+  kept = *relation->jachqT();
+
+  // so do they when the body moves above the tolerance ...
+  (*ds->q())(0) += 10. * tol;
+  relation->computeJach(0., inter);
+  reference->computeJach(0., interRef);
+  CPPUNIT_ASSERT_EQUAL_MESSAGE("testLazyJacobianUpdate : ", relation->skippedJacobianUpdates(), 2u);
+  CPPUNIT_ASSERT_EQUAL_MESSAGE("testLazyJacobianUpdate : ",
+                               distance(*relation->jachqT(), *reference->jachqT()) < 1e-14, true);
+
+  // ... but not below it
+  (*ds->q())(1) += 0.1 * tol;
+  relation->computeJach(0., inter);
+  CPPUNIT_ASSERT_EQUAL_MESSAGE("testLazyJacobianUpdate : ", relation->skippedJacobianUpdates(), 3u);
+
+  relation->resetSkippedJacobianUpdates();
+  CPPUNIT_ASSERT_EQUAL_MESSAGE("testLazyJacobianUpdate : ", relation->skippedJacobianUpdates(), 0u);
+
+  // without the lazy mode, the jacobians are always computed
+  relation->setLazyJacobianUpdate(false);
+  relation->computeJach(0., inter);
+  relation->computeJach(0., inter);
+  CPPUNIT_ASSERT_EQUAL_MESSAGE("testLazyJacobianUpdate : ", relation->skippedJacobianUpdates(), 0u);
+
+  std::cout << "--> lazy jacobian update test ended with success." <<std::endl;
+}
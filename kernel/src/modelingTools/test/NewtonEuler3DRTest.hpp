@@ -0,0 +1,55 @@
+/* Siconos is a program dedicated to modeling, simulation and control
+ * of non smooth dynamical systems.
+ *
+ * Copyright 2020 INRIA.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+*/
+#ifndef __NewtonEuler3DRTest__
+#define __NewtonEuler3DRTest__
+
+#include <cppunit/extensions/HelperMacros.h>
+#include "NewtonEulerDS.hpp"
+#include "NewtonEuler3DR.hpp"
+
+class NewtonEuler3DRTest : public CppUnit::TestFixture
+{
+
+private:
+  /** serialization hooks
+  */
+  ACCEPT_SERIALIZATION(NewtonEuler3DRTest);
+
+  // Name of the tests suite
+  CPPUNIT_TEST_SUITE(NewtonEuler3DRTest);
+
+  // tests to be done ...
+
+  CPPUNIT_TEST(testLazyJacobianUpdate);
+
+  CPPUNIT_TEST_SUITE_END();
+
+  // jacobians kept below the tolerance, computed again above it
+  void testLazyJacobianUpdate();
+
+  // Members
+
+  SP::NewtonEulerDS ds;
+
+public:
+  void setUp();
+  void tearDown();
+
+};
+
+#endif
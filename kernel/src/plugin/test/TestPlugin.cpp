@@ -16,6 +16,7 @@
  * limitations under the License.
 */
 #include <cstdio>
+#include <cmath>
 
 #if defined(_MSC_VER)
 #define DLLEXPORT __declspec(dllexport)
@@ -144,6 +145,29 @@ extern "C" DLLEXPORT void G0Sclero(unsigned int sizeDS, double* q, unsigned int
   printf("Call of the function 'G0' of the test plugin.\n");
 }
 
+// y = (sin(q0) + q1^2, q2 q3, exp(q4) - q5), for the finite differences tests
+extern "C" DLLEXPORT void hScleroNL(unsigned int sizeDS, double* q, unsigned int sizeY, double* y, unsigned int sizeZ, double* z);
+extern "C" DLLEXPORT void hScleroNL(unsigned int sizeDS, double* q, unsigned int sizeY, double* y, unsigned int sizeZ, double* z)
+{
+  y[0] = sin(q[0]) + q[1] * q[1];
+  y[1] = q[2] * q[3];
+  y[2] = exp(q[4]) - q[5];
+}
+
+// jacobian of hScleroNL (column-major)
+extern "C" DLLEXPORT void G0ScleroNL(unsigned int sizeDS, double* q, unsigned int sizeY, double* G0, unsigned int sizeZ, double* z);
+extern "C" DLLEXPORT void G0ScleroNL(unsigned int sizeDS, double* q, unsigned int sizeY, double* G0, unsigned int sizeZ, double* z)
+{
+  for(unsigned int i = 0; i < sizeY * sizeDS; ++i)
+    G0[i] = 0.;
+  G0[0] = cos(q[0]);
+  G0[3] = 2. * q[1];
+  G0[7] = q[3];
+  G0[10] = q[2];
+  G0[14] = exp(q[4]);
+  G0[17] = -1.;
+}
+
 //==================  LagrangianRheonomousR ==================
 
 extern "C" DLLEXPORT void hRheo(unsigned int, double*, double, unsigned int, double*, unsigned int, double*);
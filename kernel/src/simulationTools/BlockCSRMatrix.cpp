@@ -20,6 +20,8 @@
 
 #include "BlockCSRMatrix.hpp"
 #include <boost/numeric/ublas/matrix_sparse.hpp>
+#include <algorithm>
+#include <map>
 #include "NonSmoothLaw.hpp"
 #include "Interaction.hpp"
 
@@ -80,7 +82,7 @@ BlockCSRMatrix::~BlockCSRMatrix()
 {}
 
 // Fill the SparseMat
-void BlockCSRMatrix::fill(InteractionsGraph& indexSet)
+void BlockCSRMatrix::fill(InteractionsGraph& indexSet, bool usePositions)
 {
   // ======> Aim: find inter1 and inter2 both in indexSets[level] and which
   // have common DynamicalSystems.  Then get the corresponding matrix
@@ -95,28 +97,49 @@ void BlockCSRMatrix::fill(InteractionsGraph& indexSet)
   _diagsize0->resize(_nr);
   _diagsize1->resize(_nr);
 
-  // === Loop through "active" Interactions (ie present in
+  // === Block row of each "active" Interaction (ie present in
   // indexSets[level]) ===
+  std::vector<InteractionsGraph::VDescriptor> vertices;
+  vertices.reserve(_nr);
+  InteractionsGraph::VIterator vi, viend;
+  for(std::tie(vi, viend) = indexSet.vertices();
+      vi != viend; ++vi)
+    vertices.push_back(*vi);
 
+  std::map<InteractionsGraph::VDescriptor, unsigned int> rank;
+  if(usePositions)
+  {
+    std::stable_sort(vertices.begin(), vertices.end(),
+                     [&indexSet](InteractionsGraph::VDescriptor a, InteractionsGraph::VDescriptor b)
+    {
+      return indexSet.properties(a).absolute_position < indexSet.properties(b).absolute_position;
+    });
+    for(unsigned int i = 0; i < vertices.size(); ++i)
+      rank[vertices[i]] = i;
+  }
+  auto blockIndex = [&](InteractionsGraph::VDescriptor vd) -> unsigned int
+  {
+    return usePositions ? rank[vd] : indexSet.index(vd);
+  };
+
+  // === Loop through "active" Interactions ===
 
   int sizeV = 0;
 
-  InteractionsGraph::VIterator vi, viend;
-  for(std::tie(vi, viend) = indexSet.vertices();
-      vi != viend; ++vi)
+  for(InteractionsGraph::VDescriptor vd : vertices)
   {
-    SP::Interaction inter = indexSet.bundle(*vi);
+    SP::Interaction inter = indexSet.bundle(vd);
 
     assert(inter->nonSmoothLaw()->size() > 0);
 
+    unsigned int i = blockIndex(vd);
     sizeV  += inter->nonSmoothLaw()->size();
-    (*_diagsize0)[indexSet.index(*vi)] = sizeV;
-    (*_diagsize1)[indexSet.index(*vi)] = sizeV;
-    assert((*_diagsize0)[indexSet.index(*vi)] > 0);
-    assert((*_diagsize1)[indexSet.index(*vi)] > 0);
+    (*_diagsize0)[i] = sizeV;
+    (*_diagsize1)[i] = sizeV;
+    assert((*_diagsize0)[i] > 0);
+    assert((*_diagsize1)[i] > 0);
 
-    (*_blockCSR)(indexSet.index(*vi), indexSet.index(*vi)) =
-      indexSet.properties(*vi).block->getArray();
+    (*_blockCSR)(i, i) = indexSet.properties(vd).block->getArray();
   }
 
   InteractionsGraph::EIterator ei, eiend;
@@ -137,16 +160,18 @@ void BlockCSRMatrix::fill(InteractionsGraph& indexSet)
     assert(indexSet.index(vd2) == indexSet.index(indexSet.descriptor(inter2)));
 
 
-    unsigned int pos = indexSet.index(vd1);
-    unsigned int col = indexSet.index(vd2);
+    unsigned int pos = blockIndex(vd1);
+    unsigned int col = blockIndex(vd2);
 
     assert(pos != col);
 
-    (*_blockCSR)(std::min(pos, col), std::max(pos, col)) =
-      indexSet.properties(*ei).upper_block->getArray();
+    // upper_block rows belong to the interaction with the lower graph index
+    if(indexSet.index(vd1) > indexSet.index(vd2))
+      std::swap(pos, col);
 
-    (*_blockCSR)(std::max(pos, col), std::min(pos, col)) =
-      indexSet.properties(*ei).lower_block->getArray();
+    (*_blockCSR)(pos, col) = indexSet.properties(*ei).upper_block->getArray();
+
+    (*_blockCSR)(col, pos) = indexSet.properties(*ei).lower_block->getArray();
   }
   DEBUG_EXPR(display(););
 }
@@ -208,8 +208,11 @@ public:
 
   /** fill the current class using an index set
    *  \param indexSet set of the active constraints
+   *  \param usePositions if true, blocks are ordered by increasing
+   *  absolute_position of the Interactions (as set by OSNSMatrix) rather
+   *  than by their index in indexSet
    */
-  void fill(InteractionsGraph& indexSet);
+  void fill(InteractionsGraph& indexSet, bool usePositions = false);
 
 
   /** fill the matrix with the Mass matrix 
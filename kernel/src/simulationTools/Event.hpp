@@ -191,6 +191,11 @@ public:
    */
   inline void setK(unsigned int newK) { _k = newK; };
 
+  /** Get the current step k
+   * \return the value of _k
+   */
+  inline unsigned int getK() const { return _k; };
+
   /** Set the TimeDiscretisation
    * \param td a TimeDiscretisation for this Event
    */
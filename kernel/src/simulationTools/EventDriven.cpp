@@ -187,6 +187,8 @@ void EventDriven::updateIndexSet(unsigned int i)
     }
   }
 
+  _isEventBufferUpToDate = false;
+
   DEBUG_PRINTF("update indexSets end : _indexSet0 size : %ld\n", _indexSet0->size());
   DEBUG_PRINTF("update IndexSets end : indexSet1 size : %ld\n", indexSet1->size());
   DEBUG_PRINTF("update IndexSets end : indexSet2 size : %ld\n", indexSet2->size());
@@ -229,6 +231,7 @@ void EventDriven::updateIndexSetsWithDoubleCondition()
       RuntimeException::selfThrow("EventDriven::updateIndexSetsWithDoubleCondition(), something is wrong for the LCP resolution.");
     DEBUG_PRINTF("End update with double condition %f\n", _TOL_ED);
   }
+  _isEventBufferUpToDate = false;
 }
 
 void EventDriven::initOSNS()
@@ -425,7 +428,8 @@ void EventDriven::computeJacobianfx(OneStepIntegrator& osi,
                                     integer *sizeOfX,
                                     doublereal *time,
                                     doublereal *x,
-                                    doublereal *jacob)
+                                    doublereal *jacob,
+                                    integer ml, integer mu, integer nrowpd)
 {
   assert(osi.getType() == OSI::LSODAROSI);
 
@@ -446,10 +450,14 @@ void EventDriven::computeJacobianfx(OneStepIntegrator& osi,
   lsodar.computeJacobianRhs(t, *_DSG0);
 
   // Save jacobianX values from dynamical system into current jacob
-  // (in-out parameter)
-
-  unsigned int i = 0;
-  unsigned pos = 0;
+  // (in-out parameter). The dynamical systems are not coupled by the
+  // smooth dynamics: the jacobian is block diagonal, and jacob has been
+  // set to zero by lsodar. Element (i,j) is stored in jacob[i + j*nrowpd]
+  // for a full jacobian, and in jacob[i - j + mu + j*nrowpd] for a
+  // banded one.
+  integer jt = lsodar.intData(8);
+  bool banded = (jt == 4 || jt == 5);
+  unsigned int pos = 0;
   DynamicalSystemsGraph::VIterator dsi, dsend;
   SP::DynamicalSystemsGraph osiDSGraph = lsodar.dynamicalSystemsGraph();
   for(std::tie(dsi, dsend) = osiDSGraph->vertices(); dsi != dsend; ++dsi)
@@ -458,27 +466,29 @@ void EventDriven::computeJacobianfx(OneStepIntegrator& osi,
 
     DynamicalSystem& ds = *(osiDSGraph->bundle(*dsi));
     Type::Siconos dsType = Type::value(ds);
-    if(dsType == Type::LagrangianDS || dsType == Type::LagrangianLinearTIDS)
+    if(!(dsType == Type::LagrangianDS || dsType == Type::LagrangianLinearTIDS
+         || dsType == Type::FirstOrderNonLinearDS || dsType == Type::FirstOrderLinearDS
+         || dsType == Type::FirstOrderLinearTIDS))
     {
-      LagrangianDS& lds = static_cast<LagrangianDS&>(ds);
-      BlockMatrix& jacotmp = static_cast<BlockMatrix&>(*lds.jacobianRhsx());
-      for(unsigned int j = 0; j < lds.n(); ++j)
-      {
-        for(unsigned int k = 0; k < lds.dimension(); ++k)
-          jacob[i++] = jacotmp(k, j);
-      }
+      RuntimeException::selfThrow("EventDriven::computeJacobianfx, type of DynamicalSystem not yet supported.");
     }
-    else if(dsType == Type::FirstOrderNonLinearDS || dsType == Type::FirstOrderLinearDS
-            || dsType == Type::FirstOrderLinearTIDS)
+    const SiconosMatrix& jacotmp = *ds.jacobianRhsx();
+    unsigned int n = ds.n();
+    if(banded && (int)n - 1 > std::min(ml, mu))
     {
-      SimpleMatrix& jacotmp = static_cast<SimpleMatrix&>(*(ds.jacobianRhsx())); // Pointer link !
-      pos += jacotmp.copyData(&jacob[pos]);
+      RuntimeException::selfThrow("EventDriven::computeJacobianfx, the bandwidth of the jacobian is smaller than the size of a dynamical system.");
     }
-    else
+    for(unsigned int j = 0; j < n; ++j)
     {
-      RuntimeException::selfThrow("EventDriven::computeJacobianfx, type of DynamicalSystem not yet supported.");
+      doublereal * column = jacob + (pos + j) * nrowpd;
+      if(banded)
+        column += mu - j;
+      for(unsigned int i = 0; i < n; ++i)
+        column[banded ? i : pos + i] = jacotmp.getValue(i, j);
     }
+    pos += n;
   }
+  assert((integer)pos == *sizeOfX);
 }
 
 unsigned int EventDriven::computeSizeOfg()
@@ -487,6 +497,34 @@ unsigned int EventDriven::computeSizeOfg()
 }
 
 
+void EventDriven::updateEventBuffer()
+{
+  SP::InteractionsGraph indexSet2 = _nsds->topology()->indexSet(2);
+  _eventData.clear();
+  _eventInIndexSet2.clear();
+  _eventInteraction.clear();
+  InteractionsGraph::VIterator ui, uiend;
+  for(std::tie(ui, uiend) = _indexSet0->vertices(); ui != uiend; ++ui)
+  {
+    Interaction& inter = *_indexSet0->bundle(*ui);
+    char inIndexSet2 = indexSet2->is_vertex(_indexSet0->bundle(*ui));
+    double* y = inter.y(0)->getArray();
+    double* ydot = inter.y(1)->getArray();
+    double* yddot = inter.y(2)->getArray();
+    double* lambda = inter.lambda(2)->getArray();
+    for(unsigned int i = 0; i < inter.nonSmoothLaw()->size(); ++i)
+    {
+      _eventData.push_back(y + i);
+      _eventData.push_back(ydot + i);
+      _eventData.push_back(yddot + i);
+      _eventData.push_back(lambda + i);
+      _eventInIndexSet2.push_back(inIndexSet2);
+      _eventInteraction.push_back(&inter);
+    }
+  }
+  _isEventBufferUpToDate = true;
+}
+
 void EventDriven::computeg(SP::OneStepIntegrator osi,
                            integer * sizeOfX, doublereal* time,
                            doublereal* x, integer * ng,
@@ -494,11 +532,6 @@ void EventDriven::computeg(SP::OneStepIntegrator osi,
 {
   assert(_nsds);
   assert(_nsds->topology());
-  InteractionsGraph::VIterator ui, uiend;
-  SP::Topology topo = _nsds->topology();
-  SP::InteractionsGraph indexSet2 = topo->indexSet(2);
-  unsigned int nsLawSize, k = 0 ;
-  SP::SiconosVector y, ydot, yddot, lambda;
   SP::LsodarOSI lsodar = std::static_pointer_cast<LsodarOSI>(osi);
   // Solve LCP at acceleration level to calculate the lambda[2] at Interaction of indexSet[2]
   lsodar->fillXWork(sizeOfX, x);
@@ -516,64 +549,36 @@ void EventDriven::computeg(SP::OneStepIntegrator osi,
      computef(osi, sizeOfX,time,x,xdottmp);
      free(xdottmp);
      */
-  // Update the output from level 0 to level 1
-  _nsds->updateOutput(t,0);
-  _nsds->updateOutput(t,1);
-  _nsds->updateOutput(t,2);
+  // Update the output from level 0 to level 2, in a single pass over the interactions
+  _nsds->updateOutput(t, 0, 2);
   //
-  for(std::tie(ui, uiend) = _indexSet0->vertices(); ui != uiend; ++ui)
+  if(!_isEventBufferUpToDate)
+    updateEventBuffer();
+  assert(_eventInIndexSet2.size() == (size_t)*ng);
+  const double tol = _TOL_ED;
+  double * const * data = _eventData.data();
+  const char * inIndexSet2 = _eventInIndexSet2.data();
+  const unsigned int nc = _eventInIndexSet2.size();
+  for(unsigned int k = 0; k < nc; ++k, data += 4)
   {
-    SP::Interaction inter = _indexSet0->bundle(*ui);
-    nsLawSize = inter->nonSmoothLaw()->size();
-    y = inter->y(0);   // output y at this Interaction
-    ydot = inter->y(1); // output of level 1 at this Interaction
-    yddot = inter->y(2);
-    lambda = inter->lambda(2); // input of level 2 at this Interaction
-    if(!(indexSet2->is_vertex(inter)))  // if Interaction is not in the indexSet[2]
+    const double y = *data[0];
+    const double ydot = *data[1];
+    const double yddot = *data[2];
+    const double lambda = *data[3];
+    if(!inIndexSet2[k])  // if Interaction is not in the indexSet[2]
     {
-      for(unsigned int i = 0; i < nsLawSize; ++i)
-      {
-        if((*y)(i) > _TOL_ED)
-        {
-          gOut[k] = (*y)(i);
-        }
-        else
-        {
-          if((*ydot)(i) > -_TOL_ED)
-          {
-            gOut[k] = 100 * _TOL_ED;
-          }
-          else
-          {
-            gOut[k] = (*y)(i);
-          }
-        }
-        k++;
-      }
+      if(y > tol || ydot <= -tol)
+        gOut[k] = y;
+      else
+        gOut[k] = 100 * tol;
     }
     else // If Interaction is in the indexSet[2]
     {
-      for(unsigned int i = 0; i < nsLawSize; ++i)
-      {
-        if((*lambda)(i) > _TOL_ED)
-        {
-          gOut[k] = (*lambda)(i); // g = lambda[2]
-        }
-        else
-        {
-          if((*yddot)(i) > _TOL_ED)
-          {
-            gOut[k] = (*lambda)(i);
-          }
-          else
-          {
-            gOut[k] = 100 * _TOL_ED;
-          }
-        }
-        k++;
-      }
+      if(lambda > tol || yddot > tol)
+        gOut[k] = lambda; // g = lambda[2]
+      else
+        gOut[k] = 100 * tol;
     }
-
   }
 }
 void EventDriven::updateImpactState()
@@ -626,6 +631,8 @@ void EventDriven::advanceToEvent()
 
   // Update interactions if a manager was provided
   updateInteractions();
+  // The index sets may have changed since the last step
+  _isEventBufferUpToDate = false;
 
   _tinit = _eventsManager->startingTime();
   _tend =  _eventsManager->nextTime();
@@ -653,6 +660,11 @@ void EventDriven::advanceToEvent()
     // with _tout= _tend
     if(fabs(_tend-_tinit) >= 10 * MACHINE_PREC)
     {
+      // keep y[1] at the beginning of the step for the localization of events
+      updateEventBuffer();
+      _eventStartYdot.resize(_eventInteraction.size());
+      for(unsigned int k = 0; k < _eventStartYdot.size(); ++k)
+        _eventStartYdot[k] = *_eventData[4 * k + 1];
       newtonSolve(_newtonTolerance, _newtonMaxIteration);
     }
     else
@@ -996,72 +1008,56 @@ void EventDriven::newtonSolve(double criterion, unsigned int maxStep)
 double EventDriven::detectEvents(bool updateIstate)
 {
   DEBUG_BEGIN("double EventDriven::detectEvents(bool updateIstate)\n")
+  if(!_isEventBufferUpToDate)
+    updateEventBuffer();
+  if(_eventInteraction.size() != _indexSet0->size())
+  {
+    RuntimeException::selfThrow("In EventDriven::detectEvents, the interaction size > 1 has not been implemented yet!!!");
+  }
+  double minResiduOutput = scanEvents(updateIstate, nullptr);
+  DEBUG_END("double EventDriven::detectEvents(bool updateIstate)\n")
+  return minResiduOutput;
+}
+
+double EventDriven::scanEvents(bool updateIstate, const std::vector<unsigned int>* constraints)
+{
   double _minResiduOutput = 0.0; // maximum of g_i with i running over all activated or deactivated contacts
-  // Loop over all interactions to detect whether some constraints are activated or deactivated
+  // Loop over the constraints to detect whether some of them are activated or deactivated
   bool _IsContactClosed = false;
   bool _IsContactOpened = false;
   bool _IsFirstTime = true;
-  InteractionsGraph::VIterator ui, uiend;
-  SP::SiconosVector y, ydot, lambda;
-  SP::Topology topo = _nsds->topology();
-  SP::InteractionsGraph indexSet2 = topo->indexSet(2);
-  for(std::tie(ui, uiend) = _indexSet0->vertices(); ui != uiend; ++ui)
+  unsigned int nc = constraints ? constraints->size() : _eventInIndexSet2.size();
+  for(unsigned int j = 0; j < nc; ++j)
   {
-    SP::Interaction inter = _indexSet0->bundle(*ui);
-    double nsLawSize = inter->nonSmoothLaw()->size();
-    if(nsLawSize != 1)
+    unsigned int k = constraints ? (*constraints)[j] : j;
+    double value;
+    if(!_eventInIndexSet2[k])  // if Interaction is not in the indexSet[2]
     {
-      RuntimeException::selfThrow("In EventDriven::detectEvents, the interaction size > 1 has not been implemented yet!!!");
-    }
-    y = inter->y(0);   // output y at this Interaction
-    ydot = inter->y(1); // output of level 1 at this Interaction
-    lambda = inter->lambda(2); // input of level 2 at this Interaction
-    if(!(indexSet2->is_vertex(inter)))  // if Interaction is not in the indexSet[2]
-    {
-      if((*y)(0) < _TOL_ED)  // gap at the current interaction <= 0
+      value = *_eventData[4 * k]; // output y
+      if(value < _TOL_ED)  // gap at the current interaction <= 0
       {
         _IsContactClosed = true;
       }
-
-      if(_IsFirstTime)
-      {
-        _minResiduOutput = (*y)(0);
-        _IsFirstTime = false;
-      }
-      else
-      {
-        if(_minResiduOutput > (*y)(0))
-        {
-          _minResiduOutput = (*y)(0);
-        }
-      }
     }
     else // If interaction is in the indexSet[2]
     {
-      if((*lambda)(0) < _TOL_ED)  // normal force at the current interaction <= 0
+      value = *_eventData[4 * k + 3]; // input lambda[2]
+      if(value < _TOL_ED)  // normal force at the current interaction <= 0
       {
         _IsContactOpened = true;
       }
-
-      if(_IsFirstTime)
-      {
-        _minResiduOutput = (*lambda)(0);
-        _IsFirstTime = false;
-      }
-      else
-      {
-        if(_minResiduOutput > (*lambda)(0))
-        {
-          _minResiduOutput = (*lambda)(0);
-        }
-      }
+    }
+    if(_IsFirstTime || _minResiduOutput > value)
+    {
+      _minResiduOutput = value;
+      _IsFirstTime = false;
     }
     //
     DEBUG_EXPR_WE(
       cout.precision(15);
-      cout << "Contact number: " << inter->number() <<endl;
-      cout << "Contact gap: " << (*y)(0) <<endl;
-      cout << "Contact force: " << (*lambda)(0) <<endl;
+      cout << "Contact number: " << _eventInteraction[k]->number() <<endl;
+      cout << "Contact gap: " << *_eventData[4 * k] <<endl;
+      cout << "Contact force: " << *_eventData[4 * k + 3] <<endl;
       cout << "Is contact is closed: " << _IsContactClosed <<endl;
       cout << "Is contact is opened: " << _IsContactOpened <<endl;
     );
@@ -1088,7 +1084,6 @@ double EventDriven::detectEvents(bool updateIstate)
     }
   }
   //
-  DEBUG_END("double EventDriven::detectEvents(bool updateIstate)\n")
   return  _minResiduOutput;
 }
 
@@ -1116,6 +1111,31 @@ void EventDriven::LocalizeFirstEvent()
   bool found = false;
   bool _IsupdateIstate = false;
   unsigned int _numIter = 0;
+  // Only the constraints that may vanish in [t_a, t_b] are checked: the
+  // ones whose function is not positive at t_b (it was at t_a), and the
+  // gaps whose derivative changed from negative to positive (a minimum of
+  // the gap lies in the interval). With _localizeEventsOnCandidates
+  // false, all the constraints are checked.
+  if(!_isEventBufferUpToDate)
+    updateEventBuffer();
+  std::vector<unsigned int> candidates;
+  std::vector<Interaction*> closingInteractions;
+  bool startYdotKnown = (_eventStartYdot.size() == _eventInteraction.size());
+  for(unsigned int k = 0; k < _eventInteraction.size(); ++k)
+  {
+    if(_eventInIndexSet2[k])
+    {
+      if(!_localizeEventsOnCandidates || *_eventData[4 * k + 3] < _TOL_ED)
+        candidates.push_back(k);
+    }
+    else if(!_localizeEventsOnCandidates || *_eventData[4 * k] < _TOL_ED || !startYdotKnown ||
+            (_eventStartYdot[k] < 0.0 && *_eventData[4 * k + 1] > 0.0))
+    {
+      candidates.push_back(k);
+      if(closingInteractions.empty() || closingInteractions.back() != _eventInteraction[k])
+        closingInteractions.push_back(_eventInteraction[k]);
+    }
+  }
   while(!found)
   {
     _numIter++;
@@ -1133,7 +1153,8 @@ void EventDriven::LocalizeFirstEvent()
     // If _istate = 3 or 5, i.e. some contacts are closed, we need to compute y[0] for all interactions
     if((_istate == 3) || (_istate == 5))  // some contacts are closed
     {
-      _nsds->updateOutput(t_i,0);
+      for(unsigned int j = 0; j < closingInteractions.size(); ++j)
+        closingInteractions[j]->computeOutput(t_i, 0);
     }
     // If _istate = 4 or 5, i.e. some contacts are detached, we need to solve LCP at the acceleration level to compute contact forces
     if((_istate == 4) || (_istate == 5))  // some contacts are opened
@@ -1144,7 +1165,7 @@ void EventDriven::LocalizeFirstEvent()
       }
     }
     // Check whether or not some events occur in the interval [t_a, t_i]
-    _minConstraint = detectEvents(_IsupdateIstate);
+    _minConstraint = scanEvents(_IsupdateIstate, &candidates);
     if(std::abs(_minConstraint) < _TOL_ED)  // first event is found
     {
       _tout = t_i;
@@ -1165,4 +1186,9 @@ void EventDriven::LocalizeFirstEvent()
       RuntimeException::selfThrow("In EventDriven::LocalizeFirstEvent, the numbner of iterations performed is too large!!!");
     }
   }
+  // the outputs of the other interactions at the time of the event
+  if((_istate == 3) || (_istate == 5))
+  {
+    _nsds->updateOutput(_tout, 0);
+  }
 }
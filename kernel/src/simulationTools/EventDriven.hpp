@@ -24,6 +24,8 @@
 #include "Simulation.hpp"
 #include "SiconosFwd.hpp"               // for OneStepIntegrator, etc
 
+#include <vector>
+
 /** Simulation based on event driven method, ie events detection (see theoretical manual for more details).
  *
  * WARNING: at the time only written for Lagrangian systems !!!
@@ -86,6 +88,43 @@ protected:
   /** store the graph of DynamicalSystems for performance reason (Lsodar)*/
   SP::DynamicalSystemsGraph _DSG0;
 
+  /** addresses of y[0], y[1], y[2] and lambda[2] for each scalar
+   * constraint of indexSet0 (4 consecutive entries per constraint),
+   * see updateEventBuffer(). The values themselves stay in the vectors of
+   * the Interactions: they are written in place by computeOutput and by
+   * the OSNS, and LocalizeFirstEvent updates only some of them, so a
+   * contiguous copy would have to be gathered again after each of these
+   * updates. */
+  std::vector<double*> _eventData;
+
+  /** for each scalar constraint, 1 if its Interaction is in indexSet2 */
+  std::vector<char> _eventInIndexSet2;
+
+  /** for each scalar constraint, its Interaction */
+  std::vector<Interaction*> _eventInteraction;
+
+  /** y[1] of each scalar constraint at the beginning of the time step */
+  std::vector<double> _eventStartYdot;
+
+  /** false if the event buffer must be built again (change of the index sets) */
+  bool _isEventBufferUpToDate = false;
+
+  /** if true, LocalizeFirstEvent bisects only on the constraints that
+   * may vanish during the step, otherwise on all of them */
+  bool _localizeEventsOnCandidates = true;
+
+  /** gather the addresses of the outputs and inputs used by the event
+   * functions of all the constraints of indexSet0
+   */
+  void updateEventBuffer();
+
+  /** scan the constraints of the event buffer for events
+   * \param updateIstate true if we need to update the flag _istate
+   * \param constraints the scanned constraints (indices in the buffer), all if null
+   * \return the minimum of the constraint functions over the scanned constraints
+   */
+  double scanEvents(bool updateIstate, const std::vector<unsigned int>* constraints);
+
 public:
   /** defaut constructor
    * \param nsds current nonsmooth dynamical system
@@ -176,6 +215,15 @@ public:
     _localizeEventMaxIter = maxIter;
   }
 
+  /** To restrict the localization of events to the constraints that may
+   * vanish during the step (the default), or to search on all of them
+   *\param onCandidates true to restrict the search
+   */
+  void setLocalizeEventsOnCandidates(bool onCandidates)
+  {
+    _localizeEventsOnCandidates = onCandidates;
+  }
+
   /** get the maximum number of Newton iteration
    *  \return unsigned int
    */
@@ -251,9 +299,13 @@ public:
    *  \param sizeOfX size of vector x
    *  \param time current time given by the integrator
    *  \param x state vector
-   *  \param jacob jacobian of f according to x
+   *  \param jacob jacobian of f according to x, full or banded (jt = 4 or 5) storage
+   *  \param ml lower half-bandwidth (banded storage)
+   *  \param mu upper half-bandwidth (banded storage)
+   *  \param nrowpd leading dimension of jacob
    */
-  void computeJacobianfx(OneStepIntegrator& osi, integer* sizeOfX, doublereal* time, doublereal* x,  doublereal* jacob);
+  void computeJacobianfx(OneStepIntegrator& osi, integer* sizeOfX, doublereal* time, doublereal* x,  doublereal* jacob,
+                         integer ml, integer mu, integer nrowpd);
 
   /** compute the size of constraint function g(x,t,...) for osi 
    * \return unsigned int 
@@ -285,6 +285,23 @@ public:
     return _td->currentTimeStep(_k);
   }
 
+  /** get the index of the current time instant
+   * \return the current index k
+   */
+  inline unsigned int getK() const
+  {
+    return _k;
+  }
+
+  /** set the index of the current time instant (to restore a
+   * checkpoint, use with care)
+   * \param k the new index
+   */
+  inline void setK(unsigned int k)
+  {
+    _k = k;
+  }
+
   /** get TimeDiscretisation
    * \return the TimeDiscretisation in use for the time integration
    */
@@ -68,10 +68,6 @@ void FrictionContact::initialize(SP::Simulation sim)
 
   // Connect to the right function according to dim. of the problem
 
-  // get topology
-  SP::Topology topology =
-    simulation()->nonSmoothDynamicalSystem()->topology();
-
   // Note that interactionBlocks is up to date since updateInteractionBlocks
   // has been called during OneStepNSProblem::initialize()
 
@@ -80,32 +76,22 @@ void FrictionContact::initialize(SP::Simulation sim)
                ->topology()->indexSet(0)->size();
   _mu->reserve(sizeMu);
 
-  // If the topology is TimeInvariant ie if M structure does not
-  // change during simulation:
-
-  if(topology->indexSet0()->size()>0)
-  {
-    // Get index set from Simulation
-    SP::InteractionsGraph indexSet =
-      simulation()->indexSet(indexSetLevel());
-    InteractionsGraph::VIterator ui, uiend;
-    for(std::tie(ui, uiend) = indexSet->vertices(); ui != uiend; ++ui)
-    {
-      _mu->push_back(std::static_pointer_cast<NewtonImpactFrictionNSL>
-                     (indexSet->bundle(*ui)->nonSmoothLaw())->mu());
-    }
-  }
+  // The coefficients are filled in updateMu(), at each call to compute,
+  // once the positions of the interactions in M are known.
 }
 
 void FrictionContact::updateMu()
 {
-  _mu->clear();
+  // mu follows the rows of M and q, which may not be the order of the
+  // vertices of the index set (see LinearOSNS::setMOrdering)
   SP::InteractionsGraph indexSet = simulation()->indexSet(indexSetLevel());
+  _mu->resize(indexSet->size());
   InteractionsGraph::VIterator ui, uiend;
   for(std::tie(ui, uiend) = indexSet->vertices(); ui != uiend; ++ui)
   {
-    _mu->push_back(std::static_pointer_cast<NewtonImpactFrictionNSL>
-                   (indexSet->bundle(*ui)->nonSmoothLaw())->mu());
+    unsigned int pos = indexSet->properties(*ui).absolute_position;
+    (*_mu)[pos / _contactProblemDim] = std::static_pointer_cast<NewtonImpactFrictionNSL>
+                                       (indexSet->bundle(*ui)->nonSmoothLaw())->mu();
   }
 }
 
@@ -138,10 +124,27 @@ int FrictionContact::solve(SP::FrictionContactProblem problem)
     problem = frictionContactProblem();
   }
 
-  return (*_frictionContact_driver)(&*problem,
-                                    &*_z->getArray(),
-                                    &*_w->getArray(),
-                                    &*_numerics_solver_options);
+  if(_trace)
+    frictionContactTrace_record(&*_trace, &*problem, &*_z->getArray(), &*_w->getArray());
+
+  int info = (*_frictionContact_driver)(&*problem,
+                                        &*_z->getArray(),
+                                        &*_w->getArray(),
+                                        &*_numerics_solver_options);
+  if(_trace)
+    frictionContactTrace_record_result(&*_trace, info, &*_numerics_solver_options);
+  return info;
+}
+
+void FrictionContact::setTraceFile(const std::string& filename, unsigned int chunkSize)
+{
+  _trace.reset();
+  if(filename.empty())
+    return;
+  FrictionContactTrace* trace = frictionContactTrace_open_write(filename.c_str(), chunkSize);
+  if(!trace)
+    RuntimeException::selfThrow("FrictionContact::setTraceFile, unable to open " + filename);
+  _trace.reset(trace, frictionContactTrace_close);
 }
 
 
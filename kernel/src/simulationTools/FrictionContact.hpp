@@ -24,10 +24,12 @@
 #include "LinearOSNS.hpp"
 
 #include <FrictionContactProblem.h>
+#include <FrictionContactTrace.h>
 #include <Friction_cst.h>
 /** Pointer to function of the type used for drivers for FrictionContact problems in Numerics */
 typedef int (*Driver)(FrictionContactProblem*, double*, double*, SolverOptions*);
 TYPEDEF_SPTR(FrictionContactProblem)
+TYPEDEF_SPTR(FrictionContactTrace)
 
 /** Formalization and Resolution of a Friction-Contact Problem
 
@@ -84,6 +86,10 @@ protected:
 
   FrictionContactProblem _numerics_problem;
 
+  /** trace of the solved problems, if any. Not serialized (open
+   * file): setTraceFile() must be called again after a restart */
+  SP::FrictionContactTrace _trace;
+
 public:
 
   /** constructor (solver id and dimension)
@@ -180,6 +186,15 @@ public:
    */
   int solve(SP::FrictionContactProblem problem = SP::FrictionContactProblem());
 
+  /** record the problems given to the solver, their initial guesses and
+   * the solver statistics in a compact trace file (see
+   * FrictionContactTrace.h in numerics), to be replayed with
+   * frictionContactTrace_replay().
+   * \param filename name of the trace file, the recording stops if empty
+   * \param chunkSize number of records written at once (0 for the default)
+   */
+  void setTraceFile(const std::string& filename, unsigned int chunkSize = 0);
+
   /** Compute the unknown reaction and velocity and update the Interaction (y and lambda )
    *  \param time the current time
    *  \return int information about the solver convergence (0: ok, >0 problem, see Numerics documentation)
@@ -71,69 +71,82 @@ void GenericMechanical::initialize(SP::Simulation sim)
   LinearOSNS::initialize(sim);
 }
 
+void GenericMechanical::addProblem(Interaction& inter)
+{
+  DEBUG_PRINT("GenericMechanical::addProblem: add problem of type ");
+
+  int size = inter.nonSmoothLaw()->size();
+  if(Type::value(*(inter.nonSmoothLaw()))
+      == Type::EqualityConditionNSL)
+  {
+    gmp_add(_pnumerics_GMP, SICONOS_NUMERICS_PROBLEM_EQUALITY, size);
+    DEBUG_PRINT("Type::EqualityConditionNSL\n");
+    //pAux->size= inter.nonSmoothLaw()->size();
+  }
+  else if(Type::value(*(inter.nonSmoothLaw()))
+          == Type::NewtonImpactNSL)
+  {
+    gmp_add(_pnumerics_GMP, SICONOS_NUMERICS_PROBLEM_LCP, size);
+    DEBUG_PRINT(" Type::NewtonImpactNSL\n");
+  }
+  else if(Type::value(*(inter.nonSmoothLaw()))
+          == Type::RelayNSL)
+  {
+    RelayProblem * pAux =
+      (RelayProblem *)gmp_add(_pnumerics_GMP, SICONOS_NUMERICS_PROBLEM_RELAY, size);
+    SP::RelayNSL nsLaw =
+      std::static_pointer_cast<RelayNSL> (inter.nonSmoothLaw());
+    for(int i=0; i<size; i++)
+    {
+      pAux->lb[i] = nsLaw->lb();
+      pAux->ub[i] = nsLaw->ub();
+    }
+    DEBUG_PRINT(" Type::RelayNSL\n");
+  }
+  else if(Type::value(*(inter.nonSmoothLaw()))
+          == Type::NewtonImpactFrictionNSL)
+  {
+    FrictionContactProblem * pAux =
+      (FrictionContactProblem *)gmp_add(_pnumerics_GMP, SICONOS_NUMERICS_PROBLEM_FC3D, size);
+    SP::NewtonImpactFrictionNSL nsLaw =
+      std::static_pointer_cast<NewtonImpactFrictionNSL> (inter.nonSmoothLaw());
+    pAux->dimension = 3;
+    pAux->numberOfContacts = 1;
+    *(pAux->mu) = nsLaw->mu();
+
+    DEBUG_PRINT(" Type::NewtonImpactFrictionNSL\n");
+  }
+  else
+  {
+    RuntimeException::selfThrow("GenericMechanical::addProblem- not yet implemented for that NSLAW type");
+  }
+}
+
 void GenericMechanical::computeDiagonalInteractionBlock(const InteractionsGraph::VDescriptor& vd)
 {
   SP::InteractionsGraph indexSet = simulation()->indexSet(indexSetLevel());
   //bool isTimeInvariant = simulation()->nonSmoothDynamicalSystem()->topology()->isTimeInvariant();
 
   /*Build the corresponding numerics problems*/
+  // with another ordering, the problems are added in preCompute,
+  // once the positions of the interactions in M are known
+  if(!_hasBeenUpdated && _numericsMatrixOrdering == OSNS_ORDERING_GRAPH)
+    addProblem(*indexSet->bundle(vd));
 
-  SP::DynamicalSystem DS1 = indexSet->properties(vd).source;
-  SP::DynamicalSystem DS2 = indexSet->properties(vd).target;
-  SP::Interaction inter = indexSet->bundle(vd);
-
-  DEBUG_PRINT("GenericMechanical::computeInteractionBlock: add problem of type ");
+  LinearOSNS::computeDiagonalInteractionBlock(vd);
+}
 
-  if(!_hasBeenUpdated)
+bool GenericMechanical::preCompute(double time)
+{
+  bool res = LinearOSNS::preCompute(time);
+  if(res && !_hasBeenUpdated && _numericsMatrixOrdering != OSNS_ORDERING_GRAPH)
   {
-    int size = inter->nonSmoothLaw()->size();
-    if(Type::value(*(inter->nonSmoothLaw()))
-        == Type::EqualityConditionNSL)
-    {
-      gmp_add(_pnumerics_GMP, SICONOS_NUMERICS_PROBLEM_EQUALITY, size);
-      DEBUG_PRINT("Type::EqualityConditionNSL\n");
-      //pAux->size= inter->nonSmoothLaw()->size();
-    }
-    else if(Type::value(*(inter->nonSmoothLaw()))
-            == Type::NewtonImpactNSL)
-    {
-      gmp_add(_pnumerics_GMP, SICONOS_NUMERICS_PROBLEM_LCP, size);
-      DEBUG_PRINT(" Type::NewtonImpactNSL\n");
-    }
-    else if(Type::value(*(inter->nonSmoothLaw()))
-            == Type::RelayNSL)
-    {
-      RelayProblem * pAux =
-        (RelayProblem *)gmp_add(_pnumerics_GMP, SICONOS_NUMERICS_PROBLEM_RELAY, size);
-      SP::RelayNSL nsLaw =
-        std::static_pointer_cast<RelayNSL> (inter->nonSmoothLaw());
-      for(int i=0; i<size; i++)
-      {
-        pAux->lb[i] = nsLaw->lb();
-        pAux->ub[i] = nsLaw->ub();
-      }
-      DEBUG_PRINT(" Type::RelayNSL\n");
-    }
-    else if(Type::value(*(inter->nonSmoothLaw()))
-            == Type::NewtonImpactFrictionNSL)
-    {
-      FrictionContactProblem * pAux =
-        (FrictionContactProblem *)gmp_add(_pnumerics_GMP, SICONOS_NUMERICS_PROBLEM_FC3D, size);
-      SP::NewtonImpactFrictionNSL nsLaw =
-        std::static_pointer_cast<NewtonImpactFrictionNSL> (inter->nonSmoothLaw());
-      pAux->dimension = 3;
-      pAux->numberOfContacts = 1;
-      *(pAux->mu) = nsLaw->mu();
-
-      DEBUG_PRINT(" Type::NewtonImpactFrictionNSL\n");
-    }
-    else
-    {
-      RuntimeException::selfThrow("GenericMechanical::computeDiagonalInteractionBlock- not yet implemented for that NSLAW type");
-    }
+    // the list of problems must follow the rows of M
+    InteractionsGraph& indexSet = *simulation()->indexSet(indexSetLevel());
+    for(InteractionsGraph::VDescriptor vd : verticesInMOrder(indexSet))
+      addProblem(*indexSet.bundle(vd));
   }
-
-  LinearOSNS::computeDiagonalInteractionBlock(vd);
+  return res;
 }
 
 void GenericMechanical::computeInteractionBlock(const InteractionsGraph::EDescriptor& ed)
@@ -49,6 +49,11 @@ protected:
 
   GenericMechanicalProblem * _pnumerics_GMP;
 
+  /** add to the numerics problem the sub-problem of an interaction
+   * \param inter the interaction
+   */
+  void addProblem(Interaction& inter);
+
 public:
   
   /** constructor from solver id
@@ -95,6 +100,12 @@ public:
    */
   virtual void computeDiagonalInteractionBlock(const InteractionsGraph::VDescriptor& vd);
 
+  /** Pre compute
+   * \param time current time
+   * \return bool
+   */
+  virtual bool preCompute(double time);
+
   /** print the data to the screen */
   void display() const;
   
@@ -28,6 +28,7 @@
 #include "NewtonEulerDS.hpp"
 #include "NewtonImpactNSL.hpp"
 #include "OSNSMatrix.hpp"
+#include "SiconosAlgebraProd.hpp"
 
 #include "TypeName.hpp"
 
@@ -40,6 +41,105 @@
 // #define DEBUG_MESSAGES
 #include "debug.h"
 
+// Blocks of M and H used by the matrix-free operator.
+class GlobalFrictionContactMatrixFreeData
+{
+public:
+  struct DSBlock
+  {
+    SP::SiconosMatrix W;   // iteration matrix of the DS
+    SP::SimpleMatrix LU;   // copy of W, factorized at the first solve
+    unsigned int pos;
+    SP::SiconosVector x, y; // work vectors
+  };
+  struct InteractionBlock
+  {
+    unsigned int pos;
+    unsigned int nb; // 1 or 2 (number of distinct ds)
+    unsigned int dsPos[2];
+    SP::SimpleMatrix Ht[2]; // block of H^T (3 x ds size)
+  };
+  std::vector<DSBlock> ds;
+  std::vector<InteractionBlock> inter;
+};
+
+// y = alpha M x + beta y
+static void GFC_matrixFree_M_gemv(void* data, double alpha, const double* x, double beta, double* y)
+{
+  GlobalFrictionContactMatrixFreeData& d = *static_cast<GlobalFrictionContactMatrixFreeData*>(data);
+  for(GlobalFrictionContactMatrixFreeData::DSBlock& b : d.ds)
+  {
+    unsigned int n = b.x->size();
+    for(unsigned int i = 0; i < n; ++i)
+      b.x->setValue(i, x[b.pos + i]);
+    prod(*b.W, *b.x, *b.y, true);
+    for(unsigned int i = 0; i < n; ++i)
+      y[b.pos + i] = alpha * b.y->getValue(i) + (beta == 0.0 ? 0.0 : beta * y[b.pos + i]);
+  }
+}
+
+// x <- M^{-1} x
+static int GFC_matrixFree_M_solve(void* data, double* x)
+{
+  GlobalFrictionContactMatrixFreeData& d = *static_cast<GlobalFrictionContactMatrixFreeData*>(data);
+  for(GlobalFrictionContactMatrixFreeData::DSBlock& b : d.ds)
+  {
+    unsigned int n = b.x->size();
+    for(unsigned int i = 0; i < n; ++i)
+      b.x->setValue(i, x[b.pos + i]);
+    b.LU->PLUForwardBackwardInPlace(*b.x);
+    for(unsigned int i = 0; i < n; ++i)
+      x[b.pos + i] = b.x->getValue(i);
+  }
+  return 0;
+}
+
+// y = alpha H x + beta y (y is a global vector)
+static void GFC_matrixFree_H_gemv(void* data, double alpha, const double* x, double beta, double* y)
+{
+  GlobalFrictionContactMatrixFreeData& d = *static_cast<GlobalFrictionContactMatrixFreeData*>(data);
+  for(GlobalFrictionContactMatrixFreeData::DSBlock& b : d.ds)
+  {
+    unsigned int n = b.x->size();
+    for(unsigned int i = 0; i < n; ++i)
+      y[b.pos + i] = (beta == 0.0 ? 0.0 : beta * y[b.pos + i]);
+  }
+  for(GlobalFrictionContactMatrixFreeData::InteractionBlock& b : d.inter)
+  {
+    for(unsigned int k = 0; k < b.nb; ++k)
+    {
+      const SimpleMatrix& Ht = *b.Ht[k];
+      for(unsigned int j = 0; j < Ht.size(1); ++j)
+      {
+        double yj = 0.0;
+        for(unsigned int i = 0; i < Ht.size(0); ++i)
+          yj += Ht(i, j) * x[b.pos + i];
+        y[b.dsPos[k] + j] += alpha * yj;
+      }
+    }
+  }
+}
+
+// y = alpha H^T x + beta y (y is a local vector)
+static void GFC_matrixFree_Ht_gemv(void* data, double alpha, const double* x, double beta, double* y)
+{
+  GlobalFrictionContactMatrixFreeData& d = *static_cast<GlobalFrictionContactMatrixFreeData*>(data);
+  for(GlobalFrictionContactMatrixFreeData::InteractionBlock& b : d.inter)
+  {
+    for(unsigned int i = 0; i < b.Ht[0]->size(0); ++i)
+    {
+      double yi = 0.0;
+      for(unsigned int k = 0; k < b.nb; ++k)
+      {
+        const SimpleMatrix& Ht = *b.Ht[k];
+        for(unsigned int j = 0; j < Ht.size(1); ++j)
+          yi += Ht(i, j) * x[b.dsPos[k] + j];
+      }
+      y[b.pos + i] = alpha * yi + (beta == 0.0 ? 0.0 : beta * y[b.pos + i]);
+    }
+  }
+}
+
 // Constructor from solver id - Uses delegated constructor
 GlobalFrictionContact::GlobalFrictionContact(int dimPb, const int numericsSolverId):
   GlobalFrictionContact(dimPb, SP::SolverOptions(solver_options_create(numericsSolverId),
@@ -58,6 +158,78 @@ GlobalFrictionContact::GlobalFrictionContact(int dimPb, SP::SolverOptions option
   _numericsMatrixStorageType = NM_SPARSE;
 }
 
+void GlobalFrictionContact::setMatrixFree(bool flag)
+{
+  _matrixFree = flag;
+  // M and H (or the operator) must be rebuilt
+  _hasBeenUpdated = false;
+}
+
+void GlobalFrictionContact::updateMatrixFreeOperator(DynamicalSystemsGraph& DSG, InteractionsGraph& indexSet)
+{
+  DEBUG_BEGIN("GlobalFrictionContact::updateMatrixFreeOperator(...)\n");
+  if(!_matrixFreeData)
+    _matrixFreeData.reset(new GlobalFrictionContactMatrixFreeData());
+  GlobalFrictionContactMatrixFreeData& d = *_matrixFreeData;
+
+  // DS blocks, in the same order as OSNSMatrix::fillM
+  d.ds.clear();
+  unsigned int dim = 0;
+  DynamicalSystemsGraph::VIterator dsi, dsend;
+  for(std::tie(dsi, dsend) = DSG.vertices(); dsi != dsend; ++dsi)
+  {
+    GlobalFrictionContactMatrixFreeData::DSBlock b;
+    b.W = DSG.properties(*dsi).W;
+    b.LU.reset(new SimpleMatrix(*b.W));
+    b.pos = dim;
+    unsigned int size = DSG.bundle(*dsi)->dimension();
+    b.x.reset(new SiconosVector(size));
+    b.y.reset(new SiconosVector(size));
+    DSG.properties(*dsi).absolute_position = dim;
+    dim += size;
+    d.ds.push_back(b);
+  }
+  _sizeGlobalOutput = dim;
+
+  // Interaction blocks, in the same order as OSNSMatrix::fillH
+  d.inter.clear();
+  unsigned int pos = 0;
+  InteractionsGraph::VIterator ui, uiend;
+  for(std::tie(ui, uiend) = indexSet.vertices(); ui != uiend; ++ui)
+  {
+    Interaction& inter = *indexSet.bundle(*ui);
+    indexSet.properties(*ui).absolute_position = pos;
+
+    GlobalFrictionContactMatrixFreeData::InteractionBlock b;
+    b.pos = pos;
+    b.nb = 0;
+    SP::DynamicalSystem ds1 = indexSet.properties(*ui).source;
+    SP::DynamicalSystem ds2 = indexSet.properties(*ui).target;
+    size_t posBlock = indexSet.properties(*ui).source_pos;
+    size_t pos2 = indexSet.properties(*ui).target_pos;
+    bool endl = false;
+    for(SP::DynamicalSystem ds = ds1; !endl; ds = ds2, posBlock = pos2)
+    {
+      endl = (ds == ds2);
+      b.Ht[b.nb].reset(new SimpleMatrix(_contactProblemDim, ds->dimension()));
+      inter.getLeftInteractionBlockForDS(posBlock, b.Ht[b.nb]);
+      b.dsPos[b.nb] = DSG.properties(DSG.descriptor(ds)).absolute_position;
+      b.nb++;
+    }
+    pos += _contactProblemDim;
+    d.inter.push_back(b);
+  }
+  _sizeOutput = pos;
+
+  _numerics_operator.n = _sizeGlobalOutput;
+  _numerics_operator.data = _matrixFreeData.get();
+  _numerics_operator.M_gemv = &GFC_matrixFree_M_gemv;
+  _numerics_operator.M_solve = &GFC_matrixFree_M_solve;
+  _numerics_operator.H_gemv = &GFC_matrixFree_H_gemv;
+  _numerics_operator.Ht_gemv = &GFC_matrixFree_Ht_gemv;
+  DEBUG_END("GlobalFrictionContact::updateMatrixFreeOperator(...)\n");
+}
+
 
 void GlobalFrictionContact::initVectorsMemory()
 {
@@ -84,6 +256,10 @@ void GlobalFrictionContact::initVectorsMemory()
 
 void GlobalFrictionContact::initOSNSMatrix()
 {
+  // M and H are not assembled in matrix-free mode, see preCompute
+  if(_matrixFree)
+    return;
+
   // Default size for M = _maxSize
   if(!_M)
   {
@@ -177,8 +353,18 @@ void GlobalFrictionContact::initialize(SP::Simulation sim)
 SP::GlobalFrictionContactProblem GlobalFrictionContact::globalFrictionContactProblem()
 {
   SP::GlobalFrictionContactProblem numerics_problem(globalFrictionContactProblem_new());
-  numerics_problem->M = &*_M->numericsMatrix();
-  numerics_problem->H = &*_H->numericsMatrix();
+  if(_matrixFree)
+  {
+    numerics_problem->M = nullptr;
+    numerics_problem->H = nullptr;
+    numerics_problem->op = &_numerics_operator;
+  }
+  else
+  {
+    numerics_problem->M = &*_M->numericsMatrix();
+    numerics_problem->H = &*_H->numericsMatrix();
+    numerics_problem->op = nullptr;
+  }
   numerics_problem->q = _q->getArray();
   numerics_problem->b = _b->getArray();
   numerics_problem->numberOfContacts = _sizeOutput / _contactProblemDim;
@@ -190,8 +376,18 @@ SP::GlobalFrictionContactProblem GlobalFrictionContact::globalFrictionContactPro
 GlobalFrictionContactProblem *GlobalFrictionContact::globalFrictionContactProblemPtr()
 {
   GlobalFrictionContactProblem *numerics_problem = &_numerics_problem;
-  numerics_problem->M = &*_M->numericsMatrix();
-  numerics_problem->H = &*_H->numericsMatrix();
+  if(_matrixFree)
+  {
+    numerics_problem->M = nullptr;
+    numerics_problem->H = nullptr;
+    numerics_problem->op = &_numerics_operator;
+  }
+  else
+  {
+    numerics_problem->M = &*_M->numericsMatrix();
+    numerics_problem->H = &*_H->numericsMatrix();
+    numerics_problem->op = nullptr;
+  }
   numerics_problem->q = _q->getArray();
   numerics_problem->b = _b->getArray();
   numerics_problem->numberOfContacts = _sizeOutput / _contactProblemDim;
@@ -252,10 +448,20 @@ bool GlobalFrictionContact::preCompute(double time)
     size_t sizeM = 0;
 
 
-    // fill _M
-    _M->fillM(DSG0);
-    sizeM = _M->size();
-    _sizeGlobalOutput = sizeM;
+    if(_matrixFree)
+    {
+      updateMatrixFreeOperator(DSG0, indexSet);
+      sizeM = _sizeGlobalOutput;
+    }
+    else
+    {
+      // allocated here if the matrix-free mode has been left after initialize
+      initOSNSMatrix();
+      // fill _M
+      _M->fillM(DSG0);
+      sizeM = _M->size();
+      _sizeGlobalOutput = sizeM;
+    }
     DEBUG_PRINTF("sizeM = %lu \n", sizeM);
 
 
@@ -300,11 +506,14 @@ bool GlobalFrictionContact::preCompute(double time)
     /************************************/
 
 
-    // fill H
-    _H->fillH(DSG0, indexSet);
-    DEBUG_EXPR(NM_display(_H->numericsMatrix().get()););
+    if(!_matrixFree)
+    {
+      // fill H
+      _H->fillH(DSG0, indexSet);
+      DEBUG_EXPR(NM_display(_H->numericsMatrix().get()););
 
-    _sizeOutput =_H->sizeColumn();
+      _sizeOutput =_H->sizeColumn();
+    }
     DEBUG_PRINTF("_sizeOutput = %i\n ", _sizeOutput);
 
 
@@ -480,7 +689,9 @@ void GlobalFrictionContact::display() const
   std::cout << " - Matrix M  : " <<std::endl;
   // if (_M) _M->display();
   // else std::cout << "-> nullptr" <<std::endl;
-  NumericsMatrix* M_NM = _M->numericsMatrix().get();
+  if(_matrixFree)
+    std::cout << "-> not assembled (matrix-free mode)" <<std::endl;
+  NumericsMatrix* M_NM = (_matrixFree || !_M) ? nullptr : _M->numericsMatrix().get();
   if(M_NM)
   {
     NM_display(M_NM);
@@ -488,7 +699,9 @@ void GlobalFrictionContact::display() const
   std::cout << " - Matrix H : " <<std::endl;
   // if (_H) _H->display();
   // else std::cout << "-> nullptr" <<std::endl;
-  NumericsMatrix* H_NM = _H->numericsMatrix().get();
+  if(_matrixFree)
+    std::cout << "-> not assembled (matrix-free mode)" <<std::endl;
+  NumericsMatrix* H_NM = (_matrixFree || !_H) ? nullptr : _H->numericsMatrix().get();
   if(H_NM)
   {
     NM_display(H_NM);
@@ -25,11 +25,13 @@
 #include "SiconosVector.hpp"
 #include "SimpleMatrix.hpp"
 #include "GlobalFrictionContactProblem.h"
+#include "GlobalFrictionContactOperator.h"
 #include "Friction_cst.h"
 
 /** Pointer to function of the type used for drivers for GlobalFrictionContact problems in Numerics */
 typedef int (*GFC3D_Driver)(GlobalFrictionContactProblem*, double*, double*, double*, SolverOptions*);
 TYPEDEF_SPTR(GlobalFrictionContactProblem)
+DEFINE_SPTR(GlobalFrictionContactMatrixFreeData)
 
 /** Formalization and Resolution of a Friction-Contact Problem
  *
@@ -72,6 +74,15 @@ TYPEDEF_SPTR(GlobalFrictionContactProblem)
  *  - post-treatment of data: set values of y/lambda variables of the active Interaction (ie Interactions) using \n
  *  ouput results from the solver (velocity,reaction); function postCompute().
  *
+ * \b Matrix-free mode (setMatrixFree()): M and H are not assembled. The
+ * Numerics problem is given a GlobalFrictionContactOperator applying M,
+ * \f$M^{-1}\f$, H and \f$H^T\f$ block by block, from the iteration
+ * matrices W of the dynamical systems and the jacobians of the
+ * Interactions. Only the Numerics solvers based on products
+ * (SICONOS_GLOBAL_FRICTION_3D_VI_FPP, SICONOS_GLOBAL_FRICTION_3D_VI_EG,
+ * and SICONOS_GLOBAL_FRICTION_3D_ADMM without rescaling) can be used in
+ * this mode.
+ *
  */
 class GlobalFrictionContact : public LinearOSNS
 {
@@ -106,6 +117,23 @@ protected:
   GFC3D_Driver _gfc_driver;
 
   GlobalFrictionContactProblem _numerics_problem;
+
+  /** if true, M and H are not assembled (see setMatrixFree()) */
+  bool _matrixFree = false;
+
+  /** per-DS and per-Interaction blocks used in matrix-free mode */
+  SP::GlobalFrictionContactMatrixFreeData _matrixFreeData;
+
+  /** callbacks given to Numerics in matrix-free mode */
+  GlobalFrictionContactOperator _numerics_operator;
+
+  /** collect the blocks of M and H for the matrix-free operator and
+   * compute the positions of the DS and the Interactions
+   * \param DSG the graph of the dynamical systems
+   * \param indexSet the index set of the active Interactions
+   */
+  void updateMatrixFreeOperator(DynamicalSystemsGraph& DSG, InteractionsGraph& indexSet);
+
 public:
 
   /** constructor (solver id and dimension)
@@ -179,6 +207,19 @@ public:
    */
   void setH(SP::OSNSMatrix H) { _H = H;}
 
+  /** \return true if M and H are not assembled */
+  inline bool matrixFree() const
+  {
+    return _matrixFree;
+  }
+
+  /** do not assemble M and H, and give Numerics callbacks applying
+   * them block by block instead. Requires a solver that only uses
+   * products with M and H (VI_FPP, VI_EG, ADMM).
+   * \param flag true to enable
+   */
+  void setMatrixFree(bool flag);
+
   /** get a pointer to mu, the list of the friction coefficients
    *  \return pointer on a std::vector<double>
    */
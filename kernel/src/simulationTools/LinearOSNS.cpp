@@ -18,6 +18,7 @@
 #include "LinearOSNS.hpp"
 #include "NumericsMatrix.h"
 #include "SiconosAlgebraProd.hpp"
+#include "SiconosAlgebraFixedSize.hpp"
 #include "Simulation.hpp"
 #include "Topology.hpp"
 #include "MoreauJeanOSI.hpp"
@@ -45,6 +46,8 @@
 
 #include "Tools.hpp"
 
+#include <algorithm>
+
 using namespace RELATION;
 // #define DEBUG_NOCOLOR
 // #define DEBUG_STDOUT
@@ -111,8 +114,33 @@ void LinearOSNS::initOSNSMatrix()
         RuntimeException::selfThrow("LinearOSNS::initOSNSMatrix unknown _storageType");
       }
     }
+    _M->setOrdering(_numericsMatrixOrdering);
   }
 }
+
+void LinearOSNS::setMOrdering(int o)
+{
+  _numericsMatrixOrdering = o;
+  if(_M)
+    _M->setOrdering(o);
+  // positions must be recomputed
+  _hasBeenUpdated = false;
+}
+std::vector<InteractionsGraph::VDescriptor> LinearOSNS::verticesInMOrder(InteractionsGraph& indexSet) const
+{
+  std::vector<InteractionsGraph::VDescriptor> vertices;
+  vertices.reserve(indexSet.size());
+  InteractionsGraph::VIterator vi, viend;
+  for(std::tie(vi, viend) = indexSet.vertices(); vi != viend; ++vi)
+    vertices.push_back(*vi);
+  std::sort(vertices.begin(), vertices.end(),
+            [&indexSet](InteractionsGraph::VDescriptor a, InteractionsGraph::VDescriptor b)
+  {
+    return indexSet.properties(a).absolute_position < indexSet.properties(b).absolute_position;
+  });
+  return vertices;
+}
+
 void LinearOSNS::initialize(SP::Simulation sim)
 {
   // - Checks memory allocation for main variables (_M,q,_w,z)
@@ -132,6 +160,80 @@ void LinearOSNS::initialize(SP::Simulation sim)
 
 }
 
+// stamps of the updates of the interaction blocks, shared by all the
+// LinearOSNS, since several of them may use the same index set
+static unsigned int delassusCacheCounter = 0;
+
+// layout of the delassusCache property of an interaction
+enum { DELASSUS_H_SOURCE, DELASSUS_WINVHT_SOURCE,
+       DELASSUS_H_TARGET, DELASSUS_WINVHT_TARGET, DELASSUS_CACHE_SIZE
+     };
+
+void LinearOSNS::updateInteractionBlocks()
+{
+  _delassusCacheStamp = ++delassusCacheCounter;
+  OneStepNSProblem::updateInteractionBlocks();
+}
+
+bool LinearOSNS::cachedWinvHT(InteractionsGraph& indexSet, InteractionsGraph::VDescriptor vd,
+                              SP::DynamicalSystem ds, SP::SimpleMatrix& H, SP::SimpleMatrix& WinvHT)
+{
+  InteractionProperties& properties = indexSet.properties(vd);
+  SP::VectorOfSMatrices& cache = indexSet.delassusCache[vd];
+  if(!cache)
+    cache.reset(new VectorOfSMatrices(DELASSUS_CACHE_SIZE));
+
+  if(indexSet.delassusCacheStamp[vd] != _delassusCacheStamp)
+  {
+    Interaction& inter = *indexSet.bundle(vd);
+    RELATION::TYPES relationType = inter.relation()->getType();
+    DynamicalSystemsGraph& DSG0 = *simulation()->nonSmoothDynamicalSystem()->dynamicalSystems();
+    unsigned int nslawSize = inter.nonSmoothLaw()->size();
+
+    for(unsigned int i = DELASSUS_H_SOURCE; i < DELASSUS_CACHE_SIZE; i += 2)
+    {
+      SP::DynamicalSystem dsi = (i == DELASSUS_H_SOURCE) ? properties.source : properties.target;
+      unsigned int pos = (i == DELASSUS_H_SOURCE) ? properties.source_pos : properties.target_pos;
+      if(i == DELASSUS_H_TARGET && properties.target == properties.source)
+        break;
+      SP::SimpleMatrix& Hi = (*cache)[i];
+      SP::SimpleMatrix& WinvHTi = (*cache)[i + 1];
+
+      OneStepIntegrator& osi = *DSG0.properties(DSG0.descriptor(dsi)).osi;
+      Type::Siconos dsType = Type::value(*dsi);
+      bool applies = (relationType == Lagrangian || relationType == NewtonEuler)
+                     && osi.getType() != OSI::MOREAUJEANBILBAOOSI
+                     && dsType != Type::LagrangianLinearDiagonalDS;
+      if(applies && (dsType == Type::LagrangianLinearTIDS || dsType == Type::LagrangianDS))
+        applies = !std::static_pointer_cast<LagrangianDS>(dsi)->boundaryConditions();
+      else if(applies && dsType == Type::NewtonEulerDS)
+        applies = !std::static_pointer_cast<NewtonEulerDS>(dsi)->boundaryConditions();
+      if(!applies)
+      {
+        Hi.reset();
+        WinvHTi.reset();
+        continue;
+      }
+
+      unsigned int sizeDS = dsi->dimension();
+      if(!Hi || Hi->size(0) != nslawSize || Hi->size(1) != sizeDS)
+      {
+        Hi.reset(new SimpleMatrix(nslawSize, sizeDS));
+        WinvHTi.reset(new SimpleMatrix(sizeDS, nslawSize));
+      }
+      inter.getLeftInteractionBlockForDS(pos, Hi);
+      WinvHTi->trans(*Hi);
+      getOSIMatrix(osi, dsi)->PLUForwardBackwardInPlace(*WinvHTi);
+    }
+    indexSet.delassusCacheStamp[vd] = _delassusCacheStamp;
+  }
+
+  unsigned int i = (ds == properties.source) ? DELASSUS_H_SOURCE : DELASSUS_H_TARGET;
+  H = (*cache)[i];
+  WinvHT = (*cache)[i + 1];
+  return (bool)H;
+}
+
 void LinearOSNS::computeDiagonalInteractionBlock(const InteractionsGraph::VDescriptor& vd)
 {
   DEBUG_BEGIN("LinearOSNS::computeDiagonalInteractionBlock(const InteractionsGraph::VDescriptor& vd)\n");
@@ -221,6 +323,21 @@ void LinearOSNS::computeDiagonalInteractionBlock(const InteractionsGraph::VDescr
     OSI::TYPES osiType = osi.getType();
     unsigned int sizeDS = ds->dimension();
 
+    SP::SimpleMatrix H, WinvHT;
+    if(cachedWinvHT(*indexSet, vd, ds, H, WinvHT))
+    {
+      // currentInteractionBlock += H W^{-1} H^T
+      if(!fixedSizeProd(*H, *WinvHT, *currentInteractionBlock, false))
+        prod(*H, *WinvHT, *currentInteractionBlock, false);
+      if(relationSubType == CompliantLinearTIR && osiType == OSI::MOREAUJEANOSI)
+      {
+        * currentInteractionBlock *= (static_cast<MoreauJeanOSI&>(osi)).theta() ;
+        * currentInteractionBlock +=  *std::static_pointer_cast<LagrangianCompliantLinearTIR>(inter->relation())->D()/simulation()->timeStep() ;
+      }
+      pos = pos2;
+      continue;
+    }
+
     // get _interactionBlocks corresponding to the current DS
     // These _interactionBlocks depends on the relation type.
     leftInteractionBlock.reset(new SimpleMatrix(nslawSize, sizeDS));
@@ -450,6 +567,17 @@ void LinearOSNS::computeInteractionBlock(const InteractionsGraph::EDescriptor& e
   // loop over the common DS
   unsigned int sizeDS = ds->dimension();
 
+  SP::SimpleMatrix H1, WinvHT1, H2, WinvHT2;
+  if(cachedWinvHT(*indexSet, indexSet->source(ed), ds, H1, WinvHT1)
+      && cachedWinvHT(*indexSet, indexSet->target(ed), ds, H2, WinvHT2))
+  {
+    // currentInteractionBlock += H1 W^{-1} H2^T
+    if(!fixedSizeProd(*H1, *WinvHT2, *currentInteractionBlock, false))
+      prod(*H1, *WinvHT2, *currentInteractionBlock, false);
+    DEBUG_END("LinearOSNS::computeInteractionBlock(const InteractionsGraph::EDescriptor& ed)\n");
+    return;
+  }
+
   // get _interactionBlocks corresponding to the current DS
   // These _interactionBlocks depends on the relation type.
   leftInteractionBlock.reset(new SimpleMatrix(nslawSize1, sizeDS));
@@ -25,6 +25,7 @@
 #include "OneStepNSProblem.hpp"
 #include "SiconosVector.hpp"
 #include "NumericsMatrix.h" // For NM_DENSE
+#include "OSNSMatrix.hpp" // For OSNS_ORDERING_GRAPH
 
 /** stl vector of double */
 typedef std::vector<double> MuStorage;
@@ -65,11 +66,41 @@ protected:
       (embedded into OSNSMatrix) */
   int _numericsMatrixStorageType = NM_DENSE;
 
+  /** Ordering policy of the interaction blocks in M (see OSNSMatrixOrdering) */
+  int _numericsMatrixOrdering = OSNS_ORDERING_GRAPH;
+
   /** a boolean to decide if _w and _z vectors are initialized with
       previous values of Y and Lambda when a change occurs in problem
       size */
   bool _keepLambdaAndYState = true;
 
+  /** stamp of the last update of the interaction blocks, the
+      W^{-1}H^T cached in the index set are valid for this stamp only */
+  unsigned int _delassusCacheStamp = 0;
+
+  /** get the blocks H and W^{-1}H^T of an interaction for one of its
+   * dynamical systems. They are computed (in the delassusCache property
+   * of the index set) once per update of the interaction blocks, and used
+   * for the diagonal block and all the extra-diagonal blocks of the row.
+   * \param indexSet the index set
+   * \param vd the vertex of the interaction
+   * \param ds a dynamical system of the interaction
+   * \param[out] H the block of the jacobian of the relation for ds
+   * \param[out] WinvHT W^{-1}H^T, with W the iteration matrix of ds
+   * \return false if the cache does not apply (relation neither
+   * Lagrangian nor NewtonEuler, MoreauJeanBilbaoOSI,
+   * LagrangianLinearDiagonalDS, boundary conditions)
+   */
+  bool cachedWinvHT(InteractionsGraph& indexSet, InteractionsGraph::VDescriptor vd,
+                    SP::DynamicalSystem ds, SP::SimpleMatrix& H, SP::SimpleMatrix& WinvHT);
+
+  /** get the vertices of an index set in the order of the rows of M,
+   * i.e. sorted by absolute_position (valid once M has been filled)
+   * \param indexSet the index set
+   * \return the vertex descriptors
+   */
+  std::vector<InteractionsGraph::VDescriptor> verticesInMOrder(InteractionsGraph& indexSet) const;
+
   /** nslaw effects : visitors experimentation
    */
   struct _TimeSteppingNSLEffect;
@@ -205,6 +236,21 @@ public:
     _numericsMatrixStorageType = i;
   };
 
+  /** get the ordering policy of the interaction blocks in M
+      \return an OSNSMatrixOrdering
+   */
+  inline int getMOrdering() const
+  {
+    return _numericsMatrixOrdering;
+  };
+
+  /** set the ordering policy of the interaction blocks in M.
+   * OSNS_ORDERING_INTERACTION_NUMBER keeps the layout of M stable from
+   * one step to the next for persistent interactions.
+   * \param o an OSNSMatrixOrdering
+   */
+  void setMOrdering(int o);
+
   /** Memory allocation or resizing for z,w,q */
   void initVectorsMemory();
 
@@ -216,6 +262,11 @@ public:
   */
   virtual void initialize(SP::Simulation sim);
 
+  /** compute the interaction blocks (the cache of W^{-1}H^T is
+   * invalidated)
+   */
+  virtual void updateInteractionBlocks();
+
   /** compute extra-diagonal interactionBlock-matrix
    *  \param ed an edge descriptor
    */
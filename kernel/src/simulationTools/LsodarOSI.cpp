@@ -131,6 +131,48 @@ void LsodarOSI::setMaxNstep(integer maxNumberSteps)
   iwork[5] = maxNumberSteps;
 }
 
+void LsodarOSI::setBandwidth(integer ml, integer mu)
+{
+  if(ml < 0 || mu < 0)
+    RuntimeException::selfThrow("LsodarOSI::setBandwidth, the half-bandwidths must be nonnegative.");
+  _ml = ml;
+  _mu = mu;
+  _userBandwidth = true;
+}
+
+void LsodarOSI::computeWorkSizes()
+{
+  integer neq = _intData[0];
+  integer ng = _intData[1];
+  integer jt = _intData[8];
+  if(jt == 4 || jt == 5)
+  {
+    if(!_userBandwidth)
+    {
+      // block diagonal Jacobian: the half-bandwidths are given by the
+      // largest dynamical system
+      unsigned int maxSize = 1;
+      DynamicalSystemsGraph::VIterator dsi, dsend;
+      for(std::tie(dsi, dsend) = _dynamicalSystemsGraph->vertices(); dsi != dsend; ++dsi)
+      {
+        if(!checkOSI(dsi)) continue;
+        maxSize = std::max(maxSize, _dynamicalSystemsGraph->bundle(*dsi)->n());
+      }
+      _ml = maxSize - 1;
+      _mu = maxSize - 1;
+    }
+    // lrw, size of rwork for a banded Jacobian
+    _intData[6] = 22 + neq * std::max(16, 2 * (int)_ml + (int)_mu + 9) + 3 * ng;
+  }
+  else
+  {
+    // lrw, size of rwork for a full Jacobian
+    _intData[6] = 22 + neq * std::max(16, (int)neq + 9) + 3 * ng;
+  }
+  // liw, size of iwork
+  _intData[7] = 20 + neq;
+}
+
 void LsodarOSI::setTol(integer newItol, doublereal newRtol, doublereal newAtol)
 {
   _itol = newItol; // itol
@@ -243,7 +285,7 @@ void LsodarOSI::g(integer* nEq, doublereal*  time, doublereal* x, integer* ng, d
 
 void LsodarOSI::jacobianfx(integer* sizeOfX, doublereal* time, doublereal* x, integer* ml, integer* mu,  doublereal* jacob, integer* nrowpd)
 {
-  std::static_pointer_cast<EventDriven>(_simulation)->computeJacobianfx(*this, sizeOfX, time, x, jacob);
+  std::static_pointer_cast<EventDriven>(_simulation)->computeJacobianfx(*this, sizeOfX, time, x, jacob, *ml, *mu, *nrowpd);
 }
 
 
@@ -280,10 +322,8 @@ void LsodarOSI::initializeWorkVectorsForDS(double t, SP::DynamicalSystem ds)
 
   // 1 - Neq; x vector size.
   _intData[0] = _xWork->size();
-  // 5 - lrw, size of rwork
-  _intData[6] = 22 + _intData[0] * std::max(16, (int)_intData[0] + 9) + 3 * _intData[1];
-  // 6 - liw, size of iwork
-  _intData[7] = 20 + _intData[0];
+  // 5 - lrw, size of rwork and 6 - liw, size of iwork
+  computeWorkSizes();
 
   // memory allocation for doublereal*, according to _intData values
   updateData();
@@ -451,7 +491,8 @@ void LsodarOSI::initialize()
 
 
   // 7 - JT, Jacobian type indicator
-  _intData[8] = 2;   // jt, Jacobian type indicator.
+  if(_intData[8] == 0)  // not set by the user
+    _intData[8] = 2;   // jt, Jacobian type indicator.
   //           1 means a user-supplied full (NEQ by NEQ) Jacobian.
   //           2 means an internally generated (difference quotient) full Jacobian (using NEQ extra calls to f per df/dx value).
   //           4 means a user-supplied banded Jacobian.
@@ -474,6 +515,10 @@ void LsodarOSI::initialize()
   //   2     scalar     array      RTOL*ABS(Y(i)) + ATOL(i)
   //   3     array      scalar     RTOL(i)*ABS(Y(i)) + ATOL
   //   4     array      array      RTOL(i)*ABS(Y(i)) + ATOL(i)
+
+  // the sizes of the work arrays depend on ng and jt
+  computeWorkSizes();
+  updateData();
   DEBUG_END("LsodarOSI::initialize()\n");
 }
 
@@ -513,6 +558,13 @@ void LsodarOSI::integrate(double& tinit, double& tend, double& tout, int& istate
 
   _intData[4] = istate;
 
+  if(_intData[8] == 4 || _intData[8] == 5)
+  {
+    // half-bandwidths of the Jacobian
+    iwork[0] = _ml;
+    iwork[1] = _mu;
+  }
+
 #ifdef HAS_FORTRAN
   // call LSODAR to integrate dynamical equation
   CNAME(dlsodar)(pointerToF,
@@ -34,8 +34,13 @@
  * in externals/odepack/opkdmain.f to have a full description of these parameters.  \n
  * Most of them are read-only parameters (ie can not be set by user). \n
  *  Except: \n
- *  - jt: Jacobian type indicator (1 means a user-supplied full Jacobian, 2 means an internally generated full Jacobian). \n
- *    Default = 2.
+ *  - jt: Jacobian type indicator (1 means a user-supplied full Jacobian, 2 means an internally generated full Jacobian,
+ *    4 means a user-supplied banded Jacobian, 5 means an internally generated banded Jacobian). \n
+ *    Default = 2. \n
+ *    The dynamical systems are coupled only through the nonsmooth part of the dynamics, so that the Jacobian of the
+ *    concatenated state is block diagonal. With jt = 4 or 5, it is handled as a banded matrix whose half-bandwidths
+ *    are derived from the largest dynamical system (see setBandwidth()), and the cost of its factorization grows
+ *    linearly with the number of dynamical systems.
  *  - itol, rtol and atol \n
  *    ITOL   = an indicator for the type of error control. \n
  *    RTOL   = a relative error tolerance parameter, either a scalar or array of length NEQ. \n
@@ -53,6 +58,15 @@ private:
    * See opkdmain.f and lsodar routine for details on those variables.
    */
   std::vector<integer> _intData;
+  /** lower and upper half-bandwidths of the Jacobian, for jt = 4 or 5
+   * (ml and mu in lsodar) */
+  integer _ml = 0;
+  integer _mu = 0;
+
+  /** true if the half-bandwidths have been set with setBandwidth(), else
+   * they are derived from the dynamical systems */
+  bool _userBandwidth = false;
+
   /** _sizeTol size of the vector ot tolerances */
   unsigned int _sizeTol;
 
@@ -78,6 +92,11 @@ private:
   struct _NSLEffectOnFreeOutput;
   friend struct _NSLEffectOnFreeOutput;
 
+  /** compute the sizes of the work arrays (lrw and liw), and the
+   * half-bandwidths of the Jacobian if they are derived from the dynamical systems
+   */
+  void computeWorkSizes();
+
 public:
 
   enum LsodarOSI_ds_workVector_id{FREE, WORK_LENGTH};
@@ -182,6 +201,9 @@ public:
    *  if jt = 1 or 4, the user must supply a subroutine jac
    *  (the name is arbitrary) as described above under jac.
    *  if jt = 2 or 5, a dummy argument can be used.
+   *  Here the jacobian supplied for jt = 1 or 4 is built from the jacobians
+   *  of the dynamical systems (see EventDriven::computeJacobianfx).
+   *  It must be set before the initialization of the simulation.
    *  \param newJT new value for the jt parameter.
    */
   inline void setJT(integer newJT)
@@ -189,6 +211,26 @@ public:
     _intData[8] = newJT;
   };
 
+  /** set the half-bandwidths of the Jacobian, used when jt = 4 or 5.
+   *  By default, they are both equal to the size of the largest dynamical
+   *  system minus one (block diagonal Jacobian).
+   *  \param ml lower half-bandwidth
+   *  \param mu upper half-bandwidth
+   */
+  void setBandwidth(integer ml, integer mu);
+
+  /** \return the lower half-bandwidth of the Jacobian (jt = 4 or 5) */
+  inline integer ml() const
+  {
+    return _ml;
+  };
+
+  /** \return the upper half-bandwidth of the Jacobian (jt = 4 or 5) */
+  inline integer mu() const
+  {
+    return _mu;
+  };
+
   /** set itol, rtol and atol (tolerance parameters for lsodar)
    *  \param newItol itol value
    *  \param newRtol rtol value
@@ -133,7 +133,9 @@ void MLCP::computeDiagonalInteractionBlock(const InteractionsGraph::VDescriptor&
   SP::Interaction inter = indexSet->bundle(vd);
 
   // commonDS here...
-  if(!_hasBeenUpdated)
+  // with another ordering, the blocks are described in preCompute,
+  // once the positions of the interactions in M are known
+  if(!_hasBeenUpdated && _numericsMatrixOrdering == OSNS_ORDERING_GRAPH)
     computeOptions(inter, inter);
   LinearOSNS::computeDiagonalInteractionBlock(vd);
 }
@@ -141,6 +143,19 @@ void MLCP::computeDiagonalInteractionBlock(const InteractionsGraph::VDescriptor&
 bool MLCP::preCompute(double time)
 {
   bool res = LinearOSNS::preCompute(time);
+  if(res && !_hasBeenUpdated && _numericsMatrixOrdering != OSNS_ORDERING_GRAPH)
+  {
+    // blocksRows and blocksIsComp must follow the rows of M
+    _curBlock = 0;
+    _m = 0;
+    _n = 0;
+    InteractionsGraph& indexSet = *simulation()->indexSet(indexSetLevel());
+    for(InteractionsGraph::VDescriptor vd : verticesInMOrder(indexSet))
+    {
+      SP::Interaction inter = indexSet.bundle(vd);
+      computeOptions(inter, inter);
+    }
+  }
   _numerics_problem->n = _n;
   _numerics_problem->m = _m;
   return res;
@@ -25,6 +25,7 @@
 #include "TimeDiscretisation.hpp"
 #include "NonSmoothDynamicalSystem.hpp"
 #include "EventsManager.hpp"
+#include "AlgebraTools.hpp"
 
 //#define DEBUG_WHERE_MESSAGES
 
@@ -81,16 +82,29 @@ void MatrixIntegrator::commonInit(const DynamicalSystem& ds, const NonSmoothDyna
     {
       std::static_pointer_cast<FirstOrderLinearDS>(_DS)->setPluginA(cfolds.getPluginA());
     }
-    _isConst = (_TD->hConst()) && !(cfolds.getPluginA()->isPlugged()) ? true : false;
+    _isAPlugged = cfolds.getPluginA()->isPlugged();
+    _isConst = (_TD->hConst()) && !_isAPlugged ? true : false;
   }
 
   _DS->setNumber(9999999);
   DEBUG_EXPR(_DS->display(););
-  // integration stuff
   _nsds.reset(new NonSmoothDynamicalSystem(nsds.t0(), nsds.finalT()));
+  _nsds->insertDynamicalSystem(_DS);
+
+  // the ODE solver is only built if needed
+  _useExpm = canUseExpm();
+}
+
+void MatrixIntegrator::setUseExpm(bool flag)
+{
+  if(flag && !canUseExpm())
+    RuntimeException::selfThrow("MatrixIntegrator::setUseExpm - the matrix exponential can not be used with a time-dependent A or E");
+  _useExpm = flag;
+}
 
+void MatrixIntegrator::initODESolver()
+{
   _OSI.reset(new LsodarOSI());
-  _nsds->insertDynamicalSystem(_DS);
   _sim.reset(new EventDriven(_nsds, _TD, 0));
   _sim->associate(_OSI, _DS);
   _sim->setName("Matrix integrator simulation");
@@ -102,6 +116,42 @@ void MatrixIntegrator::commonInit(const DynamicalSystem& ds, const NonSmoothDyna
 void MatrixIntegrator::integrate()
 {
   DEBUG_BEGIN("MatrixIntegrator::integrate()\n");
+  if(_useExpm)
+    integrateExpm();
+  else
+    integrateODE();
+  _k++;
+  DEBUG_EXPR(_mat->display(););
+  DEBUG_END("MatrixIntegrator::integrate()\n");
+}
+
+void MatrixIntegrator::integrateExpm()
+{
+  double h = _TD->currentTimeStep(_k);
+  unsigned int n = _DS->n();
+  // A is null for a FirstOrderLinearDS without A
+  SimpleMatrix Ah(n, n);
+  SP::SiconosMatrix A = static_cast<FirstOrderLinearDS&>(*_DS).A();
+  if(A)
+    Ah = *A;
+
+  if(_E)
+  {
+    // Van Loan: the integral term is a block of the exponential of an augmented matrix
+    Siconos::algebra::tools::expmVanLoan(Ah, *_E, h, SP::SiconosMatrix(), *_mat);
+  }
+  else
+  {
+    Ah *= h;
+    Siconos::algebra::tools::expm(Ah, *_mat);
+  }
+}
+
+void MatrixIntegrator::integrateODE()
+{
+  if(!_sim)
+    initODESolver();
+
   SiconosVector& x0 = *_DS->x0();
   SiconosVector& x = *_DS->x();
 
@@ -133,7 +183,5 @@ void MatrixIntegrator::integrate()
   _sim->processEvents();
   //_DS->resetToInitialState();
 
-  DEBUG_EXPR(_mat->display(););
   DEBUG_EXPR(_DS->display(););
-  DEBUG_END("MatrixIntegrator::integrate()\n");
 }
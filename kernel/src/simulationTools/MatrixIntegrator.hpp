@@ -30,6 +30,15 @@
 
 #include "SiconosFwd.hpp"
 
+/** Computation of the matrices \f$exp(Ah)\f$ and \f$\int_0^h exp(A\tau)E(\tau)\mathrm{d}\tau\f$
+ *  over a time step h, as needed by the ZeroOrderHoldOSI.
+ *
+ *  When A and E do not depend on time, the result is computed directly
+ *  with a Padé scaling-and-squaring matrix exponential (the Van Loan
+ *  block form is used for the integral term). Otherwise (or if
+ *  setUseExpm(false) has been called) the matrix ODE is integrated
+ *  column by column with a LsodarOSI.
+ */
 class MatrixIntegrator
 {
 private:
@@ -68,9 +77,27 @@ protected:
   /** OneStepIntegrator of type LsodarOSI */
   SP::LsodarOSI _OSI;
 
+  /** true if A is given by a plugin */
+  bool _isAPlugged = false;
+
+  /** true if _mat is computed with the matrix exponential rather than with the ODE solver */
+  bool _useExpm = false;
+
+  /** index of the next time step, used to get its length with the matrix exponential */
+  unsigned int _k = 0;
+
   /** */
   void commonInit(const DynamicalSystem& ds, const NonSmoothDynamicalSystem& nsds, const TimeDiscretisation & td);
 
+  /** build the EventDriven simulation used to integrate the ODE */
+  void initODESolver();
+
+  /** compute _mat with the matrix exponential, for the current time step */
+  void integrateExpm();
+
+  /** compute _mat with the ODE solver, for the current time step */
+  void integrateODE();
+
   /** Default constructor */
   MatrixIntegrator() {};
 
@@ -110,6 +137,16 @@ public:
   /** Check whether the solution of the ODE is time-invariant*/
   inline bool isConst() { return _isConst; }
 
+  /** \return true if the matrix exponential is used instead of the ODE solver */
+  inline bool useExpm() const { return _useExpm; }
+
+  /** \return true if the matrix exponential can be used, i.e. if A and E do not depend on time */
+  inline bool canUseExpm() const { return !_isAPlugged && !_plugin; }
+
+  /** choose between the matrix exponential (default when possible) and the ODE solver
+   * \param flag true to use the matrix exponential, only possible if canUseExpm() */
+  void setUseExpm(bool flag);
+
 };
 
 #endif
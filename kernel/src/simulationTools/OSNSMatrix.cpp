@@ -16,6 +16,7 @@
  * limitations under the License.
 */
 #include <assert.h>
+#include <algorithm>
 #include "NumericsMatrix.h"
 #include "OSNSMatrix.hpp"
 #include "NonSmoothLaw.hpp"
@@ -143,15 +144,33 @@ unsigned OSNSMatrix::updateSizeAndPositions(InteractionsGraph& indexSet)
 
   // Computes real size of the current matrix = sum of the dim. of all
   // Interactionin indexSet
+  std::vector<InteractionsGraph::VDescriptor> vertices;
+  vertices.reserve(indexSet.size());
+  InteractionsGraph::VIterator vi, viend;
+  for(std::tie(vi, viend) = indexSet.vertices(); vi != viend; ++vi)
+    vertices.push_back(*vi);
+
+  if(_ordering == OSNS_ORDERING_INTERACTION_NUMBER)
+  {
+    // Interaction numbers are given at creation: persistent
+    // interactions keep their relative order, new ones come last.
+    std::sort(vertices.begin(), vertices.end(),
+              [&indexSet](InteractionsGraph::VDescriptor a, InteractionsGraph::VDescriptor b)
+    {
+      return indexSet.bundle(a)->number() < indexSet.bundle(b)->number();
+    });
+  }
+  else if(_ordering != OSNS_ORDERING_GRAPH)
+    RuntimeException::selfThrow("OSNSMatrix::updateSizeAndPositions unknown ordering policy");
+
   unsigned dim = 0;
-  InteractionsGraph::VIterator vd, vdend;
-  for(std::tie(vd, vdend) = indexSet.vertices(); vd != vdend; ++vd)
+  for(InteractionsGraph::VDescriptor vd : vertices)
   {
-    assert(indexSet.descriptor(indexSet.bundle(*vd)) == *vd);
-    indexSet.properties(*vd).absolute_position = dim;
-    dim += (indexSet.bundle(*vd)->nonSmoothLaw()->size());
-    DEBUG_PRINTF("Position = %i for interaction %i\n",dim, indexSet.bundle(*vd)->number());
-    assert(indexSet.properties(*vd).absolute_position < dim);
+    assert(indexSet.descriptor(indexSet.bundle(vd)) == vd);
+    indexSet.properties(vd).absolute_position = dim;
+    dim += (indexSet.bundle(vd)->nonSmoothLaw()->size());
+    DEBUG_PRINTF("Position = %i for interaction %i\n",dim, indexSet.bundle(vd)->number());
+    assert(indexSet.properties(vd).absolute_position < dim);
   }
 
   return dim;
@@ -252,13 +271,18 @@ void OSNSMatrix::fillW(InteractionsGraph& indexSet, bool update)
 
       assert(indexSet.properties(*ei).lower_block);
       assert(indexSet.properties(*ei).upper_block);
+
+      // The rows of upper_block belong to the interaction with the lower
+      // graph index, which is not the lower position in M when the
+      // interactions are sorted by number.
+      if(indexSet.index(vd1) > indexSet.index(vd2))
+        std::swap(pos, col);
+
       std::static_pointer_cast<SimpleMatrix>(_M1)
-      ->setBlock(std::min(pos, col), std::max(pos, col),
-                 *indexSet.properties(*ei).upper_block);
+      ->setBlock(pos, col, *indexSet.properties(*ei).upper_block);
 
       std::static_pointer_cast<SimpleMatrix>(_M1)
-      ->setBlock(std::max(pos, col), std::min(pos, col),
-                 *indexSet.properties(*ei).lower_block);
+      ->setBlock(col, pos, *indexSet.properties(*ei).lower_block);
     }
   }
   else if(_storageType == NM_SPARSE_BLOCK)
@@ -266,14 +290,10 @@ void OSNSMatrix::fillW(InteractionsGraph& indexSet, bool update)
     if(! _M2)
     {
       DEBUG_PRINT("Reset _M2 shared pointer using new BlockCSRMatrix(indexSet) \n ");
-      _M2.reset(new BlockCSRMatrix(indexSet));
-
-    }
-    else
-    {
-      DEBUG_PRINT("fill existing _M2\n");
-      _M2->fill(indexSet);
+      _M2.reset(new BlockCSRMatrix(indexSet.size()));
     }
+    DEBUG_PRINT("fill _M2\n");
+    _M2->fill(indexSet, _ordering != OSNS_ORDERING_GRAPH);
   }
   // invalidate other old storages.
   _numericsMatrix.get()->storageType = _storageType ;
@@ -26,6 +26,15 @@
 #include "SiconosSerialization.hpp" // for ACCEPT_SERIALIZATION
 #include "SimulationTypeDef.hpp"
 
+/** Ordering policies of the Interaction blocks in an OSNSMatrix */
+enum OSNSMatrixOrdering
+{
+  /** order of the vertices in the index set (default) */
+  OSNS_ORDERING_GRAPH = 0,
+  /** increasing Interaction::number(), i.e. order of creation */
+  OSNS_ORDERING_INTERACTION_NUMBER = 1
+};
+
 /** Interface to some specific storage types for matrices used in
  * OneStepNSProblem
  *
@@ -90,6 +99,16 @@
  *
  *  - Sparse matrix (_storageType = 2): at the time of writting, only csc (compressed-sparse column).
  *    Could also be triplet (coo or coordinate) or csr (compressed-sparse row).
+ *
+ * The position of the block of each Interaction depends on the
+ * ordering policy (see setOrdering()). By default, Interactions are
+ * taken in the order of the vertices of the index set, which changes
+ * whenever Interactions are inserted in or removed from the graph. With
+ * OSNS_ORDERING_INTERACTION_NUMBER, they are sorted by
+ * Interaction::number(): persistent Interactions keep the same relative
+ * order from one step to the next and new ones are appended at the end,
+ * so that the layout of the matrix (and the solver data attached to it)
+ * can be reused across steps.
  */
 class OSNSMatrix
 {
@@ -117,6 +136,9 @@ protected:
       (_storageType = 1) */
   SP::BlockCSRMatrix _M2;
 
+  /** Ordering policy of the Interaction blocks (an OSNSMatrixOrdering) */
+  int _ordering = OSNS_ORDERING_GRAPH;
+
   /** For each Interaction in the graph, compute its absolute position
    *  \param indexSet the index set ot the concerned interactios.
    * \return the dimension of the problem (or size of the matrix),
@@ -206,6 +228,23 @@ public:
     _storageType = i;
   };
 
+  /** get the ordering policy of the Interaction blocks
+   * \return an OSNSMatrixOrdering
+   */
+  inline int ordering() const
+  {
+    return _ordering;
+  };
+
+  /** set the ordering policy of the Interaction blocks. It is taken
+   * into account at the next update of the positions (fillW with update = true).
+   * \param o an OSNSMatrixOrdering
+   */
+  inline void setOrdering(int o)
+  {
+    _ordering = o;
+  };
+
   /** get the numerics-readable structure
    * \return SP::NumericsMatrix
    */
@@ -71,10 +71,6 @@ void RollingFrictionContact::initialize(SP::Simulation sim)
 
   // Connect to the right function according to dim. of the problem
 
-  // get topology
-  SP::Topology topology =
-    simulation()->nonSmoothDynamicalSystem()->topology();
-
   // Note that interactionBlocks is up to date since updateInteractionBlocks
   // has been called during OneStepNSProblem::initialize()
 
@@ -84,37 +80,25 @@ void RollingFrictionContact::initialize(SP::Simulation sim)
   _mu->reserve(sizeMu);
   _muR->reserve(sizeMu);
 
-  // If the topology is TimeInvariant ie if M structure does not
-  // change during simulation:
-
-  if(topology->indexSet0()->size()>0)
-  {
-    // Get index set from Simulation
-    SP::InteractionsGraph indexSet =
-      simulation()->indexSet(indexSetLevel());
-    InteractionsGraph::VIterator ui, uiend;
-    for(std::tie(ui, uiend) = indexSet->vertices(); ui != uiend; ++ui)
-    {
-      _mu->push_back(std::static_pointer_cast<NewtonImpactRollingFrictionNSL>
-                     (indexSet->bundle(*ui)->nonSmoothLaw())->mu());
-      _muR->push_back(std::static_pointer_cast<NewtonImpactRollingFrictionNSL>
-                      (indexSet->bundle(*ui)->nonSmoothLaw())->muR());
-    }
-  }
+  // The coefficients are filled in updateMu(), at each call to compute,
+  // once the positions of the interactions in M are known.
 }
 
 void RollingFrictionContact::updateMu()
 {
-  _mu->clear();
-  _muR->clear();
+  // mu and muR follow the rows of M and q, which may not be the order of
+  // the vertices of the index set (see LinearOSNS::setMOrdering)
   SP::InteractionsGraph indexSet = simulation()->indexSet(indexSetLevel());
+  _mu->resize(indexSet->size());
+  _muR->resize(indexSet->size());
   InteractionsGraph::VIterator ui, uiend;
   for(std::tie(ui, uiend) = indexSet->vertices(); ui != uiend; ++ui)
   {
-    _mu->push_back(std::static_pointer_cast<NewtonImpactRollingFrictionNSL>
-                   (indexSet->bundle(*ui)->nonSmoothLaw())->mu());
-    _muR->push_back(std::static_pointer_cast<NewtonImpactRollingFrictionNSL>
-                    (indexSet->bundle(*ui)->nonSmoothLaw())->muR());
+    unsigned int contact = indexSet->properties(*ui).absolute_position / _contactProblemDim;
+    SP::NewtonImpactRollingFrictionNSL nslaw = std::static_pointer_cast<NewtonImpactRollingFrictionNSL>
+        (indexSet->bundle(*ui)->nonSmoothLaw());
+    (*_mu)[contact] = nslaw->mu();
+    (*_muR)[contact] = nslaw->muR();
   }
 }
 
@@ -191,12 +191,16 @@ struct InteractionsGraph : public _InteractionsGraph
                            ((Vertex, SP::SimpleMatrix, blockProj))        // ProjectOnConstraint
                            ((Edge, SP::SimpleMatrix, upper_blockProj))    // idem
                            ((Edge, SP::SimpleMatrix, lower_blockProj))  // idem
+                           ((Vertex, SP::VectorOfSMatrices, delassusCache)) // LinearOSNS: H and W^{-1}H^T for each DS
+                           ((Vertex, unsigned int, delassusCacheStamp))     // idem
                            ((Vertex, std::string, name)));
 
   // to be installed with INSTALL_GRAPH_PROPERTIES
   void eraseProperties(_InteractionsGraph::VDescriptor vd)
   {
     blockProj._store->erase(vd);
+    delassusCache._store->erase(vd);
+    delassusCacheStamp._store->erase(vd);
     name._store->erase(vd);
   }
 
@@ -0,0 +1,108 @@
+/* Siconos is a program dedicated to modeling, simulation and control
+ * of non smooth dynamical systems.
+ *
+ * Copyright 2020 INRIA.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+*/
+#include "EventDrivenTest.hpp"
+#include "SiconosKernel.hpp"
+#include <cmath>
+
+// test suite registration
+CPPUNIT_TEST_SUITE_REGISTRATION(EventDrivenTest);
+
+
+void EventDrivenTest::setUp()
+{}
+
+void EventDrivenTest::tearDown()
+{}
+
+// Points on a line above the ground (gap q), with the initial velocities
+// v0 and the forces f, simulated with NewMarkAlphaOSI and h = 0.01 up to
+// the first nonsmooth event. Returns its time and the gaps at this time.
+static double firstEvent(const std::vector<double>& q0, const std::vector<double>& v0,
+                         const std::vector<double>& f, bool onCandidates,
+                         std::vector<double>& gaps)
+{
+  SP::NonSmoothDynamicalSystem nsds(new NonSmoothDynamicalSystem(0, 0.3));
+  SP::NonSmoothLaw nslaw(new NewtonImpactNSL(0.5));
+  SP::SimpleMatrix H(new SimpleMatrix(1, 1));
+  (*H)(0, 0) = 1.0;
+  std::vector<SP::Interaction> interactions;
+  for(unsigned int k = 0; k < q0.size(); ++k)
+  {
+    SP::SiconosVector q(new SiconosVector(1, q0[k]));
+    SP::SiconosVector v(new SiconosVector(1, v0[k]));
+    SP::SiconosMatrix M(new SimpleMatrix(1, 1));
+    M->eye();
+    SP::LagrangianLinearTIDS point(new LagrangianLinearTIDS(q, v, M));
+    point->setFExtPtr(std::make_shared<SiconosVector>(1, f[k]));
+    nsds->insertDynamicalSystem(point);
+    SP::Interaction inter(new Interaction(nslaw, std::make_shared<LagrangianLinearTIR>(H)));
+    nsds->link(inter, point);
+    interactions.push_back(inter);
+  }
+
+  SP::EventDriven s(new EventDriven(nsds, std::make_shared<TimeDiscretisation>(0, 0.01)));
+  s->setLocalizeEventsOnCandidates(onCandidates);
+  s->insertIntegrator(std::make_shared<NewMarkAlphaOSI>(0.5, true));
+  s->insertNonSmoothProblem(std::make_shared<LCP>(), SICONOS_OSNSP_ED_IMPACT);
+  s->insertNonSmoothProblem(std::make_shared<LCP>(), SICONOS_OSNSP_ED_SMOOTH_ACC);
+  s->insertNonSmoothProblem(std::make_shared<LCP>(), SICONOS_OSNSP_ED_SMOOTH_POS);
+  while(s->hasNextEvent())
+  {
+    s->advanceToEvent();
+    if(s->eventsManager()->nextEvent()->getType() == NS_EVENT)
+      break;
+    s->processEvents();
+  }
+  gaps.clear();
+  for(unsigned int k = 0; k < interactions.size(); ++k)
+    gaps.push_back((*interactions[k]->y(0))(0));
+  return s->eventsManager()->nextEvent()->getDoubleTimeOfEvent();
+}
+
+void EventDrivenTest::testLocalizeFirstEvent()
+{
+  std::vector<double> gaps, refGaps;
+
+  // three points reach the ground in the step [0.10, 0.11], two of them
+  // at the same time
+  std::vector<double> q0 = {0.1075, 0.108, 0.1075, 0.5};
+  std::vector<double> v0(4, -1.0), f(4, 0.0);
+  double ref = firstEvent(q0, v0, f, false, refGaps);
+  double t = firstEvent(q0, v0, f, true, gaps);
+  CPPUNIT_ASSERT_DOUBLES_EQUAL_MESSAGE("testLocalizeFirstEvent : ", 0.1075, ref, 1e-8);
+  CPPUNIT_ASSERT_DOUBLES_EQUAL_MESSAGE("testLocalizeFirstEvent : ", ref, t, 1e-12);
+  for(unsigned int k = 0; k < q0.size(); ++k)
+  {
+    CPPUNIT_ASSERT_DOUBLES_EQUAL_MESSAGE("testLocalizeFirstEvent : ", refGaps[k], gaps[k], 1e-12);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL_MESSAGE("testLocalizeFirstEvent : ", q0[k] - t, gaps[k], 1e-8);
+  }
+
+  // a point pushed upwards, with the gap -1e-4 + 50 (t - 0.105)^2: it is
+  // below the ground only inside the step [0.10, 0.11], where the first
+  // point reaches the ground at 0.108
+  q0 = {0.108, -1e-4 + 50 * 0.105 * 0.105, 0.5};
+  v0 = { -1.0, -10.5, -1.0};
+  f = {0.0, 100.0, 0.0};
+  ref = firstEvent(q0, v0, f, false, refGaps);
+  t = firstEvent(q0, v0, f, true, gaps);
+  CPPUNIT_ASSERT_DOUBLES_EQUAL_MESSAGE("testLocalizeFirstEvent : ", 0.105 - sqrt(2e-6), ref, 1e-6);
+  CPPUNIT_ASSERT_DOUBLES_EQUAL_MESSAGE("testLocalizeFirstEvent : ", ref, t, 1e-12);
+  for(unsigned int k = 0; k < q0.size(); ++k)
+    CPPUNIT_ASSERT_DOUBLES_EQUAL_MESSAGE("testLocalizeFirstEvent : ", refGaps[k], gaps[k], 1e-12);
+  CPPUNIT_ASSERT_DOUBLES_EQUAL_MESSAGE("testLocalizeFirstEvent : ", 0.0, gaps[1], 1e-8);
+}
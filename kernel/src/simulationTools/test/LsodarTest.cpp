@@ -143,3 +143,62 @@ void LsodarTest::testCstGradNLDS()
   std::cout <<std::endl <<std::endl;
 }
 
+// several uncoupled stiff systems, integrated with a full or a banded jacobian
+static std::vector<SP::DynamicalSystem> integrateUncoupledSystems(int jt, unsigned int nds, int& ml)
+{
+  SP::NonSmoothDynamicalSystem nsds(new NonSmoothDynamicalSystem(0.0, 1.0));
+  std::vector<SP::DynamicalSystem> dss;
+  for(unsigned int d = 0; d < nds; ++d)
+  {
+    SP::SiconosMatrix A(new SimpleMatrix(3, 3, 0));
+    (*A)(0, 0) = -50. * (d + 1);
+    (*A)(0, 1) = 1.;
+    (*A)(1, 1) = -2.;
+    (*A)(1, 2) = 0.1;
+    (*A)(2, 1) = 3.;
+    (*A)(2, 2) = -0.5;
+    SP::SiconosVector x0(new SiconosVector(3));
+    (*x0)(0) = 1.;
+    (*x0)(1) = 2. + d;
+    (*x0)(2) = -1.;
+    SP::SiconosVector b(new SiconosVector(3, 0));
+    SP::DynamicalSystem ds(new FirstOrderLinearTIDS(x0, A, b));
+    nsds->insertDynamicalSystem(ds);
+    dss.push_back(ds);
+  }
+  SP::TimeDiscretisation td(new TimeDiscretisation(0.0, 0.1));
+  SP::EventDriven sim(new EventDriven(nsds, td, 0));
+  SP::LsodarOSI lsodar(new LsodarOSI());
+  lsodar->setJT(jt);
+  sim->insertIntegrator(lsodar);
+  sim->initialize();
+  lsodar->setTol(1, 1e-8, 1e-8);
+  while(sim->hasNextEvent())
+  {
+    sim->advanceToEvent();
+    sim->processEvents();
+  }
+  ml = lsodar->ml();
+  return dss;
+}
+
+void LsodarTest::testBandedJacobian()
+{
+  std::cout << "------- Integrate uncoupled systems with a banded jacobian -------" <<std::endl;
+  int ml;
+  std::vector<SP::DynamicalSystem> ref = integrateUncoupledSystems(2, 10, ml);
+  int jts[3] = {1, 4, 5};
+  for(unsigned int k = 0; k < 3; ++k)
+  {
+    std::vector<SP::DynamicalSystem> dss = integrateUncoupledSystems(jts[k], 10, ml);
+    for(unsigned int d = 0; d < dss.size(); ++d)
+    {
+      SiconosVector diff(*dss[d]->x());
+      diff -= *ref[d]->x();
+      CPPUNIT_ASSERT_EQUAL_MESSAGE("testBandedJacobian : ", diff.normInf() < 1e-10, true);
+    }
+    if(jts[k] != 1)
+      CPPUNIT_ASSERT_EQUAL_MESSAGE("testBandedJacobian : bandwidth", ml, 2);
+  }
+  std::cout <<std::endl <<std::endl;
+}
@@ -18,6 +18,13 @@
 #include "OSNSPTest.hpp"
 #include "SolverOptions.h"
 #include "FrictionContact.hpp"
+#include "GlobalFrictionContact.hpp"
+#include "MoreauJeanGOSI.hpp"
+#include "SiconosKernel.hpp"
+#include "OSNSMatrix.hpp"
+#include "NumericsMatrix.h"
+#include "MixedLinearComplementarityProblem.h"
+#include <cmath>
 
 // test suite registration
 CPPUNIT_TEST_SUITE_REGISTRATION(OSNSPTest);
@@ -58,3 +65,404 @@ void OSNSPTest::testOSNSBuild_options()
   auto options_link = problem->numericsSolverOptions();
   CPPUNIT_ASSERT_EQUAL_MESSAGE("test solver options : ",  options_link->solverId == SICONOS_FRICTION_3D_ADMM, true);
 }
+
+// blocks of M for a column of three bodies (ground and two body-body
+// contacts): each block is the sum over the common dynamical systems of
+// H_i W^{-1} H_j^T
+void OSNSPTest::testDelassusBlocks()
+{
+  double h = 1e-3, theta = 0.5;
+  unsigned int nb = 3;
+  SP::NonSmoothDynamicalSystem nsds(new NonSmoothDynamicalSystem(0, 1));
+  std::vector<SP::LagrangianLinearTIDS> bodies;
+  std::vector<SP::SimpleMatrix> W;
+  for(unsigned int k = 0; k < nb; ++k)
+  {
+    SP::SiconosVector q0(new SiconosVector(3));
+    SP::SiconosVector v0(new SiconosVector(3));
+    (*q0)(1) = 2.0 * k + 1.0;
+    SP::SimpleMatrix M(new SimpleMatrix(3, 3));
+    SP::SimpleMatrix K(new SimpleMatrix(3, 3));
+    SP::SimpleMatrix C(new SimpleMatrix(3, 3));
+    M->eye();
+    *M *= (k + 1.0);
+    (*M)(2, 2) = 0.3 * (k + 1);
+    (*C)(0, 1) = 0.5;
+    (*C)(1, 0) = 0.5;
+    (*C)(2, 2) = 2.0 + k;
+    (*K)(0, 0) = 10.0 * k;
+    SP::LagrangianLinearTIDS body(new LagrangianLinearTIDS(q0, v0, M, K, C));
+    SP::SiconosVector fExt(new SiconosVector(3));
+    (*fExt)(1) = -9.81 * (k + 1);
+    body->setFExtPtr(fExt);
+    nsds->insertDynamicalSystem(body);
+    bodies.push_back(body);
+    // iteration matrix of MoreauJeanOSI
+    SP::SimpleMatrix Wk(new SimpleMatrix(*M));
+    *Wk += h * theta * *C;
+    *Wk += h * h * theta * theta * *K;
+    W.push_back(Wk);
+  }
+
+  SP::NonSmoothLaw nslaw(new NewtonImpactNSL(0.5));
+  std::vector<SP::SimpleMatrix> H;
+  std::vector<SP::Interaction> interactions;
+  for(unsigned int k = 0; k < nb; ++k)
+  {
+    SP::SimpleMatrix Hk(new SimpleMatrix(1, k ? 6 : 3));
+    SP::SiconosVector e(new SiconosVector(1));
+    if(k == 0)
+    {
+      (*Hk)(0, 1) = 1.0;
+      (*Hk)(0, 2) = 0.2;
+      (*e)(0) = -1.01;
+    }
+    else
+    {
+      (*Hk)(0, 0) = 0.1;
+      (*Hk)(0, 1) = -1.0;
+      (*Hk)(0, 4) = 1.0;
+      (*Hk)(0, 5) = 0.3;
+      (*e)(0) = -2.01;
+    }
+    SP::Interaction inter(new Interaction(nslaw, std::make_shared<LagrangianLinearTIR>(Hk, e)));
+    if(k == 0)
+      nsds->link(inter, bodies[0]);
+    else
+      nsds->link(inter, bodies[k - 1], bodies[k]);
+    H.push_back(Hk);
+    interactions.push_back(inter);
+  }
+
+  SP::LCP lcp(new LCP());
+  SP::TimeStepping s(new TimeStepping(nsds, std::make_shared<TimeDiscretisation>(0, h),
+                                      std::make_shared<MoreauJeanOSI>(theta), lcp));
+  s->computeOneStep();
+
+  SP::InteractionsGraph indexSet = s->indexSet(1);
+  CPPUNIT_ASSERT_EQUAL_MESSAGE("testDelassusBlocks : ", (unsigned int)indexSet->size(), nb);
+
+  // first column of H for the interaction i and the dynamical system d, -1 if not linked
+  auto column = [](unsigned int i, unsigned int d) -> int
+  {
+    if(i == 0)
+      return d == 0 ? 0 : -1;
+    if(d == i - 1)
+      return 0;
+    return d == i ? 3 : -1;
+  };
+  SP::SiconosMatrix M = lcp->M()->defaultMatrix();
+  for(unsigned int i = 0; i < nb; ++i)
+    for(unsigned int j = 0; j < nb; ++j)
+    {
+      double Dij = 0.0;
+      for(unsigned int d = 0; d < nb; ++d)
+      {
+        int ci = column(i, d), cj = column(j, d);
+        if(ci < 0 || cj < 0)
+          continue;
+        SimpleMatrix x(3, 1);
+        for(unsigned int l = 0; l < 3; ++l)
+          x(l, 0) = (*H[j])(0, cj + l);
+        SimpleMatrix Wd(*W[d]);
+        Wd.PLUForwardBackwardInPlace(x);
+        for(unsigned int l = 0; l < 3; ++l)
+          Dij += (*H[i])(0, ci + l) * x(l, 0);
+      }
+      unsigned int pi = indexSet->properties(indexSet->descriptor(interactions[i])).absolute_position;
+      unsigned int pj = indexSet->properties(indexSet->descriptor(interactions[j])).absolute_position;
+      CPPUNIT_ASSERT_DOUBLES_EQUAL_MESSAGE("testDelassusBlocks : ", Dij, (*M)(pi, pj), 1e-12);
+    }
+}
+
+// two balls stacked on the ground, simulated with a global friction-contact
+// problem with assembled M and H, and without them (setMatrixFree)
+static SP::SiconosVector GFCBallsPositions(int solverId, bool matrixFree)
+{
+  double h = 0.005;
+  SP::NonSmoothDynamicalSystem nsds(new NonSmoothDynamicalSystem(0, 0.5));
+  std::vector<SP::LagrangianLinearTIDS> balls;
+  for(unsigned int k = 0; k < 2; ++k)
+  {
+    SP::SiconosVector q0(new SiconosVector(3));
+    SP::SiconosVector v0(new SiconosVector(3));
+    (*q0)(0) = k;
+    (*q0)(2) = 0.5 + k;
+    (*v0)(0) = 1.0;
+    (*v0)(1) = -0.5 * k;
+    SP::SiconosMatrix M(new SimpleMatrix(3, 3));
+    M->eye();
+    (*M)(2, 2) = 1.0 + k;
+    SP::LagrangianLinearTIDS ball(new LagrangianLinearTIDS(q0, v0, M));
+    SP::SiconosVector fExt(new SiconosVector(3));
+    (*fExt)(2) = -9.81 * (1.0 + k);
+    ball->setFExtPtr(fExt);
+    nsds->insertDynamicalSystem(ball);
+    balls.push_back(ball);
+  }
+  SP::NonSmoothLaw nslaw(new NewtonImpactFrictionNSL(0.5, 0., 0.3, 3));
+  // ball 0 on the ground
+  SP::SimpleMatrix H0(new SimpleMatrix(3, 3));
+  (*H0)(0, 2) = 1.0;
+  (*H0)(1, 0) = 1.0;
+  (*H0)(2, 1) = 1.0;
+  nsds->link(std::make_shared<Interaction>(nslaw, std::make_shared<LagrangianLinearTIR>(H0)), balls[0]);
+  // ball 1 on ball 0
+  SP::SimpleMatrix H1(new SimpleMatrix(3, 6));
+  (*H1)(0, 2) = 1.0;
+  (*H1)(0, 5) = -1.0;
+  (*H1)(1, 0) = 1.0;
+  (*H1)(1, 3) = -1.0;
+  (*H1)(2, 1) = 1.0;
+  (*H1)(2, 4) = -1.0;
+  SP::SiconosVector e1(new SiconosVector(3));
+  (*e1)(0) = -1.0;
+  nsds->link(std::make_shared<Interaction>(nslaw, std::make_shared<LagrangianLinearTIR>(H1, e1)), balls[1], balls[0]);
+
+  std::shared_ptr<GlobalFrictionContact> osnspb(new GlobalFrictionContact(3, solverId));
+  osnspb->numericsSolverOptions()->dparam[SICONOS_DPARAM_TOL] = 1e-10;
+  osnspb->numericsSolverOptions()->iparam[SICONOS_IPARAM_MAX_ITER] = 100000;
+  osnspb->setMatrixFree(matrixFree);
+  SP::TimeStepping s(new TimeStepping(nsds, std::make_shared<TimeDiscretisation>(0, h),
+                                      std::make_shared<MoreauJeanGOSI>(0.5), osnspb));
+  while(s->hasNextEvent())
+  {
+    s->computeOneStep();
+    s->nextStep();
+  }
+  SP::SiconosVector q(new SiconosVector(6));
+  q->setBlock(0, *balls[0]->q());
+  q->setBlock(3, *balls[1]->q());
+  return q;
+}
+
+void OSNSPTest::testGFCMatrixFree()
+{
+  SP::SiconosVector q = GFCBallsPositions(SICONOS_GLOBAL_FRICTION_3D_VI_FPP, false);
+  // the first ball rests on the ground, the second one bounces on it
+  CPPUNIT_ASSERT_DOUBLES_EQUAL_MESSAGE("testGFCMatrixFree : ", 0.0, (*q)(2), 1e-3);
+  CPPUNIT_ASSERT_EQUAL_MESSAGE("testGFCMatrixFree : ", (*q)(5) - (*q)(2) > 1.0 - 1e-3, true);
+
+  int solvers[2] = {SICONOS_GLOBAL_FRICTION_3D_VI_FPP, SICONOS_GLOBAL_FRICTION_3D_ADMM};
+  for(int solverId : solvers)
+  {
+    SP::SiconosVector q_mf = GFCBallsPositions(solverId, true);
+    for(unsigned int i = 0; i < 6; ++i)
+      CPPUNIT_ASSERT_DOUBLES_EQUAL_MESSAGE("testGFCMatrixFree : ", (*q)(i), (*q_mf)(i), 1e-6);
+  }
+}
+
+// three balls with different friction coefficients, dropped from
+// different heights so that the vertices of the index set are not in the
+// order of the interaction numbers, then sliding on the ground
+void OSNSPTest::testFrictionContactMuOrdering()
+{
+  double h = 0.005, g = 9.81, v0 = 2.0;
+  unsigned int nb = 3;
+  double mu[3] = {0.1, 0.3, 0.2};
+  SP::NonSmoothDynamicalSystem nsds(new NonSmoothDynamicalSystem(0, 0.5));
+  std::vector<SP::LagrangianLinearTIDS> balls;
+  std::vector<SP::Interaction> interactions;
+  for(unsigned int k = 0; k < nb; ++k)
+  {
+    SP::SiconosVector q0(new SiconosVector(3));
+    SP::SiconosVector v(new SiconosVector(3));
+    (*q0)(2) = 0.05 * (nb - 1 - k);
+    (*v)(0) = v0;
+    SP::SiconosMatrix M(new SimpleMatrix(3, 3));
+    M->eye();
+    SP::LagrangianLinearTIDS ball(new LagrangianLinearTIDS(q0, v, M));
+    SP::SiconosVector fExt(new SiconosVector(3));
+    (*fExt)(2) = -g;
+    ball->setFExtPtr(fExt);
+    nsds->insertDynamicalSystem(ball);
+    balls.push_back(ball);
+
+    SP::NonSmoothLaw nslaw(new NewtonImpactFrictionNSL(0.0, 0.0, mu[k], 3));
+    SP::SimpleMatrix H(new SimpleMatrix(3, 3));
+    (*H)(0, 2) = 1.0;
+    (*H)(1, 0) = 1.0;
+    (*H)(2, 1) = 1.0;
+    SP::Interaction inter(new Interaction(nslaw, std::make_shared<LagrangianLinearTIR>(H)));
+    nsds->link(inter, ball);
+    interactions.push_back(inter);
+  }
+
+  SP::FrictionContact osnspb(new FrictionContact(3));
+  osnspb->numericsSolverOptions()->dparam[SICONOS_DPARAM_TOL] = 1e-12;
+  osnspb->setMOrdering(OSNS_ORDERING_INTERACTION_NUMBER);
+  SP::TimeStepping s(new TimeStepping(nsds, std::make_shared<TimeDiscretisation>(0, h),
+                                      std::make_shared<MoreauJeanOSI>(0.5), osnspb));
+  bool reordered = false;
+  while(s->hasNextEvent())
+  {
+    s->computeOneStep();
+    SP::InteractionsGraph indexSet = s->indexSet(1);
+    InteractionsGraph::VIterator ui, uiend;
+    unsigned int rank = 0;
+    for(std::tie(ui, uiend) = indexSet->vertices(); ui != uiend; ++ui, ++rank)
+    {
+      unsigned int pos = indexSet->properties(*ui).absolute_position;
+      reordered |= (pos != 3 * rank);
+      double mu_law = std::static_pointer_cast<NewtonImpactFrictionNSL>
+                      (indexSet->bundle(*ui)->nonSmoothLaw())->mu();
+      CPPUNIT_ASSERT_EQUAL_MESSAGE("testFrictionContactMuOrdering : ", mu_law, osnspb->getMu(pos / 3));
+    }
+    s->nextStep();
+  }
+  CPPUNIT_ASSERT_EQUAL_MESSAGE("testFrictionContactMuOrdering : ", reordered, true);
+
+  // the balls do not bounce and keep sliding: the normal impulses sum up
+  // to g T and the tangential ones to mu_k g T
+  for(unsigned int k = 0; k < nb; ++k)
+    CPPUNIT_ASSERT_DOUBLES_EQUAL_MESSAGE("testFrictionContactMuOrdering : ", v0 - mu[k] * g * 0.5,
+                                         (*balls[k]->velocity())(0), 1e-2);
+}
+
+// a body sliding on the ground (interaction B, size 1) up to a wall
+// (interaction A, size 2, created first): A enters the index set after B,
+// so that the graph order differs from the interaction numbers. W built
+// with OSNS_ORDERING_INTERACTION_NUMBER, dense and sparse block, must be
+// the graph-ordered W up to the permutation of the blocks.
+void OSNSPTest::testOSNSMatrixOrdering()
+{
+  double h = 0.01;
+  SP::NonSmoothDynamicalSystem nsds(new NonSmoothDynamicalSystem(0, 0.8));
+  SP::SiconosVector q0(new SiconosVector(3));
+  SP::SiconosVector v0(new SiconosVector(3));
+  (*v0)(0) = 1.0;
+  SP::SimpleMatrix M(new SimpleMatrix(3, 3));
+  (*M)(0, 0) = 2.0;
+  (*M)(0, 1) = (*M)(1, 0) = 0.5;
+  (*M)(1, 1) = 2.0;
+  (*M)(1, 2) = (*M)(2, 1) = 0.3;
+  (*M)(2, 2) = 1.0;
+  SP::LagrangianLinearTIDS body(new LagrangianLinearTIDS(q0, v0, M));
+  SP::SiconosVector fExt(new SiconosVector(3));
+  (*fExt)(2) = -9.81;
+  body->setFExtPtr(fExt);
+  nsds->insertDynamicalSystem(body);
+
+  // wall at x = 0.5
+  SP::SimpleMatrix HA(new SimpleMatrix(2, 3));
+  (*HA)(0, 0) = -1.0;
+  (*HA)(1, 1) = 1.0;
+  SP::SiconosVector eA(new SiconosVector(2));
+  (*eA)(0) = 0.5;
+  SP::Interaction interA(new Interaction(std::make_shared<NewtonImpactNSL>(2, 0.0),
+                                         std::make_shared<LagrangianLinearTIR>(HA, eA)));
+  nsds->link(interA, body);
+  // ground
+  SP::SimpleMatrix HB(new SimpleMatrix(1, 3));
+  (*HB)(0, 1) = 0.5;
+  (*HB)(0, 2) = 1.0;
+  SP::Interaction interB(new Interaction(std::make_shared<NewtonImpactNSL>(0.0),
+                                         std::make_shared<LagrangianLinearTIR>(HB)));
+  nsds->link(interB, body);
+  CPPUNIT_ASSERT_EQUAL_MESSAGE("testOSNSMatrixOrdering : ", interA->number() < interB->number(), true);
+
+  SP::LCP lcp(new LCP());
+  lcp->setMOrdering(OSNS_ORDERING_INTERACTION_NUMBER);
+  SP::TimeStepping s(new TimeStepping(nsds, std::make_shared<TimeDiscretisation>(0, h),
+                                      std::make_shared<MoreauJeanOSI>(0.5), lcp));
+  SP::Interaction inters[2] = {interA, interB};
+  unsigned int compared = 0;
+  while(s->hasNextEvent())
+  {
+    s->computeOneStep();
+    SP::InteractionsGraph indexSet = s->indexSet(1);
+    if(indexSet->size() == 2 &&
+        indexSet->index(indexSet->descriptor(interA)) > indexSet->index(indexSet->descriptor(interB)))
+    {
+      unsigned int posG[2], posN[2];
+      OSNSMatrix WG(*indexSet, NM_DENSE);
+      for(unsigned int i = 0; i < 2; ++i)
+        posG[i] = indexSet->properties(indexSet->descriptor(inters[i])).absolute_position;
+      CPPUNIT_ASSERT_EQUAL_MESSAGE("testOSNSMatrixOrdering : ", posG[1], 0u);
+
+      int storages[2] = {NM_DENSE, NM_SPARSE_BLOCK};
+      for(int stor : storages)
+      {
+        OSNSMatrix WN(*indexSet, stor);
+        WN.setOrdering(OSNS_ORDERING_INTERACTION_NUMBER);
+        WN.fillW(*indexSet);
+        for(unsigned int i = 0; i < 2; ++i)
+          posN[i] = indexSet->properties(indexSet->descriptor(inters[i])).absolute_position;
+        CPPUNIT_ASSERT_EQUAL_MESSAGE("testOSNSMatrixOrdering : ", posN[0], 0u);
+
+        for(unsigned int i = 0; i < 2; ++i)
+          for(unsigned int j = 0; j < 2; ++j)
+            for(unsigned int a = 0; a < inters[i]->nonSmoothLaw()->size(); ++a)
+              for(unsigned int b = 0; b < inters[j]->nonSmoothLaw()->size(); ++b)
+                CPPUNIT_ASSERT_DOUBLES_EQUAL_MESSAGE("testOSNSMatrixOrdering : ",
+                                                     NM_get_value(WG.numericsMatrix().get(), posG[i] + a, posG[j] + b),
+                                                     NM_get_value(WN.numericsMatrix().get(), posN[i] + a, posN[j] + b),
+                                                     1e-14);
+      }
+      // W A,B is not zero: the test does see the extra-diagonal blocks
+      CPPUNIT_ASSERT_EQUAL_MESSAGE("testOSNSMatrixOrdering : ",
+                                   std::fabs(NM_get_value(WG.numericsMatrix().get(), posG[0] + 1, posG[1])) > 1e-3, true);
+      ++compared;
+    }
+    s->nextStep();
+  }
+  CPPUNIT_ASSERT_EQUAL_MESSAGE("testOSNSMatrixOrdering : ", compared > 0, true);
+}
+
+void OSNSPTest::testMLCPOrdering()
+{
+  double h = 0.1;
+  int orderings[2] = {OSNS_ORDERING_GRAPH, OSNS_ORDERING_INTERACTION_NUMBER};
+  double x[2][2];
+  for(unsigned int o = 0; o < 2; ++o)
+  {
+    SP::NonSmoothDynamicalSystem nsds(new NonSmoothDynamicalSystem(0, h));
+    SP::SiconosVector x0(new SiconosVector(2));
+    (*x0)(0) = 1.0;
+    (*x0)(1) = 0.05;
+    SP::SiconosVector b(new SiconosVector(2));
+    (*b)(1) = -1.0;
+    SP::FirstOrderLinearDS ds(new FirstOrderLinearDS(x0, std::make_shared<SimpleMatrix>(2, 2), b));
+    nsds->insertDynamicalSystem(ds);
+
+    // x0 = 0
+    SP::SimpleMatrix C0(new SimpleMatrix(1, 2));
+    SP::SimpleMatrix B0(new SimpleMatrix(2, 1));
+    (*C0)(0, 0) = (*B0)(0, 0) = 1.0;
+    SP::Interaction interEq(new Interaction(std::make_shared<EqualityConditionNSL>(1),
+                                            std::make_shared<FirstOrderLinearTIR>(C0, B0)));
+    // 0 <= x1 _|_ r1 >= 0
+    SP::SimpleMatrix C1(new SimpleMatrix(1, 2));
+    SP::SimpleMatrix B1(new SimpleMatrix(2, 1));
+    (*C1)(0, 1) = (*B1)(1, 0) = 1.0;
+    SP::Interaction interComp(new Interaction(std::make_shared<ComplementarityConditionNSL>(1),
+                                              std::make_shared<FirstOrderLinearTIR>(C1, B1)));
+    // the equality comes first in the numbers, last in the graph
+    nsds->link(interComp, ds);
+    nsds->link(interEq, ds);
+    CPPUNIT_ASSERT_EQUAL_MESSAGE("testMLCPOrdering : ", interEq->number() < interComp->number(), true);
+
+    SP::MLCP mlcp(new MLCP());
+    mlcp->setMOrdering(orderings[o]);
+    SP::TimeStepping s(new TimeStepping(nsds, std::make_shared<TimeDiscretisation>(0, h),
+                                        std::make_shared<EulerMoreauOSI>(0.5), mlcp));
+    s->computeOneStep();
+
+    SP::MixedLinearComplementarityProblem problem = mlcp->getNumericsMLCP();
+    CPPUNIT_ASSERT_EQUAL_MESSAGE("testMLCPOrdering : ", problem->n, 1);
+    CPPUNIT_ASSERT_EQUAL_MESSAGE("testMLCPOrdering : ", problem->m, 1);
+    InteractionsGraph& indexSet = *s->indexSet(mlcp->indexSetLevel());
+    unsigned int posEq = indexSet.properties(indexSet.descriptor(interEq)).absolute_position;
+    CPPUNIT_ASSERT_EQUAL_MESSAGE("testMLCPOrdering : ", posEq, o == 0 ? 1u : 0u);
+    CPPUNIT_ASSERT_EQUAL_MESSAGE("testMLCPOrdering : ", problem->blocksRows[posEq], (int)posEq);
+    CPPUNIT_ASSERT_EQUAL_MESSAGE("testMLCPOrdering : ", problem->blocksIsComp[posEq], 0);
+    CPPUNIT_ASSERT_EQUAL_MESSAGE("testMLCPOrdering : ", problem->blocksIsComp[1 - posEq], 1);
+
+    x[o][0] = ds->x()->getValue(0);
+    x[o][1] = ds->x()->getValue(1);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL_MESSAGE("testMLCPOrdering : ", x[o][0], 0.0, 1e-12);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL_MESSAGE("testMLCPOrdering : ", x[o][1], 0.0, 1e-12);
+  }
+  for(unsigned int i = 0; i < 2; ++i)
+    CPPUNIT_ASSERT_DOUBLES_EQUAL_MESSAGE("testMLCPOrdering : ", x[0][i], x[1][i], 1e-12);
+}
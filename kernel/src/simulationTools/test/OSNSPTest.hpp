@@ -31,11 +31,21 @@ private:
   CPPUNIT_TEST(testOSNSBuild_default);
   CPPUNIT_TEST(testOSNSBuild_solverid);
   CPPUNIT_TEST(testOSNSBuild_options);
+  CPPUNIT_TEST(testDelassusBlocks);
+  CPPUNIT_TEST(testGFCMatrixFree);
+  CPPUNIT_TEST(testFrictionContactMuOrdering);
+  CPPUNIT_TEST(testOSNSMatrixOrdering);
+  CPPUNIT_TEST(testMLCPOrdering);
   CPPUNIT_TEST_SUITE_END();
 
   void testOSNSBuild_default();
   void testOSNSBuild_solverid();
   void testOSNSBuild_options();
+  void testDelassusBlocks();
+  void testGFCMatrixFree();
+  void testFrictionContactMuOrdering();
+  void testOSNSMatrixOrdering();
+  void testMLCPOrdering();
 
 
 public:
@@ -17,6 +17,7 @@
 */
 #include "ZOHTest.hpp"
 #include "EventsManager.hpp"
+#include "MatrixIntegrator.hpp"
 #include "SiconosAlgebraProd.hpp"
 
 #define CPPUNIT_ASSERT_NOT_EQUAL(message, alpha, omega)      \
@@ -340,3 +341,42 @@ void ZOHTest::testMatrixIntegration4()
   std::cout << "------- Integration Ok, error = " << (dataPlot - dataPlotRef).normInf() << " -------" <<std::endl;
   CPPUNIT_ASSERT_EQUAL_MESSAGE("testMatrixExp4 : ", (dataPlot - dataPlotRef).normInf() < _tol, true);
 }
+
+void ZOHTest::testMatrixIntegratorExpm()
+{
+  std::cout << "===========================================" <<std::endl;
+  std::cout << " ===== ZOH tests start ... ===== " <<std::endl;
+  std::cout << "===========================================" <<std::endl;
+  std::cout << "------- Compare the matrix exponential and the ODE solver -------" <<std::endl;
+  _A->zero();
+  (*_A)(0, 1) = 1;
+  (*_A)(1, 0) = -2;
+  (*_A)(1, 1) = -0.5;
+  SP::SimpleMatrix E(new SimpleMatrix(_n, 1));
+  (*E)(0, 0) = 0.3;
+  (*E)(1, 0) = 1;
+  _DS.reset(new FirstOrderLinearTIDS(_x0, _A, _b));
+  _TD.reset(new TimeDiscretisation(_t0, _h));
+  _model.reset(new NonSmoothDynamicalSystem(_t0, _T));
+
+  MatrixIntegrator AdExpm(*_DS, *_model, *_TD);
+  MatrixIntegrator AdODE(*_DS, *_model, *_TD);
+  MatrixIntegrator BdExpm(*_DS, *_model, *_TD, E);
+  MatrixIntegrator BdODE(*_DS, *_model, *_TD, E);
+  CPPUNIT_ASSERT_EQUAL_MESSAGE("testMatrixIntegratorExpm : ", AdExpm.useExpm(), true);
+  AdODE.setUseExpm(false);
+  BdODE.setUseExpm(false);
+  AdExpm.integrate();
+  AdODE.integrate();
+  BdExpm.integrate();
+  BdODE.integrate();
+  SimpleMatrix diffAd(AdExpm.mat());
+  diffAd -= AdODE.mat();
+  SimpleMatrix diffBd(BdExpm.mat());
+  diffBd -= BdODE.mat();
+  double errAd = diffAd.normInf();
+  double errBd = diffBd.normInf();
+  std::cout << "------- Ad error = " << errAd << ", Bd error = " << errBd << " -------" <<std::endl;
+  CPPUNIT_ASSERT_EQUAL_MESSAGE("testMatrixIntegratorExpm : ", errAd < 1e-10, true);
+  CPPUNIT_ASSERT_EQUAL_MESSAGE("testMatrixIntegratorExpm : ", errBd < 1e-10, true);
+}
@@ -50,6 +50,7 @@ private:
   CPPUNIT_TEST(testMatrixIntegration2);
   CPPUNIT_TEST(testMatrixIntegration3);
   CPPUNIT_TEST(testMatrixIntegration4);
+  CPPUNIT_TEST(testMatrixIntegratorExpm);
 
   CPPUNIT_TEST_SUITE_END();
 
@@ -61,6 +62,7 @@ private:
   void testMatrixIntegration2();
   void testMatrixIntegration3();
   void testMatrixIntegration4();
+  void testMatrixIntegratorExpm();
   // Members
 
   unsigned int _n;
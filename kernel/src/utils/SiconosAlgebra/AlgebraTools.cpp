@@ -18,6 +18,8 @@
 
 #include "AlgebraTools.hpp"
 #include "SiconosMatrix.hpp"
+#include "SimpleMatrix.hpp"
+#include "SiconosMatrixException.hpp"
 #include <boost/numeric/ublas/io.hpp>
 #include "expm.hpp"
 
@@ -37,11 +39,51 @@ void expm(SiconosMatrix& A, SiconosMatrix& Exp, bool computeAndAdd)
   A.resetLU();
   Exp.resetLU();
   assert(Exp.num() == 1 || A.num() == 1);
+  // expm_pad does not handle a null input
+  if(A.normInf() == 0.0)
+  {
+    if(!computeAndAdd)
+      Exp.zero();
+    for(unsigned int i = 0; i < Exp.size(0); ++i)
+      Exp.setValue(i, i, Exp.getValue(i, i) + 1.0);
+    return;
+  }
   if(computeAndAdd)
     *Exp.dense() += expm_pad(*A.dense());
   else
     *Exp.dense() = expm_pad(*A.dense());
 }
+
+void expmVanLoan(const SiconosMatrix& A, const SiconosMatrix& E, double h,
+                 SP::SiconosMatrix Exp, SiconosMatrix& Int)
+{
+  unsigned int n = A.size(0);
+  unsigned int p = E.size(1);
+  if(A.size(1) != n || E.size(0) != n)
+    SiconosMatrixException::selfThrow("expmVanLoan: inconsistent sizes between A and E.");
+  if(Int.size(0) != n || Int.size(1) != p || (Exp && (Exp->size(0) != n || Exp->size(1) != n)))
+    SiconosMatrixException::selfThrow("expmVanLoan: inconsistent sizes of the results.");
+
+  // augmented matrix [[A h, E h], [0, 0]]
+  SimpleMatrix M(n + p, n + p);
+  for(unsigned int j = 0; j < n; ++j)
+    for(unsigned int i = 0; i < n; ++i)
+      M.setValue(i, j, h * A.getValue(i, j));
+  for(unsigned int j = 0; j < p; ++j)
+    for(unsigned int i = 0; i < n; ++i)
+      M.setValue(i, n + j, h * E.getValue(i, j));
+
+  SimpleMatrix expM(n + p, n + p);
+  expm(M, expM);
+
+  for(unsigned int j = 0; j < p; ++j)
+    for(unsigned int i = 0; i < n; ++i)
+      Int.setValue(i, j, expM.getValue(i, n + j));
+  if(Exp)
+    for(unsigned int j = 0; j < n; ++j)
+      for(unsigned int i = 0; i < n; ++i)
+        Exp->setValue(i, j, expM.getValue(i, j));
+}
 } // namespace tools
 } // namespace algebra
 } // namespace Siconos
@@ -36,6 +36,20 @@ namespace Siconos {
     \param computeAndAdd : if true, result = result + exp(A)
 **/
       void expm(SiconosMatrix& A, SiconosMatrix& Exp, bool computeAndAdd = false);
+
+/** Compute, for a time step h, Exp = exp(A h) and
+    Int = \f$\int_0^h exp(A\tau)\mathrm{d}\tau E\f$ with a single
+    matrix exponential (Van Loan block-triangular form):
+    \f[ exp\left(\begin{bmatrix} A & E \\ 0 & 0 \end{bmatrix} h\right)
+    = \begin{bmatrix} exp(A h) & \int_0^h exp(A\tau)\mathrm{d}\tau E \\ 0 & I \end{bmatrix}\f]
+    \param A : input square matrix (n x n)
+    \param E : input matrix (n x p)
+    \param h : time step
+    \param Exp : result = exp(A h), not computed if null
+    \param Int : result = \f$\int_0^h exp(A\tau)\mathrm{d}\tau E\f$ (n x p)
+**/
+      void expmVanLoan(const SiconosMatrix& A, const SiconosMatrix& E, double h,
+                       SP::SiconosMatrix Exp, SiconosMatrix& Int);
     
     } // namespace tools
   } // namespace algebra
@@ -0,0 +1,189 @@
+/* Siconos is a program dedicated to modeling, simulation and control
+ * of non smooth dynamical systems.
+ *
+ * Copyright 2020 INRIA.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+*/
+
+#include "FiniteDifferenceJacobian.hpp"
+
+#include <cmath>
+#include <limits>
+#include <algorithm>
+
+#include "SiconosVector.hpp"
+#include "SiconosMatrix.hpp"
+#include "SiconosMatrixException.hpp"
+
+// #define DEBUG_MESSAGES
+// #define DEBUG_STDOUT
+#include "debug.h"
+
+FiniteDifferenceJacobian::FiniteDifferenceJacobian():
+  _epsilon(sqrt(std::numeric_limits< double >::epsilon()))
+{}
+
+void FiniteDifferenceJacobian::setSparsityPattern(const SiconosMatrix& pattern)
+{
+  _nRows = pattern.size(0);
+  _nCols = pattern.size(1);
+  _pattern.assign(_nCols, std::vector<unsigned int>());
+  for(unsigned int j = 0; j < _nCols; ++j)
+    for(unsigned int i = 0; i < _nRows; ++i)
+      if(pattern.getValue(i, j) != 0.0)
+        _pattern[j].push_back(i);
+  colorColumns();
+}
+
+void FiniteDifferenceJacobian::detectSparsityPattern(const Function& f, const SiconosVector& x, unsigned int m)
+{
+  DEBUG_BEGIN("FiniteDifferenceJacobian::detectSparsityPattern(...)\n");
+  _nRows = m;
+  _nCols = x.size();
+  _pattern.assign(_nCols, std::vector<unsigned int>());
+
+  SiconosVector fx(m);
+  SiconosVector fp(m);
+  SiconosVector xp(x);
+  f(x, fx);
+  for(unsigned int j = 0; j < _nCols; ++j)
+  {
+    double xj = x.getValue(j);
+    xp.setValue(j, xj + _epsilon * std::max(1.0, std::fabs(xj)));
+    f(xp, fp);
+    xp.setValue(j, xj);
+    for(unsigned int i = 0; i < m; ++i)
+      if(fp.getValue(i) != fx.getValue(i))
+        _pattern[j].push_back(i);
+  }
+  colorColumns();
+  DEBUG_PRINTF("%i columns, %i groups\n", _nCols, (int)_groups.size());
+  DEBUG_END("FiniteDifferenceJacobian::detectSparsityPattern(...)\n");
+}
+
+void FiniteDifferenceJacobian::clearSparsityPattern()
+{
+  _pattern.clear();
+  _groups.clear();
+}
+
+void FiniteDifferenceJacobian::colorColumns()
+{
+  // Greedy coloring, largest columns first: a column gets the first
+  // group in which none of its rows is already used.
+  std::vector<unsigned int> order(_nCols);
+  for(unsigned int j = 0; j < _nCols; ++j)
+    order[j] = j;
+  std::stable_sort(order.begin(), order.end(),
+                   [this](unsigned int a, unsigned int b)
+  {
+    return _pattern[a].size() > _pattern[b].size();
+  });
+
+  _groups.clear();
+  // usedRows[g][i] is true if row i is already hit by a column of group g
+  std::vector<std::vector<bool> > usedRows;
+  for(unsigned int k = 0; k < _nCols; ++k)
+  {
+    unsigned int j = order[k];
+    unsigned int g = 0;
+    for(; g < _groups.size(); ++g)
+    {
+      bool conflict = false;
+      for(unsigned int i : _pattern[j])
+        if(usedRows[g][i])
+        {
+          conflict = true;
+          break;
+        }
+      if(!conflict)
+        break;
+    }
+    if(g == _groups.size())
+    {
+      _groups.push_back(std::vector<unsigned int>());
+      usedRows.push_back(std::vector<bool>(_nRows, false));
+    }
+    _groups[g].push_back(j);
+    for(unsigned int i : _pattern[j])
+      usedRows[g][i] = true;
+  }
+}
+
+void FiniteDifferenceJacobian::compute(const Function& f, const SiconosVector& x, const SiconosVector& fx,
+                                       SiconosMatrix& J, bool threadSafe)
+{
+  DEBUG_BEGIN("FiniteDifferenceJacobian::compute(...)\n");
+  unsigned int m = fx.size();
+  unsigned int n = x.size();
+  if(J.size(0) != m || J.size(1) != n)
+    SiconosMatrixException::selfThrow("FiniteDifferenceJacobian::compute, inconsistent sizes between J, x and f(x).");
+
+  if(_autoDetectPattern && !hasSparsityPattern())
+    detectSparsityPattern(f, x, m);
+
+  bool withPattern = hasSparsityPattern();
+  if(withPattern && (_nRows != m || _nCols != n))
+    SiconosMatrixException::selfThrow("FiniteDifferenceJacobian::compute, the sparsity pattern does not fit the jacobian size.");
+
+  if(withPattern)
+    J.zero();
+
+  int nGroups = withPattern ? (int)_groups.size() : (int)n;
+  _lastEvaluationsNumber = nGroups;
+
+  bool parallel = _parallel && threadSafe;
+  (void)parallel;
+#pragma omp parallel if(parallel)
+  {
+    // per-thread work vectors
+    SiconosVector xp(x);
+    SiconosVector fp(m);
+    std::vector<double> h(n);
+
+#pragma omp for schedule(dynamic)
+    for(int g = 0; g < nGroups; ++g)
+    {
+      const std::vector<unsigned int> dense_group(1, g);
+      const std::vector<unsigned int>& group = withPattern ? _groups[g] : dense_group;
+      for(unsigned int j : group)
+      {
+        double xj = x.getValue(j);
+        h[j] = _epsilon * std::max(1.0, std::fabs(xj));
+        xp.setValue(j, xj + h[j]);
+        // use the actual step, to reduce round-off errors
+        h[j] = xp.getValue(j) - xj;
+      }
+
+      f(xp, fp);
+
+      for(unsigned int j : group)
+      {
+        xp.setValue(j, x.getValue(j));
+        if(withPattern)
+        {
+          for(unsigned int i : _pattern[j])
+            J.setValue(i, j, (fp.getValue(i) - fx.getValue(i)) / h[j]);
+        }
+        else
+        {
+          for(unsigned int i = 0; i < m; ++i)
+            J.setValue(i, j, (fp.getValue(i) - fx.getValue(i)) / h[j]);
+        }
+      }
+    }
+  }
+  DEBUG_EXPR(J.display(););
+  DEBUG_END("FiniteDifferenceJacobian::compute(...)\n");
+}
@@ -0,0 +1,202 @@
+/* Siconos is a program dedicated to modeling, simulation and control
+ * of non smooth dynamical systems.
+ *
+ * Copyright 2020 INRIA.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+*/
+
+/*! \file FiniteDifferenceJacobian.hpp
+  Sparsity-aware (colored) finite-difference approximation of jacobians.
+*/
+
+#ifndef FINITEDIFFERENCEJACOBIAN_HPP
+#define FINITEDIFFERENCEJACOBIAN_HPP
+
+#include <functional>
+#include <vector>
+
+#include "SiconosFwd.hpp"
+#include "SiconosSerialization.hpp"
+
+/** Forward finite-difference approximation of the jacobian of a
+ *  function \f$ f: R^n \mapsto R^m \f$.
+ *
+ *  Without any information on the structure of the jacobian, one
+ *  evaluation of f is needed per column. When a sparsity pattern is
+ *  known (given by the user or detected by probing), structurally
+ *  orthogonal columns (columns that do not share any non-zero row) are
+ *  grouped by a greedy coloring and perturbed simultaneously, so that
+ *  the number of evaluations is the number of colors.
+ *
+ *  Evaluations of the different groups are independent. When Siconos is
+ *  built WITH_OPENMP and setParallel(true) has been called, they are
+ *  dispatched over threads: in that case the evaluated function must be
+ *  thread-safe (i.e. must not write in shared data).
+ *
+ *  Usage :
+ *  \code
+ *  FiniteDifferenceJacobian fd;
+ *  fd.detectSparsityPattern(f, x, m); // or fd.setSparsityPattern(pattern);
+ *  f(x, fx);
+ *  fd.compute(f, x, fx, J);
+ *  \endcode
+ */
+class FiniteDifferenceJacobian
+{
+public:
+
+  /** signature of the differentiated function: fx = f(x) */
+  typedef std::function<void(const SiconosVector& x, SiconosVector& fx)> Function;
+
+protected:
+  /** serialization hooks
+   */
+  ACCEPT_SERIALIZATION(FiniteDifferenceJacobian);
+
+  /** number of rows of the jacobian (size of f) */
+  unsigned int _nRows = 0;
+
+  /** number of columns of the jacobian (size of x) */
+  unsigned int _nCols = 0;
+
+  /** sparsity pattern, stored column-wise: rows of the non-zero entries of each column.
+   * Empty if no pattern is set (dense jacobian) */
+  std::vector<std::vector<unsigned int> > _pattern;
+
+  /** groups of structurally orthogonal columns, perturbed together */
+  std::vector<std::vector<unsigned int> > _groups;
+
+  /** relative perturbation step */
+  double _epsilon;
+
+  /** true if groups may be evaluated concurrently */
+  bool _parallel = false;
+
+  /** true if the sparsity pattern must be detected at the first call to compute() */
+  bool _autoDetectPattern = false;
+
+  /** number of evaluations of f done during the last call to compute() */
+  unsigned int _lastEvaluationsNumber = 0;
+
+  /** build _groups from _pattern, by a greedy coloring of the column intersection graph */
+  void colorColumns();
+
+public:
+
+  /** default constructor, no sparsity pattern (dense jacobian) and
+   *  \f$ \epsilon = \sqrt{\epsilon_{machine}} \f$
+   */
+  FiniteDifferenceJacobian();
+
+  /** destructor */
+  virtual ~FiniteDifferenceJacobian() {};
+
+  /** \return the relative perturbation step */
+  inline double epsilon() const
+  {
+    return _epsilon;
+  }
+
+  /** set the relative perturbation step. Column j is perturbed with
+   * \f$ h_j = \epsilon \max(1, |x_j|) \f$
+   * \param eps the new value
+   */
+  inline void setEpsilon(double eps)
+  {
+    _epsilon = eps;
+  }
+
+  /** \return true if groups of columns are evaluated concurrently */
+  inline bool parallel() const
+  {
+    return _parallel;
+  }
+
+  /** allow (or not) concurrent evaluations of f (only effective WITH_OPENMP)
+   * \param flag true to enable
+   */
+  inline void setParallel(bool flag)
+  {
+    _parallel = flag;
+  }
+
+  /** set the sparsity pattern of the jacobian: each non-zero entry
+   *  of pattern is a (potential) non-zero of the jacobian.
+   *  \param pattern a matrix with the dimensions of the jacobian
+   */
+  void setSparsityPattern(const SiconosMatrix& pattern);
+
+  /** compute the sparsity pattern by probing f: each column is
+   *  perturbed separately (n evaluations of f) and the rows that changed
+   *  are recorded. This pattern is kept for all subsequent calls to compute().
+   *  \param f the function
+   *  \param x the point where the pattern is probed
+   *  \param m size of f(x)
+   */
+  void detectSparsityPattern(const Function& f, const SiconosVector& x, unsigned int m);
+
+  /** \return true if the sparsity pattern is detected at the first call to compute() */
+  inline bool autoDetectPattern() const
+  {
+    return _autoDetectPattern;
+  }
+
+  /** ask for the detection of the sparsity pattern (see detectSparsityPattern())
+   *  at the first call to compute() where no pattern is available.
+   *  Warning: entries that vanish at this first point (e.g. \f$ \partial x^2/\partial x \f$ at 0)
+   *  are considered as structural zeros.
+   *  \param flag true to enable
+   */
+  inline void setAutoDetectPattern(bool flag)
+  {
+    _autoDetectPattern = flag;
+  }
+
+  /** forget the sparsity pattern, the jacobian is then considered as dense */
+  void clearSparsityPattern();
+
+  /** \return true if a sparsity pattern is available */
+  inline bool hasSparsityPattern() const
+  {
+    return !_pattern.empty();
+  }
+
+  /** \return the number of groups of columns (i.e. the number of
+   *  evaluations of f in compute()), 0 if no pattern is set */
+  inline unsigned int numberOfGroups() const
+  {
+    return _groups.size();
+  }
+
+  /** \return the number of evaluations of f done during the last call to compute() */
+  inline unsigned int lastEvaluationsNumber() const
+  {
+    return _lastEvaluationsNumber;
+  }
+
+  /** compute the jacobian of f at x, using forward differences.
+   *  Entries outside the sparsity pattern (if any) are set to zero.
+   *  If autoDetectPattern() is true and no pattern is available, it is
+   *  first detected at x.
+   *  \param f the function
+   *  \param x the point of evaluation
+   *  \param fx value of f(x)
+   *  \param[out] J the jacobian, of size fx.size() x x.size()
+   *  \param threadSafe false if f must not be called concurrently, whatever parallel() is.
+   */
+  void compute(const Function& f, const SiconosVector& x, const SiconosVector& fx,
+               SiconosMatrix& J, bool threadSafe = true);
+};
+
+#endif
@@ -0,0 +1,232 @@
+/* Siconos is a program dedicated to modeling, simulation and control
+ * of non smooth dynamical systems.
+ *
+ * Copyright 2020 INRIA.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+*/
+#include "SiconosAlgebraFixedSize.hpp"
+#include "SiconosAlgebraTypeDef.hpp"
+#include "SiconosMatrix.hpp"
+#include "SiconosVector.hpp"
+#include "BlockVector.hpp"
+
+using namespace Siconos::FixedSize;
+
+namespace
+{
+  /* y (+)= A x or y (+)= trans(A) x for a R x N block */
+  template <unsigned int R, unsigned int N>
+  struct GemvKernel
+  {
+    static void apply(bool trans, const double* A, unsigned int lda,
+                      const double* x, double* y, bool init)
+    {
+      if(trans)
+        gemvT<R, N>(A, lda, x, y, init);
+      else
+        gemv<R, N>(A, lda, x, y, init);
+    }
+  };
+
+  template <unsigned int R>
+  bool gemvCols(unsigned int n, bool trans, const double* A, unsigned int lda,
+                const double* x, double* y, bool init)
+  {
+    switch(n)
+    {
+    case 3:
+      GemvKernel<R, 3>::apply(trans, A, lda, x, y, init);
+      return true;
+    case 6:
+      GemvKernel<R, 6>::apply(trans, A, lda, x, y, init);
+      return true;
+    case 12:
+      GemvKernel<R, 12>::apply(trans, A, lda, x, y, init);
+      return true;
+    default:
+      return false;
+    }
+  }
+
+  bool fixedSizeGemv(unsigned int m, unsigned int n, bool trans,
+                     const double* A, unsigned int lda,
+                     const double* x, double* y, bool init)
+  {
+    switch(m)
+    {
+    case 1:
+      return gemvCols<1>(n, trans, A, lda, x, y, init);
+    case 2:
+      return gemvCols<2>(n, trans, A, lda, x, y, init);
+    case 3:
+      return gemvCols<3>(n, trans, A, lda, x, y, init);
+    case 5:
+      return gemvCols<5>(n, trans, A, lda, x, y, init);
+    default:
+      return false;
+    }
+  }
+
+  bool isHandledRows(unsigned int m)
+  {
+    return m == 1 || m == 2 || m == 3 || m == 5;
+  }
+
+  bool isHandledCols(unsigned int n)
+  {
+    return n == 3 || n == 6 || n == 12;
+  }
+
+  bool isDense(const SiconosMatrix& A)
+  {
+    return A.num() == Siconos::DENSE && !A.isPLUFactorized();
+  }
+
+  /* true if all the blocks of x are dense with a handled size, and if
+   * their sizes add up to size */
+  bool isHandledBlockVector(const BlockVector& x, unsigned int size)
+  {
+    unsigned int total = 0;
+    for(VectorOfVectors::const_iterator it = x.begin(); it != x.end(); ++it)
+    {
+      if(!*it || (*it)->num() != 1 || !isHandledCols((*it)->size()))
+        return false;
+      total += (*it)->size();
+    }
+    return total == size;
+  }
+
+  template <unsigned int R, unsigned int K>
+  bool gemmCols(unsigned int n, const double* A, unsigned int lda,
+                const double* B, unsigned int ldb,
+                double* C, unsigned int ldc, bool init)
+  {
+    switch(n)
+    {
+    case 1:
+      gemm<R, K, 1>(A, lda, B, ldb, C, ldc, init);
+      return true;
+    case 2:
+      gemm<R, K, 2>(A, lda, B, ldb, C, ldc, init);
+      return true;
+    case 3:
+      gemm<R, K, 3>(A, lda, B, ldb, C, ldc, init);
+      return true;
+    case 5:
+      gemm<R, K, 5>(A, lda, B, ldb, C, ldc, init);
+      return true;
+    case 6:
+      gemm<R, K, 6>(A, lda, B, ldb, C, ldc, init);
+      return true;
+    default:
+      return false;
+    }
+  }
+
+  template <unsigned int R>
+  bool gemmInner(unsigned int k, unsigned int n, const double* A, unsigned int lda,
+                 const double* B, unsigned int ldb,
+                 double* C, unsigned int ldc, bool init)
+  {
+    switch(k)
+    {
+    case 3:
+      return gemmCols<R, 3>(n, A, lda, B, ldb, C, ldc, init);
+    case 6:
+      return gemmCols<R, 6>(n, A, lda, B, ldb, C, ldc, init);
+    case 7:
+      return gemmCols<R, 7>(n, A, lda, B, ldb, C, ldc, init);
+    default:
+      return false;
+    }
+  }
+}
+
+bool fixedSizeGemm(unsigned int m, unsigned int k, unsigned int n,
+                   const double* A, unsigned int lda,
+                   const double* B, unsigned int ldb,
+                   double* C, unsigned int ldc, bool init)
+{
+  switch(m)
+  {
+  case 1:
+    return gemmInner<1>(k, n, A, lda, B, ldb, C, ldc, init);
+  case 2:
+    return gemmInner<2>(k, n, A, lda, B, ldb, C, ldc, init);
+  case 3:
+    return gemmInner<3>(k, n, A, lda, B, ldb, C, ldc, init);
+  case 5:
+    return gemmInner<5>(k, n, A, lda, B, ldb, C, ldc, init);
+  default:
+    return false;
+  }
+}
+
+bool fixedSizeProd(const SiconosMatrix& A, const BlockVector& x, SiconosVector& y, bool init)
+{
+  unsigned int m = A.size(0);
+  if(!isDense(A) || !isHandledRows(m) || y.num() != 1 || y.size() != m
+     || !isHandledBlockVector(x, A.size(1)))
+    return false;
+
+  const double* a = A.getArray();
+  double* py = y.getArray();
+  bool first = init;
+  for(VectorOfVectors::const_iterator it = x.begin(); it != x.end(); ++it)
+  {
+    unsigned int n = (*it)->size();
+    fixedSizeGemv(m, n, false, a, m, (*it)->getArray(), py, first);
+    a += m * n;
+    first = false;
+  }
+  return true;
+}
+
+bool fixedSizeProd(const SiconosVector& x, const SiconosMatrix& A, SiconosVector& y, bool init)
+{
+  unsigned int m = A.size(0);
+  if(!isDense(A) || !isHandledRows(m) || x.num() != 1 || x.size() != m
+     || y.num() != 1 || y.size() != A.size(1))
+    return false;
+  return fixedSizeGemv(m, y.size(), true, A.getArray(), m, x.getArray(), y.getArray(), init);
+}
+
+bool fixedSizeProd(const SiconosVector& x, const SiconosMatrix& A, BlockVector& y, bool init)
+{
+  unsigned int m = A.size(0);
+  if(!isDense(A) || !isHandledRows(m) || x.num() != 1 || x.size() != m
+     || !isHandledBlockVector(y, A.size(1)))
+    return false;
+
+  const double* a = A.getArray();
+  const double* px = x.getArray();
+  for(VectorOfVectors::iterator it = y.begin(); it != y.end(); ++it)
+  {
+    unsigned int n = (*it)->size();
+    fixedSizeGemv(m, n, true, a, m, px, (*it)->getArray(), init);
+    a += m * n;
+  }
+  return true;
+}
+
+bool fixedSizeProd(const SiconosMatrix& A, const SiconosMatrix& B, SiconosMatrix& C, bool init)
+{
+  unsigned int m = A.size(0);
+  unsigned int k = A.size(1);
+  unsigned int n = B.size(1);
+  if(!isDense(A) || !isDense(B) || !isDense(C)
+     || B.size(0) != k || C.size(0) != m || C.size(1) != n)
+    return false;
+  return fixedSizeGemm(m, k, n, A.getArray(), m, B.getArray(), k, C.getArray(), m, init);
+}
@@ -0,0 +1,197 @@
+/* Siconos is a program dedicated to modeling, simulation and control
+ * of non smooth dynamical systems.
+ *
+ * Copyright 2020 INRIA.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+*/
+
+/*! \file SiconosAlgebraFixedSize.hpp
+  \brief Products of small dense blocks with sizes known at compile time.
+
+  The jacobians of the contact relations are small dense blocks (1x6, 3x6,
+  5x6 for a Newton-Euler body, 2x3 for a body in the plane, ...). For these
+  sizes, the generic prod() spends most of its time in the dispatch on the
+  storage type of its arguments. The kernels below work on column-major
+  arrays (the storage of DenseMat) with sizes given as template
+  parameters, so that the loops are fully unrolled by the compiler.
+
+  fixedSizeProd() checks that its arguments are dense and that their sizes
+  are handled, does the product and returns true. Otherwise it returns false
+  and nothing is computed, the caller then falls back to prod():
+
+  \code
+  if(!fixedSizeProd(*_jachqT, *DSlink[velocity], y, true))
+    prod(*_jachqT, *DSlink[velocity], y, true);
+  \endcode
+
+  Handled sizes: 1, 2, 3 or 5 rows (dimension of the interaction) and
+  blocks of 3 or 6 columns (size of the dynamical systems), or 12 columns
+  for the vectors of two Newton-Euler bodies.
+*/
+#ifndef SICONOSALGEBRAFIXEDSIZE_H
+#define SICONOSALGEBRAFIXEDSIZE_H
+
+class SiconosMatrix;
+class SiconosVector;
+class BlockVector;
+
+namespace Siconos {
+  namespace FixedSize {
+
+    /** Dense R x C matrix with a static storage, in column-major order as DenseMat.
+     */
+    template <unsigned int R, unsigned int C>
+    struct Matrix
+    {
+      double data[R * C];
+
+      inline double& operator()(unsigned int i, unsigned int j)
+      {
+        return data[i + j * R];
+      }
+      inline double operator()(unsigned int i, unsigned int j) const
+      {
+        return data[i + j * R];
+      }
+    };
+
+    /** C = A B (or C += A B if init is false) where A is R x K with leading
+     * dimension lda, B is K x N with leading dimension ldb and C is R x N
+     * with leading dimension ldc (all column-major)
+     */
+    template <unsigned int R, unsigned int K, unsigned int N>
+    inline void gemm(const double* A, unsigned int lda,
+                     const double* B, unsigned int ldb,
+                     double* C, unsigned int ldc, bool init)
+    {
+      for(unsigned int j = 0; j < N; ++j)
+      {
+        double c[R];
+        for(unsigned int i = 0; i < R; ++i)
+          c[i] = init ? 0.0 : C[i + j * ldc];
+        for(unsigned int k = 0; k < K; ++k)
+        {
+          const double b = B[k + j * ldb];
+          for(unsigned int i = 0; i < R; ++i)
+            c[i] += A[i + k * lda] * b;
+        }
+        for(unsigned int i = 0; i < R; ++i)
+          C[i + j * ldc] = c[i];
+      }
+    }
+
+    /** y = A x (or y += A x if init is false), A is R x N with leading dimension lda
+     */
+    template <unsigned int R, unsigned int N>
+    inline void gemv(const double* A, unsigned int lda, const double* x, double* y, bool init)
+    {
+      double c[R];
+      for(unsigned int i = 0; i < R; ++i)
+        c[i] = init ? 0.0 : y[i];
+      for(unsigned int k = 0; k < N; ++k)
+        for(unsigned int i = 0; i < R; ++i)
+          c[i] += A[i + k * lda] * x[k];
+      for(unsigned int i = 0; i < R; ++i)
+        y[i] = c[i];
+    }
+
+    /** y = trans(A) x (or y += trans(A) x if init is false), A is R x N with leading dimension lda
+     */
+    template <unsigned int R, unsigned int N>
+    inline void gemvT(const double* A, unsigned int lda, const double* x, double* y, bool init)
+    {
+      for(unsigned int k = 0; k < N; ++k)
+      {
+        double c = init ? 0.0 : y[k];
+        for(unsigned int i = 0; i < R; ++i)
+          c += A[i + k * lda] * x[i];
+        y[k] = c;
+      }
+    }
+
+    /** a = b c
+     * \param b a R x K matrix
+     * \param c a K x N matrix
+     * \param[out] a the R x N result
+     */
+    template <unsigned int R, unsigned int K, unsigned int N>
+    inline void prod(const Matrix<R, K>& b, const Matrix<K, N>& c, Matrix<R, N>& a)
+    {
+      gemm<R, K, N>(b.data, R, c.data, K, a.data, R, true);
+    }
+
+  } // namespace FixedSize
+} // namespace Siconos
+
+/** computes C = A B (or C += A B if init is false) for column-major arrays
+ * when the sizes are handled by the fixed-size kernels (m in {1, 2, 3, 5},
+ * k in {3, 6, 7} and n in {1, 2, 3, 5, 6})
+ * \param m number of rows of A and C
+ * \param k number of columns of A and rows of B
+ * \param n number of columns of B and C
+ * \param A array of A, with leading dimension lda
+ * \param lda leading dimension of A
+ * \param B array of B, with leading dimension ldb
+ * \param ldb leading dimension of B
+ * \param[in,out] C array of C, with leading dimension ldc
+ * \param ldc leading dimension of C
+ * \param init if true, C is overwritten, else the product is added to C
+ * \return true if the product has been computed
+ */
+bool fixedSizeGemm(unsigned int m, unsigned int k, unsigned int n,
+                   const double* A, unsigned int lda,
+                   const double* B, unsigned int ldb,
+                   double* C, unsigned int ldc, bool init);
+
+/** fixedSizeProd(A, x, y, init) computes y = A x (or y += A x if init is false)
+ * with the fixed-size kernels, if possible
+ * \param A a dense matrix
+ * \param x a block vector with dense blocks
+ * \param[in,out] y a dense vector
+ * \param init a bool
+ * \return true if the product has been computed, false if prod() has to be used
+ */
+bool fixedSizeProd(const SiconosMatrix& A, const BlockVector& x, SiconosVector& y, bool init = true);
+
+/** fixedSizeProd(x, A, y, init) computes y = trans(A) x (or y += trans(A) x if
+ * init is false) with the fixed-size kernels, if possible
+ * \param x a dense vector
+ * \param A a dense matrix
+ * \param[in,out] y a dense vector
+ * \param init a bool
+ * \return true if the product has been computed, false if prod() has to be used
+ */
+bool fixedSizeProd(const SiconosVector& x, const SiconosMatrix& A, SiconosVector& y, bool init = true);
+
+/** fixedSizeProd(x, A, y, init) computes y = trans(A) x (or y += trans(A) x if
+ * init is false) with the fixed-size kernels, if possible
+ * \param x a dense vector
+ * \param A a dense matrix
+ * \param[in,out] y a block vector with dense blocks
+ * \param init a bool
+ * \return true if the product has been computed, false if prod() has to be used
+ */
+bool fixedSizeProd(const SiconosVector& x, const SiconosMatrix& A, BlockVector& y, bool init = true);
+
+/** fixedSizeProd(A, B, C, init) computes C = A B (or C += A B if init is false)
+ * with the fixed-size kernels, if possible
+ * \param A a dense matrix
+ * \param B a dense matrix
+ * \param[in,out] C a dense matrix
+ * \param init a bool
+ * \return true if the product has been computed, false if prod() has to be used
+ */
+bool fixedSizeProd(const SiconosMatrix& A, const SiconosMatrix& B, SiconosMatrix& C, bool init = true);
+
+#endif
@@ -20,6 +20,7 @@
 #include "SimpleMatrixTest.hpp"
 #include "SiconosAlgebra.hpp"
 #include "SiconosAlgebraProd.hpp"
+#include "SiconosAlgebraFixedSize.hpp"
 #include "SiconosAlgebraScal.hpp"
 #include "SimpleMatrixFriends.hpp"
 #include "SiconosMatrixSetBlock.hpp"
@@ -3391,6 +3392,76 @@ void SimpleMatrixTest::testProd6() // y += trans(A)*x
   std::cout << "-->  test prod6 ended with success." <<std::endl;
 }
 
+void SimpleMatrixTest::testFixedSizeProd() // small dense blocks of the contact relations
+{
+  std::cout << "--> Test: fixedSizeProd" <<std::endl;
+
+  // a 3 x 12 jacobian, as for a contact between two Newton-Euler bodies
+  SimpleMatrix H(3, 12);
+  for(unsigned int i = 0; i < 3; ++i)
+    for(unsigned int j = 0; j < 12; ++j)
+      H(i, j) = 1.0 / (1.0 + i + 2.0 * j) - 0.1 * j;
+
+  SP::SiconosVector v1(new SiconosVector(6));
+  SP::SiconosVector v2(new SiconosVector(6));
+  for(unsigned int j = 0; j < 6; ++j)
+  {
+    (*v1)(j) = 0.5 * j - 1.0;
+    (*v2)(j) = 2.0 - 0.3 * j;
+  }
+  BlockVector v(v1, v2);
+  SiconosVector y(3), yRef(3);
+
+  CPPUNIT_ASSERT_EQUAL_MESSAGE("testFixedSizeProd: ", fixedSizeProd(H, v, y), true);
+  prod(H, v, yRef);
+  for(unsigned int i = 0; i < 3; ++i)
+    CPPUNIT_ASSERT_EQUAL_MESSAGE("testFixedSizeProd: ", fabs(y(i) - yRef(i)) < tol, true);
+
+  // p += trans(H) lambda, on a block vector and on a vector
+  SiconosVector lambda(3);
+  lambda(0) = 1.5;
+  lambda(1) = -0.2;
+  lambda(2) = 0.7;
+  BlockVector p(v), pRef(v);
+  CPPUNIT_ASSERT_EQUAL_MESSAGE("testFixedSizeProd: ", fixedSizeProd(lambda, H, p, false), true);
+  prod(lambda, H, pRef, false);
+  for(unsigned int j = 0; j < 12; ++j)
+    CPPUNIT_ASSERT_EQUAL_MESSAGE("testFixedSizeProd: ", fabs(p(j) - pRef(j)) < tol, true);
+
+  SiconosVector f(12), fRef(12);
+  CPPUNIT_ASSERT_EQUAL_MESSAGE("testFixedSizeProd: ", fixedSizeProd(lambda, H, f), true);
+  prod(lambda, H, fRef);
+  for(unsigned int j = 0; j < 12; ++j)
+    CPPUNIT_ASSERT_EQUAL_MESSAGE("testFixedSizeProd: ", fabs(f(j) - fRef(j)) < tol, true);
+
+  // Delassus block W += H1 * B with H1 3 x 6 and B 6 x 3
+  SimpleMatrix H1(3, 6), B(6, 3), W(3, 3), WRef(3, 3);
+  for(unsigned int i = 0; i < 3; ++i)
+    for(unsigned int j = 0; j < 6; ++j)
+    {
+      H1(i, j) = H(i, j);
+      B(j, i) = H(i, j + 6) + 0.25 * i;
+    }
+  W.eye();
+  WRef.eye();
+  CPPUNIT_ASSERT_EQUAL_MESSAGE("testFixedSizeProd: ", fixedSizeProd(H1, B, W, false), true);
+  prod(H1, B, WRef, false);
+  for(unsigned int i = 0; i < 3; ++i)
+    for(unsigned int j = 0; j < 3; ++j)
+      CPPUNIT_ASSERT_EQUAL_MESSAGE("testFixedSizeProd: ", fabs(W(i, j) - WRef(i, j)) < tol, true);
+
+  // sizes that are not handled are left to prod
+  SimpleMatrix H4(4, 12);
+  SiconosVector y4(4);
+  CPPUNIT_ASSERT_EQUAL_MESSAGE("testFixedSizeProd: ", fixedSizeProd(H4, v, y4), false);
+  SP::SiconosVector v3(new SiconosVector(4));
+  BlockVector w(v1, v3);
+  SimpleMatrix H10(3, 10);
+  CPPUNIT_ASSERT_EQUAL_MESSAGE("testFixedSizeProd: ", fixedSizeProd(H10, w, y), false);
+
+  std::cout << "-->  test fixedSizeProd ended with success." <<std::endl;
+}
+
 // void SimpleMatrixTest::testGemv()
 // {
 //   std::cout << "--> Test: gemv" <<std::endl;
@@ -93,6 +93,7 @@ private:
   CPPUNIT_TEST(testProd4);
   CPPUNIT_TEST(testProd5);
   CPPUNIT_TEST(testProd6);
+  CPPUNIT_TEST(testFixedSizeProd);
   // CPPUNIT_TEST(testGemv);
   // CPPUNIT_TEST(testGemm);
   CPPUNIT_TEST(End);
@@ -153,6 +154,7 @@ private:
   void testProd4();
   void testProd5();
   void testProd6();
+  void testFixedSizeProd();
   // void testGemm();
   // void testGemv();
   void End();
@@ -67,6 +67,22 @@ void computeRotationMatrix(double q0, double q1, double q2, double q3,
 }
 
 
+void computeRotationMatrix(double q0, double q1, double q2, double q3,
+                           double* rotationMatrix)
+{
+  rotationMatrix[0] =     q0*q0 +q1*q1 -q2*q2 -q3*q3;
+  rotationMatrix[1] = 2.0*(q1*q2        + q0*q3);
+  rotationMatrix[2] = 2.0*(q1*q3        - q0*q2);
+
+  rotationMatrix[3] = 2.0*(q1*q2        - q0*q3);
+  rotationMatrix[4] =     q0*q0 -q1*q1 +q2*q2 -q3*q3;
+  rotationMatrix[5] = 2.0*(q2*q3         + q0*q1);
+
+  rotationMatrix[6] = 2.0*(q1*q3        + q0*q2);
+  rotationMatrix[7] = 2.0*(q2*q3        - q0*q1);
+  rotationMatrix[8] =     q0*q0 -q1*q1 -q2*q2 +q3*q3;
+}
+
 
 void quaternionRotate(double q0, double q1, double q2, double q3, SiconosVector& v)
 {
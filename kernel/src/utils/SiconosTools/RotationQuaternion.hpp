@@ -60,6 +60,13 @@ void normalizeq(SP::SiconosVector q);
 
 void computeRotationMatrix(double q0, double q1, double q2, double q3, SP::SimpleMatrix rotationMatrix);
 
+/* For a given quaternion q, compute the associated rotation matrix
+ * in a column-major array of size 9
+ * \param[in] q0, q1, q2, q3 the components of the quaternion
+ * \param[out] rotationMatrix the array of the rotation matrix
+ */
+void computeRotationMatrix(double q0, double q1, double q2, double q3, double* rotationMatrix);
+
 /* For a given configuration vector q composed of a position and a quaternion,
  * compute the associated rotation matrix
  * w.r.t the quaternion that parametrize the rotation in q,
@@ -5,6 +5,7 @@ if(WITH_${COMPONENT}_TESTING)
   # ---- Collision/native tests ----
   begin_tests(src/collision/native/test DEPS "numerics;kernel;CPPUNIT::CPPUNIT")
   new_test(SOURCES MultiBodyTest.cpp ${SIMPLE_TEST_MAIN})
+  new_test(SOURCES NativeCollisionTest.cpp ${SIMPLE_TEST_MAIN})
 
   if(WITH_BULLET)
     begin_tests(src/collision/bullet/test DEPS "numerics;kernel;CPPUNIT::CPPUNIT")
@@ -220,6 +220,8 @@ SiconosBulletOptions::SiconosBulletOptions()
   , minimumPointsPerturbationThreshold(3)
   , enableSatConvex(false)
   , enablePolyhedralContactClipping(false)
+  , lazyJacobianUpdate(false)
+  , jacobianUpdateTolerance(1e-10)
 {
 }
 
@@ -2250,6 +2252,11 @@ void SiconosBulletCollisionManager::updateInteractions(SP::Simulation simulation
 
         /* update the relation */
         SP::BulletR rel(std::static_pointer_cast<BulletR>((*p_inter)->relation()));
+        if(rel_bulletR)
+        {
+          _stats.jacobian_updates_skipped += rel_bulletR->skippedJacobianUpdates();
+          rel_bulletR->resetSkippedJacobianUpdates();
+        }
         rel->updateContactPointsFromManifoldPoint(*it->manifold, *it->point,
             flip, _options.worldScale,
             rbdsA,
@@ -2327,6 +2334,9 @@ void SiconosBulletCollisionManager::updateInteractions(SP::Simulation simulation
 
           if(!rel) continue;
 
+          if(_options.lazyJacobianUpdate)
+            rel->setLazyJacobianUpdate(true, _options.jacobianUpdateTolerance);
+
           // Fill in extra contact information
           rel->base[0] = pairA->base;
           rel->base[1] = pairB->base;
@@ -62,6 +62,12 @@ public:
   unsigned int minimumPointsPerturbationThreshold;
   bool enableSatConvex;
   bool enablePolyhedralContactClipping;
+
+  /** if true, the jacobians of the BulletR relations are only
+   * recomputed when the contact moved more than jacobianUpdateTolerance
+   * (see NewtonEuler3DR::setLazyJacobianUpdate) */
+  bool lazyJacobianUpdate;
+  double jacobianUpdateTolerance;
 };
 
 struct SiconosBulletStatistics
@@ -76,10 +82,14 @@ public:
     : new_interactions_created(0)
     , existing_interactions_processed(0)
     , interaction_warnings(0)
+    , jacobian_updates_skipped(0)
     {}
   int new_interactions_created;
   int existing_interactions_processed;
   int interaction_warnings;
+  /** jacobian updates skipped by the persistent contacts since the
+   * previous call to updateInteractions (lazyJacobianUpdate mode) */
+  int jacobian_updates_skipped;
 };
 
 class SiconosBulletCollisionManager : public SiconosCollisionManager
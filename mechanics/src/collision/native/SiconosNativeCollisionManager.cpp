@@ -0,0 +1,683 @@
+/* Siconos is a program dedicated to modeling, simulation and control
+ * of non smooth dynamical systems.
+ *
+ * Copyright 2020 INRIA.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+*/
+
+/*! \file SiconosNativeCollisionManager.cpp
+  \brief Definition of a Bullet-free interaction handler for contact
+  detection between primitive shapes.
+*/
+
+// #define DEBUG_STDOUT
+// #define DEBUG_MESSAGES 1
+#include <debug.h>
+
+#include "SiconosNativeCollisionManager.hpp"
+#include "RigidBodyDS.hpp"
+#include "ContactR.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <map>
+#include <tuple>
+#include <vector>
+
+#include <Interaction.hpp>
+#include <Simulation.hpp>
+#include <NonSmoothDynamicalSystem.hpp>
+#include <NonSmoothLaw.hpp>
+#include <SiconosVisitor.hpp>
+#include <SiconosException.hpp>
+
+/* Kinds of shapes handled by the native narrow phase */
+enum NativeShapeKind
+{
+  NATIVE_SPHERE = 0,
+  NATIVE_PLANE = 1,
+  NATIVE_BOX = 2,
+  NATIVE_CAPSULE = 3
+};
+
+/* Maximum number of contact points produced for one pair of shapes
+ * (the eight corners of a box on a plane). */
+#define NATIVE_MAX_POINTS_PER_PAIR 8
+
+/* A contactor attached to a body (ds != null) or to a static
+ * contactor set (ds == null). */
+struct NativeShapeRecord
+{
+  SP::RigidBodyDS ds;
+  SP::SiconosVector base;
+  SP::SiconosContactor contactor;
+  SP::SiconosShape shape;
+  NativeShapeKind kind;
+  const void* owner;
+};
+
+/* A candidate pair given by the broad phase. a is the shape on the
+ * side of ds1 of the future relation, b on the side of ds2. */
+struct NativePair
+{
+  unsigned int a;
+  unsigned int b;
+};
+
+/* A contact point in world frame: pa on shape a, pb on shape b, normal
+ * from b towards a. */
+struct NativeContactPoint
+{
+  double pa[3];
+  double pb[3];
+  double n[3];
+  double distance;
+};
+
+/* Identifies a persistent contact: both records and the feature
+ * (corner of a box, end of a capsule) that produced it. */
+typedef std::tuple<const void*, const SiconosContactor*,
+                   const void*, const SiconosContactor*, int> NativeContactKey;
+
+class SiconosNativeCollisionManager_impl
+{
+public:
+  std::vector<NativeShapeRecord> records;
+  std::map<const RigidBodyDS*, bool> knownBodies;
+
+  /* contiguous per-shape data, updated at each step:
+   * position (3), rotation matrix (9, row-major), dimensions (4) and
+   * bounding radius (1) */
+  std::vector<double> position;
+  std::vector<double> rotation;
+  std::vector<double> dimensions;
+  std::vector<double> boundingRadius;
+
+  std::vector<NativePair> pairs;
+  std::vector<NativeContactPoint> points;
+  std::vector<int> pointsFeatures;
+  std::vector<unsigned int> pointsNumber;
+
+  std::map<NativeContactKey, SP::Interaction> contacts;
+
+  void addContactorSet(SP::SiconosContactorSet cs, SP::RigidBodyDS ds,
+                       SP::SiconosVector base, const void* owner);
+  void updateShapes();
+  void broadPhase(double threshold, SiconosNativeCollisionStatistics& stats);
+  void narrowPhase(double threshold, bool parallel);
+};
+
+/* rotation matrix (row-major) of the unit quaternion (w,x,y,z) */
+static inline void quaternionToMatrix(double w, double x, double y, double z, double* R)
+{
+  double nq = std::sqrt(w*w + x*x + y*y + z*z);
+  if(nq > 0.0)
+  {
+    w /= nq;
+    x /= nq;
+    y /= nq;
+    z /= nq;
+  }
+  R[0] = 1.0 - 2.0*(y*y + z*z);
+  R[1] = 2.0*(x*y - w*z);
+  R[2] = 2.0*(x*z + w*y);
+  R[3] = 2.0*(x*y + w*z);
+  R[4] = 1.0 - 2.0*(x*x + z*z);
+  R[5] = 2.0*(y*z - w*x);
+  R[6] = 2.0*(x*z - w*y);
+  R[7] = 2.0*(y*z + w*x);
+  R[8] = 1.0 - 2.0*(x*x + y*y);
+}
+
+static inline double dot3(const double* a, const double* b)
+{
+  return a[0]*b[0] + a[1]*b[1] + a[2]*b[2];
+}
+
+void SiconosNativeCollisionManager_impl::addContactorSet(SP::SiconosContactorSet cs,
+    SP::RigidBodyDS ds,
+    SP::SiconosVector base,
+    const void* owner)
+{
+  for(SiconosContactorSet::iterator it = cs->begin(); it != cs->end(); ++it)
+  {
+    NativeShapeRecord record;
+    record.ds = ds;
+    record.base = base;
+    record.contactor = *it;
+    record.shape = (*it)->shape;
+    record.owner = owner;
+    if(std::dynamic_pointer_cast<SiconosSphere>(record.shape))
+      record.kind = NATIVE_SPHERE;
+    else if(std::dynamic_pointer_cast<SiconosPlane>(record.shape))
+      record.kind = NATIVE_PLANE;
+    else if(std::dynamic_pointer_cast<SiconosBox>(record.shape))
+      record.kind = NATIVE_BOX;
+    else if(std::dynamic_pointer_cast<SiconosCapsule>(record.shape))
+      record.kind = NATIVE_CAPSULE;
+    else
+      throw SiconosException("SiconosNativeCollisionManager: only spheres, planes, "
+                             "boxes and capsules are supported.");
+    records.push_back(record);
+  }
+}
+
+void SiconosNativeCollisionManager_impl::updateShapes()
+{
+  size_t n = records.size();
+  position.resize(3*n);
+  rotation.resize(9*n);
+  dimensions.resize(4*n);
+  boundingRadius.resize(n);
+
+  for(size_t i = 0; i < n; ++i)
+  {
+    const NativeShapeRecord& r = records[i];
+    double* p = &position[3*i];
+    double* R = &rotation[9*i];
+    double* d = &dimensions[4*i];
+
+    // base frame of the contactor (identity for a static set without position)
+    double Rb[9] = {1., 0., 0., 0., 1., 0., 0., 0., 1.};
+    double pb[3] = {0., 0., 0.};
+    if(r.base)
+    {
+      const SiconosVector& q = *r.base;
+      pb[0] = q(0);
+      pb[1] = q(1);
+      pb[2] = q(2);
+      quaternionToMatrix(q(3), q(4), q(5), q(6), Rb);
+    }
+
+    // shape frame = base frame * offset
+    double Ro[9] = {1., 0., 0., 0., 1., 0., 0., 0., 1.};
+    double po[3] = {0., 0., 0.};
+    if(r.contactor->offset)
+    {
+      const SiconosVector& o = *r.contactor->offset;
+      po[0] = o(0);
+      po[1] = o(1);
+      po[2] = o(2);
+      quaternionToMatrix(o(3), o(4), o(5), o(6), Ro);
+    }
+    for(int k = 0; k < 3; ++k)
+    {
+      p[k] = pb[k] + Rb[3*k]*po[0] + Rb[3*k+1]*po[1] + Rb[3*k+2]*po[2];
+      for(int l = 0; l < 3; ++l)
+        R[3*k+l] = Rb[3*k]*Ro[l] + Rb[3*k+1]*Ro[3+l] + Rb[3*k+2]*Ro[6+l];
+    }
+
+    double m = r.shape->outsideMargin();
+    d[0] = d[1] = d[2] = d[3] = 0.0;
+    switch(r.kind)
+    {
+    case NATIVE_SPHERE:
+    {
+      d[0] = std::static_pointer_cast<SiconosSphere>(r.shape)->radius() + m;
+      boundingRadius[i] = d[0];
+      break;
+    }
+    case NATIVE_BOX:
+    {
+      const SiconosVector& dim = *std::static_pointer_cast<SiconosBox>(r.shape)->dimensions();
+      d[1] = dim(0)/2 + m;
+      d[2] = dim(1)/2 + m;
+      d[3] = dim(2)/2 + m;
+      boundingRadius[i] = std::sqrt(d[1]*d[1] + d[2]*d[2] + d[3]*d[3]);
+      break;
+    }
+    case NATIVE_CAPSULE:
+    {
+      SP::SiconosCapsule capsule(std::static_pointer_cast<SiconosCapsule>(r.shape));
+      d[0] = capsule->radius() + m;
+      d[1] = capsule->length()/2;
+      boundingRadius[i] = d[0] + d[1];
+      break;
+    }
+    case NATIVE_PLANE:
+    {
+      // the surface of the plane is z = outsideMargin in the shape frame
+      p[0] += R[2]*m;
+      p[1] += R[5]*m;
+      p[2] += R[8]*m;
+      boundingRadius[i] = 0.0;
+      break;
+    }
+    }
+  }
+}
+
+/* Sweep-and-prune on the x axis for the finite shapes, and a test of
+ * every finite shape against every plane. */
+void SiconosNativeCollisionManager_impl::broadPhase(double threshold,
+    SiconosNativeCollisionStatistics& stats)
+{
+  pairs.clear();
+  size_t n = records.size();
+
+  std::vector<unsigned int> finite, planes;
+  for(unsigned int i = 0; i < n; ++i)
+  {
+    if(records[i].kind == NATIVE_PLANE)
+      planes.push_back(i);
+    else
+      finite.push_back(i);
+  }
+
+  std::sort(finite.begin(), finite.end(),
+            [this](unsigned int a, unsigned int b)
+  {
+    return position[3*a] - boundingRadius[a] < position[3*b] - boundingRadius[b];
+  });
+
+  for(size_t k = 0; k < finite.size(); ++k)
+  {
+    unsigned int i = finite[k];
+    const double* pi = &position[3*i];
+    double maxx = pi[0] + boundingRadius[i] + threshold;
+    for(size_t l = k+1; l < finite.size(); ++l)
+    {
+      unsigned int j = finite[l];
+      const double* pj = &position[3*j];
+      if(pj[0] - boundingRadius[j] > maxx)
+        break;
+      if(records[i].ds == records[j].ds)
+        continue;
+      double dx = pi[0]-pj[0], dy = pi[1]-pj[1], dz = pi[2]-pj[2];
+      double reach = boundingRadius[i] + boundingRadius[j] + threshold;
+      if(dx*dx + dy*dy + dz*dz > reach*reach)
+        continue;
+      if(records[i].kind != NATIVE_SPHERE || records[j].kind != NATIVE_SPHERE)
+      {
+        stats.unsupported_pairs++;
+        continue;
+      }
+      // ds1 of the relation must be a body
+      NativePair pair = {i, j};
+      if(!records[i].ds)
+        std::swap(pair.a, pair.b);
+      pairs.push_back(pair);
+    }
+  }
+
+  for(unsigned int p : planes)
+  {
+    const double* pp = &position[3*p];
+    const double* R = &rotation[9*p];
+    for(unsigned int i : finite)
+    {
+      if(records[i].ds == records[p].ds)
+        continue;
+      const double* pi = &position[3*i];
+      double s = R[2]*(pi[0]-pp[0]) + R[5]*(pi[1]-pp[1]) + R[8]*(pi[2]-pp[2]);
+      if(s > boundingRadius[i] + threshold)
+        continue;
+      NativePair pair = {i, p};
+      if(!records[i].ds)
+        std::swap(pair.a, pair.b);
+      pairs.push_back(pair);
+    }
+  }
+  stats.candidate_pairs = pairs.size();
+}
+
+/* sphere a against sphere b */
+static inline unsigned int sphereSphere(const double* pa, double ra,
+                                        const double* pb, double rb,
+                                        double threshold,
+                                        NativeContactPoint* out, int* features)
+{
+  double d[3] = {pa[0]-pb[0], pa[1]-pb[1], pa[2]-pb[2]};
+  double len = std::sqrt(dot3(d, d));
+  double dist = len - ra - rb;
+  if(dist >= threshold)
+    return 0;
+  double n[3] = {0., 0., 1.};
+  if(len > 0.0)
+  {
+    n[0] = d[0]/len;
+    n[1] = d[1]/len;
+    n[2] = d[2]/len;
+  }
+  for(int k = 0; k < 3; ++k)
+  {
+    out->n[k] = n[k];
+    out->pa[k] = pa[k] - ra*n[k];
+    out->pb[k] = pb[k] + rb*n[k];
+  }
+  out->distance = dist;
+  features[0] = 0;
+  return 1;
+}
+
+/* points c[i] (vertices of a shape, inflated by a radius r) against a plane */
+static inline unsigned int pointsPlane(const double* c, unsigned int nc, double r,
+                                       const double* pp, const double* np,
+                                       double threshold,
+                                       NativeContactPoint* out, int* features)
+{
+  unsigned int count = 0;
+  for(unsigned int i = 0; i < nc; ++i)
+  {
+    const double* ci = &c[3*i];
+    double s = np[0]*(ci[0]-pp[0]) + np[1]*(ci[1]-pp[1]) + np[2]*(ci[2]-pp[2]);
+    double dist = s - r;
+    if(dist >= threshold)
+      continue;
+    NativeContactPoint& pt = out[count];
+    for(int k = 0; k < 3; ++k)
+    {
+      pt.n[k] = np[k];
+      pt.pa[k] = ci[k] - r*np[k];
+      pt.pb[k] = ci[k] - s*np[k];
+    }
+    pt.distance = dist;
+    features[count] = i;
+    count++;
+  }
+  return count;
+}
+
+void SiconosNativeCollisionManager_impl::narrowPhase(double threshold, bool parallel)
+{
+  int npairs = pairs.size();
+  points.resize(NATIVE_MAX_POINTS_PER_PAIR * npairs);
+  pointsFeatures.resize(NATIVE_MAX_POINTS_PER_PAIR * npairs);
+  pointsNumber.resize(npairs);
+
+  (void)parallel;
+#pragma omp parallel for schedule(static) if(parallel)
+  for(int k = 0; k < npairs; ++k)
+  {
+    unsigned int a = pairs[k].a, b = pairs[k].b;
+    NativeContactPoint* out = &points[NATIVE_MAX_POINTS_PER_PAIR * k];
+    int* features = &pointsFeatures[NATIVE_MAX_POINTS_PER_PAIR * k];
+
+    // the plane, if any, and the other shape
+    bool flip = (records[a].kind == NATIVE_PLANE);
+    unsigned int s = flip ? b : a;
+    unsigned int p = flip ? a : b;
+    const double* ps = &position[3*s];
+    const double* Rs = &rotation[9*s];
+    const double* ds = &dimensions[4*s];
+    const double* pp = &position[3*p];
+    const double np[3] = {rotation[9*p+2], rotation[9*p+5], rotation[9*p+8]};
+
+    unsigned int count = 0;
+    if(records[p].kind == NATIVE_SPHERE)
+    {
+      count = sphereSphere(ps, ds[0], pp, dimensions[4*p], threshold, out, features);
+    }
+    else if(records[s].kind == NATIVE_SPHERE)
+    {
+      count = pointsPlane(ps, 1, ds[0], pp, np, threshold, out, features);
+    }
+    else if(records[s].kind == NATIVE_BOX)
+    {
+      double c[3*8];
+      for(int i = 0; i < 8; ++i)
+      {
+        double h[3] = {(i & 1) ? ds[1] : -ds[1],
+                       (i & 2) ? ds[2] : -ds[2],
+                       (i & 4) ? ds[3] : -ds[3]
+                      };
+        for(int l = 0; l < 3; ++l)
+          c[3*i+l] = ps[l] + Rs[3*l]*h[0] + Rs[3*l+1]*h[1] + Rs[3*l+2]*h[2];
+      }
+      count = pointsPlane(c, 8, 0.0, pp, np, threshold, out, features);
+    }
+    else if(records[s].kind == NATIVE_CAPSULE)
+    {
+      // the axis of a capsule is the y axis of its frame
+      double c[3*2];
+      for(int l = 0; l < 3; ++l)
+      {
+        c[l] = ps[l] - Rs[3*l+1]*ds[1];
+        c[3+l] = ps[l] + Rs[3*l+1]*ds[1];
+      }
+      count = pointsPlane(c, 2, ds[0], pp, np, threshold, out, features);
+    }
+
+    if(flip)
+    {
+      // the plane is on the side of ds1
+      for(unsigned int i = 0; i < count; ++i)
+        for(int l = 0; l < 3; ++l)
+        {
+          std::swap(out[i].pa[l], out[i].pb[l]);
+          out[i].n[l] = -out[i].n[l];
+        }
+    }
+    pointsNumber[k] = count;
+  }
+}
+
+SiconosNativeCollisionOptions::SiconosNativeCollisionOptions()
+  : contactBreakingThreshold(0.02)
+  , parallel(true)
+  , parallelThreshold(256)
+  , lazyJacobianUpdate(false)
+  , jacobianUpdateTolerance(1e-10)
+{
+}
+
+SiconosNativeCollisionManager::SiconosNativeCollisionManager()
+  : SiconosCollisionManager()
+  , _impl(new SiconosNativeCollisionManager_impl())
+{
+}
+
+SiconosNativeCollisionManager::SiconosNativeCollisionManager(const SiconosNativeCollisionOptions &options)
+  : SiconosCollisionManager()
+  , _impl(new SiconosNativeCollisionManager_impl())
+  , _options(options)
+{
+}
+
+SiconosNativeCollisionManager::~SiconosNativeCollisionManager()
+{
+}
+
+SiconosCollisionManager::StaticContactorSetID
+SiconosNativeCollisionManager::insertStaticContactorSet(SP::SiconosContactorSet cs,
+    SP::SiconosVector position)
+{
+  SP::SiconosVector base;
+  if(position)
+  {
+    base.reset(new SiconosVector(7));
+    base->zero();
+    (*base)(3) = 1.0;
+    for(unsigned int i = 0; i < position->size() && i < 7; ++i)
+      (*base)(i) = (*position)(i);
+  }
+  // the identifier is the address of the contactor set
+  _impl->addContactorSet(cs, SP::RigidBodyDS(), base, &*cs);
+  return (StaticContactorSetID)&*cs;
+}
+
+bool SiconosNativeCollisionManager::removeStaticContactorSet(StaticContactorSetID id)
+{
+  std::vector<NativeShapeRecord>& records = _impl->records;
+  size_t size = records.size();
+  records.erase(std::remove_if(records.begin(), records.end(),
+                               [id](const NativeShapeRecord& r)
+  {
+    return !r.ds && r.owner == id;
+  }), records.end());
+  return records.size() != size;
+}
+
+void SiconosNativeCollisionManager::removeBody(const SP::RigidBodyDS& body)
+{
+  std::vector<NativeShapeRecord>& records = _impl->records;
+  records.erase(std::remove_if(records.begin(), records.end(),
+                               [&body](const NativeShapeRecord& r)
+  {
+    return r.ds == body;
+  }), records.end());
+  _impl->knownBodies.erase(&*body);
+
+  // the interactions of the body have been removed with it from the
+  // NonSmoothDynamicalSystem, just forget them.
+  std::map<NativeContactKey, SP::Interaction>::iterator it = _impl->contacts.begin();
+  while(it != _impl->contacts.end())
+  {
+    if(std::get<0>(it->first) == &*body || std::get<2>(it->first) == &*body)
+      it = _impl->contacts.erase(it);
+    else
+      ++it;
+  }
+}
+
+class NativeCollisionUpdateVisitor : public SiconosVisitor
+{
+public:
+  using SiconosVisitor::visit;
+  SiconosNativeCollisionManager_impl &impl;
+
+  NativeCollisionUpdateVisitor(SiconosNativeCollisionManager_impl& _impl)
+    : impl(_impl) {}
+
+  void visit(SP::RigidBodyDS bds)
+  {
+    if(bds->contactors() && impl.knownBodies.find(&*bds) == impl.knownBodies.end())
+    {
+      impl.addContactorSet(bds->contactors(), bds, bds->base_position(), &*bds);
+      impl.knownBodies[&*bds] = true;
+    }
+  }
+};
+
+void SiconosNativeCollisionManager::updateInteractions(SP::Simulation simulation)
+{
+  DEBUG_BEGIN("SiconosNativeCollisionManager::updateInteractions(SP::Simulation simulation)\n");
+  // 0. gather the contactors of new RigidBodyDS dynamical systems
+  SP::SiconosVisitor updateVisitor(new NativeCollisionUpdateVisitor(*_impl));
+  simulation->nonSmoothDynamicalSystem()->visitDynamicalSystems(updateVisitor);
+
+  resetStatistics();
+  double threshold = _options.contactBreakingThreshold;
+
+  // 1. world positions of all shapes in contiguous arrays
+  _impl->updateShapes();
+
+  // 2. candidate pairs
+  _impl->broadPhase(threshold, _stats);
+
+  // 3. contact points, independently for each pair
+  _impl->narrowPhase(threshold, _options.parallel
+                     && _impl->pairs.size() >= _options.parallelThreshold);
+
+  // 4. create or update the interactions, in the order of the pairs
+  std::map<NativeContactKey, SP::Interaction> contacts;
+  SiconosVector pos1(3), pos2(3), normal(3);
+  for(size_t k = 0; k < _impl->pairs.size(); ++k)
+  {
+    const NativeShapeRecord& ra = _impl->records[_impl->pairs[k].a];
+    const NativeShapeRecord& rb = _impl->records[_impl->pairs[k].b];
+    for(unsigned int i = 0; i < _impl->pointsNumber[k]; ++i)
+    {
+      const NativeContactPoint& pt = _impl->points[NATIVE_MAX_POINTS_PER_PAIR * k + i];
+      NativeContactKey key(ra.owner, &*ra.contactor, rb.owner, &*rb.contactor,
+                           _impl->pointsFeatures[NATIVE_MAX_POINTS_PER_PAIR * k + i]);
+
+      // contact points in body frames (world frame without ds2), as
+      // expected by ContactR::updateContactPoints
+      double R1[9], R2[9];
+      const SiconosVector& q1 = *ra.ds->q();
+      quaternionToMatrix(q1(3), q1(4), q1(5), q1(6), R1);
+      double d1[3] = {pt.pa[0]-q1(0), pt.pa[1]-q1(1), pt.pa[2]-q1(2)};
+      for(int l = 0; l < 3; ++l)
+        pos1(l) = R1[l]*d1[0] + R1[3+l]*d1[1] + R1[6+l]*d1[2];
+      if(rb.ds)
+      {
+        const SiconosVector& q2 = *rb.ds->q();
+        quaternionToMatrix(q2(3), q2(4), q2(5), q2(6), R2);
+        double d2[3] = {pt.pb[0]-q2(0), pt.pb[1]-q2(1), pt.pb[2]-q2(2)};
+        for(int l = 0; l < 3; ++l)
+        {
+          pos2(l) = R2[l]*d2[0] + R2[3+l]*d2[1] + R2[6+l]*d2[2];
+          normal(l) = R2[l]*pt.n[0] + R2[3+l]*pt.n[1] + R2[6+l]*pt.n[2];
+        }
+      }
+      else
+      {
+        for(int l = 0; l < 3; ++l)
+        {
+          pos2(l) = pt.pb[l];
+          normal(l) = pt.n[l];
+        }
+      }
+
+      std::map<NativeContactKey, SP::Interaction>::iterator found = _impl->contacts.find(key);
+      if(found != _impl->contacts.end())
+      {
+        SP::ContactR rel(std::static_pointer_cast<ContactR>(found->second->relation()));
+        _stats.jacobian_updates_skipped += rel->skippedJacobianUpdates();
+        rel->resetSkippedJacobianUpdates();
+        rel->updateContactPoints(pos1, pos2, normal);
+        contacts[key] = found->second;
+        _impl->contacts.erase(found);
+        _stats.existing_interactions_processed ++;
+        continue;
+      }
+
+      SP::NonSmoothLaw nslaw = nonSmoothLaw(ra.contactor->collision_group,
+                                            rb.contactor->collision_group);
+      if(!nslaw || nslaw->size() != 3)
+        continue;
+
+      SP::ContactR rel(new ContactR());
+      rel->base[0] = ra.base;
+      rel->base[1] = rb.base;
+      rel->shape[0] = ra.shape;
+      rel->shape[1] = rb.shape;
+      rel->contactor[0] = ra.contactor;
+      rel->contactor[1] = rb.contactor;
+      rel->ds[0] = ra.ds;
+      rel->ds[1] = rb.ds;
+      rel->updateContactPoints(pos1, pos2, normal);
+      if(_options.lazyJacobianUpdate)
+        rel->setLazyJacobianUpdate(true, _options.jacobianUpdateTolerance);
+
+      // Interactions should be created before the contact is made
+      if(pt.distance < 0.0)
+      {
+        DEBUG_PRINTF("SiconosNativeCollisionManager :: Interactions must be created with positive "
+                     "distance (%f).\n", pt.distance);
+        _stats.interaction_warnings ++;
+      }
+
+      SP::Interaction inter(std::make_shared<Interaction>(nslaw, rel));
+      simulation->link(inter, ra.ds, rb.ds);
+      contacts[key] = inter;
+      _stats.new_interactions_created ++;
+    }
+  }
+
+  // 5. remaining interactions are out of the breaking threshold
+  for(std::map<NativeContactKey, SP::Interaction>::iterator it = _impl->contacts.begin();
+      it != _impl->contacts.end(); ++it)
+  {
+    simulation->unlink(it->second);
+    _stats.interactions_removed ++;
+  }
+  _impl->contacts.swap(contacts);
+
+  DEBUG_PRINTF("SiconosNativeCollisionManager :: %i pairs, %i new, %i updated, %i removed\n",
+               _stats.candidate_pairs, _stats.new_interactions_created,
+               _stats.existing_interactions_processed, _stats.interactions_removed);
+  DEBUG_END("SiconosNativeCollisionManager::updateInteractions(SP::Simulation simulation)\n");
+}
@@ -0,0 +1,140 @@
+/* Siconos is a program dedicated to modeling, simulation and control
+ * of non smooth dynamical systems.
+ *
+ * Copyright 2020 INRIA.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+*/
+
+/*! \file SiconosNativeCollisionManager.hpp
+  \brief Definition of a Bullet-free interaction handler for contact
+  detection between primitive shapes (spheres, boxes, capsules and
+  planes).
+*/
+
+#ifndef SiconosNativeCollisionManager_h
+#define SiconosNativeCollisionManager_h
+
+#include <MechanicsFwd.hpp>
+
+#include <SiconosCollisionManager.hpp>
+#include <SiconosShape.hpp>
+#include <SiconosContactor.hpp>
+
+DEFINE_SPTR(SiconosNativeCollisionManager_impl);
+
+struct SiconosNativeCollisionOptions
+{
+protected:
+  /** serialization hooks
+   */
+  ACCEPT_SERIALIZATION(SiconosNativeCollisionOptions);
+
+public:
+  SiconosNativeCollisionOptions();
+
+  /** contact points are created (and kept) while their distance is
+   * below this value */
+  double contactBreakingThreshold;
+
+  /** evaluate the narrow phase concurrently (only effective WITH_OPENMP) */
+  bool parallel;
+
+  /** minimum number of candidate pairs for a parallel narrow phase */
+  unsigned int parallelThreshold;
+
+  /** if true, the jacobians of the ContactR relations are only
+   * recomputed when the contact moved more than jacobianUpdateTolerance
+   * (see NewtonEuler3DR::setLazyJacobianUpdate) */
+  bool lazyJacobianUpdate;
+  double jacobianUpdateTolerance;
+};
+
+struct SiconosNativeCollisionStatistics
+{
+protected:
+  /** serialization hooks
+   */
+  ACCEPT_SERIALIZATION(SiconosNativeCollisionStatistics);
+
+public:
+  SiconosNativeCollisionStatistics()
+    : new_interactions_created(0)
+    , existing_interactions_processed(0)
+    , interaction_warnings(0)
+    , interactions_removed(0)
+    , candidate_pairs(0)
+    , unsupported_pairs(0)
+    , jacobian_updates_skipped(0)
+    {}
+  int new_interactions_created;
+  int existing_interactions_processed;
+  int interaction_warnings;
+  int interactions_removed;
+  int candidate_pairs;
+  int unsupported_pairs;
+  /** jacobian updates skipped by the persistent contacts since the
+   * previous call to updateInteractions (lazyJacobianUpdate mode) */
+  int jacobian_updates_skipped;
+};
+
+/** Collision manager dedicated to scenes made only of primitive
+ *  shapes.
+ *
+ *  Shapes of all the contactors (RigidBodyDS contactors and static
+ *  contactor sets) are gathered at each step in contiguous arrays
+ *  (world position, orientation and dimensions).  A sweep-and-prune
+ *  broad phase on the x axis (plus a plane/shape pass) builds a list of
+ *  candidate pairs, then the closed-form narrow-phase kernels are
+ *  evaluated independently for each pair, concurrently if Siconos is
+ *  built WITH_OPENMP.  The contact points are finally turned into
+ *  ContactR interactions, which are kept from one step to the next while
+ *  their distance is below the breaking threshold.
+ *
+ *  Supported pairs are sphere/sphere, sphere/plane, box/plane and
+ *  capsule/plane. Other pairs between supported shapes are ignored (and
+ *  counted in SiconosNativeCollisionStatistics::unsupported_pairs);
+ *  other shapes are rejected with an exception.
+ */
+class SiconosNativeCollisionManager : public SiconosCollisionManager
+{
+protected:
+  /** serialization hooks
+   */
+  ACCEPT_SERIALIZATION(SiconosNativeCollisionManager);
+
+  SP::SiconosNativeCollisionManager_impl _impl;
+
+  SiconosNativeCollisionOptions _options;
+  SiconosNativeCollisionStatistics _stats;
+
+public:
+  SiconosNativeCollisionManager();
+  SiconosNativeCollisionManager(const SiconosNativeCollisionOptions &options);
+  virtual ~SiconosNativeCollisionManager();
+
+  StaticContactorSetID insertStaticContactorSet(
+    SP::SiconosContactorSet cs, SP::SiconosVector position = SP::SiconosVector());
+
+  bool removeStaticContactorSet(StaticContactorSetID id);
+
+  void removeBody(const SP::RigidBodyDS& body);
+
+  void updateInteractions(SP::Simulation simulation);
+
+  const SiconosNativeCollisionOptions &options() const { return _options; }
+  const SiconosNativeCollisionStatistics &statistics() const { return _stats; }
+  void resetStatistics() { _stats = SiconosNativeCollisionStatistics(); }
+};
+
+#endif /* SiconosNativeCollisionManager.hpp */
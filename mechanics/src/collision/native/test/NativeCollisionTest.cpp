@@ -0,0 +1,162 @@
+/* Siconos is a program dedicated to modeling, simulation and control
+ * of non smooth dynamical systems.
+ *
+ * Copyright 2020 INRIA.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+*/
+#include "NativeCollisionTest.hpp"
+
+#include "SiconosContactor.hpp"
+#include "SiconosShape.hpp"
+#include "SiconosNativeCollisionManager.hpp"
+#include "RigidBodyDS.hpp"
+#include "SolverOptions.h"
+#include "SiconosKernel.hpp"
+
+#include <string>
+
+// test suite registration
+CPPUNIT_TEST_SUITE_REGISTRATION(NativeCollisionTest);
+
+void NativeCollisionTest::setUp() {}
+void NativeCollisionTest::tearDown() {}
+
+struct NativeDropResult
+{
+  double final_position;
+  int num_interactions;
+  int max_interactions;
+};
+
+/* Drop a body on a static plane (or on a static sphere of radius 1
+ * centred at z=-1.5), and return its final altitude. */
+static
+NativeDropResult dropTest(std::string moving, std::string ground, double position)
+{
+  double t0 = 0;
+  double T = 2.0;
+  double h = 0.005;
+  double g = 9.81;
+  double mass = 1.0;
+
+  SP::NonSmoothDynamicalSystem nsds(new NonSmoothDynamicalSystem(t0, T));
+
+  SP::SiconosVector q0(new SiconosVector(7));
+  SP::SiconosVector v0(new SiconosVector(6));
+  q0->zero();
+  v0->zero();
+  (*q0)(2) = position;
+  (*q0)(3) = 1.0;
+
+  SP::RigidBodyDS body(new RigidBodyDS(q0, v0, mass));
+  SP::SiconosContactorSet contactors(new SiconosContactorSet());
+  if(moving == "sphere")
+    contactors->push_back(std::make_shared<SiconosContactor>(
+                            std::make_shared<SiconosSphere>(0.5)));
+  else if(moving == "box")
+    contactors->push_back(std::make_shared<SiconosContactor>(
+                            std::make_shared<SiconosBox>(1.0, 1.0, 1.0)));
+  else if(moving == "capsule")
+  {
+    // capsule lying along x (its axis is y in its own frame)
+    SP::SiconosVector offset(new SiconosVector(7));
+    offset->zero();
+    (*offset)(3) = cos(M_PI/4);
+    (*offset)(6) = sin(M_PI/4);
+    contactors->push_back(std::make_shared<SiconosContactor>(
+                            std::make_shared<SiconosCapsule>(0.5, 1.0), offset));
+  }
+  body->setContactors(contactors);
+
+  SP::SiconosVector FExt(new SiconosVector(3));
+  FExt->zero();
+  FExt->setValue(2, - g * mass);
+  body->setFExtPtr(FExt);
+  nsds->insertDynamicalSystem(body);
+
+  SP::SiconosContactorSet static_contactors(std::make_shared<SiconosContactorSet>());
+  if(ground == "plane")
+    static_contactors->push_back(std::make_shared<SiconosContactor>(
+                                   std::make_shared<SiconosPlane>()));
+  else if(ground == "sphere")
+  {
+    SP::SiconosVector pos(new SiconosVector(7));
+    pos->zero();
+    (*pos)(2) = -1.5;
+    (*pos)(3) = 1.0;
+    static_contactors->push_back(std::make_shared<SiconosContactor>(
+                                   std::make_shared<SiconosSphere>(1.0), pos));
+  }
+
+  SP::TimeDiscretisation timedisc(new TimeDiscretisation(t0, h));
+  SP::FrictionContact osnspb(new FrictionContact(3));
+  osnspb->numericsSolverOptions()->iparam[SICONOS_IPARAM_MAX_ITER] = 1000;
+  osnspb->numericsSolverOptions()->dparam[SICONOS_DPARAM_TOL] = 1e-8;
+  osnspb->setMaxSize(16384);
+  osnspb->setMStorageType(1);
+
+  SP::TimeStepping simulation(new TimeStepping(nsds, timedisc));
+  simulation->insertIntegrator(std::make_shared<MoreauJeanOSI>(0.5));
+  simulation->insertNonSmoothProblem(osnspb);
+
+  SP::SiconosNativeCollisionManager collisionMan(new SiconosNativeCollisionManager());
+  simulation->insertInteractionManager(collisionMan);
+  collisionMan->insertStaticContactorSet(static_contactors);
+  collisionMan->insertNonSmoothLaw(std::make_shared<NewtonImpactFrictionNSL>(0.0, 0., 0.5, 3), 0, 0);
+
+  NativeDropResult result = {0.0, 0, 0};
+  while(simulation->hasNextEvent())
+  {
+    simulation->computeOneStep();
+    int n = nsds->topology()->indexSet0()->size();
+    result.max_interactions = std::max(result.max_interactions, n);
+    result.num_interactions += collisionMan->statistics().new_interactions_created;
+    simulation->nextStep();
+  }
+  result.final_position = (*body->q())(2);
+  return result;
+}
+
+void NativeCollisionTest::t1()
+{
+  std::cout << "\n===========================================\n";
+  std::cout << " ===== NativeCollisionTest tests start ... ===== " << std::endl;
+  std::cout << "===========================================\n";
+  std::cout << "------- sphere on plane -------" << std::endl;
+  NativeDropResult r = dropTest("sphere", "plane", 1.0);
+  CPPUNIT_ASSERT_MESSAGE("sphere on plane: one contact", r.max_interactions == 1);
+  CPPUNIT_ASSERT_DOUBLES_EQUAL_MESSAGE("sphere on plane: resting position", 0.5, r.final_position, 2e-2);
+
+  std::cout << "------- sphere on sphere -------" << std::endl;
+  r = dropTest("sphere", "sphere", 1.0);
+  CPPUNIT_ASSERT_MESSAGE("sphere on sphere: one contact", r.max_interactions == 1);
+  CPPUNIT_ASSERT_DOUBLES_EQUAL_MESSAGE("sphere on sphere: resting position", 0.0, r.final_position, 2e-2);
+}
+
+void NativeCollisionTest::t2()
+{
+  std::cout << "------- box on plane -------" << std::endl;
+  NativeDropResult r = dropTest("box", "plane", 1.0);
+  CPPUNIT_ASSERT_MESSAGE("box on plane: four contacts", r.max_interactions == 4);
+  CPPUNIT_ASSERT_DOUBLES_EQUAL_MESSAGE("box on plane: resting position", 0.5, r.final_position, 2e-2);
+}
+
+void NativeCollisionTest::t3()
+{
+  std::cout << "------- capsule on plane -------" << std::endl;
+  NativeDropResult r = dropTest("capsule", "plane", 1.0);
+  CPPUNIT_ASSERT_MESSAGE("capsule on plane: two contacts", r.max_interactions == 2);
+  CPPUNIT_ASSERT_DOUBLES_EQUAL_MESSAGE("capsule on plane: resting position", 0.5, r.final_position, 2e-2);
+  std::cout << "\n ===== NativeCollisionTest tests end ===== " << std::endl;
+}
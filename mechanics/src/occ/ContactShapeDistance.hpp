@@ -18,6 +18,14 @@ struct ContactShapeDistance
   double ny;
   double nz;
 
+  /** surface/curve parameters of the closest points found by the last
+   * query, in the order of the distance function arguments: (u, v) on
+   * the face, then (u, v) on the second face or u on the edge */
+  double uv[4];
+
+  /** true if uv holds the result of a previous query */
+  bool hasUV = false;
+
 };
 
 #endif
@@ -17,6 +17,10 @@ struct CadmbtbDistanceType : DistanceCalculatorType { ACCEPT_STD_VISITORS(); };
 struct Geometer : public Question<ContactShapeDistance>
 {
   Geometer() {};
+
+  /** start each query from the closest points of the previous one
+   * (answer.uv), if the distance calculator supports it */
+  bool warmStart = false;
 };
 
 template<typename DistType>
@@ -25,7 +29,8 @@ void distanceFaceFace(const OccContactFace& csh1,
                       Standard_Real& X1, Standard_Real& Y1, Standard_Real& Z1,
                       Standard_Real& X2, Standard_Real& Y2, Standard_Real& Z2,
                       Standard_Real& nX, Standard_Real& nY, Standard_Real& nZ,
-                      Standard_Real& MinDist)
+                      Standard_Real& MinDist,
+                      Standard_Real* uv, bool warmStart)
 {}
 
 template<typename DistType>
@@ -34,7 +39,8 @@ void distanceFaceEdge(const OccContactFace& csh1,
                       Standard_Real& X1, Standard_Real& Y1, Standard_Real& Z1,
                       Standard_Real& X2, Standard_Real& Y2, Standard_Real& Z2,
                       Standard_Real& nX, Standard_Real& nY, Standard_Real& nZ,
-                      Standard_Real& MinDist)
+                      Standard_Real& MinDist,
+                      Standard_Real* uv, bool warmStart)
 {}
 
 template<typename DistType>
@@ -43,7 +49,8 @@ void distanceEdgeEdge(const OccContactEdge& csh1,
                       Standard_Real& X1, Standard_Real& Y1, Standard_Real& Z1,
                       Standard_Real& X2, Standard_Real& Y2, Standard_Real& Z2,
                       Standard_Real& nX, Standard_Real& nY, Standard_Real& nZ,
-                      Standard_Real& MinDist)
+                      Standard_Real& MinDist,
+                      Standard_Real* uv, bool warmStart)
 {
   throw "Geometer: Edge-Edge distance unimplemented";
 }
@@ -55,10 +62,11 @@ void distanceFaceFace<CadmbtbDistanceType>(const OccContactFace& csh1,
                                    Standard_Real& X1, Standard_Real& Y1, Standard_Real& Z1,
                                    Standard_Real& X2, Standard_Real& Y2, Standard_Real& Z2,
                                    Standard_Real& nX, Standard_Real& nY, Standard_Real& nZ,
-                                   Standard_Real& MinDist)
+                                   Standard_Real& MinDist,
+                                   Standard_Real* uv, bool warmStart)
 {
   cadmbtb_distanceFaceFace(csh1, csh2, X1, Y1, Z1, X2, Y2, Z2, nX, nY, nZ,
-                           MinDist);
+                           MinDist, uv, warmStart);
 }
 
 template<>
@@ -67,10 +75,11 @@ void distanceFaceEdge<CadmbtbDistanceType>(const OccContactFace& csh1,
                                    Standard_Real& X1, Standard_Real& Y1, Standard_Real& Z1,
                                    Standard_Real& X2, Standard_Real& Y2, Standard_Real& Z2,
                                    Standard_Real& nX, Standard_Real& nY, Standard_Real& nZ,
-                                   Standard_Real& MinDist)
+                                   Standard_Real& MinDist,
+                                   Standard_Real* uv, bool warmStart)
 {
   cadmbtb_distanceFaceEdge(csh1, csh2, X1, Y1, Z1, X2, Y2, Z2, nX, nY, nZ,
-                           MinDist);
+                           MinDist, uv, warmStart);
 }
 
 
@@ -80,10 +89,12 @@ void distanceFaceFace<OccDistanceType>(const OccContactFace& csh1,
                                        Standard_Real& X1, Standard_Real& Y1, Standard_Real& Z1,
                                        Standard_Real& X2, Standard_Real& Y2, Standard_Real& Z2,
                                        Standard_Real& nX, Standard_Real& nY, Standard_Real& nZ,
-                                       Standard_Real& MinDist)
+                                       Standard_Real& MinDist,
+                                       Standard_Real* uv, bool warmStart)
 {
+  // BRepExtrema has no starting point: the parameters are only returned
   occ_distanceFaceFace(csh1, csh2, X1, Y1, Z1, X2, Y2, Z2, nX, nY, nZ,
-                       MinDist);
+                       MinDist, uv);
 }
 
 template<>
@@ -92,9 +103,11 @@ void distanceFaceEdge<OccDistanceType>(const OccContactFace& csh1,
                                Standard_Real& X1, Standard_Real& Y1, Standard_Real& Z1,
                                Standard_Real& X2, Standard_Real& Y2, Standard_Real& Z2,
                                Standard_Real& nX, Standard_Real& nY, Standard_Real& nZ,
-                               Standard_Real& MinDist)
+                               Standard_Real& MinDist,
+                               Standard_Real* uv, bool warmStart)
 {
-  occ_distanceFaceEdge(csh1, csh2, X1, Y1, Z1, X2, Y2, Z2, nX, nY, nZ, MinDist);
+  occ_distanceFaceEdge(csh1, csh2, X1, Y1, Z1, X2, Y2, Z2, nX, nY, nZ, MinDist,
+                       uv);
 }
 
 template <typename DistType>
@@ -114,7 +127,9 @@ struct FaceGeometer : public Geometer
                                dist.x1, dist.y1, dist.z1,
                                dist.x2, dist.y2, dist.z2,
                                dist.nx, dist.ny, dist.nz,
-                               dist.value);
+                               dist.value,
+                               dist.uv, this->warmStart && dist.hasUV);
+    dist.hasUV = true;
   }
   void visit(const OccContactEdge& edge2)
   {
@@ -124,7 +139,9 @@ struct FaceGeometer : public Geometer
                                dist.x1, dist.y1, dist.z1,
                                dist.x2, dist.y2, dist.z2,
                                dist.nx, dist.ny, dist.nz,
-                               dist.value);
+                               dist.value,
+                               dist.uv, this->warmStart && dist.hasUV);
+    dist.hasUV = true;
     dist.nx = -dist.nx;
     dist.ny = -dist.ny;
     dist.nz = -dist.nz;
@@ -149,7 +166,9 @@ struct EdgeGeometer : public Geometer
                                dist.x1, dist.y1, dist.z1,
                                dist.x2, dist.y2, dist.z2,
                                dist.nx, dist.ny, dist.nz,
-                               dist.value);
+                               dist.value,
+                               dist.uv, this->warmStart && dist.hasUV);
+    dist.hasUV = true;
   }
   void visit(const OccContactEdge& edge2)
   {
@@ -159,7 +178,9 @@ struct EdgeGeometer : public Geometer
                                dist.x1, dist.y1, dist.z1,
                                dist.x2, dist.y2, dist.z2,
                                dist.nx, dist.ny, dist.nz,
-                               dist.value);
+                               dist.value,
+                               dist.uv, this->warmStart && dist.hasUV);
+    dist.hasUV = true;
   }
 
 };
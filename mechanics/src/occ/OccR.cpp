@@ -4,6 +4,8 @@
 #include "ContactShapeDistance.hpp"
 #include "WhichGeometer.hpp"
 #include "RuntimeException.hpp"
+#include "BlockVector.hpp"
+#include <cmath>
 #include <limits>
 #include <iostream>
 #include <boost/typeof/typeof.hpp>
@@ -19,7 +21,12 @@ OccR::OccR(const ContactPoint& contact1,
   _contact2(contact2),
   _geometer(),
   _offset1(0.),
-  _offset2(0.)
+  _offset2(0.),
+  _useCache(true),
+  _cacheTolerance(0.),
+  _cacheValid(false),
+  _cacheHits(0),
+  _distanceQueries(0)
 {
   DEBUG_BEGIN("OccR::OccR(const ContactPoint& contact1, const ContactPoint& contact2,                         const DistanceCalculatorType& distance_calculator)\n");
   switch(Type::value(distance_calculator))
@@ -33,19 +40,47 @@ OccR::OccR(const ContactPoint& contact1,
   default:
     RuntimeException::selfThrow("OccR: Unknown distance calculator");
   }
+  this->_geometer->warmStart = true;
   this->_contact2.contactShape().accept(*this->_geometer);
     
   DEBUG_END("OccR::OccR(const ContactPoint& contact1, const ContactPoint& contact2,                         const DistanceCalculatorType& distance_calculator)\n");
 }
 
 
+void OccR::computeDistance(const BlockVector& q0)
+{
+  if(_useCache && _cacheValid && _cachedPositions.size() == q0.size())
+  {
+    bool hit = true;
+    for(unsigned int i = 0; i < q0.size() && hit; ++i)
+      hit = std::fabs(q0.getValue(i) - _cachedPositions[i]) <= _cacheTolerance;
+    if(hit)
+    {
+      DEBUG_PRINT("OccR::computeDistance: cache hit\n");
+      this->_geometer->answer = _cachedDistance;
+      ++_cacheHits;
+      return;
+    }
+  }
+
+  this->_contact2.contactShape().accept(*this->_geometer);
+  ++_distanceQueries;
+
+  if(_useCache)
+  {
+    _cachedPositions.resize(q0.size());
+    for(unsigned int i = 0; i < q0.size(); ++i)
+      _cachedPositions[i] = q0.getValue(i);
+    _cachedDistance = this->_geometer->answer;
+    _cacheValid = true;
+  }
+}
+
 void OccR::computeh(double time, const BlockVector& q0, SiconosVector& y)
 {
   DEBUG_BEGIN("OccR::computeh(double time, BlockVector& q0, SiconosVector& y)\n");
-  this->_contact2.contactShape().accept(*this->_geometer);
+  computeDistance(q0);
 
-  
-  
   ContactShapeDistance& dist = this->_geometer->answer;
 
   DEBUG_PRINTF("---->%g P1=(%g, %g, %g) P2=(%g,%g,%g) N=(%g, %g, %g)\n", dist.value,
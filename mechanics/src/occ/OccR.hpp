@@ -29,6 +29,8 @@
 #include <SiconosFwd.hpp>
 #include <NewtonEuler3DR.hpp>
 
+#include <vector>
+
 class OccR : public NewtonEuler3DR
 {
 public:
@@ -47,6 +49,43 @@ public:
    */
   void computeh(double time, const BlockVector& q0, SiconosVector& y);
 
+  /** Compute the distance between the contact shapes (geometer answer)
+   *  for the positions q0 of the bodies. If the cache is enabled and q0
+   *  did not move more than the cache tolerance since the last query,
+   *  the previous distance is reused. This is called by computeh and, in
+   *  parallel for all the contacts, by OccTimeStepping::updateWorldFromDS.
+   *  \param q0 : the state vector.
+   */
+  void computeDistance(const BlockVector& q0);
+
+  /** Enable or disable the reuse of the last computed distance.
+   * \param val : true to enable the cache (default).
+   */
+  void setUseCache(bool val) { _useCache = val; _cacheValid = false; };
+
+  /** Set the cache tolerance: the last distance is reused while no
+   *  component of q0 moved more than this value (0 by default, ie only
+   *  for the same positions).
+   * \param val : the new value.
+   */
+  void setCacheTolerance(double val) { _cacheTolerance = val; };
+
+  /** Start each distance query from the closest points of the previous
+   *  one (CadmbtbDistanceType only).
+   * \param val : true to enable the warm start (default).
+   */
+  void setWarmStart(bool val) { _geometer->warmStart = val; };
+
+  /** Get the number of distance queries answered by the cache.
+   * \return an unsigned int
+   */
+  unsigned int cacheHits() const { return _cacheHits; };
+
+  /** Get the number of computed distance queries.
+   * \return an unsigned int
+   */
+  unsigned int distanceQueries() const { return _distanceQueries; };
+
   /** Set offset1, offset from first contact.
    * \param val : the new value.
    */
@@ -79,6 +118,16 @@ protected:
 
   double _offset1;
   double _offset2;
+
+  /** distance cache, keyed on the positions of the bodies */
+  bool _useCache;
+  double _cacheTolerance;
+  bool _cacheValid;
+  std::vector<double> _cachedPositions;
+  ContactShapeDistance _cachedDistance;
+
+  unsigned int _cacheHits;
+  unsigned int _distanceQueries;
 };
 
 #endif
@@ -11,8 +11,16 @@ class OccBody;
 
 #include "OccTimeStepping.hpp"
 #include "OccBody.hpp"
+#include "OccR.hpp"
 
 #include <NonSmoothDynamicalSystem.hpp>
+#include <Topology.hpp>
+#include <Interaction.hpp>
+#include <NewtonEulerR.hpp>
+#include <BlockVector.hpp>
+
+#include <exception>
+#include <vector>
 
 #include <SiconosVisitor.hpp>
 
@@ -51,4 +59,48 @@ void OccTimeStepping::updateWorldFromDS()
     dsg.bundle(*dsi)->accept(up);
   }
 
+  // the shapes have moved: compute the distances of all the contacts,
+  // each OccR keeps its own answer so that they are independent
+  std::vector<OccR*> relations;
+  std::vector<BlockVector*> positions;
+  InteractionsGraph& indexSet0 = *_nsds->topology()->indexSet0();
+  InteractionsGraph::VIterator ui, uiend;
+  for(std::tie(ui, uiend) = indexSet0.vertices(); ui != uiend; ++ui)
+  {
+    Interaction& inter = *indexSet0.bundle(*ui);
+    OccR* relation = dynamic_cast<OccR*>(inter.relation().get());
+    VectorOfBlockVectors& DSlink = inter.linkToDSVariables();
+    // not yet initialized interactions are computed later by computeh
+    if(relation && DSlink.size() > NewtonEulerR::q0 && DSlink[NewtonEulerR::q0])
+    {
+      relations.push_back(relation);
+      positions.push_back(DSlink[NewtonEulerR::q0].get());
+    }
+  }
+
+  int nrelations = relations.size();
+  bool parallel = _parallelDistances && nrelations > 1;
+  (void)parallel;
+  // an exception must not leave the parallel region: the first one
+  // caught is raised again after the loop
+  std::exception_ptr error;
+#pragma omp parallel for schedule(dynamic) if(parallel)
+  for(int i = 0; i < nrelations; ++i)
+  {
+    try
+    {
+      relations[i]->computeDistance(*positions[i]);
+    }
+    catch(...)
+    {
+#pragma omp critical(occ_distance_error)
+      {
+        if(!error)
+          error = std::current_exception();
+      }
+    }
+  }
+  if(error)
+    std::rethrow_exception(error);
+
 }
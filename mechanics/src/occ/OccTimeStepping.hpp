@@ -12,8 +12,24 @@ public:
 
   OccTimeStepping(SP::NonSmoothDynamicalSystem nsds, SP::TimeDiscretisation td) : TimeStepping(nsds,td) {};
 
+  /** Move the contact shapes of the bodies, then compute the distances
+   *  of all the OccR interactions (concurrently if parallelDistances()
+   *  and Siconos is built WITH_OPENMP); computeh then reuses them.
+   */
   virtual void updateWorldFromDS();
 
+  /** Compute the contact distances concurrently (default true).
+   * \param val : the new value.
+   */
+  void setParallelDistances(bool val) { _parallelDistances = val; };
+
+  /** \return true if the contact distances are computed concurrently */
+  bool parallelDistances() const { return _parallelDistances; };
+
+protected:
+
+  bool _parallelDistances = true;
+
 };
 
 #endif
@@ -28,7 +28,8 @@ void occ_distanceFaceFace(const OccContactFace& csh1,
                           Standard_Real& X1, Standard_Real& Y1, Standard_Real& Z1,
                           Standard_Real& X2, Standard_Real& Y2, Standard_Real& Z2,
                           Standard_Real& nX, Standard_Real& nY, Standard_Real& nZ,
-                          Standard_Real& MinDist)
+                          Standard_Real& MinDist,
+                          Standard_Real* uv)
 {
   // need the 2 sp pointers to keep memory
   SPC::TopoDS_Face pface1 = csh1.contact();
@@ -70,6 +71,14 @@ void occ_distanceFaceFace(const OccContactFace& csh1,
         }
         normal.Coord(nX,nY,nZ);
         MinDist = measure.Value();
+        if(uv)
+        {
+          uv[0] = uv[1] = 0.;
+          if(measure.SupportTypeShape1(i) == BRepExtrema_IsInFace)
+            measure.ParOnFaceS1(i, uv[0], uv[1]);
+          uv[2] = u;
+          uv[3] = v;
+        }
         break;
       }
     }
@@ -82,7 +91,8 @@ void occ_distanceFaceEdge(const OccContactFace& csh1,
                           Standard_Real& X1, Standard_Real& Y1, Standard_Real& Z1,
                           Standard_Real& X2, Standard_Real& Y2, Standard_Real& Z2,
                           Standard_Real& nX, Standard_Real& nY, Standard_Real& nZ,
-                          Standard_Real& MinDist)
+                          Standard_Real& MinDist,
+                          Standard_Real* uv)
 {
   // need the 2 sp pointers to keep memory
   SPC::TopoDS_Face pface1 = csh1.contact();
@@ -122,6 +132,14 @@ void occ_distanceFaceEdge(const OccContactFace& csh1,
           normal.Reverse();
         normal.Coord(nX,nY,nZ);
         MinDist = measure.Value();
+        if(uv)
+        {
+          uv[0] = u;
+          uv[1] = v;
+          uv[2] = 0.;
+          if(measure.SupportTypeShape2(i) == BRepExtrema_IsOnEdge)
+            measure.ParOnEdgeS2(i, uv[2]);
+        }
         break;
       }
     }
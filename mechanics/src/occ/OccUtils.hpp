@@ -10,18 +10,24 @@ class OccContactEdge;
 
 void occ_move(TopoDS_Shape& shape, const SiconosVector& pos);
 
+/** Minimal distance between two faces (resp. a face and an edge) with
+ * BRepExtrema_DistShapeShape. If uv is given, the parameters of the
+ * closest points are returned in it (as in cadmbtb_distanceFaceFace).
+ */
 void occ_distanceFaceFace(const OccContactFace& csh1,
                           const OccContactFace& csh2,
                           Standard_Real& X1, Standard_Real& Y1, Standard_Real& Z1,
                           Standard_Real& X2, Standard_Real& Y2, Standard_Real& Z2,
                           Standard_Real& nX, Standard_Real& nY, Standard_Real& nZ,
-                          Standard_Real& MinDist);
+                          Standard_Real& MinDist,
+                          Standard_Real* uv = nullptr);
 
 void occ_distanceFaceEdge(const OccContactFace& csh1,
                           const OccContactEdge& csh2,
                           Standard_Real& X1, Standard_Real& Y1, Standard_Real& Z1,
                           Standard_Real& X2, Standard_Real& Y2, Standard_Real& Z2,
                           Standard_Real& nX, Standard_Real& nY, Standard_Real& nZ,
-                          Standard_Real& MinDist);
+                          Standard_Real& MinDist,
+                          Standard_Real* uv = nullptr);
 
 #endif
@@ -19,6 +19,7 @@
 #include <gp_Vec.hxx>
 #include <gp_Quaternion.hxx>
 
+#include <algorithm>
 #include <iostream>
 //#define DEBUG_MESSAGES 1
 #include <debug.h>
@@ -151,7 +152,8 @@ void cadmbtb_distanceFaceFace(const OccContactFace& csh1,
                               Standard_Real& X1, Standard_Real& Y1, Standard_Real& Z1,
                               Standard_Real& X2, Standard_Real& Y2, Standard_Real& Z2,
                               Standard_Real& nX, Standard_Real& nY, Standard_Real& nZ,
-                              Standard_Real& MinDist)
+                              Standard_Real& MinDist,
+                              Standard_Real* uv, bool warmStart)
 {
   // need the 2 sp pointers to keep memory
   SPC::TopoDS_Face pface1 = csh1.contact();
@@ -191,6 +193,11 @@ void cadmbtb_distanceFaceFace(const OccContactFace& csh1,
   x[2]=(binf[2]+bsup[2])*0.5;
   x[3]=(binf[3]+bsup[3])*0.5;
 
+  // start from the previous closest points (within the bounds)
+  if(uv && warmStart)
+    for(int i = 0; i < 4; ++i)
+      x[i] = std::min(std::max(uv[i], binf[i]), bsup[i]);
+
   cadmbtb_myf_FaceFace(x,&f,g,face1,face2);
 
   df1=f;
@@ -207,25 +214,27 @@ void cadmbtb_distanceFaceFace(const OccContactFace& csh1,
 
 //      DEBUG_PRINTF("call n2qn1_: n=%d,x[0]=%e,x[1]=%e,x[2]=%e,x[3]=%e,fx=%e \n g[0]=%e,g[1]=%e,g[2]=%e,g[3]=%e \n dxim[0]=%e,dxim[1]=%e,dxim[2]=%e,dxim[3]=%e,epsabs=%e,imp=%d,io=%d,mode=%d,iter=%d,nsim=%d \n binf[0]=%e,binf[1]=%e,binf[2]=%e,binf[3]=%e \n bsup[0]=%e,bsup[1]=%e,bsup[2]=%e,bsup[3]=%e \n sizeD=%d,sizeI=%d\n",n,x[0],x[1],x[2],x[3],f,g[0],g[1],g[2],g[3],dxim[0],dxim[1],dxim[2],dxim[3],epsabs,imp,io,mode,iter,nsim,binf[0],binf[1],binf[2],binf[3],bsup[0],bsup[1],bsup[2],bsup[3],sizeD,sizeI);
 #ifdef HAS_FORTRAN
+  // the state of n2qn1 is threadprivate: the contacts may be computed
+  // in concurrent threads
   n2qn1_(&n, x, &f, g, dxim, &df1, &epsabs, &imp, &io,&mode, &iter, &nsim, binf, bsup, iz, rz, &reverse);
-#else
-  RuntimeException::selfThrow("_CADMBTB_getMinDistanceFaceFace_using_n2qn1, Fortran Language is not enabled in siconos mechanisms. Compile with fortran if you need n2qn1");
-#endif
   while(mode > 7)
   {
     cadmbtb_myf_FaceFace(x,&f,g,face1,face2);
-#ifdef HAS_FORTRAN
     n2qn1_(&n, x, &f, g, dxim, &df1, &epsabs, &imp, &io,&mode, &iter, &nsim, binf, bsup, iz, rz, &reverse);
+  }
 #else
-    RuntimeException::selfThrow("_CADMBTB_getMinDistanceFaceFace_using_n2qn1, Fortran Language is not enabled in siconos mechanisms. Compile with fortran if you need n2qn1");
+  RuntimeException::selfThrow("_CADMBTB_getMinDistanceFaceFace_using_n2qn1, Fortran Language is not enabled in siconos mechanisms. Compile with fortran if you need n2qn1");
 #endif
-  }
 
   DEBUG_PRINTF("mode=%d and min value at u=%e,v=%e f=%e\n",mode,x[0],x[1],sqrt(f));
   DEBUG_PRINTF("_CADMBTB_getMinDistanceFaceFace_using_n2qn1 dist = %e\n",sqrt(f));
 
   MinDist=sqrt(f);
 
+  if(uv)
+    for(int i = 0; i < 4; ++i)
+      uv[i] = x[i];
+
   gp_Dir normal = cadmbtb_FaceNormal(face2,x[2],x[3]);
   normal.Coord(nX,nY,nZ);
 
@@ -250,7 +259,8 @@ void cadmbtb_distanceFaceEdge(
   Standard_Real& X1, Standard_Real& Y1, Standard_Real& Z1,
   Standard_Real& X2, Standard_Real& Y2, Standard_Real& Z2,
   Standard_Real& nX, Standard_Real& nY, Standard_Real& nZ,
-  Standard_Real& MinDist)
+  Standard_Real& MinDist,
+  Standard_Real* uv, bool warmStart)
 {
 
   // need the 2 sp pointers to keep memory
@@ -287,6 +297,12 @@ void cadmbtb_distanceFaceEdge(
   x[0]=(binf[0]+bsup[0])*0.5;
   x[1]=(binf[1]+bsup[1])*0.5;
   x[2]=(binf[2]+bsup[2])*0.5;
+
+  // start from the previous closest points (within the bounds)
+  if(uv && warmStart)
+    for(int i = 0; i < 3; ++i)
+      x[i] = std::min(std::max(uv[i], binf[i]), bsup[i]);
+
   cadmbtb_myf_FaceEdge(x,&f,g,face1,edge2);
 
   df1=f;
@@ -301,22 +317,24 @@ void cadmbtb_distanceFaceEdge(
 //    DEBUG_PRINTF("call n2qn1_: n=%d,x[0]=%e,x[1]=%e,x[2]=%e,fx=%e \n g[0]=%e,g[1]=%e,g[2]=%e \n dxim[0]=%e,dxim[1]=%e,dxim[2]=%e,epsabs=%e,imp=%d,io=%d,mode=%d,iter=%d,nsim=%d \n binf[0]=%e,binf[1]=%e,binf[2]=%e \n bsup[0]=%e,bsup[1]=%e,bsup[2]=%e \n sizeD=%d,sizeI=%d\n",n,x[0],x[1],x[2],f,g[0],g[1],g[2],dxim[0],dxim[1],dxim[2],epsabs,imp,io,mode,iter,nsim,binf[0],binf[1],binf[2],bsup[0],bsup[1],bsup[2],sizeD,sizeI);
 
 #ifdef HAS_FORTRAN
+  // the state of n2qn1 is threadprivate: the contacts may be computed
+  // in concurrent threads
   n2qn1_(&n, x, &f, g, dxim, &df1, &epsabs, &imp, &io,&mode, &iter, &nsim, binf, bsup, iz, rz, &reverse);
-#else
-  RuntimeException::selfThrow("_CADMBTB_getMinDistanceFaceFace_using_n2qn1, Fortran Language is not enabled in siconos mechanisms. Compile with fortran if you need n2qn1");
-#endif
   while(mode > 7)
   {
     cadmbtb_myf_FaceEdge(x,&f,g,face1,edge2);
-#ifdef HAS_FORTRAN
     n2qn1_(&n, x, &f, g, dxim, &df1, &epsabs, &imp, &io,&mode, &iter, &nsim, binf, bsup, iz, rz, &reverse);
+  }
 #else
-    RuntimeException::selfThrow("_CADMBTB_getMinDistanceFaceFace_using_n2qn1, Fortran Language is not enabled in siconos mechanisms. Compile with fortran if you need n2qn1");
+  RuntimeException::selfThrow("_CADMBTB_getMinDistanceFaceFace_using_n2qn1, Fortran Language is not enabled in siconos mechanisms. Compile with fortran if you need n2qn1");
 #endif
-  }
 
   MinDist=sqrt(f);
 
+  if(uv)
+    for(int i = 0; i < 3; ++i)
+      uv[i] = x[i];
+
   DEBUG_PRINTF("mode=%d and min value at u=%e,v=%e f=%e\n",mode,x[0],x[1],MinDist);
   DEBUG_PRINTF("cadmbtb_getMinDistanceFaceEdge_using_n2qn1 dist = %e\n",MinDist);
 
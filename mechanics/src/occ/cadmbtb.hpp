@@ -13,18 +13,31 @@ gp_Pnt cadmbtb_FacePoint(const TopoDS_Face &face,Standard_Real u, Standard_Real
 gp_Pnt cadmbtb_EdgePoint(const TopoDS_Edge &edge,Standard_Real u);
 gp_Dir cadmbtb_FaceNormal(const TopoDS_Face &face,Standard_Real u, Standard_Real v);
 
+/** Minimal distance between two faces (resp. a face and an edge),
+ * computed with n2qn1 from the surface (curve) parameters.
+ *
+ * If uv is given, the parameters of the closest points are returned in
+ * it (4 values for two faces, 3 for a face and an edge); with warmStart,
+ * uv is also the starting point of the minimization, instead of the
+ * middle of the UV bounds.
+ *
+ * n2qn1 keeps its state in static variables, so that the minimizations
+ * are serialized when the queries are evaluated concurrently.
+ */
 void cadmbtb_distanceFaceFace(const OccContactFace& csh1,
                               const OccContactFace& csh2,
                               Standard_Real& X1, Standard_Real& Y1, Standard_Real& Z1,
                               Standard_Real& X2, Standard_Real& Y2, Standard_Real& Z2,
                               Standard_Real& nX, Standard_Real& nY, Standard_Real& nZ,
-                              Standard_Real& MinDist);
+                              Standard_Real& MinDist,
+                              Standard_Real* uv = nullptr, bool warmStart = false);
 
 void cadmbtb_distanceFaceEdge(
   const OccContactFace& sh1, const OccContactEdge& sh2,
   Standard_Real& X1, Standard_Real& Y1, Standard_Real& Z1,
   Standard_Real& X2, Standard_Real& Y2, Standard_Real& Z2,
   Standard_Real& nX, Standard_Real& nY, Standard_Real& nZ,
-  Standard_Real& MinDist);
+  Standard_Real& MinDist,
+  Standard_Real* uv = nullptr, bool warmStart = false);
 
 #endif
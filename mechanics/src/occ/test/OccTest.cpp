@@ -8,6 +8,7 @@
 #include "ContactPoint.hpp"
 #include "WhichGeometer.hpp"
 #include "WhichGeometer.hpp"
+#include "OccR.hpp"
 
 #include <TopoDS_Shape.hxx>
 #include <BRepPrimAPI_MakeSphere.hxx>
@@ -74,6 +75,7 @@ void OccTest::computeUVBounds()
 
 
 #include <SiconosVector.hpp>
+#include <BlockVector.hpp>
 #include <SimpleMatrix.hpp>
 #include <OccBody.hpp>
 void OccTest::move()
@@ -214,6 +216,108 @@ void OccTest::distance()
   std::cout << dist.nx << "," << dist.ny << "," << dist.nz << std::endl;
 
   CPPUNIT_ASSERT(std::abs(dist.value - 1.0) < 1e-9);
+  CPPUNIT_ASSERT(dist.hasUV);
 
+  // a query started from the previous closest points finds the same distance
+  geometer->warmStart = true;
+  body2->contactShape(0).accept(*geometer);
+
+  CPPUNIT_ASSERT(std::abs(geometer->answer.value - 1.0) < 1e-9);
+  CPPUNIT_ASSERT(geometer->answer.uv[0] >= body1->contactShape(0).binf1[0]);
+  CPPUNIT_ASSERT(geometer->answer.uv[0] <= body1->contactShape(0).bsup1[0]);
+
+}
+
+void OccTest::distanceCache()
+{
+  const double pi = boost::math::constants::pi<double>();
+
+  BRepPrimAPI_MakeSphere mksphere1(1, pi);
+  BRepPrimAPI_MakeSphere mksphere2(1, pi);
+
+  OccContactShape sphere1(mksphere1.Shape());
+  OccContactShape sphere2(mksphere2.Shape());
+
+  OccContactFace sphere1_contact(sphere1, 0);
+  OccContactFace sphere2_contact(sphere2, 0);
+
+  SP::SiconosVector position1(new SiconosVector(7));
+  SP::SiconosVector position2(new SiconosVector(7));
+  SP::SiconosVector velocity(new SiconosVector(6));
+  SP::SimpleMatrix inertia(new SimpleMatrix(3,3));
+  position1->zero();
+  (*position1)(3) = 1;
+
+  position2->zero();
+  (*position2)(0) = 3.;
+  (*position2)(3) = cos(pi/2.);
+  (*position2)(5) = sin(pi/2.);
+
+  velocity->zero();
+  inertia->eye();
+
+  SP::OccBody body1(new OccBody(position1, velocity, 1, inertia));
+  SP::OccBody body2(new OccBody(position2, velocity, 1, inertia));
+
+  body1->addContactShape(createSPtrOccContactShape(sphere1_contact));
+  body2->addContactShape(createSPtrOccContactShape(sphere2_contact));
+
+  ContactPoint contact1(body1->contactShape(0));
+  ContactPoint contact2(body2->contactShape(0));
+
+  OccR relation(contact1, contact2);
+
+  BlockVector q0(body1->q(), body2->q());
+
+  // first query: computed
+  relation.computeDistance(q0);
+  CPPUNIT_ASSERT(relation.distanceQueries() == 1);
+  CPPUNIT_ASSERT(relation.cacheHits() == 0);
+
+  SiconosVector y(1);
+  relation.computeh(0., q0, y);
+  CPPUNIT_ASSERT(std::abs(y(0) - 1.0) < 1e-9);
+
+  // same positions: the previous distance is reused
+  CPPUNIT_ASSERT(relation.distanceQueries() == 1);
+  CPPUNIT_ASSERT(relation.cacheHits() == 1);
+
+  // the second body moves away: the cache is invalid
+  (*body2->q())(0) = 4.;
+  body2->updateContactShapes();
+  relation.computeh(0., q0, y);
+  CPPUNIT_ASSERT(relation.distanceQueries() == 2);
+  CPPUNIT_ASSERT(relation.cacheHits() == 1);
+  CPPUNIT_ASSERT(std::abs(y(0) - 2.0) < 1e-9);
+
+  // a move within the cache tolerance keeps the previous distance
+  relation.setCacheTolerance(1e-2);
+  (*body2->q())(0) = 4. + 5e-3;
+  body2->updateContactShapes();
+  relation.computeh(0., q0, y);
+  CPPUNIT_ASSERT(relation.distanceQueries() == 2);
+  CPPUNIT_ASSERT(relation.cacheHits() == 2);
+  CPPUNIT_ASSERT(std::abs(y(0) - 2.0) < 1e-9);
+
+  // and a larger one does not
+  (*body2->q())(0) = 4. + 5e-2;
+  body2->updateContactShapes();
+  relation.computeh(0., q0, y);
+  CPPUNIT_ASSERT(relation.distanceQueries() == 3);
+  CPPUNIT_ASSERT(std::abs(y(0) - 2.05) < 1e-9);
+
+  // without the cache, each query is computed
+  relation.setUseCache(false);
+  relation.computeDistance(q0);
+  relation.computeDistance(q0);
+  CPPUNIT_ASSERT(relation.distanceQueries() == 5);
+  CPPUNIT_ASSERT(relation.cacheHits() == 2);
+
+  // enabling it again starts from an empty cache
+  relation.setUseCache(true);
+  relation.computeDistance(q0);
+  CPPUNIT_ASSERT(relation.distanceQueries() == 6);
+  relation.computeDistance(q0);
+  CPPUNIT_ASSERT(relation.cacheHits() == 3);
 }
 #endif
@@ -36,6 +36,7 @@ private:
   CPPUNIT_TEST(move);
 #ifdef HAS_FORTRAN
   CPPUNIT_TEST(distance);
+  CPPUNIT_TEST(distanceCache);
 #endif
   CPPUNIT_TEST_SUITE_END();
 
@@ -48,6 +49,8 @@ private:
 
 #ifdef HAS_FORTRAN
   void distance();
+
+  void distanceCache();
 #endif
   
 public:
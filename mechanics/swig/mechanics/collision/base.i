@@ -42,6 +42,10 @@ PY_FULL_REGISTER(RigidBody2dDS, Mechanics);
 PY_FULL_REGISTER(SiconosCollisionQueryResult, Mechanics);
 PY_FULL_REGISTER(SiconosCollisionManager, Mechanics);
 
+PY_REGISTER_WITHOUT_HEADER(SiconosNativeCollisionOptions, Mechanics);
+PY_REGISTER_WITHOUT_HEADER(SiconosNativeCollisionStatistics, Mechanics);
+PY_FULL_REGISTER(SiconosNativeCollisionManager, Mechanics);
+
 %inline
 {
   SP::ContactR cast_ContactR(SP::Relation rel)
@@ -1,6 +1,13 @@
 include(tools4tests)
 
 if(WITH_${COMPONENT}_TESTING)
-  # No tests for this component.
- 
+
+  # ---- MBTB tests ----
+  if(WITH_OPENMP)
+    begin_tests(src/MBTB/test DEPS "CPPUNIT::CPPUNIT;OpenMP::OpenMP_CXX")
+  else()
+    begin_tests(src/MBTB/test DEPS "CPPUNIT::CPPUNIT")
+  endif()
+  new_test(SOURCES MBTBInternalToolTest.cpp ${SIMPLE_TEST_MAIN})
+
 endif()
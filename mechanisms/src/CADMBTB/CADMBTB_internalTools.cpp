@@ -31,6 +31,9 @@
 #include "gp_Vec.hxx"
 #include "CADMBTB_API.hpp"
 #include <assert.h>
+#ifdef _OPENMP
+#include <omp.h>
+#endif
 #include "BRepClass_FaceClassifier.hxx"
 #include "TopAbs_State.hxx"
 
@@ -112,10 +115,30 @@ extern "C"
 }
 #endif
 
+/* The ACE timers are global and not thread safe: they are only used when
+   the contacts are not computed in concurrent threads. */
+static inline void _CADMBTB_timerStart(int timer)
+{
+#ifdef _OPENMP
+  if(omp_in_parallel())
+    return;
+#endif
+  ACE_times[timer].start();
+}
+
+static inline void _CADMBTB_timerStop(int timer)
+{
+#ifdef _OPENMP
+  if(omp_in_parallel())
+    return;
+#endif
+  ACE_times[timer].stop();
+}
+
 void _myf_FaceFace(double *x, double * fx, double * gx,const TopoDS_Face& face1,const TopoDS_Face& face2)
 {
-  ACE_times[ACE_TIMER_CAD_13].start();
-  ACE_times[ACE_TIMER_CAD_15].start();
+  _CADMBTB_timerStart(ACE_TIMER_CAD_13);
+  _CADMBTB_timerStart(ACE_TIMER_CAD_15);
   gp_Pnt aP1;
   gp_Pnt aP2;
   gp_Vec aVP2P1;
@@ -125,11 +148,11 @@ void _myf_FaceFace(double *x, double * fx, double * gx,const TopoDS_Face& face1,
   gp_Vec aV2v;
   BRepAdaptor_Surface SF1(face1);
   BRepAdaptor_Surface SF2(face2);
-  ACE_times[ACE_TIMER_CAD_15].stop();
-  ACE_times[ACE_TIMER_CAD_16].start();
+  _CADMBTB_timerStop(ACE_TIMER_CAD_15);
+  _CADMBTB_timerStart(ACE_TIMER_CAD_16);
   SF1.D1(x[0],x[1],aP1, aV1u, aV1v);
   SF2.D1(x[2],x[3],aP2, aV2u, aV2v);
-  ACE_times[ACE_TIMER_CAD_16].stop();
+  _CADMBTB_timerStop(ACE_TIMER_CAD_16);
   aVP2P1.SetX(aP1.X()-aP2.X());
   aVP2P1.SetY(aP1.Y()-aP2.Y());
   aVP2P1.SetZ(aP1.Z()-aP2.Z());
@@ -139,12 +162,12 @@ void _myf_FaceFace(double *x, double * fx, double * gx,const TopoDS_Face& face1,
   gx[1]=2*aV1v.Dot(aVP2P1);
   gx[2]=-2*aV2u.Dot(aVP2P1);
   gx[3]=-2*aV2v.Dot(aVP2P1);
-  ACE_times[ACE_TIMER_CAD_13].stop();
+  _CADMBTB_timerStop(ACE_TIMER_CAD_13);
 }
 void _myf_FaceEdge(double *x, double * fx, double * gx,const TopoDS_Face& face1,const TopoDS_Edge& edge2)
 {
-  ACE_times[ACE_TIMER_CAD_13].start();
-  ACE_times[ACE_TIMER_CAD_15].start();
+  _CADMBTB_timerStart(ACE_TIMER_CAD_13);
+  _CADMBTB_timerStart(ACE_TIMER_CAD_15);
   gp_Pnt aP1;
   gp_Pnt aP2;
   gp_Vec aVP2P1;
@@ -154,11 +177,11 @@ void _myf_FaceEdge(double *x, double * fx, double * gx,const TopoDS_Face& face1,
   //  gp_Vec aV2v;/*here, zero*/
   BRepAdaptor_Surface SF1(face1);
   BRepAdaptor_Curve SC(edge2);
-  ACE_times[ACE_TIMER_CAD_15].stop();
-  ACE_times[ACE_TIMER_CAD_16].start();
+  _CADMBTB_timerStop(ACE_TIMER_CAD_15);
+  _CADMBTB_timerStart(ACE_TIMER_CAD_16);
   SF1.D1(x[0],x[1],aP1, aV1u, aV1v);
   SC.D1(x[2],aP2, aV2u);
-  ACE_times[ACE_TIMER_CAD_16].stop();
+  _CADMBTB_timerStop(ACE_TIMER_CAD_16);
   aVP2P1.SetX(aP1.X()-aP2.X());
   aVP2P1.SetY(aP1.Y()-aP2.Y());
   aVP2P1.SetZ(aP1.Z()-aP2.Z());
@@ -168,7 +191,7 @@ void _myf_FaceEdge(double *x, double * fx, double * gx,const TopoDS_Face& face1,
   gx[1]=2*aV1v.Dot(aVP2P1);
   gx[2]=-2*aV2u.Dot(aVP2P1);
   //  gx[3]=-2*aV2v.Dot(aVP2P1);
-  ACE_times[ACE_TIMER_CAD_13].stop();
+  _CADMBTB_timerStop(ACE_TIMER_CAD_13);
 }
 
 void _CADMBTB_getMinDistanceFaceFace_using_n2qn1(unsigned int idContact, unsigned int idFace1, unsigned int idFace2,
@@ -305,22 +328,17 @@ void _CADMBTB_getMinDistanceFaceFace_using_n2qn1(unsigned int idContact, unsigne
 #endif
       //      ACE_times[ACE_TIMER_CAD_12].start();
 #ifdef HAS_FORTRAN
+      // the state of n2qn1 is threadprivate: the contacts may be computed
+      // in concurrent threads
       n2qn1_(&n, x, &f, g, dxim, &df1, &epsabs, &imp, &io,&mode, &iter, &nsim, binf, bsup, iz, rz, &reverse);
-#else
-      RuntimeException::selfThrow("_CADMBTB_getMinDistanceFaceFace_using_n2qn1, Fortran Language is not enabled in siconos mechanisms. Compile with fortran if you need n2qn1");
-#endif
-      //      ACE_times[ACE_TIMER_CAD_12].stop();
       while(mode > 7)
       {
         _myf_FaceFace(x,&f,g,face1,face2);
-        //	ACE_times[ACE_TIMER_CAD_12].start();
-#ifdef HAS_FORTRAN
         n2qn1_(&n, x, &f, g, dxim, &df1, &epsabs, &imp, &io,&mode, &iter, &nsim, binf, bsup, iz, rz, &reverse);
+      }
 #else
-        RuntimeException::selfThrow("_CADMBTB_getMinDistanceFaceFace_using_n2qn1, Fortran Language is not enabled in siconos mechanisms. Compile with fortran if you need n2qn1");
+      RuntimeException::selfThrow("_CADMBTB_getMinDistanceFaceFace_using_n2qn1, Fortran Language is not enabled in siconos mechanisms. Compile with fortran if you need n2qn1");
 #endif
-        //	ACE_times[ACE_TIMER_CAD_12].stop();
-      }
       //      ACE_times[ACE_TIMER_CAD_12].stop();
       //      ACE_times[ACE_TIMER_CAD_14].start();
 #ifdef DEBUG_USING_N2QN1
@@ -569,23 +587,17 @@ void _CADMBTB_getMinDistanceFaceEdge_using_n2qn1(
     printf("call n2qn1_: n=%d,x[0]=%e,x[1]=%e,x[2]=%e,fx=%e \n g[0]=%e,g[1]=%e,g[2]=%e \n dxim[0]=%e,dxim[1]=%e,dxim[2]=%e,epsabs=%e,imp=%d,io=%d,mode=%d,iter=%d,nsim=%d \n binf[0]=%e,binf[1]=%e,binf[2]=%e \n bsup[0]=%e,bsup[1]=%e,bsup[2]=%e \n sizeD=%d,sizeI=%d\n",n,x[0],x[1],x[2],f,g[0],g[1],g[2],dxim[0],dxim[1],dxim[2],epsabs,imp,io,mode,iter,nsim,binf[0],binf[1],binf[2],bsup[0],bsup[1],bsup[2],sizeD,sizeI);
 #endif
 #ifdef HAS_FORTRAN
-    //    ACE_times[ACE_TIMER_CAD_12].start();
+    // the state of n2qn1 is threadprivate: the contacts may be computed
+    // in concurrent threads
     n2qn1_(&n, x, &f, g, dxim, &df1, &epsabs, &imp, &io,&mode, &iter, &nsim, binf, bsup, iz, rz, &reverse);
-    //    ACE_times[ACE_TIMER_CAD_12].stop();
-#else
-    RuntimeException::selfThrow("_CADMBTB_getMinDistanceFaceFace_using_n2qn1, Fortran Language is not enabled in siconos mechanisms. Compile with fortran if you need n2qn1");
-#endif
     while(mode > 7)
     {
       _myf_FaceEdge(x,&f,g,face1,edge2);
-      //      ACE_times[ACE_TIMER_CAD_12].start();
-#ifdef HAS_FORTRAN
       n2qn1_(&n, x, &f, g, dxim, &df1, &epsabs, &imp, &io,&mode, &iter, &nsim, binf, bsup, iz, rz, &reverse);
+    }
 #else
-      RuntimeException::selfThrow("_CADMBTB_getMinDistanceFaceFace_using_n2qn1, Fortran Language is not enabled in siconos mechanisms. Compile with fortran if you need n2qn1");
+    RuntimeException::selfThrow("_CADMBTB_getMinDistanceFaceFace_using_n2qn1, Fortran Language is not enabled in siconos mechanisms. Compile with fortran if you need n2qn1");
 #endif
-      //      ACE_times[ACE_TIMER_CAD_12].stop();
-    }
     //    ACE_times[ACE_TIMER_CAD_12].stop();
     //    ACE_times[ACE_TIMER_CAD_14].start();
     double sqrt_f=sqrt(f);
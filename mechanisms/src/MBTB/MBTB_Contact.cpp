@@ -1,8 +1,13 @@
 #include "MBTB_Contact.hpp"
 #include "MBTB_ContactRelation.hpp"
 #include "MBTB_FC3DContactRelation.hpp"
+#include "CADMBTB_API.hpp"
+#include <chrono>
 
-MBTB_Contact::MBTB_Contact() {}
+typedef std::chrono::steady_clock MBTB_Clock;
+
+MBTB_Contact::MBTB_Contact():
+  _minDistanceUpToDate(false), _distanceTime(0.), _distanceCount(0), _moveTime(0.) {}
 
 MBTB_Contact::MBTB_Contact(unsigned int id,const std::string& ContactName, unsigned int indexBody1, int indexBody2,unsigned int indexCAD1,unsigned int indexCAD2, int withFriction)
 {
@@ -18,6 +23,8 @@ MBTB_Contact::MBTB_Contact(unsigned int id,const std::string& ContactName, unsig
   _curTimeh=-1.0;
   _Offset=0.01;
   _OffsetP1=1;
+  _minDistanceUpToDate=false;
+  resetTimers();
   _withFriction=withFriction;
   _normalFromFace1=1;
   if(_withFriction)
@@ -38,3 +45,54 @@ void MBTB_Contact::setInteraction(SP::Interaction newInteraction)
   _interaction->display();
 
 }
+
+void MBTB_Contact::moveModels()
+{
+  MBTB_Clock::time_point start = MBTB_Clock::now();
+  CADMBTB_moveModelFromModel(_indexCAD1,_indexBody1);
+  if(_indexBody2!=-1)
+    CADMBTB_moveModelFromModel(_indexCAD2,_indexBody2);
+  _minDistanceUpToDate=false;
+  _moveTime += std::chrono::duration<double>(MBTB_Clock::now()-start).count();
+}
+
+void MBTB_Contact::computeMinDistance()
+{
+  double * d = _minDistanceData;
+  MBTB_Clock::time_point start = MBTB_Clock::now();
+  CADMBTB_getMinDistance(_id,_indexCAD1,_indexCAD2,
+                         d[0],d[1],d[2],
+                         d[3],d[4],d[5],
+                         d[6],d[7],d[8],_normalFromFace1,
+                         d[9]);
+  _distanceTime += std::chrono::duration<double>(MBTB_Clock::now()-start).count();
+  _distanceCount++;
+  _minDistanceUpToDate=true;
+}
+
+void MBTB_Contact::getMinDistance(double& X1, double& Y1, double& Z1,
+                                  double& X2, double& Y2, double& Z2,
+                                  double& nx, double& ny, double& nz, double& dist)
+{
+  if(!_minDistanceUpToDate)
+    computeMinDistance();
+  _minDistanceUpToDate=false;
+  const double * d = _minDistanceData;
+  X1=d[0];
+  Y1=d[1];
+  Z1=d[2];
+  X2=d[3];
+  Y2=d[4];
+  Z2=d[5];
+  nx=d[6];
+  ny=d[7];
+  nz=d[8];
+  dist=d[9];
+}
+
+void MBTB_Contact::resetTimers()
+{
+  _distanceTime=0.;
+  _distanceCount=0;
+  _moveTime=0.;
+}
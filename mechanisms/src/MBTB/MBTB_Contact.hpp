@@ -34,6 +34,24 @@ protected:
     A link to the interaction.
    */
   SP::Interaction _interaction;
+
+  /*!
+    Contact points, normal and distance computed by computeMinDistance,
+    used once by the next call to getMinDistance.
+   */
+  double _minDistanceData[10];
+
+  //! True if _minDistanceData is up to date with the current CAD models.
+  bool _minDistanceUpToDate;
+
+  //! Cumulated time (in seconds) spent in the distance computations.
+  double _distanceTime;
+
+  //! Number of distance computations.
+  unsigned long _distanceCount;
+
+  //! Cumulated time (in seconds) spent in moving the CAD models.
+  double _moveTime;
  
   MBTB_Contact();
 public:
@@ -63,6 +81,63 @@ public:
   }
   void setInteraction(SP::Interaction newInteraction);
 
+  /** To move the CAD models of the contact to the current position of the bodies.
+   * The CAD models are owned by the contact, so that different contacts may be
+   * moved concurrently.
+   */
+  void moveModels();
+
+  /** To compute the minimal distance between the CAD models of the contact
+   * and to keep it for the next call to getMinDistance.
+   * Different contacts may be computed concurrently.
+   */
+  void computeMinDistance();
+
+  //! To be called when the CAD models have been moved outside of moveModels.
+  inline void invalidateMinDistance()
+  {
+    _minDistanceUpToDate=false;
+  }
+
+  /** To get the minimal distance between the CAD models of the contact, either
+   * kept by a previous call to computeMinDistance (the kept value is used only
+   * once) or computed now.
+   * \param [out] X1 Y1 Z1 the contact point on the first model
+   * \param [out] X2 Y2 Z2 the contact point on the second model
+   * \param [out] nx ny nz the normal
+   * \param [out] dist the distance
+   */
+  void getMinDistance(double& X1, double& Y1, double& Z1,
+                      double& X2, double& Y2, double& Z2,
+                      double& nx, double& ny, double& nz, double& dist);
+
+  /** To get the cumulated time spent in the distance computations.
+   * \return double the time in seconds
+   */
+  inline double distanceTime() const
+  {
+    return _distanceTime;
+  }
+
+  /** To get the number of distance computations.
+   * \return unsigned long
+   */
+  inline unsigned long distanceCount() const
+  {
+    return _distanceCount;
+  }
+
+  /** To get the cumulated time spent in moving the CAD models.
+   * \return double the time in seconds
+   */
+  inline double moveTime() const
+  {
+    return _moveTime;
+  }
+
+  //! To reset the timing counters.
+  void resetTimers();
+
   //! The id of the contact.
   unsigned int _id;
 
@@ -42,11 +42,10 @@ void MBTB_ContactRelation::computeh(double time, BlockVector& q0, SiconosVector&
   //if (_pContact->_curTimeh + 1e-9 < time){
   ACE_times[ACE_TIMER_DIST].start();
   double X1,X2,Y1,Y2,Z1,Z2,nx,ny,nz;
-  CADMBTB_getMinDistance(_pContact->_id,_pContact->_indexCAD1,_pContact->_indexCAD2,
-                         X1,Y1,Z1,
-                         X2,Y2,Z2,
-                         nx,ny,nz,_pContact->_normalFromFace1,
-                         _pContact->_dist);
+  _pContact->getMinDistance(X1,Y1,Z1,
+                            X2,Y2,Z2,
+                            nx,ny,nz,
+                            _pContact->_dist);
   if(sPrintDist)
   {
     printf("    Minimal distance computed from CAD and n2qn1 : %lf \n",_pContact->_dist);
@@ -19,6 +19,8 @@ int sJointType[MBTB_MAX_JOINTS_NUMBER];
 SP::TimeStepping sSimu;
 unsigned int sDrawMode=0;
 unsigned int sPrintDist=0;
+unsigned int sParallelContacts=1;
+unsigned int sPrintContactTimers=0;
 unsigned int sDisplayStepBodies=0;
 unsigned int sDisplayStepJoints=0;
 unsigned int sDisplayStepContacts=0;
@@ -59,6 +59,10 @@ extern SP::TimeStepping sSimu;
 extern unsigned int sDrawMode;
 //!The verbose mode for print_dist
 extern unsigned int sPrintDist;
+//!If not 0, the contacts are updated concurrently (OpenMP).
+extern unsigned int sParallelContacts;
+//!The verbose mode for print_contactTimers
+extern unsigned int sPrintContactTimers;
 //!The verbose mode for displayStep_bodies
 extern unsigned int sDisplayStepBodies;
 //!The verbose mode for displayStep_joints
@@ -51,11 +51,10 @@ void MBTB_FC3DContactRelation::computeh(double time, const BlockVector& q0, Sico
   //if (_pContact->_curTimeh + 1e-9 < time){
   ACE_times[ACE_TIMER_DIST].start();
   double X1,X2,Y1,Y2,Z1,Z2,n1x,n1y,n1z;
-  CADMBTB_getMinDistance(_pContact->_id,_pContact->_indexCAD1,_pContact->_indexCAD2,
-                         X1,Y1,Z1,
-                         X2,Y2,Z2,
-                         n1x,n1y,n1z,_pContact->_normalFromFace1,
-                         _pContact->_dist);
+  _pContact->getMinDistance(X1,Y1,Z1,
+                            X2,Y2,Z2,
+                            n1x,n1y,n1z,
+                            _pContact->_dist);
 
   if(sPrintDist)
   {
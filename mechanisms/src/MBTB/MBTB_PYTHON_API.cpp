@@ -750,6 +750,8 @@ void MBTB_run(int NbSteps)
   }
   fclose(fp) ;
   ACE_PRINT_TIME();
+  if(sPrintContactTimers)
+    _MBTB_printContactTimers();
   //updateDSFromSiconos();
   //updateContactFromDS();
   //QList<MDIWindow*>::iterator i;
@@ -843,6 +845,34 @@ void MBTB_print_dist(unsigned int v)
   sPrintDist=v;
 }
 
+void MBTB_parallelContacts(unsigned int v)
+{
+  sParallelContacts=v;
+}
+
+void MBTB_print_contactTimers(unsigned int v)
+{
+  sPrintContactTimers=v;
+}
+
+double MBTB_ContactDistanceTime(unsigned int numContact)
+{
+  assert(numContact<sNbOfContacts && "MBTB_ContactDistanceTime contactId out of range");
+  return sContacts[numContact]->distanceTime();
+}
+
+unsigned long MBTB_ContactDistanceCount(unsigned int numContact)
+{
+  assert(numContact<sNbOfContacts && "MBTB_ContactDistanceCount contactId out of range");
+  return sContacts[numContact]->distanceCount();
+}
+
+double MBTB_ContactMoveTime(unsigned int numContact)
+{
+  assert(numContact<sNbOfContacts && "MBTB_ContactMoveTime contactId out of range");
+  return sContacts[numContact]->moveTime();
+}
+
 void MBTB_displayStep_bodies(unsigned int v)
 {
   sDisplayStepBodies=v;
@@ -299,6 +299,39 @@ void MBTB_displayStep_contacts(unsigned int v);
  */
 void MBTB_print_dist(unsigned int v);
 
+//! It allows to update the contacts concurrently
+/*!
+  The CAD models of the contacts are moved, and their distances are computed,
+  in an OpenMP parallel loop (default). The CADMBTB timers of the
+  minimizations are not updated by the concurrent loop.
+  \param [in] v unsigned int , if 0 the contacts are updated sequentially
+ */
+void MBTB_parallelContacts(unsigned int v);
+
+//! It allows to print the per contact timers at the end of MBTB_run
+/*!
+  \param [in] v unsigned int , if 0 no print (default)
+ */
+void MBTB_print_contactTimers(unsigned int v);
+
+/** To get the time spent in the distance computations of a contact.
+ * \param [in] numContact the id of the contact
+ * \return double the cumulated time in seconds
+ */
+double MBTB_ContactDistanceTime(unsigned int numContact);
+
+/** To get the number of distance computations of a contact.
+ * \param [in] numContact the id of the contact
+ * \return unsigned long
+ */
+unsigned long MBTB_ContactDistanceCount(unsigned int numContact);
+
+/** To get the time spent in moving the CAD models of a contact.
+ * \param [in] numContact the id of the contact
+ * \return double the cumulated time in seconds
+ */
+double MBTB_ContactMoveTime(unsigned int numContact);
+
 
 
 /** MBTB_BodySetDParam not yet used
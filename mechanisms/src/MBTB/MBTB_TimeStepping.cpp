@@ -19,4 +19,5 @@ void MBTB_TimeStepping::updateWorldFromDS()
 #endif
   MBTB_updateDSFromSiconos();
   _MBTB_updateContactFromDS();
+  _MBTB_computeContactDistances();
 }
@@ -11,4 +11,5 @@ void MBTB_TimeSteppingCombinedProj::updateWorldFromDS()
 #endif
   MBTB_updateDSFromSiconos();
   _MBTB_updateContactFromDS();
+  _MBTB_computeContactDistances();
 }
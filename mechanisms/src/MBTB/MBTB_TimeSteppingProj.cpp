@@ -11,4 +11,5 @@ void MBTB_TimeSteppingProj::updateWorldFromDS()
 #endif
   MBTB_updateDSFromSiconos();
   _MBTB_updateContactFromDS();
+  _MBTB_computeContactDistances();
 }
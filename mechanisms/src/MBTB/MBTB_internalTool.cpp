@@ -11,6 +11,11 @@
 #include "SiconosAlgebraProd.hpp" // for prod
 void _MBTB_updateContactFromDS()
 {
+  /* Each contact owns its CAD models: they are moved concurrently. */
+  _MBTB_forEachContact(sNbOfContacts, sParallelContacts,
+                       [](int numC) { sContacts[numC]->moveModels(); });
+
+  /* The graphical context is not thread safe. */
   for(unsigned int numC=0; numC<sNbOfContacts; numC++)
   {
 #ifdef PRINT_FORCE_CONTACTS
@@ -20,10 +25,6 @@ void _MBTB_updateContactFromDS()
     int index1=sContacts[numC]->_indexBody1;
     int index2=sContacts[numC]->_indexBody2;
 
-    CADMBTB_moveModelFromModel(sContacts[numC]->_indexCAD1,index1);
-    if(index2!=-1)
-      CADMBTB_moveModelFromModel(sContacts[numC]->_indexCAD2,index2);
-
 #ifdef DRAW_CONTACT_FORCES
 
 #endif
@@ -33,8 +34,24 @@ void _MBTB_updateContactFromDS()
   }
 }
 
+void _MBTB_computeContactDistances()
+{
+  if(!sParallelContacts)
+    return;
+  /* A failure of one contact is raised once all the distances are done. */
+  _MBTB_forEachContact(sNbOfContacts, true,
+                       [](int numC) { sContacts[numC]->computeMinDistance(); });
+}
 
-
+void _MBTB_printContactTimers()
+{
+  for(unsigned int numC=0; numC<sNbOfContacts; numC++)
+  {
+    MBTB_Contact * c = sContacts[numC];
+    printf("contact %s: %lu distance computations in %e s, models moved in %e s\n",
+           c->contactName(),c->distanceCount(),c->distanceTime(),c->moveTime());
+  }
+}
 
 void _MBTB_updateContactFromDS(int numDS)
 {
@@ -43,11 +60,13 @@ void _MBTB_updateContactFromDS(int numDS)
     if((int)(sContacts[numC]->_indexBody1) == numDS)
     {
       CADMBTB_moveModelFromModel(sContacts[numC]->_indexCAD1,numDS);
+      sContacts[numC]->invalidateMinDistance();
       CADMBTB_moveGraphicalModelFromModel(sContacts[numC]->_indexCAD1,numDS);
     }
     if(sContacts[numC]->_indexBody2 == numDS)
     {
       CADMBTB_moveModelFromModel(sContacts[numC]->_indexCAD2,numDS);
+      sContacts[numC]->invalidateMinDistance();
       CADMBTB_moveGraphicalModelFromModel(sContacts[numC]->_indexCAD2,numDS);
     }
   }
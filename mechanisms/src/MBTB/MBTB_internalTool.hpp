@@ -9,6 +9,7 @@
 #define INTERNALTOOLMBTB
 #include <stdio.h>
 #include <string>
+#include <exception>
 #define PRINT_FORCE_CONTACTS
 #define MBTB_PRINT_DIST
 //! It updates the contacts CAD model from the body.
@@ -22,6 +23,49 @@ void _MBTB_updateContactFromDS();
  */
 void _MBTB_updateContactFromDS(int numDS);
 
+/** It computes the distances of all the contacts concurrently, they are
+ * used by the next computation of the relations. Nothing is done if
+ * sParallelContacts is 0.
+ */
+void _MBTB_computeContactDistances();
+
+/** It calls f(numC) for each contact numC in [0, nbOfContacts),
+ * concurrently if parallel is true. An exception thrown for a contact does
+ * not stop the other ones: it is raised again after the loop (the first
+ * one caught, if several contacts fail).
+ * \param nbOfContacts the number of contacts
+ * \param parallel true to run the loop in an OpenMP parallel for
+ * \param f the function called for each contact index
+ */
+template<typename F>
+void _MBTB_forEachContact(unsigned int nbOfContacts, bool parallel, F f)
+{
+  std::exception_ptr error;
+  int n = (int)nbOfContacts;
+#pragma omp parallel for if(parallel) schedule(dynamic)
+  for(int numC=0; numC<n; numC++)
+  {
+    try
+    {
+      f(numC);
+    }
+    catch(...)
+    {
+#pragma omp critical(mbtb_contact_error)
+      {
+        if(!error)
+          error = std::current_exception();
+      }
+    }
+  }
+  if(error)
+    std::rethrow_exception(error);
+}
+
+/** It prints the per contact timers.
+ */
+void _MBTB_printContactTimers();
+
 FILE* _MBTB_open(std::string filename, std::string args);
 
 void _MBTB_close(FILE *);
@@ -0,0 +1,61 @@
+#include "MBTBInternalToolTest.hpp"
+#include "MBTB_internalTool.hpp"
+
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+CPPUNIT_TEST_SUITE_REGISTRATION(MBTBInternalToolTest);
+
+void MBTBInternalToolTest::setUp()
+{
+}
+
+void MBTBInternalToolTest::tearDown()
+{
+}
+
+void MBTBInternalToolTest::forEachContact()
+{
+  const unsigned int nbOfContacts = 50;
+  for(bool parallel : {false, true})
+  {
+    std::vector<int> count(nbOfContacts, 0);
+    _MBTB_forEachContact(nbOfContacts, parallel,
+                         [&count](int numC) { count[numC]++; });
+    for(unsigned int numC = 0; numC < nbOfContacts; numC++)
+      CPPUNIT_ASSERT(count[numC] == 1);
+  }
+
+  // no contact
+  _MBTB_forEachContact(0, true, [](int) { throw std::runtime_error("no contact"); });
+}
+
+void MBTBInternalToolTest::forEachContactError()
+{
+  const unsigned int nbOfContacts = 50;
+  for(bool parallel : {false, true})
+  {
+    std::vector<int> count(nbOfContacts, 0);
+    bool raised = false;
+    try
+    {
+      _MBTB_forEachContact(nbOfContacts, parallel,
+                           [&count](int numC)
+      {
+        count[numC]++;
+        if(numC == 7 || numC == 31)
+          throw std::runtime_error("contact " + std::to_string(numC));
+      });
+    }
+    catch(std::runtime_error& e)
+    {
+      std::string what = e.what();
+      raised = (what == "contact 7" || what == "contact 31");
+    }
+    // the error is raised after the loop, the other contacts are computed
+    CPPUNIT_ASSERT(raised);
+    for(unsigned int numC = 0; numC < nbOfContacts; numC++)
+      CPPUNIT_ASSERT(count[numC] == 1);
+  }
+}
@@ -64,6 +64,11 @@ if(WITH_${COMPONENT}_TESTING)
   #  Use new_tests_collection function as below.
   
   new_test(NAME lcp_test_DefaultSolverOptions SOURCES LinearComplementarity_DefaultSolverOptions_test.c)
+  new_test(SOURCES lcp_enum_threads_test.c)
+  # the *_threads_test compare 1 and several OpenMP threads,
+  # they are skipped (exit code 77) without WITH_OPENMP
+  set_tests_properties(lcp_enum_threads_test PROPERTIES SKIP_RETURN_CODE 77)
+  new_test(SOURCES lcp_block_pivot_test.c)
 
   new_tests_collection(
     DRIVER lcp_test_collection.c.in FORMULATION lcp COLLECTION TEST_LCP_COLLECTION_1
@@ -113,6 +118,9 @@ if(WITH_${COMPONENT}_TESTING)
     new_test(NAME MLCPtest SOURCES main_mlcp.cpp)
   endif()
   new_test(SOURCES MixedLinearComplementarity_ReadWrite_test.c)
+  new_test(SOURCES mlcp_direct_neighbours_test.c)
+  new_test(SOURCES mlcp_enum_threads_test.c)
+  set_tests_properties(mlcp_enum_threads_test PROPERTIES SKIP_RETURN_CODE 77)
 
   # ----------- MCP solvers tests -----------
   begin_tests(src/MCP/test)
@@ -229,8 +237,39 @@ if(WITH_${COMPONENT}_TESTING)
     DRIVER gfc3d_test_collection.c.in FORMULATION gfc3d COLLECTION TEST_IPM_COLLECTION_1
     EXTRA_SOURCES data_collection_gfc3d_1.c test_ipm_gfc3d_1.c)
 
+  # matrix-free operators
+  new_test(SOURCES gfc3d_matrix_free_test.c)
+
   # Alart Curnier functions
   new_test(NAME AlartCurnierFunctions_test SOURCES fc3d_AlartCurnierFunctions_test.c)
+
+  # Jacobi iterations of the rolling friction on several threads
+  new_test(SOURCES rfc3d_jacobi_threads_test.c)
+  set_tests_properties(rfc3d_jacobi_threads_test PROPERTIES SKIP_RETURN_CODE 77)
+
+  # compact trace of the solved problems
+  new_test(SOURCES fc3d_trace_test.c)
+
+  # contacts distributed on the MPI processes
+  new_test(SOURCES fc3d_nsgs_mpi_test.c)
+  if(WITH_MPI)
+    # the same test on several processes, with the colored sweeps
+    # and with the Jacobi sweeps (relaxation)
+    foreach(_np 2 3)
+      foreach(_mode coloring jacobi)
+        set(_name fc3d_nsgs_mpi_test_np${_np}_${_mode})
+        add_test(NAME ${_name}
+          COMMAND ${MPIEXEC_EXECUTABLE} ${MPIEXEC_NUMPROC_FLAG} ${_np} ${MPIEXEC_PREFLAGS}
+          $<TARGET_FILE:fc3d_nsgs_mpi_test> ${MPIEXEC_POSTFLAGS} ${_mode}
+          WORKING_DIRECTORY ${CMAKE_CURRENT_BINARY_DIR}/${CURRENT_TEST_DIR})
+        set_siconos_test_properties(NAME ${_name})
+        set_tests_properties(${_name} PROPERTIES PROCESSORS ${_np})
+      endforeach()
+    endforeach()
+  endif()
+
+  # workspace of fc3d_nsgs kept between the calls
+  new_test(SOURCES fc3d_nsgs_workspace_test.c)
   
   if(WITH_FCLIB)
 
@@ -346,6 +385,9 @@ if(WITH_${COMPONENT}_TESTING)
   new_test(SOURCES soclcp_test1.c)
   new_test(SOURCES soclcp_test2.c)
   new_test(SOURCES soclcp_test3.c)
+  new_test(SOURCES soclcp_test6.c)
+  new_test(SOURCES soclcp_vi_threads_test.c)
+  set_tests_properties(soclcp_vi_threads_test PROPERTIES SKIP_RETURN_CODE 77)
   # timeout on all machines, see
   # http://cdash-bipop.inrialpes.fr/testSummary.php?project=1&name=SOCLCP_test4&date=2015-09-03
   # Feel free to remove this once it is fixed --xhub
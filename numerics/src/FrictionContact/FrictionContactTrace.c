@@ -0,0 +1,889 @@
+/* Siconos is a program dedicated to modeling, simulation and control
+ * of non smooth dynamical systems.
+ *
+ * Copyright 2020 INRIA.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+*/
+
+#include "FrictionContactTrace.h"
+#include <assert.h>                  // for assert
+#include <stdint.h>                  // for uint64_t
+#include <stdlib.h>                  // for free, malloc, realloc, calloc
+#include <string.h>                  // for memcpy, memcmp, memset
+#include <time.h>                    // for clock, CLOCKS_PER_SEC
+#include "CSparseMatrix_internal.h"  // for CSparseMatrix, CS_INT
+#include "FrictionContactProblem.h"  // for FrictionContactProblem
+#include "NonSmoothDrivers.h"        // for fc3d_driver, fc2d_driver
+#include "NumericsMatrix.h"          // for NumericsMatrix, NM_csc, NM_...
+#include "NumericsSparseMatrix.h"    // for NumericsSparseMatrix, NSM_CSC
+#include "SolverOptions.h"           // for SolverOptions, SICONOS_IPARAM...
+#include "SparseBlockMatrix.h"       // for SparseBlockStructuredMatrix
+#include "numerics_verbose.h"        // for numerics_warning
+
+/* File layout:
+ *   - the magic string FCT_MAGIC,
+ *   - a sequence of chunks: number of records (4 bytes), number of bytes
+ *     (8 bytes), then the records.
+ * Record layout:
+ *   - the statistics (FCT_STATS_SIZE bytes, written before the solve and
+ *     updated after it),
+ *   - the flags (1 byte),
+ *   - if FCT_STRUCTURE is set, the size of the encoded structure and
+ *     the structure,
+ *   - if FCT_FULL is set, all the values, else a bitmap of the modified
+ *     segments and their values.
+ * Integers are little endian, sizes and indices are written as base 128
+ * varints.
+ */
+#define FCT_MAGIC "SICOFCT1"
+#define FCT_MAGIC_SIZE 8
+#define FCT_DEFAULT_CHUNK_SIZE 64
+#define FCT_STATS_SIZE 40
+
+#define FCT_STRUCTURE 1
+#define FCT_FULL 2
+
+/** growable array of bytes */
+typedef struct
+{
+  unsigned char* data;
+  size_t size;
+  size_t capacity;
+} fct_buffer;
+
+/** reading position in an array of bytes */
+typedef struct
+{
+  const unsigned char* data;
+  size_t size;
+  size_t pos;
+  int error;
+} fct_cursor;
+
+struct FrictionContactTrace
+{
+  FILE* file;
+  int writing;
+  unsigned int chunk_size;
+  size_t steps;
+  size_t bytes;
+
+  /* records of the current chunk */
+  fct_buffer chunk;
+  /* records in the chunk (writing) or records still to be read (reading) */
+  unsigned int chunk_records;
+  /* reading position in the chunk */
+  size_t chunk_pos;
+  /* position of the statistics of the last record in the chunk */
+  size_t last_stats;
+  int pending_stats;
+  clock_t start;
+
+  /* encoded structure of the last problem */
+  fct_buffer structure;
+  fct_buffer new_structure;
+
+  /* values of the last problem: M, q, mu, r, u */
+  size_t nvalues;
+  double* values;
+  double* current;
+
+  /* segments [segments[k], segments[k+1]) of the values */
+  size_t nsegments;
+  size_t* segments;
+  size_t nmatrix_segments;
+
+  /* problem and initial guesses read */
+  FrictionContactProblem* problem;
+  double* reaction;
+  double* velocity;
+};
+
+static void fct_reserve(fct_buffer* b, size_t n)
+{
+  if(b->size + n > b->capacity)
+  {
+    size_t capacity = b->capacity ? 2 * b->capacity : 1024;
+    while(capacity < b->size + n) capacity *= 2;
+    b->data = (unsigned char*)realloc(b->data, capacity);
+    b->capacity = capacity;
+  }
+}
+
+static void fct_put_byte(fct_buffer* b, unsigned char c)
+{
+  fct_reserve(b, 1);
+  b->data[b->size++] = c;
+}
+
+static void fct_put_uint(fct_buffer* b, size_t v)
+{
+  while(v >= 0x80)
+  {
+    fct_put_byte(b, (unsigned char)(v | 0x80));
+    v >>= 7;
+  }
+  fct_put_byte(b, (unsigned char)v);
+}
+
+static void fct_set_fixed(unsigned char* p, uint64_t v, unsigned int nbytes)
+{
+  for(unsigned int k = 0; k < nbytes; ++k)
+    p[k] = (unsigned char)(v >> (8 * k));
+}
+
+static uint64_t fct_double_bits(double d)
+{
+  uint64_t x;
+  memcpy(&x, &d, sizeof(double));
+  return x;
+}
+
+static double fct_bits_double(uint64_t x)
+{
+  double d;
+  memcpy(&d, &x, sizeof(double));
+  return d;
+}
+
+/* a value is written as its xor with the previous one: a header byte
+ * (0 if the value is unchanged, else 0x80 | leading zero bytes << 3 |
+ * trailing zero bytes) and the remaining bytes */
+static void fct_put_double(fct_buffer* b, double value, double previous)
+{
+  uint64_t x = fct_double_bits(value) ^ fct_double_bits(previous);
+  if(!x)
+  {
+    fct_put_byte(b, 0);
+    return;
+  }
+  unsigned int lead = 0, trail = 0;
+  while(!((x >> (56 - 8 * lead)) & 0xff)) lead++;
+  while(!((x >> (8 * trail)) & 0xff)) trail++;
+  fct_reserve(b, 9);
+  b->data[b->size++] = (unsigned char)(0x80 | (lead << 3) | trail);
+  for(unsigned int k = trail; k < 8 - lead; ++k)
+    b->data[b->size++] = (unsigned char)(x >> (8 * k));
+}
+
+static unsigned char fct_get_byte(fct_cursor* c)
+{
+  if(c->pos >= c->size)
+  {
+    c->error = 1;
+    return 0;
+  }
+  return c->data[c->pos++];
+}
+
+static size_t fct_get_uint(fct_cursor* c)
+{
+  size_t v = 0;
+  unsigned int shift = 0;
+  unsigned char byte;
+  do
+  {
+    byte = fct_get_byte(c);
+    v |= (size_t)(byte & 0x7f) << shift;
+    shift += 7;
+  }
+  while((byte & 0x80) && !c->error && shift < 64);
+  return v;
+}
+
+static uint64_t fct_get_fixed(fct_cursor* c, unsigned int nbytes)
+{
+  uint64_t v = 0;
+  for(unsigned int k = 0; k < nbytes; ++k)
+    v |= (uint64_t)fct_get_byte(c) << (8 * k);
+  return v;
+}
+
+static double fct_get_double(fct_cursor* c, double previous)
+{
+  unsigned char header = fct_get_byte(c);
+  if(!header)
+    return previous;
+  unsigned int lead = (header >> 3) & 7, trail = header & 7;
+  uint64_t x = 0;
+  for(unsigned int k = trail; k < 8 - lead; ++k)
+    x |= (uint64_t)fct_get_byte(c) << (8 * k);
+  return fct_bits_double(x ^ fct_double_bits(previous));
+}
+
+/* encode the structure of a problem: dimension, number of contacts,
+ * storage and sizes of M, then its sparsity pattern */
+static void fct_encode_structure(fct_buffer* b, FrictionContactProblem* problem)
+{
+  NumericsMatrix* M = problem->M;
+  b->size = 0;
+  fct_put_uint(b, (size_t)problem->dimension);
+  fct_put_uint(b, (size_t)problem->numberOfContacts);
+  fct_put_uint(b, (size_t)M->storageType);
+  fct_put_uint(b, (size_t)M->size0);
+  fct_put_uint(b, (size_t)M->size1);
+  switch(M->storageType)
+  {
+  case NM_DENSE:
+    break;
+  case NM_SPARSE_BLOCK:
+  {
+    SparseBlockStructuredMatrix* m = M->matrix1;
+    fct_put_uint(b, m->blocknumber0);
+    fct_put_uint(b, m->blocknumber1);
+    for(unsigned int i = 0; i < m->blocknumber0; ++i)
+      fct_put_uint(b, m->blocksize0[i]);
+    for(unsigned int j = 0; j < m->blocknumber1; ++j)
+      fct_put_uint(b, m->blocksize1[j]);
+    fct_put_uint(b, m->filled1);
+    for(size_t i = 0; i < m->filled1; ++i)
+      fct_put_uint(b, m->index1_data[i]);
+    fct_put_uint(b, m->filled2);
+    for(size_t k = 0; k < m->filled2; ++k)
+      fct_put_uint(b, m->index2_data[k]);
+    break;
+  }
+  case NM_SPARSE:
+  {
+    CSparseMatrix* csc = NM_csc(M);
+    for(CS_INT j = 0; j <= csc->n; ++j)
+      fct_put_uint(b, (size_t)csc->p[j]);
+    for(CS_INT k = 0; k < csc->p[csc->n]; ++k)
+      fct_put_uint(b, (size_t)csc->i[k]);
+    break;
+  }
+  default:
+    numerics_error("fct_encode_structure", "unknown storageType %d for matrix\n", M->storageType);
+  }
+}
+
+static void fct_add_segment(FrictionContactTrace* trace, size_t size)
+{
+  trace->segments[trace->nsegments + 1] = trace->segments[trace->nsegments] + size;
+  trace->nsegments++;
+}
+
+/* compute the segments of the values from the encoded structure and, if
+ * build is set, allocate the problem and the initial guesses read */
+static int fct_layout(FrictionContactTrace* trace, int build)
+{
+  fct_cursor c = {trace->structure.data, trace->structure.size, 0, 0};
+  int dim = (int)fct_get_uint(&c);
+  int nc = (int)fct_get_uint(&c);
+  int storage = (int)fct_get_uint(&c);
+  int size0 = (int)fct_get_uint(&c);
+  int size1 = (int)fct_get_uint(&c);
+  int n = dim * nc;
+  if(c.error || size0 != n || size1 != n)
+    return -1;
+
+  NumericsMatrix* M = NULL;
+  size_t nmatrix = 0;
+  switch(storage)
+  {
+  case NM_DENSE:
+  {
+    nmatrix = (size_t)size1;
+    if(build)
+      M = NM_create(NM_DENSE, size0, size1);
+    break;
+  }
+  case NM_SPARSE_BLOCK:
+  {
+    size_t bn0 = fct_get_uint(&c);
+    size_t bn1 = fct_get_uint(&c);
+    if(c.error) return -1;
+    SparseBlockStructuredMatrix* m = SBM_new();
+    m->blocknumber0 = (unsigned int)bn0;
+    m->blocknumber1 = (unsigned int)bn1;
+    m->blocksize0 = (unsigned int*)malloc((bn0 + 1) * sizeof(unsigned int));
+    m->blocksize1 = (unsigned int*)malloc((bn1 + 1) * sizeof(unsigned int));
+    for(size_t i = 0; i < bn0; ++i)
+      m->blocksize0[i] = (unsigned int)fct_get_uint(&c);
+    for(size_t j = 0; j < bn1; ++j)
+      m->blocksize1[j] = (unsigned int)fct_get_uint(&c);
+    m->filled1 = fct_get_uint(&c);
+    m->index1_data = (size_t*)malloc((m->filled1 + 1) * sizeof(size_t));
+    for(size_t i = 0; i < m->filled1 && !c.error; ++i)
+      m->index1_data[i] = fct_get_uint(&c);
+    m->filled2 = fct_get_uint(&c);
+    m->nbblocks = (unsigned int)m->filled2;
+    m->index2_data = (size_t*)malloc((m->filled2 + 1) * sizeof(size_t));
+    m->block = (double**)calloc(m->filled2 + 1, sizeof(double*));
+    for(size_t k = 0; k < m->filled2 && !c.error; ++k)
+      m->index2_data[k] = fct_get_uint(&c);
+    nmatrix = m->filled2;
+    if(!c.error && m->filled1 > bn0 + 1)
+      c.error = 1;
+    for(size_t i = 0; i + 1 < m->filled1 && !c.error; ++i)
+      for(size_t k = m->index1_data[i]; k < m->index1_data[i + 1] && !c.error; ++k)
+        if(k >= m->filled2 || m->index2_data[k] >= bn1)
+          c.error = 1;
+    if(!c.error && build)
+    {
+      M = NM_new_SBM(size0, size1, m);
+    }
+    else
+    {
+      SBM_clear(m);
+      free(m);
+    }
+    break;
+  }
+  case NM_SPARSE:
+  {
+    if(build)
+    {
+      M = NM_create(NM_SPARSE, size0, size1);
+      CS_INT* p = (CS_INT*)malloc((size1 + 1) * sizeof(CS_INT));
+      for(int j = 0; j <= size1; ++j)
+        p[j] = (CS_INT)fct_get_uint(&c);
+      if(c.error)
+      {
+        free(p);
+        break;
+      }
+      NM_csc_alloc(M, p[size1]);
+      M->matrix2->origin = NSM_CSC;
+      CSparseMatrix* csc = M->matrix2->csc;
+      memcpy(csc->p, p, (size1 + 1) * sizeof(CS_INT));
+      for(CS_INT k = 0; k < p[size1]; ++k)
+        csc->i[k] = (CS_INT)fct_get_uint(&c);
+      free(p);
+    }
+    nmatrix = (size_t)size1;
+    break;
+  }
+  default:
+    return -1;
+  }
+  if(c.error)
+  {
+    if(M)
+    {
+      NM_clear(M);
+      free(M);
+    }
+    return -1;
+  }
+
+  /* segments: the blocks or the columns of M, then q, r, u by contact
+   * and mu */
+  trace->segments = (size_t*)realloc(trace->segments,
+                                     (nmatrix + 3 * nc + 2) * sizeof(size_t));
+  trace->segments[0] = 0;
+  trace->nsegments = 0;
+  c.pos = 0;
+  switch(storage)
+  {
+  case NM_DENSE:
+    for(int j = 0; j < size1; ++j)
+      fct_add_segment(trace, (size_t)size0);
+    break;
+  case NM_SPARSE_BLOCK:
+  {
+    /* the structure has been checked above */
+    SparseBlockStructuredMatrix m;
+    fct_get_uint(&c); fct_get_uint(&c); fct_get_uint(&c);
+    fct_get_uint(&c); fct_get_uint(&c);
+    m.blocknumber0 = (unsigned int)fct_get_uint(&c);
+    m.blocknumber1 = (unsigned int)fct_get_uint(&c);
+    size_t* rows = (size_t*)malloc((m.blocknumber0 + m.blocknumber1 + 1) * sizeof(size_t));
+    size_t* cols = rows + m.blocknumber0;
+    size_t previous = 0;
+    for(unsigned int i = 0; i < m.blocknumber0; ++i)
+    {
+      size_t s = fct_get_uint(&c);
+      rows[i] = s - previous;
+      previous = s;
+    }
+    previous = 0;
+    for(unsigned int j = 0; j < m.blocknumber1; ++j)
+    {
+      size_t s = fct_get_uint(&c);
+      cols[j] = s - previous;
+      previous = s;
+    }
+    size_t filled1 = fct_get_uint(&c);
+    size_t* index1 = (size_t*)malloc((filled1 + 1) * sizeof(size_t));
+    for(size_t i = 0; i < filled1; ++i)
+      index1[i] = fct_get_uint(&c);
+    size_t filled2 = fct_get_uint(&c);
+    size_t* index2 = (size_t*)malloc((filled2 + 1) * sizeof(size_t));
+    for(size_t k = 0; k < filled2; ++k)
+      index2[k] = fct_get_uint(&c);
+    size_t* sizes = (size_t*)calloc(filled2 + 1, sizeof(size_t));
+    for(size_t i = 0; i + 1 < filled1; ++i)
+      for(size_t k = index1[i]; k < index1[i + 1]; ++k)
+        sizes[k] = rows[i] * cols[index2[k]];
+    for(size_t k = 0; k < filled2; ++k)
+    {
+      fct_add_segment(trace, sizes[k]);
+      if(M)
+        M->matrix1->block[k] = (double*)calloc(sizes[k] ? sizes[k] : 1, sizeof(double));
+    }
+    free(sizes);
+    free(index2);
+    free(index1);
+    free(rows);
+    break;
+  }
+  case NM_SPARSE:
+  {
+    for(int k = 0; k < 5; ++k) fct_get_uint(&c);
+    size_t previous = fct_get_uint(&c);
+    for(int j = 0; j < size1; ++j)
+    {
+      size_t p = fct_get_uint(&c);
+      fct_add_segment(trace, p - previous);
+      previous = p;
+    }
+    break;
+  }
+  }
+  trace->nmatrix_segments = trace->nsegments;
+  for(int i = 0; i < nc; ++i)
+    fct_add_segment(trace, (size_t)dim);
+  fct_add_segment(trace, (size_t)nc);
+  for(int i = 0; i < 2 * nc; ++i)
+    fct_add_segment(trace, (size_t)dim);
+
+  trace->nvalues = trace->segments[trace->nsegments];
+  trace->values = (double*)realloc(trace->values, (trace->nvalues + 1) * sizeof(double));
+  trace->current = (double*)realloc(trace->current, (trace->nvalues + 1) * sizeof(double));
+  memset(trace->values, 0, trace->nvalues * sizeof(double));
+
+  if(build)
+  {
+    if(trace->problem)
+      frictionContactProblem_free(trace->problem);
+    trace->problem = frictionContactProblem_new();
+    trace->problem->dimension = dim;
+    trace->problem->numberOfContacts = nc;
+    trace->problem->M = M;
+    trace->problem->q = (double*)calloc(n + 1, sizeof(double));
+    trace->problem->mu = (double*)calloc(nc + 1, sizeof(double));
+    trace->reaction = (double*)realloc(trace->reaction, (n + 1) * sizeof(double));
+    trace->velocity = (double*)realloc(trace->velocity, (n + 1) * sizeof(double));
+  }
+  return 0;
+}
+
+/* copy the values of a problem and of the initial guesses in trace->current */
+static void fct_gather(FrictionContactTrace* trace, FrictionContactProblem* problem,
+                       double* reaction, double* velocity)
+{
+  NumericsMatrix* M = problem->M;
+  double* v = trace->current;
+  size_t nmatrix = trace->segments[trace->nmatrix_segments];
+  int n = problem->dimension * problem->numberOfContacts;
+  switch(M->storageType)
+  {
+  case NM_DENSE:
+    memcpy(v, M->matrix0, nmatrix * sizeof(double));
+    break;
+  case NM_SPARSE_BLOCK:
+    for(size_t k = 0; k < trace->nmatrix_segments; ++k)
+      memcpy(v + trace->segments[k], M->matrix1->block[k],
+             (trace->segments[k + 1] - trace->segments[k]) * sizeof(double));
+    break;
+  case NM_SPARSE:
+    memcpy(v, NM_csc(M)->x, nmatrix * sizeof(double));
+    break;
+  }
+  v += nmatrix;
+  memcpy(v, problem->q, n * sizeof(double));
+  v += n;
+  memcpy(v, problem->mu, problem->numberOfContacts * sizeof(double));
+  v += problem->numberOfContacts;
+  if(reaction)
+    memcpy(v, reaction, n * sizeof(double));
+  else
+    memset(v, 0, n * sizeof(double));
+  v += n;
+  if(velocity)
+    memcpy(v, velocity, n * sizeof(double));
+  else
+    memset(v, 0, n * sizeof(double));
+}
+
+/* copy trace->values in the problem and the initial guesses read */
+static void fct_scatter(FrictionContactTrace* trace)
+{
+  FrictionContactProblem* problem = trace->problem;
+  NumericsMatrix* M = problem->M;
+  const double* v = trace->values;
+  size_t nmatrix = trace->segments[trace->nmatrix_segments];
+  int n = problem->dimension * problem->numberOfContacts;
+  switch(M->storageType)
+  {
+  case NM_DENSE:
+    memcpy(M->matrix0, v, nmatrix * sizeof(double));
+    break;
+  case NM_SPARSE_BLOCK:
+    for(size_t k = 0; k < trace->nmatrix_segments; ++k)
+      memcpy(M->matrix1->block[k], v + trace->segments[k],
+             (trace->segments[k + 1] - trace->segments[k]) * sizeof(double));
+    break;
+  case NM_SPARSE:
+    memcpy(M->matrix2->csc->x, v, nmatrix * sizeof(double));
+    NM_clearTriplet(M);
+    NM_clearHalfTriplet(M);
+    NM_clearCSCTranspose(M);
+    NM_clearCSR(M);
+    break;
+  }
+  /* the storages computed by a previous solve are out of date */
+  NM_clear_other_storages(M, M->storageType);
+  v += nmatrix;
+  memcpy(problem->q, v, n * sizeof(double));
+  v += n;
+  memcpy(problem->mu, v, problem->numberOfContacts * sizeof(double));
+  v += problem->numberOfContacts;
+  memcpy(trace->reaction, v, n * sizeof(double));
+  v += n;
+  memcpy(trace->velocity, v, n * sizeof(double));
+}
+
+static int fct_flush(FrictionContactTrace* trace)
+{
+  if(!trace->chunk_records)
+    return 0;
+  unsigned char header[12];
+  fct_set_fixed(header, trace->chunk_records, 4);
+  fct_set_fixed(header + 4, trace->chunk.size, 8);
+  int error = fwrite(header, 1, 12, trace->file) != 12
+              || fwrite(trace->chunk.data, 1, trace->chunk.size, trace->file) != trace->chunk.size
+              || fflush(trace->file);
+  trace->bytes += 12 + trace->chunk.size;
+  trace->chunk.size = 0;
+  trace->chunk_records = 0;
+  trace->pending_stats = 0;
+  if(error)
+    numerics_warning("frictionContactTrace", "failed to write a chunk of the trace");
+  return error ? -1 : 0;
+}
+
+static FrictionContactTrace* fct_new(FILE* file, int writing)
+{
+  FrictionContactTrace* trace = (FrictionContactTrace*)calloc(1, sizeof(FrictionContactTrace));
+  trace->file = file;
+  trace->writing = writing;
+  return trace;
+}
+
+FrictionContactTrace* frictionContactTrace_open_write(const char* filename,
+                                                      unsigned int chunk_size)
+{
+  FILE* file = fopen(filename, "wb");
+  if(!file)
+    return NULL;
+  if(fwrite(FCT_MAGIC, 1, FCT_MAGIC_SIZE, file) != FCT_MAGIC_SIZE)
+  {
+    fclose(file);
+    return NULL;
+  }
+  FrictionContactTrace* trace = fct_new(file, 1);
+  trace->chunk_size = chunk_size ? chunk_size : FCT_DEFAULT_CHUNK_SIZE;
+  trace->bytes = FCT_MAGIC_SIZE;
+  return trace;
+}
+
+FrictionContactTrace* frictionContactTrace_open_read(const char* filename)
+{
+  FILE* file = fopen(filename, "rb");
+  if(!file)
+    return NULL;
+  char magic[FCT_MAGIC_SIZE];
+  if(fread(magic, 1, FCT_MAGIC_SIZE, file) != FCT_MAGIC_SIZE
+     || memcmp(magic, FCT_MAGIC, FCT_MAGIC_SIZE))
+  {
+    fclose(file);
+    return NULL;
+  }
+  FrictionContactTrace* trace = fct_new(file, 0);
+  trace->bytes = FCT_MAGIC_SIZE;
+  return trace;
+}
+
+int frictionContactTrace_close(FrictionContactTrace* trace)
+{
+  if(!trace)
+    return 0;
+  int info = 0;
+  if(trace->writing)
+    info = fct_flush(trace);
+  if(fclose(trace->file))
+    info = -1;
+  free(trace->chunk.data);
+  free(trace->structure.data);
+  free(trace->new_structure.data);
+  free(trace->values);
+  free(trace->current);
+  free(trace->segments);
+  if(trace->problem)
+    frictionContactProblem_free(trace->problem);
+  free(trace->reaction);
+  free(trace->velocity);
+  free(trace);
+  return info;
+}
+
+int frictionContactTrace_record(FrictionContactTrace* trace,
+                                FrictionContactProblem* problem,
+                                double* reaction, double* velocity)
+{
+  assert(trace && trace->writing);
+  assert(problem && problem->M);
+  int info = 0;
+  if(trace->chunk_records == trace->chunk_size)
+    info = fct_flush(trace);
+
+  /* the first record of a chunk holds the structure and all the values */
+  unsigned char flags = 0;
+  fct_encode_structure(&trace->new_structure, problem);
+  if(!trace->chunk_records
+     || trace->new_structure.size != trace->structure.size
+     || memcmp(trace->new_structure.data, trace->structure.data, trace->structure.size))
+  {
+    fct_buffer tmp = trace->structure;
+    trace->structure = trace->new_structure;
+    trace->new_structure = tmp;
+    flags = FCT_STRUCTURE | FCT_FULL;
+    if(fct_layout(trace, 0))
+      numerics_error("frictionContactTrace_record", "inconsistent problem structure");
+  }
+  fct_gather(trace, problem, reaction, velocity);
+
+  fct_buffer* b = &trace->chunk;
+  trace->last_stats = b->size;
+  fct_reserve(b, FCT_STATS_SIZE);
+  memset(b->data + b->size, 0, FCT_STATS_SIZE);
+  fct_set_fixed(b->data + b->size, (uint64_t)(uint32_t) -1, 4);
+  b->size += FCT_STATS_SIZE;
+  fct_put_byte(b, flags);
+
+  const double* previous = trace->values;
+  const double* current = trace->current;
+  if(flags & FCT_STRUCTURE)
+  {
+    fct_put_uint(b, trace->structure.size);
+    fct_reserve(b, trace->structure.size);
+    memcpy(b->data + b->size, trace->structure.data, trace->structure.size);
+    b->size += trace->structure.size;
+  }
+  if(flags & FCT_FULL)
+  {
+    for(size_t i = 0; i < trace->nvalues; ++i)
+      fct_put_double(b, current[i], 0.);
+  }
+  else
+  {
+    size_t nbitmap = (trace->nsegments + 7) / 8;
+    size_t bitmap = b->size;
+    fct_reserve(b, nbitmap);
+    memset(b->data + bitmap, 0, nbitmap);
+    b->size += nbitmap;
+    for(size_t k = 0; k < trace->nsegments; ++k)
+    {
+      size_t s = trace->segments[k], e = trace->segments[k + 1];
+      if(memcmp(current + s, previous + s, (e - s) * sizeof(double)))
+      {
+        b->data[bitmap + k / 8] |= (unsigned char)(1 << (k % 8));
+        for(size_t i = s; i < e; ++i)
+          fct_put_double(b, current[i], previous[i]);
+      }
+    }
+  }
+  double* tmp = trace->values;
+  trace->values = trace->current;
+  trace->current = tmp;
+
+  trace->chunk_records++;
+  trace->steps++;
+  trace->pending_stats = 1;
+  trace->start = clock();
+  return info;
+}
+
+void frictionContactTrace_record_result(FrictionContactTrace* trace,
+                                        int info, SolverOptions* options)
+{
+  assert(trace && trace->writing);
+  if(!trace->pending_stats)
+    return;
+  double cpu = (double)(clock() - trace->start) / CLOCKS_PER_SEC;
+  unsigned char* p = trace->chunk.data + trace->last_stats;
+  if(options)
+  {
+    fct_set_fixed(p, (uint64_t)(uint32_t)options->solverId, 4);
+    fct_set_fixed(p + 4, (uint64_t)(uint32_t)options->iparam[SICONOS_IPARAM_MAX_ITER], 4);
+    fct_set_fixed(p + 8, fct_double_bits(options->dparam[SICONOS_DPARAM_TOL]), 8);
+    fct_set_fixed(p + 20, (uint64_t)(uint32_t)options->iparam[SICONOS_IPARAM_ITER_DONE], 4);
+    fct_set_fixed(p + 24, fct_double_bits(options->dparam[SICONOS_DPARAM_RESIDU]), 8);
+  }
+  fct_set_fixed(p + 16, (uint64_t)(uint32_t)info, 4);
+  fct_set_fixed(p + 32, fct_double_bits(cpu), 8);
+  trace->pending_stats = 0;
+}
+
+int frictionContactTrace_read_next(FrictionContactTrace* trace,
+                                   FrictionContactProblem** problem,
+                                   double** reaction, double** velocity,
+                                   FrictionContactTraceStep* step)
+{
+  assert(trace && !trace->writing);
+  if(!trace->chunk_records)
+  {
+    unsigned char header[12];
+    size_t nread = fread(header, 1, 12, trace->file);
+    if(nread == 0 && feof(trace->file))
+      return 0;
+    if(nread != 12)
+      return -1;
+    fct_cursor h = {header, 12, 0, 0};
+    unsigned int nrecords = (unsigned int)fct_get_fixed(&h, 4);
+    size_t size = (size_t)fct_get_fixed(&h, 8);
+    trace->chunk.size = 0;
+    fct_reserve(&trace->chunk, size);
+    if(fread(trace->chunk.data, 1, size, trace->file) != size || !nrecords)
+      return -1;
+    trace->chunk.size = size;
+    trace->chunk_records = nrecords;
+    trace->chunk_pos = 0;
+    trace->bytes += 12 + size;
+  }
+
+  fct_cursor c = {trace->chunk.data, trace->chunk.size, trace->chunk_pos, 0};
+  FrictionContactTraceStep s;
+  s.solverId = (int)(int32_t)fct_get_fixed(&c, 4);
+  s.maxIter = (int)(int32_t)fct_get_fixed(&c, 4);
+  s.tolerance = fct_bits_double(fct_get_fixed(&c, 8));
+  s.info = (int)(int32_t)fct_get_fixed(&c, 4);
+  s.iterations = (int)(int32_t)fct_get_fixed(&c, 4);
+  s.residual = fct_bits_double(fct_get_fixed(&c, 8));
+  s.cpuTime = fct_bits_double(fct_get_fixed(&c, 8));
+  unsigned char flags = fct_get_byte(&c);
+  if(c.error)
+    return -1;
+
+  if(flags & FCT_STRUCTURE)
+  {
+    size_t size = fct_get_uint(&c);
+    if(c.error || c.pos + size > c.size)
+      return -1;
+    trace->structure.size = 0;
+    fct_reserve(&trace->structure, size);
+    memcpy(trace->structure.data, c.data + c.pos, size);
+    trace->structure.size = size;
+    c.pos += size;
+    if(fct_layout(trace, 1))
+      return -1;
+  }
+  else if(!trace->problem)
+    return -1;
+
+  double* values = trace->values;
+  if(flags & FCT_FULL)
+  {
+    for(size_t i = 0; i < trace->nvalues; ++i)
+      values[i] = fct_get_double(&c, 0.);
+  }
+  else
+  {
+    size_t nbitmap = (trace->nsegments + 7) / 8;
+    if(c.pos + nbitmap > c.size)
+      return -1;
+    const unsigned char* bitmap = c.data + c.pos;
+    c.pos += nbitmap;
+    for(size_t k = 0; k < trace->nsegments; ++k)
+      if(bitmap[k / 8] & (1 << (k % 8)))
+        for(size_t i = trace->segments[k]; i < trace->segments[k + 1]; ++i)
+          values[i] = fct_get_double(&c, values[i]);
+  }
+  if(c.error)
+    return -1;
+  fct_scatter(trace);
+
+  trace->chunk_pos = c.pos;
+  trace->chunk_records--;
+  trace->steps++;
+  *problem = trace->problem;
+  *reaction = trace->reaction;
+  *velocity = trace->velocity;
+  if(step)
+    *step = s;
+  return 1;
+}
+
+size_t frictionContactTrace_steps(FrictionContactTrace* trace)
+{
+  return trace->steps;
+}
+
+size_t frictionContactTrace_bytes(FrictionContactTrace* trace)
+{
+  return trace->bytes;
+}
+
+int frictionContactTrace_replay(const char* filename, SolverOptions* options,
+                                FILE* report)
+{
+  FrictionContactTrace* trace = frictionContactTrace_open_read(filename);
+  if(!trace)
+    return -1;
+
+  FrictionContactProblem* problem;
+  double* reaction;
+  double* velocity;
+  FrictionContactTraceStep step;
+  int nsteps = 0;
+  int status;
+  while((status = frictionContactTrace_read_next(trace, &problem, &reaction,
+                                                 &velocity, &step)) == 1)
+  {
+    SolverOptions* stepOptions = options;
+    if(!options)
+    {
+      if(step.solverId < 0)
+      {
+        numerics_warning("frictionContactTrace_replay",
+                         "no solver recorded for step %d", nsteps);
+        status = -1;
+        break;
+      }
+      stepOptions = solver_options_create(step.solverId);
+      stepOptions->iparam[SICONOS_IPARAM_MAX_ITER] = step.maxIter;
+      stepOptions->dparam[SICONOS_DPARAM_TOL] = step.tolerance;
+    }
+    clock_t start = clock();
+    int info;
+    if(problem->dimension == 2)
+      info = fc2d_driver(problem, reaction, velocity, stepOptions);
+    else
+      info = fc3d_driver(problem, reaction, velocity, stepOptions);
+    double cpu = (double)(clock() - start) / CLOCKS_PER_SEC;
+    if(report)
+      fprintf(report, "%d %d %d %d %g %g %d %d %g %g\n", nsteps,
+              problem->numberOfContacts, step.info, step.iterations,
+              step.residual, step.cpuTime, info,
+              stepOptions->iparam[SICONOS_IPARAM_ITER_DONE],
+              stepOptions->dparam[SICONOS_DPARAM_RESIDU], cpu);
+    if(!options)
+      solver_options_delete(stepOptions);
+    nsteps++;
+  }
+  frictionContactTrace_close(trace);
+  return status < 0 ? -1 : nsteps;
+}
@@ -0,0 +1,150 @@
+/* Siconos is a program dedicated to modeling, simulation and control
+ * of non smooth dynamical systems.
+ *
+ * Copyright 2020 INRIA.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+*/
+#ifndef FRICTIONCONTACTTRACE_H
+#define FRICTIONCONTACTTRACE_H
+
+/*!\file FrictionContactTrace.h
+  \brief Compact trace of the successive friction-contact problems solved
+  during a simulation.
+
+  A trace file holds, for each solve, the problem (M, q, mu), the initial
+  guesses for the reaction and the velocity and some statistics of the
+  solve (solver, tolerance, returned value, number of iterations,
+  residual, cpu time).
+
+  A problem is stored as a difference with the previous one: when the
+  structure of M (storage, sizes, sparsity pattern) is unchanged, only the
+  segments of values that have been modified are written (blocks of a
+  sparse block matrix, columns of a dense or csc matrix, q, r and u by
+  contact, mu). Each value is written as the bitwise xor with its previous
+  value, leading and trailing zero bytes being dropped, so that values
+  that are close to their previous value take a few bytes.
+
+  Records are grouped into chunks, written at once. The first record of
+  a chunk is always complete, hence a truncated file only loses its last
+  chunk.
+
+  frictionContactTrace_replay() solves again the recorded problems, in
+  order to reproduce the behavior of the solver on the slow steps.
+*/
+
+#include <stdio.h>          // for FILE, size_t
+#include "NumericsFwd.h"    // for FrictionContactProblem, SolverOptions
+#include "SiconosConfig.h"  // for BUILD_AS_CPP // IWYU pragma: keep
+
+typedef struct FrictionContactTrace FrictionContactTrace;
+
+/** \struct FrictionContactTraceStep FrictionContactTrace.h
+ * Statistics of a recorded solve.
+ */
+typedef struct
+{
+  int solverId;     /**< id of the solver, -1 if unknown */
+  int maxIter;      /**< maximum number of iterations */
+  double tolerance; /**< required tolerance */
+  int info;         /**< value returned by the driver */
+  int iterations;   /**< number of iterations done */
+  double residual;  /**< residual at the end of the solve */
+  double cpuTime;   /**< cpu time of the solve, in seconds */
+} FrictionContactTraceStep;
+
+#if defined(__cplusplus) && !defined(BUILD_AS_CPP)
+extern "C"
+{
+#endif
+
+  /** open a trace file for writing
+   * \param filename name of the file, replaced if it exists
+   * \param chunk_size number of records per chunk (0 for the default, 64)
+   * \return the trace, NULL if the file cannot be opened
+   */
+  FrictionContactTrace* frictionContactTrace_open_write(const char* filename,
+                                                        unsigned int chunk_size);
+
+  /** open a trace file for reading
+   * \param filename name of the file
+   * \return the trace, NULL if the file cannot be opened or is not a trace
+   */
+  FrictionContactTrace* frictionContactTrace_open_read(const char* filename);
+
+  /** close a trace (the records not yet written are flushed) and free it
+   * \param trace the trace
+   * \return 0 if successful
+   */
+  int frictionContactTrace_close(FrictionContactTrace* trace);
+
+  /** record a problem and the initial guesses, before the solve
+   * \param trace a trace opened for writing
+   * \param problem the problem
+   * \param reaction initial guess for the reaction (NULL for zero)
+   * \param velocity initial guess for the velocity (NULL for zero)
+   * \return 0 if successful
+   */
+  int frictionContactTrace_record(FrictionContactTrace* trace,
+                                  FrictionContactProblem* problem,
+                                  double* reaction, double* velocity);
+
+  /** record the statistics of the solve of the last recorded problem
+   * \param trace a trace opened for writing
+   * \param info the value returned by the driver
+   * \param options the solver options used for the solve (may be NULL)
+   */
+  void frictionContactTrace_record_result(FrictionContactTrace* trace,
+                                          int info, SolverOptions* options);
+
+  /** read the next record of a trace
+   * \param trace a trace opened for reading
+   * \param[out] problem the problem, owned by the trace and valid until
+   *             the next reading
+   * \param[out] reaction the initial guess for the reaction, owned by the trace
+   * \param[out] velocity the initial guess for the velocity, owned by the trace
+   * \param[out] step the statistics of the solve (may be NULL)
+   * \return 1 if a record has been read, 0 at the end of the trace, -1 on error
+   */
+  int frictionContactTrace_read_next(FrictionContactTrace* trace,
+                                     FrictionContactProblem** problem,
+                                     double** reaction, double** velocity,
+                                     FrictionContactTraceStep* step);
+
+  /** \return the number of records written or read so far
+   * \param trace the trace
+   */
+  size_t frictionContactTrace_steps(FrictionContactTrace* trace);
+
+  /** \return the number of bytes written or read so far
+   * \param trace the trace
+   */
+  size_t frictionContactTrace_bytes(FrictionContactTrace* trace);
+
+  /** solve again the problems of a trace, from their recorded initial guesses
+   * \param filename name of the trace file
+   * \param options the solver options, NULL to use the recorded solver,
+   *        tolerance and maximum number of iterations
+   * \param report if not NULL, a line per step is printed in it: step,
+   *        number of contacts, recorded info, iterations, residual and cpu
+   *        time, then the same values for the new solve
+   * \return the number of solved problems, -1 on error
+   */
+  int frictionContactTrace_replay(const char* filename, SolverOptions* options,
+                                  FILE* report);
+
+#if defined(__cplusplus) && !defined(BUILD_AS_CPP)
+}
+#endif
+
+#endif
@@ -59,6 +59,8 @@ enum FRICTION_SOLVER
   SICONOS_FRICTION_3D_PFP = 522,
   /** ADMM local formulation */
   SICONOS_FRICTION_3D_ADMM = 523,
+  /** NSGS on a contact set distributed on the processes of a MPI communicator */
+  SICONOS_FRICTION_3D_NSGS_MPI = 524,
 
   /* 3D Frictional Contact solvers for one contact (used mainly inside NSGS solvers) */
 
@@ -111,6 +113,8 @@ enum FRICTION_SOLVER
   SICONOS_ROLLING_FRICTION_3D_NSGS = 3000,
   SICONOS_ROLLING_FRICTION_3D_ONECONTACT_ProjectionOnCone= 3001,
   SICONOS_ROLLING_FRICTION_3D_ONECONTACT_ProjectionOnConeWithLocalIteration = 3002,
+  /** Non-smooth Jacobi, local formulation, with the contacts solved in parallel */
+  SICONOS_ROLLING_FRICTION_3D_JACOBI = 3003,
 
   /** Non-smooth Gauss Seidel, local formulation */
   SICONOS_ROLLING_FRICTION_2D_NSGS = 4000,
@@ -128,6 +132,7 @@ extern const char* const   SICONOS_FRICTION_2D_ENUM_STR ;
 
 extern const char* const   SICONOS_FRICTION_3D_NSGS_STR ;
 extern const char* const   SICONOS_FRICTION_3D_NSGSV_STR ;
+extern const char* const   SICONOS_FRICTION_3D_NSGS_MPI_STR ;
 extern const char* const   SICONOS_FRICTION_3D_PROX_STR;
 extern const char* const   SICONOS_FRICTION_3D_TFP_STR ;
 extern const char* const   SICONOS_FRICTION_3D_PFP_STR ;
@@ -186,6 +191,7 @@ extern const char* const   SICONOS_FRICTION_3D_ONECONTACT_QUARTIC_NU_STR ;
 extern const char* const   SICONOS_ROLLING_FRICTION_3D_NSGS_STR ;
 extern const char* const   SICONOS_ROLLING_FRICTION_3D_ONECONTACT_ProjectionOnCone_STR;
 extern const char* const   SICONOS_ROLLING_FRICTION_3D_ONECONTACT_ProjectionOnConeWithLocalIteration_STR;
+extern const char* const   SICONOS_ROLLING_FRICTION_3D_JACOBI_STR ;
 
 extern const char* const   SICONOS_ROLLING_FRICTION_2D_NSGS_STR ;
 extern const char* const   SICONOS_ROLLING_FRICTION_2D_ONECONTACT_ProjectionOnCone_STR;
@@ -246,11 +252,33 @@ enum SICONOS_FRICTION_3D_NSGS_IPARAM
   SICONOS_FRICTION_3D_NSGS_SHUFFLE_SEED=6,
   /** index in iparam to store the  */
   SICONOS_FRICTION_3D_NSGS_FILTER_LOCAL_SOLUTION =14,
+  /** index in iparam to store the precision of the off-diagonal blocks */
+  SICONOS_FRICTION_3D_NSGS_MIXED_PRECISION =15,
+  /** index in iparam to store the number of successive sweeps with a small
+      change of its reaction after which the local solve of a contact is
+      skipped (0: all the contacts are solved at each sweep) */
+  SICONOS_FRICTION_3D_NSGS_FREEZING_SWEEPS =12,
+  /** index in iparam to store the frequency of the sweeps in which all the
+      contacts are solved, when some of them may be skipped */
+  SICONOS_FRICTION_3D_NSGS_FULL_SWEEP_FREQUENCY =13,
+  /** index in iparam to store the number of threads of the Jacobi solvers */
+  SICONOS_FRICTION_3D_NSGS_NUMBER_OF_THREADS =16,
+  /** index in iparam to store, for NSGS_MPI, if the processes are colored
+      so that only processes without coupled contacts solve their local
+      problems at the same time (1), or if all the processes solve them at
+      the same time (0, block Jacobi, which needs a relaxation) */
+  SICONOS_FRICTION_3D_NSGS_MPI_COLORING =17,
 };
 enum SICONOS_FRICTION_3D_NSGS_DPARAM
 {
   /** index in dparam to store the relaxation strategy */
   SICONOS_FRICTION_3D_NSGS_RELAXATION_VALUE=8,
+  /** index in dparam to store the incremental error under which the
+      mixed precision iterations are followed by double precision ones */
+  SICONOS_FRICTION_3D_NSGS_MIXED_PRECISION_TOL=9,
+  /** index in dparam to store the relative change of a reaction under
+      which a sweep is counted as quiet for SICONOS_FRICTION_3D_NSGS_FREEZING_SWEEPS */
+  SICONOS_FRICTION_3D_NSGS_FREEZING_TOL=10,
 };
 
 
@@ -297,6 +325,15 @@ enum SICONOS_FRICTION_3D_NSGS_FILTER_LOCAL_SOLUTION_ENUM
   SICONOS_FRICTION_3D_NSGS_FILTER_LOCAL_SOLUTION_FALSE =0,
   SICONOS_FRICTION_3D_NSGS_FILTER_LOCAL_SOLUTION_TRUE =1
 };
+enum SICONOS_FRICTION_3D_NSGS_MIXED_PRECISION_ENUM
+{
+  /** all the iterations in double precision */
+  SICONOS_FRICTION_3D_NSGS_MIXED_PRECISION_FALSE =0,
+  /** off-diagonal blocks of a sparse block matrix in single precision until
+      the incremental error is below dparam[SICONOS_FRICTION_3D_NSGS_MIXED_PRECISION_TOL]
+      (or the tolerance), then double precision iterations */
+  SICONOS_FRICTION_3D_NSGS_MIXED_PRECISION_TRUE =1
+};
 
 
 enum SICONOS_FRICTION_3D_NSN_IPARAM
@@ -0,0 +1,101 @@
+/* Siconos is a program dedicated to modeling, simulation and control
+ * of non smooth dynamical systems.
+ *
+ * Copyright 2020 INRIA.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+*/
+#include "GlobalFrictionContactOperator.h"
+#include <stdlib.h>                        // for malloc
+#include "GlobalFrictionContactProblem.h"  // for GlobalFrictionContactProblem
+#include "NumericsMatrix.h"                // for NM_gemv, NM_tgemv, NM_gesv_expert
+#include "numerics_verbose.h"              // for numerics_error
+
+GlobalFrictionContactOperator* globalFrictionContactOperator_new(void)
+{
+  GlobalFrictionContactOperator* op = malloc(sizeof(GlobalFrictionContactOperator));
+  op->n = 0;
+  op->data = NULL;
+  op->M_gemv = NULL;
+  op->M_solve = NULL;
+  op->H_gemv = NULL;
+  op->Ht_gemv = NULL;
+  return op;
+}
+
+int globalFrictionContact_globalSize(GlobalFrictionContactProblem* problem)
+{
+  if(problem->op)
+    return problem->op->n;
+  return problem->M->size0;
+}
+
+int globalFrictionContact_isMatrixFree(GlobalFrictionContactProblem* problem)
+{
+  return (problem->op && (!problem->M || !problem->H));
+}
+
+void globalFrictionContact_M_gemv(GlobalFrictionContactProblem* problem,
+                                  double alpha, const double* x, double beta, double* y)
+{
+  if(problem->op && problem->op->M_gemv)
+    problem->op->M_gemv(problem->op->data, alpha, x, beta, y);
+  else if(problem->M)
+    NM_gemv(alpha, problem->M, x, beta, y);
+  else
+    numerics_error("globalFrictionContact_M_gemv", "neither M nor op->M_gemv is set");
+}
+
+int globalFrictionContact_M_solve(GlobalFrictionContactProblem* problem, double* x)
+{
+  if(problem->op && problem->op->M_solve)
+    return problem->op->M_solve(problem->op->data, x);
+  else if(problem->M)
+    return NM_gesv_expert(problem->M, x, NM_PRESERVE);
+  numerics_error("globalFrictionContact_M_solve", "neither M nor op->M_solve is set");
+  return 1;
+}
+
+void globalFrictionContact_H_gemv(GlobalFrictionContactProblem* problem,
+                                  double alpha, const double* x, double beta, double* y)
+{
+  if(problem->op && problem->op->H_gemv)
+    problem->op->H_gemv(problem->op->data, alpha, x, beta, y);
+  else if(problem->H)
+    NM_gemv(alpha, problem->H, x, beta, y);
+  else
+    numerics_error("globalFrictionContact_H_gemv", "neither H nor op->H_gemv is set");
+}
+
+void globalFrictionContact_Ht_gemv(GlobalFrictionContactProblem* problem,
+                                   double alpha, const double* x, double beta, double* y)
+{
+  if(problem->op && problem->op->Ht_gemv)
+    problem->op->Ht_gemv(problem->op->data, alpha, x, beta, y);
+  else if(problem->H)
+    NM_tgemv(alpha, problem->H, x, beta, y);
+  else
+    numerics_error("globalFrictionContact_Ht_gemv", "neither H nor op->Ht_gemv is set");
+}
+
+int globalFrictionContact_Delassus_gemv(GlobalFrictionContactProblem* problem,
+                                        const double* x, double* y, double* work)
+{
+  /* work = H x */
+  globalFrictionContact_H_gemv(problem, 1.0, x, 0.0, work);
+  /* work = M^{-1} H x */
+  int info = globalFrictionContact_M_solve(problem, work);
+  /* y = H^T M^{-1} H x */
+  globalFrictionContact_Ht_gemv(problem, 1.0, work, 0.0, y);
+  return info;
+}
@@ -0,0 +1,132 @@
+/* Siconos is a program dedicated to modeling, simulation and control
+ * of non smooth dynamical systems.
+ *
+ * Copyright 2020 INRIA.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+*/
+#ifndef GLOBALFRICTIONCONTACTOPERATOR_H
+#define GLOBALFRICTIONCONTACTOPERATOR_H
+
+/*!\file GlobalFrictionContactOperator.h
+  \brief Matrix-free description of the operators M and H of a global
+  friction-contact problem.
+*/
+
+#include "NumericsFwd.h"  // for GlobalFrictionContactProblem
+#include "SiconosConfig.h" // for BUILD_AS_CPP // IWYU pragma: keep
+
+/** computes \f$ y = \alpha A x + \beta y \f$ for an operator A
+ *  \param data user data (GlobalFrictionContactOperator::data)
+ *  \param alpha scalar
+ *  \param x input vector
+ *  \param beta scalar
+ *  \param[in,out] y output vector
+ */
+typedef void (*GlobalFrictionContactOperator_gemv)(void* data, double alpha, const double* x, double beta, double* y);
+
+/** computes \f$ x \leftarrow M^{-1} x \f$ in place
+ *  \param data user data (GlobalFrictionContactOperator::data)
+ *  \param[in,out] x right-hand side on input, solution on output
+ *  \return 0 if successful
+ */
+typedef int (*GlobalFrictionContactOperator_solve)(void* data, double* x);
+
+/** \struct GlobalFrictionContactOperator GlobalFrictionContactOperator.h
+ *
+ * Callbacks applying the operators of a GlobalFrictionContactProblem
+ * without any global assembly of M and H (for instance using the
+ * per-DS iteration matrices of the integrator and the per-interaction
+ * jacobians).
+ *
+ * When GlobalFrictionContactProblem::op is set, solvers relying only on
+ * products (VI fixed-point projection and extra-gradient, error
+ * computation, computation of the global velocity) use these callbacks
+ * and problem->M and problem->H may be NULL. ADMM then solves its
+ * linear systems \f$ (M + \rho H H^T) v = r \f$ with a conjugate
+ * gradient preconditioned by M_solve. Solvers that factorize or convert
+ * the global matrices (IPM, NSN, NSGS, reformulations) still require
+ * M and H.
+ */
+struct GlobalFrictionContactOperator
+{
+  /** size \f$ n \f$ of the global velocity */
+  int n;
+  /** user data, given as first argument to the callbacks */
+  void* data;
+  /** \f$ y = \alpha M x + \beta y \f$, x and y of size n */
+  GlobalFrictionContactOperator_gemv M_gemv;
+  /** \f$ x \leftarrow M^{-1} x \f$, x of size n */
+  GlobalFrictionContactOperator_solve M_solve;
+  /** \f$ y = \alpha H x + \beta y \f$, x of size m, y of size n */
+  GlobalFrictionContactOperator_gemv H_gemv;
+  /** \f$ y = \alpha H^T x + \beta y \f$, x of size n, y of size m */
+  GlobalFrictionContactOperator_gemv Ht_gemv;
+};
+
+#if defined(__cplusplus) && !defined(BUILD_AS_CPP)
+extern "C"
+{
+#endif
+
+  /** creates an empty operator (all callbacks set to NULL)
+   * \return a pointer to a GlobalFrictionContactOperator
+   */
+  GlobalFrictionContactOperator* globalFrictionContactOperator_new(void);
+
+  /** \param problem the problem
+   * \return the size n of the global velocity, from problem->op if set,
+   * from problem->M otherwise
+   */
+  int globalFrictionContact_globalSize(GlobalFrictionContactProblem* problem);
+
+  /** \param problem the problem
+   * \return 1 if the problem has no assembled M or H and must be solved
+   * through problem->op
+   */
+  int globalFrictionContact_isMatrixFree(GlobalFrictionContactProblem* problem);
+
+  /** \f$ y = \alpha M x + \beta y \f$ (through problem->op if set) */
+  void globalFrictionContact_M_gemv(GlobalFrictionContactProblem* problem,
+                                    double alpha, const double* x, double beta, double* y);
+
+  /** \f$ x \leftarrow M^{-1} x \f$ (through problem->op if set,
+   * otherwise with NM_gesv_expert(problem->M, x, NM_PRESERVE))
+   * \return 0 if successful
+   */
+  int globalFrictionContact_M_solve(GlobalFrictionContactProblem* problem, double* x);
+
+  /** \f$ y = \alpha H x + \beta y \f$ (through problem->op if set) */
+  void globalFrictionContact_H_gemv(GlobalFrictionContactProblem* problem,
+                                    double alpha, const double* x, double beta, double* y);
+
+  /** \f$ y = \alpha H^T x + \beta y \f$ (through problem->op if set) */
+  void globalFrictionContact_Ht_gemv(GlobalFrictionContactProblem* problem,
+                                     double alpha, const double* x, double beta, double* y);
+
+  /** applies the Delassus operator \f$ y = H^T M^{-1} H x \f$ without
+   * forming it
+   * \param problem the problem
+   * \param x input vector, of size m
+   * \param[out] y output vector, of size m
+   * \param work a work vector of size n
+   * \return 0 if successful
+   */
+  int globalFrictionContact_Delassus_gemv(GlobalFrictionContactProblem* problem,
+                                          const double* x, double* y, double* work);
+
+#if defined(__cplusplus) && !defined(BUILD_AS_CPP)
+}
+#endif
+
+#endif
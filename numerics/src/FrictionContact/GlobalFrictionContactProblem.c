@@ -22,6 +22,7 @@
 #include <string.h>            // for memcpy
 #include "SiconosBlas.h"         // for cblas_dscal, cblas_dcopy
 #include "NumericsMatrix.h"    // for NumericsMatrix, NM_display, NM_clear
+#include "GlobalFrictionContactOperator.h" // for globalFrictionContact_M_solve
 #include "numerics_verbose.h"  // for CHECK_IO
 #include "io_tools.h"
 #include "debug.h"
@@ -38,6 +39,7 @@ GlobalFrictionContactProblem* globalFrictionContactProblem_new(void)
   problem->b = NULL;
   problem->mu = NULL;
   problem->env = NULL;
+  problem->op = NULL;
   problem->numberOfContacts = 0;
   problem->dimension = 0;
   return problem;
@@ -268,6 +270,7 @@ GlobalFrictionContactProblem* globalFrictionContact_copy(GlobalFrictionContactPr
   new->mu = (double*)malloc(nc*sizeof(double));
   memcpy(new->mu, problem->mu, nc*sizeof(double));
   new->env = NULL;
+  new->op = problem->op;
   return new;
 }
 
@@ -399,8 +402,8 @@ int globalFrictionContact_computeGlobalVelocity(
 {
   int info = -1;
 
-  int n = problem->M->size0;
-  int m = problem->H->size1;
+  int n = globalFrictionContact_globalSize(problem);
+  int m = problem->H ? problem->H->size1 : problem->numberOfContacts * problem->dimension;
 
   /* globalVelocity <- problem->q */
   cblas_dcopy(n,  problem->q, 1, globalVelocity, 1);
@@ -409,12 +412,12 @@ int globalFrictionContact_computeGlobalVelocity(
   if(m>0)
   {
     /* globalVelocity <-  H*reaction + globalVelocity*/
-    NM_gemv(1.0, problem->H, reaction, 1.0, globalVelocity);
+    globalFrictionContact_H_gemv(problem, 1.0, reaction, 1.0, globalVelocity);
     DEBUG_EXPR(NM_vector_display(reaction, m));
   }
 
   /* Compute globalVelocity <- M^(-1) globalVelocity*/
-  info = NM_gesv_expert(problem->M, globalVelocity, NM_PRESERVE);
+  info = globalFrictionContact_M_solve(problem, globalVelocity);
   DEBUG_EXPR(NM_vector_display(globalVelocity, n));
 
   return info;
@@ -60,6 +60,10 @@ struct GlobalFrictionContactProblem
   double* mu;
   /** opaque environment, solver specific */
   void* env;
+  /** matrix-free operators (optional, NULL by default). If set, they are
+      used instead of M and H by the solvers that only need products,
+      see GlobalFrictionContactOperator. Not owned by the problem. */
+  GlobalFrictionContactOperator* op;
 };
 
 #if defined(__cplusplus) && !defined(BUILD_AS_CPP)
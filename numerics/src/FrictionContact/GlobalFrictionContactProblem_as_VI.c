@@ -19,7 +19,8 @@
 #include "GlobalFrictionContactProblem_as_VI.h"
 #include <math.h>                          // for sqrt
 #include "GlobalFrictionContactProblem.h"  // for GlobalFrictionContactProblem
-#include "NumericsMatrix.h"                // for NM_gemv, NM_tgemv, Numeric...
+#include "GlobalFrictionContactOperator.h" // for globalFrictionContact_M_gemv, ...
+#include "NumericsMatrix.h"                // for NM_vector_display
 #include "VariationalInequality.h"         // for VariationalInequality
 #include "projectionOnCone.h"              // for projectionOnCone
 #include "SiconosBlas.h"                         // for cblas_dcopy
@@ -38,7 +39,7 @@ void Function_VI_GFC3D(void * self, int n_notused, double *x, double *F)
   int nLocal =  gfc3d->dimension;
 
   int m = gfc3d->numberOfContacts *  gfc3d->dimension;
-  int n =  gfc3d->M->size0;
+  int n =  globalFrictionContact_globalSize(gfc3d);
   DEBUG_EXPR(NM_vector_display(x, n+m));
 
   double * globalVelocity = &x[0];
@@ -47,8 +48,8 @@ void Function_VI_GFC3D(void * self, int n_notused, double *x, double *F)
   cblas_dcopy(n, gfc3d->q, 1, F, 1);
   for(int i  = 0; i < n; i++) F[i] *= -1.0;  /* F= -q*/
 
-  NM_gemv(1.0, gfc3d->M, globalVelocity, 1.0, F); /* F= M v -q */
-  NM_gemv(-1.0, gfc3d->H, reaction, 1.0, F); /* F= M v -q - Hr  */
+  globalFrictionContact_M_gemv(gfc3d, 1.0, globalVelocity, 1.0, F); /* F= M v -q */
+  globalFrictionContact_H_gemv(gfc3d, -1.0, reaction, 1.0, F); /* F= M v -q - Hr  */
 
   /* cblas_dcopy(n , gfc3d->q , 1 , F, 1); */
 
@@ -58,7 +59,7 @@ void Function_VI_GFC3D(void * self, int n_notused, double *x, double *F)
 
   double * localvelocity = &F[n];
   cblas_dcopy(m, gfc3d->b, 1, localvelocity, 1); /* localvelocity = b */
-  NM_tgemv(1., gfc3d->H, globalVelocity, 1., localvelocity); /* localvelocity = b + H^T V*/
+  globalFrictionContact_Ht_gemv(gfc3d, 1., globalVelocity, 1., localvelocity); /* localvelocity = b + H^T V*/
 
   for(int contact = 0 ; contact <  gfc3d->numberOfContacts ; ++contact)
   {
@@ -86,7 +87,7 @@ void Projection_VI_GFC3D(void *viIn, double *x, double *PX)
 
   int nLocal =  gfc3d->dimension;
   int m = gfc3d->numberOfContacts* nLocal;
-  int n =  gfc3d->M->size0;
+  int n =  globalFrictionContact_globalSize(gfc3d);
   DEBUG_EXPR(NM_vector_display(x, n+m));
   cblas_dcopy(n+m, x, 1, PX, 1);
 
@@ -69,6 +69,9 @@ void fc3d_ConvexQP_ProjectedGradient_Cylinder(FrictionContactProblem* problem, d
   SolverOptions * cqpsolver_options = solver_options_create(SICONOS_CONVEXQP_PG);
   cqpsolver_options->dparam[SICONOS_DPARAM_TOL] = options->dparam[SICONOS_DPARAM_TOL];
   cqpsolver_options->iparam[SICONOS_IPARAM_MAX_ITER] = options->iparam[SICONOS_IPARAM_MAX_ITER];
+  cqpsolver_options->iparam[SICONOS_IPARAM_ACCELERATION] = options->iparam[SICONOS_IPARAM_ACCELERATION];
+  cqpsolver_options->iparam[SICONOS_IPARAM_ACCELERATION_MEMORY] = options->iparam[SICONOS_IPARAM_ACCELERATION_MEMORY];
+  cqpsolver_options->dparam[SICONOS_DPARAM_ACCELERATION_RESTART] = options->dparam[SICONOS_DPARAM_ACCELERATION_RESTART];
   //cqpsolver_options->dWork =  options->dWork;
   convexQP_ProjectedGradient(cqp, reaction, velocity, info, cqpsolver_options);
   //options->solverId = SICONOS_FRICTION_3D_CONVEXQP_PG_CYLINDER;
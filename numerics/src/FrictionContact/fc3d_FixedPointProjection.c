@@ -29,6 +29,7 @@
 #include "debug.h"                   // for DEBUG_EXPR_WE, DEBUG_PRINTF
 #include "fc3d_Solvers.h"            // for fc3d_fixedPointProjection, fc3d_...
 #include "fc3d_compute_error.h"      // for fc3d_compute_error
+#include "fixed_point_acceleration.h" // for fixed_point_acceleration_update
 #include "numerics_verbose.h"        // for verbose
 #include "projectionOnCone.h"        // for projectionOnCone
 #include "SiconosBlas.h"                   // for cblas_dcopy, cblas_dnrm2, cblas_...
@@ -101,6 +102,7 @@ void fc3d_fixedPointProjection(FrictionContactProblem* problem, double *reaction
     velocity_k = (double *)calloc(n,sizeof(double));
     reactiontmp = (double *)calloc(n,sizeof(double));
   }
+  fixed_point_acceleration * acc = fixed_point_acceleration_new(n, options);
 
 
 
@@ -208,6 +210,13 @@ void fc3d_fixedPointProjection(FrictionContactProblem* problem, double *reaction
                    );
 
 
+      /* the extrapolated reaction is projected again */
+      if(fixed_point_acceleration_update(acc, reaction_k, reaction))
+      {
+        for(contact = 0 ; contact < nc ; ++contact)
+          projectionOnCone(&reaction[contact * nLocal], mu[contact]);
+      }
+
       /* **** Criterium convergence **** */
       fc3d_compute_error(problem, reaction, velocity, tolerance, options, norm_q, &error);
       DEBUG_EXPR_WE(
@@ -245,6 +254,7 @@ void fc3d_fixedPointProjection(FrictionContactProblem* problem, double *reaction
   free(reaction_k);
   free(velocity_k);
   free(reactiontmp);
+  fixed_point_acceleration_free(acc);
 
 }
 
@@ -252,4 +262,5 @@ void fc3d_fixedPointProjection(FrictionContactProblem* problem, double *reaction
 void fc3d_fpp_set_default(SolverOptions* options)
 {
   options->dparam[SICONOS_FRICTION_3D_NSN_RHO] = 1.0;
+  fixed_point_acceleration_set_default(options);
 }
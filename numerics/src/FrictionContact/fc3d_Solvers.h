@@ -102,13 +102,51 @@ extern "C"
 
       The internal (local) solver must set by the SolverOptions options[1]
 
+      The local problem and the arrays of the contacts are kept in
+      options->solverData between the calls, with the size of the
+      largest problem solved so far. They are released by
+      fc3d_nsgs_free_workspace(), called by solver_options_delete() and
+      solver_options_release_workspace().
+
   */
   void fc3d_nsgs(FrictionContactProblem* problem, double *reaction, double *velocity, int* info, SolverOptions* options);
 
+  /** release the workspace kept by fc3d_nsgs() in options->solverData
+      \param options the options given to fc3d_nsgs()
+  */
+  void fc3d_nsgs_free_workspace(SolverOptions* options);
+
   void fc3d_nsgs_initialize_local_solver(SolverPtr* solve, UpdatePtr* update, FreeSolverNSGSPtr* freeSolver, ComputeErrorPtr* computeError,
                                          FrictionContactProblem* problem, FrictionContactProblem* localproblem,
                                          SolverOptions * options);
 
+  /** Non-Smooth Gauss Seidel solver for a friction-contact 3D problem
+      distributed on the processes of a MPI communicator. Each process owns
+      a set of contacts: problem->numberOfContacts, q and mu are the ones of
+      its contacts and problem->M, with a sparse block storage, holds the
+      rows of its contacts and the columns of all the contacts, numbered
+      process by process. The communicator is the one of problem->M (see
+      NM_MPI_set_comm), MPI_COMM_WORLD by default. At each iteration the
+      reactions of the contacts coupled to the ones of another process are
+      exchanged, and the local problem is solved by the internal solver
+      (one sweep of NSGS by default). By default the processes are colored
+      and the colors solve one after the other, which is a NSGS with
+      another order of the contacts. Without MPI, the problem is solved on
+      a single process.
+      \param problem the local part of the friction-contact 3D problem
+      \param reaction reactions of the local contacts, in-out parameter
+      \param velocity velocities of the local contacts, in-out parameter
+      \param info return 0 if the solution is found
+      \param options the solver options :
+      [in]  iparam[SICONOS_FRICTION_3D_IPARAM_ERROR_EVALUATION] error evaluation, as for NSGS
+      [in]  iparam[SICONOS_FRICTION_3D_NSGS_MPI_COLORING] 1 to color the processes,
+            0 for a block Jacobi iteration between the processes
+      [in]  iparam[SICONOS_FRICTION_3D_NSGS_RELAXATION] and
+            dparam[SICONOS_FRICTION_3D_NSGS_RELAXATION_VALUE] relaxation of the iterates
+      [out] dparam[SICONOS_DPARAM_RESIDU] reached error, the same on all the processes
+  */
+  void fc3d_nsgs_mpi(FrictionContactProblem* problem, double *reaction, double *velocity, int* info, SolverOptions* options);
+
   void fc3d_admm(FrictionContactProblem*  problem, double*  reaction,
                  double*  velocity,
                  int*  info, SolverOptions*  options);
@@ -311,6 +349,7 @@ extern "C"
   void fc3d_nsn_nm_set_default(SolverOptions* options);
   void fc3d_pfp_set_default(SolverOptions* options);
   void fc3d_admm_set_default(SolverOptions* options);
+  void fc3d_nsgs_mpi_set_default(SolverOptions* options);
   void fc3d_onecontact_nsn_set_default(SolverOptions* options);
   void fc3d_onecontact_nsn_gp_set_default(SolverOptions* options);
   void fc3d_poc_set_default(SolverOptions* options);
@@ -33,6 +33,7 @@
 #include "debug.h"                   // for DEBUG_EXPR, DEBUG_PRINTF, DEBUG_...
 #include "fc3d_Solvers.h"            // for fc3d_checkTrivialCase, fc3d_admm
 #include "fc3d_compute_error.h"      // for fc3d_compute_error
+#include "fixed_point_acceleration.h" // for fixed_point_acceleration_update
 #include "numerics_verbose.h"        // for numerics_printf_verbose, numeric...
 #include "projectionOnCone.h"        // for projectionOnCone, projectionOnDu...
 #include "SiconosBlas.h"                   // for cblas_dcopy, cblas_daxpy, cblas_...
@@ -241,6 +242,11 @@ static void fc3d_admm_symmetric(FrictionContactProblem* restrict problem,
   rho_k=rho;
   int has_rho_changed = 1;
 
+  /* the generic acceleration, if any, acts on (z_hat, xi_hat) */
+  fixed_point_acceleration * acc = fixed_point_acceleration_new(2*m, options);
+  double * fp_x_k = acc ? (double*)malloc(2*m*sizeof(double)) : NULL;
+  double * fp_x = acc ? (double*)malloc(2*m*sizeof(double)) : NULL;
+
   while((iter < itermax) && (hasNotConverged > 0))
   {
     ++iter;
@@ -362,7 +368,17 @@ static void fc3d_admm_symmetric(FrictionContactProblem* restrict problem,
     /*********************************/
     /*  3 - Acceleration and restart */
     /*********************************/
-    if(options->iparam[SICONOS_FRICTION_3D_ADMM_IPARAM_ACCELERATION] == SICONOS_FRICTION_3D_ADMM_ACCELERATION ||
+    if(acc)
+    {
+      cblas_dcopy(m, z_hat, 1, fp_x_k, 1);
+      cblas_dcopy(m, xi_hat, 1, &fp_x_k[m], 1);
+      cblas_dcopy(m, z, 1, fp_x, 1);
+      cblas_dcopy(m, xi, 1, &fp_x[m], 1);
+      fixed_point_acceleration_update(acc, fp_x_k, fp_x);
+      cblas_dcopy(m, fp_x, 1, z_hat, 1);
+      cblas_dcopy(m, &fp_x[m], 1, xi_hat, 1);
+    }
+    else if(options->iparam[SICONOS_FRICTION_3D_ADMM_IPARAM_ACCELERATION] == SICONOS_FRICTION_3D_ADMM_ACCELERATION ||
         options->iparam[SICONOS_FRICTION_3D_ADMM_IPARAM_ACCELERATION] == SICONOS_FRICTION_3D_ADMM_ACCELERATION_AND_RESTART)
     {
       if((e <  eta * e_k))
@@ -451,6 +467,8 @@ static void fc3d_admm_symmetric(FrictionContactProblem* restrict problem,
     }
     numerics_printf_verbose(2, "fc3d_admm. rho = %5.2e\t, rho_k = %5.2e\t ", rho, rho_k);
     rho_ratio = rho_k/rho;
+    if(has_rho_changed)
+      fixed_point_acceleration_reset(acc);
 
     DEBUG_PRINTF("rho =%e\t,rho_k =%e \n", rho, rho_k);
 
@@ -528,6 +546,9 @@ static void fc3d_admm_symmetric(FrictionContactProblem* restrict problem,
     numerics_printf_verbose(1,"---- FC3D - ADMM  - Iteration %i rho = %14.7e \t full error = %14.7e", iter, rho, error);
   }
   NM_clear(W);
+  fixed_point_acceleration_free(acc);
+  free(fp_x_k);
+  free(fp_x);
   dparam[SICONOS_DPARAM_RESIDU] = error;
   iparam[SICONOS_IPARAM_ITER_DONE] = iter;
 }
@@ -649,7 +670,10 @@ static void fc3d_admm_asymmetric(FrictionContactProblem* restrict problem,
   rho_k=rho;
   int has_rho_changed = 1;
 
-
+  /* the generic acceleration, if any, acts on (z_hat, xi_hat) */
+  fixed_point_acceleration * acc = fixed_point_acceleration_new(4*m, options);
+  double * fp_x_k = acc ? (double*)malloc(4*m*sizeof(double)) : NULL;
+  double * fp_x = acc ? (double*)malloc(4*m*sizeof(double)) : NULL;
 
   while((iter < itermax) && (hasNotConverged > 0))
   {
@@ -803,7 +827,17 @@ static void fc3d_admm_asymmetric(FrictionContactProblem* restrict problem,
     /*********************************/
     /*  3 - Acceleration and restart */
     /*********************************/
-    if(options->iparam[SICONOS_FRICTION_3D_ADMM_IPARAM_ACCELERATION] == SICONOS_FRICTION_3D_ADMM_ACCELERATION ||
+    if(acc)
+    {
+      cblas_dcopy(2*m, z_hat, 1, fp_x_k, 1);
+      cblas_dcopy(2*m, xi_hat, 1, &fp_x_k[2*m], 1);
+      cblas_dcopy(2*m, z, 1, fp_x, 1);
+      cblas_dcopy(2*m, xi, 1, &fp_x[2*m], 1);
+      fixed_point_acceleration_update(acc, fp_x_k, fp_x);
+      cblas_dcopy(2*m, fp_x, 1, z_hat, 1);
+      cblas_dcopy(2*m, &fp_x[2*m], 1, xi_hat, 1);
+    }
+    else if(options->iparam[SICONOS_FRICTION_3D_ADMM_IPARAM_ACCELERATION] == SICONOS_FRICTION_3D_ADMM_ACCELERATION ||
         options->iparam[SICONOS_FRICTION_3D_ADMM_IPARAM_ACCELERATION] == SICONOS_FRICTION_3D_ADMM_ACCELERATION_AND_RESTART)
     {
       if((e <  eta * e_k))
@@ -894,6 +928,8 @@ static void fc3d_admm_asymmetric(FrictionContactProblem* restrict problem,
     numerics_printf_verbose(2, "fc3d_admm. rho = %5.2e\t, rho_k = %5.2e\t, r = %5.2e\t,  s = %5.2e\t", rho, rho_k, r, s);
 
     rho_ratio = rho_k/rho;
+    if(has_rho_changed)
+      fixed_point_acceleration_reset(acc);
     DEBUG_PRINTF("rho =%e\t,rho_k =%e \n", rho, rho_k);
 
     cblas_dscal(2*m, rho_ratio, xi,1);
@@ -953,6 +989,9 @@ static void fc3d_admm_asymmetric(FrictionContactProblem* restrict problem,
   NM_clear(A);
   NM_clear(M_s);
   NM_clear(W);
+  fixed_point_acceleration_free(acc);
+  free(fp_x_k);
+  free(fp_x);
 
 }
 
@@ -1106,4 +1145,5 @@ void fc3d_admm_set_default(SolverOptions* options)
   options->dparam[SICONOS_FRICTION_3D_ADMM_BALANCING_RESIDUAL_PHI]=2.0;
 
   options->iparam[SICONOS_FRICTION_3D_IPARAM_RESCALING]=SICONOS_FRICTION_3D_RESCALING_NO;
+  fixed_point_acceleration_set_default(options);
 }
@@ -93,8 +93,10 @@ int fc3d_driver(FrictionContactProblem* problem,
   if(problem->dimension != 3)
     numerics_error("fc3d_driver", "Dimension of the problem : problem-> dimension is not compatible or is not set");
 
-  /* Check for trivial case */
-  info = fc3d_checkTrivialCase(problem, velocity, reaction, options);
+  /* Check for trivial case. For a distributed problem, the contacts of a
+     single process do not tell if the solution is trivial. */
+  if(options->solverId != SICONOS_FRICTION_3D_NSGS_MPI)
+    info = fc3d_checkTrivialCase(problem, velocity, reaction, options);
   if(info == 0)
   {
     /* If a trivial solution is found, we set the number of iterations to 0
@@ -121,6 +123,12 @@ int fc3d_driver(FrictionContactProblem* problem,
     fc3d_nsgs_velocity(problem, reaction, velocity, &info, options);
     break;
   }
+  case SICONOS_FRICTION_3D_NSGS_MPI:
+  {
+    numerics_printf(" ========================== Call NSGS_MPI solver for Friction-Contact 3D problem ==========================\n");
+    fc3d_nsgs_mpi(problem, reaction, velocity, &info, options);
+    break;
+  }
   /* ADMM*/
   case SICONOS_FRICTION_3D_ADMM:
   {
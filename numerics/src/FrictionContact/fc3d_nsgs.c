@@ -25,7 +25,9 @@
 #include "Friction_cst.h"                              // for SICONOS_FRICTI...
 #include "NumericsArrays.h"                            // for uint_shuffle
 #include "NumericsFwd.h"                               // for SolverOptions
+#include "NumericsMatrix.h"                            // for NumericsMatrix
 #include "SolverOptions.h"                             // for SolverOptions
+#include "SparseBlockMatrix.h"                         // for SparseBlockStr...
 #include "fc3d_2NCP_Glocker.h"                         // for NCPGlocker_update
 #include "fc3d_NCPGlockerFixedPoint.h"                 // for fc3d_FixedP_in...
 #include "fc3d_Path.h"                                 // for fc3d_Path_init...
@@ -242,11 +244,12 @@ void fc3d_nsgs_initialize_local_solver(SolverPtr* solve, UpdatePtr* update,
 
 
 
+/* fill the given array of size nc with the shuffled contacts, returns NULL
+ * without shuffle */
 static
-unsigned int* allocShuffledContacts(FrictionContactProblem *problem,
-                                    SolverOptions *options)
+unsigned int* initShuffledContacts(FrictionContactProblem *problem,
+                                   SolverOptions *options, unsigned int *scontacts)
 {
-  unsigned int *scontacts = 0;
   unsigned int nc = problem->numberOfContacts;
   if(options->iparam[SICONOS_FRICTION_3D_NSGS_SHUFFLE] == SICONOS_FRICTION_3D_NSGS_SHUFFLE_TRUE||
       options->iparam[SICONOS_FRICTION_3D_NSGS_SHUFFLE] == SICONOS_FRICTION_3D_NSGS_SHUFFLE_TRUE_EACH_LOOP)
@@ -257,14 +260,14 @@ unsigned int* allocShuffledContacts(FrictionContactProblem *problem,
     }
     else
       srand(1);
-    scontacts = (unsigned int *) malloc(nc * sizeof(unsigned int));
     for(unsigned int i = 0; i < nc ; ++i)
     {
       scontacts[i] = i;
     }
     uint_shuffle(scontacts, nc);
+    return scontacts;
   }
-  return scontacts;
+  return NULL;
 }
 
 static
@@ -533,7 +536,372 @@ void statsIterationCallback(FrictionContactProblem *problem,
 }
 
 
+#define MIXED_PRECISION_WINDOW 50
+#define MIXED_PRECISION_STAGNATION 0.9
 
+/** Single precision copy of the off-diagonal blocks of a sparse block
+ * matrix, for the mixed precision iterations. The local problems are
+ * built from a problem whose matrix only holds the (double precision)
+ * diagonal blocks and whose q includes the off-diagonal products. */
+typedef struct
+{
+  size_t *row;           /**< blocks of the row i in [row[i], row[i+1]) */
+  unsigned int *column;  /**< column of the blocks */
+  float *blocks;         /**< the 3x3 blocks, column major */
+  FrictionContactProblem problem; /**< diagonal blocks, q and mu */
+} MixedPrecisionData;
+
+static
+void mixedPrecisionFree(MixedPrecisionData *data)
+{
+  SparseBlockStructuredMatrix *D = data->problem.M->matrix1;
+  /* the diagonal blocks belong to the matrix of the problem */
+  for(unsigned int i = 0; i < D->nbblocks; ++i)
+    D->block[i] = NULL;
+  NM_clear(data->problem.M);
+  free(data->problem.M);
+  free(data->problem.q);
+  free(data->blocks);
+  free(data->column);
+  free(data->row);
+  free(data);
+}
+
+static
+MixedPrecisionData * mixedPrecisionAllocate(FrictionContactProblem *problem)
+{
+  unsigned int nc = problem->numberOfContacts;
+  if(problem->M->storageType != NM_SPARSE_BLOCK)
+  {
+    numerics_warning("fc3d_nsgs", "mixed precision is only available for a sparse block matrix, "
+                     "all the iterations are done in double precision");
+    return NULL;
+  }
+  SparseBlockStructuredMatrix *M = problem->M->matrix1;
+  if(M->blocknumber0 != nc || M->filled1 != nc + 1)
+  {
+    numerics_warning("fc3d_nsgs", "mixed precision needs a diagonal block in each row, "
+                     "all the iterations are done in double precision");
+    return NULL;
+  }
+  for(unsigned int i = 0; i < nc; ++i)
+  {
+    if(M->blocksize0[i] != 3 * (i + 1) || M->blocksize1[i] != 3 * (i + 1))
+    {
+      numerics_warning("fc3d_nsgs", "mixed precision needs 3x3 blocks, "
+                       "all the iterations are done in double precision");
+      return NULL;
+    }
+  }
+
+  MixedPrecisionData *data = (MixedPrecisionData *)malloc(sizeof(MixedPrecisionData));
+  data->row = (size_t *)malloc((nc + 1) * sizeof(size_t));
+  data->column = (unsigned int *)malloc((M->filled2 + 1) * sizeof(unsigned int));
+  data->blocks = (float *)malloc((9 * M->filled2 + 1) * sizeof(float));
+
+  SparseBlockStructuredMatrix *D = SBM_new();
+  D->nbblocks = nc;
+  D->blocknumber0 = nc;
+  D->blocknumber1 = nc;
+  D->blocksize0 = (unsigned int *)malloc(nc * sizeof(unsigned int));
+  D->blocksize1 = (unsigned int *)malloc(nc * sizeof(unsigned int));
+  memcpy(D->blocksize0, M->blocksize0, nc * sizeof(unsigned int));
+  memcpy(D->blocksize1, M->blocksize1, nc * sizeof(unsigned int));
+  D->filled1 = nc + 1;
+  D->filled2 = nc;
+  D->index1_data = (size_t *)malloc((nc + 1) * sizeof(size_t));
+  D->index2_data = (size_t *)malloc(nc * sizeof(size_t));
+  D->block = (double **)calloc(nc, sizeof(double *));
+
+  size_t nb = 0;
+  int complete = 1;
+  for(unsigned int i = 0; i < nc; ++i)
+  {
+    data->row[i] = nb;
+    D->index1_data[i] = i;
+    D->index2_data[i] = i;
+    for(size_t k = M->index1_data[i]; k < M->index1_data[i + 1]; ++k)
+    {
+      unsigned int j = (unsigned int)M->index2_data[k];
+      if(j == i)
+        D->block[i] = M->block[k];
+      else
+      {
+        data->column[nb] = j;
+        for(int l = 0; l < 9; ++l)
+          data->blocks[9 * nb + l] = (float)M->block[k][l];
+        nb++;
+      }
+    }
+    if(!D->block[i])
+      complete = 0;
+  }
+  data->row[nc] = nb;
+  D->index1_data[nc] = nc;
+
+  data->problem.dimension = 3;
+  data->problem.numberOfContacts = nc;
+  data->problem.M = NM_new_SBM(3 * nc, 3 * nc, D);
+  data->problem.q = (double *)malloc(3 * nc * sizeof(double));
+  data->problem.mu = problem->mu;
+  memcpy(data->problem.q, problem->q, 3 * nc * sizeof(double));
+
+  if(!complete)
+  {
+    numerics_warning("fc3d_nsgs", "mixed precision needs a diagonal block in each row, "
+                     "all the iterations are done in double precision");
+    mixedPrecisionFree(data);
+    return NULL;
+  }
+  return data;
+}
+
+/* q of the local problem of a contact, with the off-diagonal blocks in
+ * single precision and a double precision accumulation */
+static
+void mixedPrecisionComputeQ(MixedPrecisionData *data, FrictionContactProblem *problem,
+                            double *reaction, unsigned int contact)
+{
+  double q0 = problem->q[3 * contact];
+  double q1 = problem->q[3 * contact + 1];
+  double q2 = problem->q[3 * contact + 2];
+  for(size_t k = data->row[contact]; k < data->row[contact + 1]; ++k)
+  {
+    const float *b = &data->blocks[9 * k];
+    const double *r = &reaction[3 * data->column[k]];
+    q0 += (double)b[0] * r[0] + (double)b[3] * r[1] + (double)b[6] * r[2];
+    q1 += (double)b[1] * r[0] + (double)b[4] * r[1] + (double)b[7] * r[2];
+    q2 += (double)b[2] * r[0] + (double)b[5] * r[1] + (double)b[8] * r[2];
+  }
+  data->problem.q[3 * contact] = q0;
+  data->problem.q[3 * contact + 1] = q1;
+  data->problem.q[3 * contact + 2] = q2;
+}
+
+/* NSGS iterations with the off-diagonal blocks in single precision, until
+ * the incremental error is below the switch tolerance or stagnates (it is
+ * limited by the rounding of the blocks). At most itermax - 1 iterations
+ * are done, so that at least one double precision iteration follows.
+ * \return the number of iterations done */
+static
+int mixedPrecisionIterations(MixedPrecisionData *data, FrictionContactProblem *problem,
+                             FrictionContactProblem *localproblem,
+                             UpdatePtr update_localproblem, SolverPtr local_solver,
+                             double *reaction, double *velocity, double *error,
+                             unsigned int *scontacts, SolverOptions *options)
+{
+  int *iparam = options->iparam;
+  double *dparam = options->dparam;
+  SolverOptions *localsolver_options = options->internalSolvers[0];
+  unsigned int nc = problem->numberOfContacts;
+  double omega = dparam[SICONOS_FRICTION_3D_NSGS_RELAXATION_VALUE];
+  double tolerance = dparam[SICONOS_FRICTION_3D_NSGS_MIXED_PRECISION_TOL];
+  if(tolerance < dparam[SICONOS_DPARAM_TOL])
+    tolerance = dparam[SICONOS_DPARAM_TOL];
+  double localreaction[3];
+  int iter = 0;
+  int hasNotConverged = 1;
+  /* the error is checked for stagnation every MIXED_PRECISION_WINDOW iterations */
+  double window_error = INFINITY;
+
+  while((iter < iparam[SICONOS_IPARAM_MAX_ITER] - 1) && (hasNotConverged > 0))
+  {
+    ++iter;
+    double light_error_sum = 0.0;
+    fc3d_set_internalsolver_tolerance(problem, options, localsolver_options, *error);
+
+    for(unsigned int i = 0 ; i < nc ; ++i)
+    {
+      unsigned int contact = i;
+      if(scontacts)
+      {
+        if(iparam[SICONOS_FRICTION_3D_NSGS_SHUFFLE] == SICONOS_FRICTION_3D_NSGS_SHUFFLE_TRUE_EACH_LOOP)
+          uint_shuffle(scontacts, nc);
+        contact = scontacts[i];
+      }
+
+      mixedPrecisionComputeQ(data, problem, reaction, contact);
+      solveLocalReaction(update_localproblem, local_solver, contact,
+                         &data->problem, localproblem, reaction, localsolver_options,
+                         localreaction);
+
+      if(iparam[SICONOS_FRICTION_3D_NSGS_RELAXATION] == SICONOS_FRICTION_3D_NSGS_RELAXATION_TRUE)
+        performRelaxation(localreaction, &reaction[contact*3], omega);
+
+      accumulateLightErrorSum(&light_error_sum, localreaction, &reaction[contact*3]);
+
+      if(iparam[SICONOS_FRICTION_3D_NSGS_FILTER_LOCAL_SOLUTION] == SICONOS_FRICTION_3D_NSGS_FILTER_LOCAL_SOLUTION_TRUE)
+        acceptLocalReactionFiltered(localproblem, localsolver_options,
+                                    contact, iter, reaction, localreaction);
+      else
+        acceptLocalReactionUnconditionally(contact, reaction, localreaction);
+    }
+
+    *error = calculateLightError(light_error_sum, nc, reaction);
+    numerics_printf("--------------- FC3D - NSGS - mixed precision");
+    hasNotConverged = determine_convergence(*error, tolerance, iter, options);
+    statsIterationCallback(problem, options, reaction, velocity, *error);
+
+    if(iter % MIXED_PRECISION_WINDOW == 0)
+    {
+      if(*error > MIXED_PRECISION_STAGNATION * window_error)
+      {
+        numerics_printf("--------------- FC3D - NSGS - mixed precision stagnation, "
+                        "switch to double precision");
+        break;
+      }
+      window_error = *error;
+    }
+  }
+  return iter;
+}
+
+/* Activity of the contacts, to skip the local solves of the contacts
+ * whose reaction has not changed for several sweeps. A skipped contact
+ * keeps its reaction, although its local problem changes with the
+ * reactions of its neighbours: every full_sweep_frequency iterations
+ * all the contacts are solved again (and a contact that moves becomes
+ * active), and the convergence is only checked after a full sweep. */
+typedef struct
+{
+  unsigned int *quiet; /* number of successive small changes of each contact */
+  unsigned int sweeps; /* number of small changes after which a contact is skipped */
+  int frequency;       /* frequency of the full sweeps */
+  double tol;          /* relative threshold on the change of a reaction */
+  int full;            /* is the current sweep a full one? */
+  int force_full;      /* the next sweep has to be a full one */
+  unsigned int skipped; /* number of skipped contacts in the current sweep */
+} ContactActivity;
+
+/* activity->quiet is an array of size nc, returns NULL without freezing */
+static
+ContactActivity * contactActivityInitialize(ContactActivity *activity, unsigned int nc, SolverOptions *options)
+{
+  if(options->iparam[SICONOS_FRICTION_3D_NSGS_FREEZING_SWEEPS] <= 0)
+    return NULL;
+  memset(activity->quiet, 0, nc * sizeof(unsigned int));
+  activity->sweeps = (unsigned int)options->iparam[SICONOS_FRICTION_3D_NSGS_FREEZING_SWEEPS];
+  activity->frequency = options->iparam[SICONOS_FRICTION_3D_NSGS_FULL_SWEEP_FREQUENCY];
+  activity->tol = options->dparam[SICONOS_FRICTION_3D_NSGS_FREEZING_TOL];
+  activity->full = 1;
+  activity->force_full = 0;
+  activity->skipped = 0;
+  return activity;
+}
+
+static inline
+void contactActivityStartSweep(ContactActivity *activity, int iter)
+{
+  activity->full = activity->force_full || activity->frequency <= 1
+                   || (iter % activity->frequency == 0);
+  activity->force_full = 0;
+  activity->skipped = 0;
+}
+
+static inline
+int contactActivitySkip(ContactActivity *activity, unsigned int contact)
+{
+  if(activity->full || activity->quiet[contact] < activity->sweeps)
+    return 0;
+  activity->skipped++;
+  return 1;
+}
+
+/* compare the new local reaction with the current one, before it is accepted */
+static inline
+void contactActivityUpdate(ContactActivity *activity, unsigned int contact,
+                           double *localreaction, double *oldreaction)
+{
+  double d0 = localreaction[0] - oldreaction[0];
+  double d1 = localreaction[1] - oldreaction[1];
+  double d2 = localreaction[2] - oldreaction[2];
+  double change = d0 * d0 + d1 * d1 + d2 * d2;
+  double norm = localreaction[0] * localreaction[0] + localreaction[1] * localreaction[1]
+                + localreaction[2] * localreaction[2];
+  if(change <= activity->tol * activity->tol * norm)
+    activity->quiet[contact]++;
+  else
+    activity->quiet[contact] = 0;
+}
+
+/* the incremental error of a partial sweep ignores the skipped contacts
+ * and is not used to decide the convergence: when it is small enough,
+ * the next sweep is a full one */
+static inline
+int contactActivityPartialSweep(ContactActivity *activity, double error,
+                                double tolerance, int iter)
+{
+  numerics_printf("--------------- FC3D - NSGS - Iteration %i partial sweep, %u contacts skipped, "
+                  "incremental error = %14.7e", iter, activity->skipped, error);
+  if(error < tolerance)
+    activity->force_full = 1;
+  return 1;
+}
+
+/* The workspace of fc3d_nsgs is kept in options->solverData between the
+ * calls, so that a sequence of problems (the time steps of a simulation)
+ * does not allocate anything once the largest one has been met. It is
+ * released by fc3d_nsgs_free_workspace. */
+typedef struct
+{
+  FrictionContactProblem *localproblem; /* the problem of one contact */
+  int sbm;                              /* localproblem->M points to the blocks of a sparse block matrix */
+  unsigned int size;                    /* number of contacts of the arrays below */
+  unsigned int *scontacts;              /* shuffled contacts */
+  ContactActivity activity;             /* skipped contacts, activity.quiet has size elements */
+} Fc3d_NSGS_workspace;
+
+static
+Fc3d_NSGS_workspace * fc3d_nsgs_workspace(FrictionContactProblem *problem, SolverOptions *options)
+{
+  unsigned int nc = problem->numberOfContacts;
+  int sbm = (problem->M->storageType == NM_SPARSE_BLOCK);
+  Fc3d_NSGS_workspace *workspace = (Fc3d_NSGS_workspace *)options->solverData;
+  if(!workspace)
+  {
+    workspace = (Fc3d_NSGS_workspace *)calloc(1, sizeof(Fc3d_NSGS_workspace));
+    options->solverData = workspace;
+  }
+  /* the local matrix is a copy of the diagonal blocks, or a pointer to
+   * them for a sparse block matrix */
+  if(workspace->localproblem && workspace->sbm != sbm)
+  {
+    if(workspace->sbm)
+      workspace->localproblem->M->matrix0 = NULL;
+    frictionContactProblem_free(workspace->localproblem);
+    workspace->localproblem = NULL;
+  }
+  if(!workspace->localproblem)
+  {
+    workspace->localproblem = fc3d_local_problem_allocate(problem);
+    workspace->sbm = sbm;
+  }
+  if(workspace->size < nc)
+  {
+    workspace->scontacts = (unsigned int *)realloc(workspace->scontacts, nc * sizeof(unsigned int));
+    workspace->activity.quiet = (unsigned int *)realloc(workspace->activity.quiet, nc * sizeof(unsigned int));
+    workspace->size = nc;
+  }
+  return workspace;
+}
+
+void fc3d_nsgs_free_workspace(SolverOptions* options)
+{
+  Fc3d_NSGS_workspace *workspace = (Fc3d_NSGS_workspace *)options->solverData;
+  if(!workspace)
+    return;
+  if(workspace->localproblem)
+  {
+    /* do not release the diagonal blocks of the original matrix */
+    if(workspace->sbm)
+      workspace->localproblem->M->matrix0 = NULL;
+    frictionContactProblem_free(workspace->localproblem);
+  }
+  free(workspace->scontacts);
+  free(workspace->activity.quiet);
+  free(workspace);
+  options->solverData = NULL;
+}
 
 void fc3d_nsgs(FrictionContactProblem* problem, double *reaction,
                double *velocity, int* info, SolverOptions* options)
@@ -575,18 +943,20 @@ void fc3d_nsgs(FrictionContactProblem* problem, double *reaction,
   int hasNotConverged = 1;
   unsigned int contact; /* Number of the current row of blocks in M */
   unsigned int *scontacts = NULL;
+  ContactActivity *activity = NULL;
 
   if(*info == 0)
     return;
 
   /*****  Initialize various solver options *****/
-  localproblem = fc3d_local_problem_allocate(problem);
+  Fc3d_NSGS_workspace *workspace = fc3d_nsgs_workspace(problem, options);
+  localproblem = workspace->localproblem;
 
   fc3d_nsgs_initialize_local_solver(&local_solver, &update_localproblem,
                                     (FreeSolverNSGSPtr *)&freeSolver, &computeError,
                                     problem, localproblem, options);
 
-  scontacts = allocShuffledContacts(problem, options);
+  scontacts = initShuffledContacts(problem, options, workspace->scontacts);
 
   /*****  Check solver options *****/
   if(!(iparam[SICONOS_FRICTION_3D_NSGS_SHUFFLE] == SICONOS_FRICTION_3D_NSGS_SHUFFLE_FALSE
@@ -615,8 +985,26 @@ void fc3d_nsgs(FrictionContactProblem* problem, double *reaction,
     return;
   }
 
+  /*****  Mixed precision iterations *****/
+
+  /* The double precision iterations below continue from them and act as
+   * a refinement, the final error is the one of the original problem. */
+  if(iparam[SICONOS_FRICTION_3D_NSGS_MIXED_PRECISION] == SICONOS_FRICTION_3D_NSGS_MIXED_PRECISION_TRUE)
+  {
+    MixedPrecisionData *mixed = mixedPrecisionAllocate(problem);
+    if(mixed)
+    {
+      iter = mixedPrecisionIterations(mixed, problem, localproblem,
+                                      update_localproblem, local_solver,
+                                      reaction, velocity, &error, scontacts, options);
+      mixedPrecisionFree(mixed);
+    }
+  }
+
   /*****  NSGS Iterations *****/
 
+  activity = contactActivityInitialize(&workspace->activity, nc, options);
+
   /* A special case for the most common options (should correspond
    * with mechanics_run.py **/
   if(iparam[SICONOS_FRICTION_3D_NSGS_SHUFFLE] == SICONOS_FRICTION_3D_NSGS_SHUFFLE_FALSE
@@ -630,16 +1018,23 @@ void fc3d_nsgs(FrictionContactProblem* problem, double *reaction,
       double light_error_sum = 0.0;
 
       fc3d_set_internalsolver_tolerance(problem, options, localsolver_options, error);
+      if(activity)
+        contactActivityStartSweep(activity, iter);
 
       for(unsigned int i = 0 ; i < nc ; ++i)
       {
         contact = i;
 
+        if(activity && contactActivitySkip(activity, contact))
+          continue;
 
         solveLocalReaction(update_localproblem, local_solver, contact,
                            problem, localproblem, reaction, localsolver_options,
                            localreaction);
 
+        if(activity)
+          contactActivityUpdate(activity, contact, localreaction, &reaction[contact*3]);
+
         accumulateLightErrorSum(&light_error_sum, localreaction, &reaction[contact*3]);
 
         /* #if 0 */
@@ -650,7 +1045,10 @@ void fc3d_nsgs(FrictionContactProblem* problem, double *reaction,
 
       error = calculateLightError(light_error_sum, nc, reaction);
 
-      hasNotConverged = determine_convergence(error, tolerance, iter, options);
+      if(activity && !activity->full)
+        hasNotConverged = contactActivityPartialSweep(activity, error, tolerance, iter);
+      else
+        hasNotConverged = determine_convergence(error, tolerance, iter, options);
 
       statsIterationCallback(problem, options, reaction, velocity, error);
     }
@@ -666,6 +1064,8 @@ void fc3d_nsgs(FrictionContactProblem* problem, double *reaction,
       ++iter;
       double light_error_sum = 0.0;
       fc3d_set_internalsolver_tolerance(problem, options, localsolver_options, error);
+      if(activity)
+        contactActivityStartSweep(activity, iter);
 
       for(unsigned int i = 0 ; i < nc ; ++i)
       {
@@ -679,6 +1079,8 @@ void fc3d_nsgs(FrictionContactProblem* problem, double *reaction,
         else
           contact = i;
 
+        if(activity && contactActivitySkip(activity, contact))
+          continue;
 
         solveLocalReaction(update_localproblem, local_solver, contact,
                            problem, localproblem, reaction, localsolver_options,
@@ -687,6 +1089,9 @@ void fc3d_nsgs(FrictionContactProblem* problem, double *reaction,
         if(iparam[SICONOS_FRICTION_3D_NSGS_RELAXATION] == SICONOS_FRICTION_3D_NSGS_RELAXATION_TRUE)
           performRelaxation(localreaction, &reaction[contact*3], omega);
 
+        if(activity)
+          contactActivityUpdate(activity, contact, localreaction, &reaction[contact*3]);
+
         accumulateLightErrorSum(&light_error_sum, localreaction, &reaction[contact*3]);
 
         /* int test =100; */
@@ -707,7 +1112,12 @@ void fc3d_nsgs(FrictionContactProblem* problem, double *reaction,
 
       }
 
-      if(iparam[SICONOS_FRICTION_3D_IPARAM_ERROR_EVALUATION] == SICONOS_FRICTION_3D_NSGS_ERROR_EVALUATION_LIGHT)
+      if(activity && !activity->full)
+      {
+        error = calculateLightError(light_error_sum, nc, reaction);
+        hasNotConverged = contactActivityPartialSweep(activity, error, tolerance, iter);
+      }
+      else if(iparam[SICONOS_FRICTION_3D_IPARAM_ERROR_EVALUATION] == SICONOS_FRICTION_3D_NSGS_ERROR_EVALUATION_LIGHT)
       {
         error = calculateLightError(light_error_sum, nc, reaction);
         hasNotConverged = determine_convergence(error, tolerance, iter, options);
@@ -763,8 +1173,6 @@ void fc3d_nsgs(FrictionContactProblem* problem, double *reaction,
 
   /** Free memory **/
   (*freeSolver)(problem,localproblem,localsolver_options);
-  fc3d_local_problem_free(localproblem, problem);
-  if(scontacts) free(scontacts);
 }
 
 void fc3d_nsgs_set_default(SolverOptions* options)
@@ -777,9 +1185,14 @@ void fc3d_nsgs_set_default(SolverOptions* options)
   options->iparam[SICONOS_FRICTION_3D_NSGS_SHUFFLE_SEED] = 0;
   options->iparam[SICONOS_FRICTION_3D_NSGS_FILTER_LOCAL_SOLUTION] = SICONOS_FRICTION_3D_NSGS_FILTER_LOCAL_SOLUTION_FALSE;
   options->iparam[SICONOS_FRICTION_3D_NSGS_RELAXATION] = SICONOS_FRICTION_3D_NSGS_RELAXATION_FALSE;
+  options->iparam[SICONOS_FRICTION_3D_NSGS_MIXED_PRECISION] = SICONOS_FRICTION_3D_NSGS_MIXED_PRECISION_FALSE;
+  options->iparam[SICONOS_FRICTION_3D_NSGS_FREEZING_SWEEPS] = 0;
+  options->iparam[SICONOS_FRICTION_3D_NSGS_FULL_SWEEP_FREQUENCY] = 10;
   options->iparam[SICONOS_FRICTION_3D_IPARAM_ERROR_EVALUATION_FREQUENCY] = 0;
   options->dparam[SICONOS_DPARAM_TOL] = 1e-4;
   options->dparam[SICONOS_FRICTION_3D_DPARAM_INTERNAL_ERROR_RATIO] = 10.0;
+  options->dparam[SICONOS_FRICTION_3D_NSGS_MIXED_PRECISION_TOL] = 1e-6;
+  options->dparam[SICONOS_FRICTION_3D_NSGS_FREEZING_TOL] = 1e-10;
   // Internal solver
   assert(options->numberOfInternalSolvers == 1);
   options->internalSolvers[0] = solver_options_create(SICONOS_FRICTION_3D_ONECONTACT_NSN_GP_HYBRID);
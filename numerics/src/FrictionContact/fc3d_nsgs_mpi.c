@@ -0,0 +1,523 @@
+/* Siconos is a program dedicated to modeling, simulation and control
+ * of non smooth dynamical systems.
+ *
+ * Copyright 2020 INRIA.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <assert.h>                      // for assert
+#include <float.h>                       // for DBL_EPSILON
+#include <math.h>                        // for sqrt, fabs
+#include <stdlib.h>                      // for malloc, free, qsort, bsearch
+#include "SiconosBlas.h"                 // for cblas_dcopy
+#include "FrictionContactProblem.h"      // for FrictionContactProblem
+#include "Friction_cst.h"                // for SICONOS_FRICTION_3D_NSGS...
+#include "NM_MPI.h"                      // for NM_MPI_comm
+#include "NumericsMatrix.h"              // for NumericsMatrix, NM_gemv
+#include "SolverOptions.h"               // for SolverOptions, SICONOS_DPA...
+#include "SparseBlockMatrix.h"           // for SparseBlockStructuredMatrix
+#include "fc3d_Solvers.h"                // for fc3d_nsgs, fc3d_nsgs_mpi
+#include "fc3d_compute_error.h"          // for fc3d_unitary_compute_and_a...
+#include "numerics_verbose.h"            // for numerics_printf, numerics_...
+#include "op3x3.h"                       // for mvp3x3
+
+const char* const   SICONOS_FRICTION_3D_NSGS_MPI_STR = "FC3D_NSGS_MPI";
+
+/* Distribution of the contacts and pattern of the halo exchange.
+ *
+ * The contacts are numbered process by process: the process of rank p
+ * owns the contacts offset, ..., offset + numberOfContacts - 1 of the
+ * global problem. The halo of a process is the set of the contacts owned
+ * by the other processes and coupled to its own contacts by a block of
+ * its rows of M. All the counts and displacements are in doubles. */
+typedef struct
+{
+#ifdef SICONOS_HAS_MPI
+  MPI_Comm comm;
+#endif
+  int rank;
+  int nranks;
+  int offset;
+  /* the processes of a color have no coupled contacts */
+  int color;
+  int ncolors;
+  /* contacts sent to the other processes, local numbers */
+  int send_size;
+  int * send_contacts;
+  int * send_counts;
+  int * send_displs;
+  double * send_buffer;
+  /* reactions of the halo contacts, sorted by global number */
+  int halo_size;
+  int * recv_counts;
+  int * recv_displs;
+  double * halo;
+  /* blocks of M coupling a local contact to a halo contact */
+  int nb_halo_blocks;
+  int * halo_block_row;
+  int * halo_block_pos;
+  double ** halo_block;
+} fc3d_nsgs_mpi_data;
+
+static int fc3d_nsgs_mpi_compare_int(const void * a, const void * b)
+{
+  int ia = *(const int *)a;
+  int ib = *(const int *)b;
+  return (ia > ib) - (ia < ib);
+}
+
+/* sum of the values of all the processes, in place */
+static void fc3d_nsgs_mpi_sum(fc3d_nsgs_mpi_data * data, double * values, int n)
+{
+#ifdef SICONOS_HAS_MPI
+  if(data->nranks > 1)
+    CHECK_MPI(data->comm, MPI_Allreduce(MPI_IN_PLACE, values, n, MPI_DOUBLE, MPI_SUM, data->comm));
+#endif
+}
+
+/* Greedy coloring of the graph of the processes, two processes being
+ * adjacent if one of them needs the reactions of the other one. All the
+ * processes compute the same coloring. */
+static void fc3d_nsgs_mpi_coloring(fc3d_nsgs_mpi_data * data)
+{
+  data->color = 0;
+  data->ncolors = 1;
+#ifdef SICONOS_HAS_MPI
+  int nranks = data->nranks;
+  if(nranks == 1)
+    return;
+  int * neighbours = (int *)malloc(nranks * sizeof(int));
+  int * graph = (int *)malloc(nranks * nranks * sizeof(int));
+  int * colors = (int *)malloc(nranks * sizeof(int));
+  int * used = (int *)malloc(nranks * sizeof(int));
+  for(int p = 0; p < nranks; p++)
+    neighbours[p] = (data->send_counts[p] > 0 || data->recv_counts[p] > 0);
+  CHECK_MPI(data->comm, MPI_Allgather(neighbours, nranks, MPI_INT, graph, nranks, MPI_INT, data->comm));
+  data->ncolors = 0;
+  for(int p = 0; p < nranks; p++)
+  {
+    for(int c = 0; c < data->ncolors; c++)
+      used[c] = 0;
+    for(int q = 0; q < p; q++)
+    {
+      if(graph[p * nranks + q] || graph[q * nranks + p])
+        used[colors[q]] = 1;
+    }
+    colors[p] = 0;
+    while(colors[p] < data->ncolors && used[colors[p]])
+      colors[p]++;
+    if(colors[p] == data->ncolors)
+      data->ncolors++;
+  }
+  data->color = colors[data->rank];
+  free(neighbours);
+  free(graph);
+  free(colors);
+  free(used);
+#endif
+}
+
+/* Splits the rows of M owned by this process into a square sparse block
+ * matrix on the local contacts, which shares its blocks with M, and a list
+ * of the blocks coupling the local contacts to the halo. The pattern of
+ * the halo exchange is computed at the same time. */
+static NumericsMatrix * fc3d_nsgs_mpi_setup(FrictionContactProblem * problem, fc3d_nsgs_mpi_data * data)
+{
+  int nc = problem->numberOfContacts;
+  SparseBlockStructuredMatrix * M = problem->M->matrix1;
+
+  data->rank = 0;
+  data->nranks = 1;
+  data->offset = 0;
+  int nc_global = nc;
+#ifdef SICONOS_HAS_MPI
+  data->comm = NM_MPI_comm(problem->M);
+  CHECK_MPI(data->comm, MPI_Comm_rank(data->comm, &data->rank));
+  CHECK_MPI(data->comm, MPI_Comm_size(data->comm, &data->nranks));
+#endif
+  int * first_contact = (int *)malloc((data->nranks + 1) * sizeof(int));
+  first_contact[0] = 0;
+  first_contact[1] = nc;
+#ifdef SICONOS_HAS_MPI
+  if(data->nranks > 1)
+  {
+    CHECK_MPI(data->comm, MPI_Allgather(&nc, 1, MPI_INT, first_contact + 1, 1, MPI_INT, data->comm));
+    for(int p = 0; p < data->nranks; p++)
+      first_contact[p + 1] += first_contact[p];
+    data->offset = first_contact[data->rank];
+    nc_global = first_contact[data->nranks];
+  }
+#endif
+
+  if(M->blocknumber0 != (unsigned int)nc || M->blocknumber1 != (unsigned int)nc_global)
+    numerics_error("fc3d_nsgs_mpi", "the rows of M must be the ones of the local contacts "
+                   "and its columns the ones of all the contacts");
+
+  /* count the local blocks and collect the halo contacts */
+  int nb_local_blocks = 0;
+  int nb_halo_blocks = 0;
+  for(size_t k = 0; k < M->filled2; k++)
+  {
+    int col = (int)M->index2_data[k];
+    if(col >= data->offset && col < data->offset + nc)
+      nb_local_blocks++;
+    else
+      nb_halo_blocks++;
+  }
+  int * halo_contacts = (int *)malloc((nb_halo_blocks + 1) * sizeof(int));
+  int nb = 0;
+  for(size_t k = 0; k < M->filled2; k++)
+  {
+    int col = (int)M->index2_data[k];
+    if(col < data->offset || col >= data->offset + nc)
+      halo_contacts[nb++] = col;
+  }
+  qsort(halo_contacts, nb_halo_blocks, sizeof(int), fc3d_nsgs_mpi_compare_int);
+  int halo_size = 0;
+  for(int k = 0; k < nb_halo_blocks; k++)
+  {
+    if(halo_size == 0 || halo_contacts[halo_size - 1] != halo_contacts[k])
+      halo_contacts[halo_size++] = halo_contacts[k];
+  }
+  data->halo_size = halo_size;
+
+  /* the local matrix and the halo blocks */
+  SparseBlockStructuredMatrix * A = SBM_new();
+  A->nbblocks = nb_local_blocks;
+  A->block = (double **)malloc((nb_local_blocks + 1) * sizeof(double *));
+  A->blocknumber0 = nc;
+  A->blocknumber1 = nc;
+  A->blocksize0 = (unsigned int *)malloc((nc + 1) * sizeof(unsigned int));
+  A->blocksize1 = (unsigned int *)malloc((nc + 1) * sizeof(unsigned int));
+  for(int i = 0; i < nc; i++)
+  {
+    A->blocksize0[i] = 3 * (i + 1);
+    A->blocksize1[i] = 3 * (i + 1);
+  }
+  A->filled1 = nc + 1;
+  A->filled2 = nb_local_blocks;
+  A->index1_data = (size_t *)malloc((nc + 1) * sizeof(size_t));
+  A->index2_data = (size_t *)malloc((nb_local_blocks + 1) * sizeof(size_t));
+
+  data->nb_halo_blocks = nb_halo_blocks;
+  data->halo_block_row = (int *)malloc((nb_halo_blocks + 1) * sizeof(int));
+  data->halo_block_pos = (int *)malloc((nb_halo_blocks + 1) * sizeof(int));
+  data->halo_block = (double **)malloc((nb_halo_blocks + 1) * sizeof(double *));
+
+  int nloc = 0;
+  nb = 0;
+  for(int row = 0; row < nc; row++)
+  {
+    A->index1_data[row] = nloc;
+    if((size_t)row + 1 >= M->filled1)
+      continue;
+    for(size_t k = M->index1_data[row]; k < M->index1_data[row + 1]; k++)
+    {
+      int col = (int)M->index2_data[k];
+      if(col >= data->offset && col < data->offset + nc)
+      {
+        A->block[nloc] = M->block[k];
+        A->index2_data[nloc++] = col - data->offset;
+      }
+      else
+      {
+        int * pos = (int *)bsearch(&col, halo_contacts, halo_size, sizeof(int), fc3d_nsgs_mpi_compare_int);
+        data->halo_block_row[nb] = row;
+        data->halo_block_pos[nb] = (int)(pos - halo_contacts);
+        data->halo_block[nb++] = M->block[k];
+      }
+    }
+  }
+  A->index1_data[nc] = nloc;
+
+  /* the halo exchange: each process receives the reactions of its halo
+   * contacts from their owners */
+  data->send_counts = (int *)calloc(data->nranks, sizeof(int));
+  data->send_displs = (int *)calloc(data->nranks, sizeof(int));
+  data->recv_counts = (int *)calloc(data->nranks, sizeof(int));
+  data->recv_displs = (int *)calloc(data->nranks, sizeof(int));
+  int owner = 0;
+  for(int k = 0; k < halo_size; k++)
+  {
+    while(halo_contacts[k] >= first_contact[owner + 1])
+      owner++;
+    data->recv_counts[owner]++;
+  }
+  if(data->nranks == 1 && halo_size > 0)
+    numerics_error("fc3d_nsgs_mpi", "the columns of M must be the ones of the local contacts "
+                   "without MPI");
+#ifdef SICONOS_HAS_MPI
+  if(data->nranks > 1)
+    CHECK_MPI(data->comm, MPI_Alltoall(data->recv_counts, 1, MPI_INT,
+                                       data->send_counts, 1, MPI_INT, data->comm));
+#endif
+  data->send_size = 0;
+  for(int p = 0; p < data->nranks; p++)
+  {
+    data->send_displs[p] = data->send_size;
+    data->send_size += data->send_counts[p];
+    if(p > 0)
+      data->recv_displs[p] = data->recv_displs[p - 1] + data->recv_counts[p - 1];
+  }
+  fc3d_nsgs_mpi_coloring(data);
+  data->send_contacts = (int *)malloc((data->send_size + 1) * sizeof(int));
+#ifdef SICONOS_HAS_MPI
+  if(data->nranks > 1)
+    CHECK_MPI(data->comm, MPI_Alltoallv(halo_contacts, data->recv_counts, data->recv_displs, MPI_INT,
+                                        data->send_contacts, data->send_counts, data->send_displs, MPI_INT,
+                                        data->comm));
+#endif
+  for(int k = 0; k < data->send_size; k++)
+    data->send_contacts[k] -= data->offset;
+  for(int p = 0; p < data->nranks; p++)
+  {
+    data->send_counts[p] *= 3;
+    data->send_displs[p] *= 3;
+    data->recv_counts[p] *= 3;
+    data->recv_displs[p] *= 3;
+  }
+  data->send_buffer = (double *)malloc((3 * data->send_size + 1) * sizeof(double));
+  data->halo = (double *)malloc((3 * halo_size + 1) * sizeof(double));
+
+  numerics_printf_verbose(1, "fc3d_nsgs_mpi, process %i: %i contacts, %i halo contacts, %i contacts sent, color %i of %i",
+                          data->rank, nc, halo_size, data->send_size, data->color, data->ncolors);
+
+  free(halo_contacts);
+  free(first_contact);
+  return NM_create_from_data(NM_SPARSE_BLOCK, 3 * nc, 3 * nc, A);
+}
+
+static void fc3d_nsgs_mpi_free(NumericsMatrix * A, fc3d_nsgs_mpi_data * data)
+{
+  /* the blocks belong to the matrix of the problem */
+  SparseBlockStructuredMatrix * sbm = A->matrix1;
+  for(unsigned int k = 0; k < sbm->nbblocks; k++)
+    sbm->block[k] = NULL;
+  NM_clear(A);
+  free(A);
+  free(data->send_contacts);
+  free(data->send_counts);
+  free(data->send_displs);
+  free(data->send_buffer);
+  free(data->recv_counts);
+  free(data->recv_displs);
+  free(data->halo);
+  free(data->halo_block_row);
+  free(data->halo_block_pos);
+  free(data->halo_block);
+}
+
+/* Receives the reactions of the halo contacts and computes
+ * q_local = q + (M reaction) restricted to the halo contacts, that is the
+ * vector q of the local problem on the contacts of this process. */
+static void fc3d_nsgs_mpi_local_q(FrictionContactProblem * problem, fc3d_nsgs_mpi_data * data,
+                                  double * reaction, double * q_local)
+{
+#ifdef SICONOS_HAS_MPI
+  if(data->nranks > 1)
+  {
+    for(int k = 0; k < data->send_size; k++)
+    {
+      double * r = &reaction[3 * data->send_contacts[k]];
+      data->send_buffer[3 * k] = r[0];
+      data->send_buffer[3 * k + 1] = r[1];
+      data->send_buffer[3 * k + 2] = r[2];
+    }
+    CHECK_MPI(data->comm, MPI_Alltoallv(data->send_buffer, data->send_counts, data->send_displs, MPI_DOUBLE,
+                                        data->halo, data->recv_counts, data->recv_displs, MPI_DOUBLE,
+                                        data->comm));
+  }
+#endif
+  cblas_dcopy(3 * problem->numberOfContacts, problem->q, 1, q_local, 1);
+  for(int k = 0; k < data->nb_halo_blocks; k++)
+    mvp3x3(data->halo_block[k], &data->halo[3 * data->halo_block_pos[k]],
+           &q_local[3 * data->halo_block_row[k]]);
+}
+
+/* The error of fc3d_compute_error for the global problem: the velocity of
+ * the local contacts is computed from the reactions of the halo and the
+ * squares of the local errors are summed on all the processes. */
+static double fc3d_nsgs_mpi_compute_error(FrictionContactProblem * problem, fc3d_nsgs_mpi_data * data,
+                                          NumericsMatrix * A, double * reaction, double * velocity,
+                                          double * q_local, double norm_q)
+{
+  int nc = problem->numberOfContacts;
+  fc3d_nsgs_mpi_local_q(problem, data, reaction, q_local);
+  cblas_dcopy(3 * nc, q_local, 1, velocity, 1);
+  NM_gemv(1.0, A, reaction, 1.0, velocity);
+
+  double error = 0.;
+  double worktmp[3];
+  for(int contact = 0; contact < nc; contact++)
+    fc3d_unitary_compute_and_add_error(&reaction[3 * contact], &velocity[3 * contact],
+                                       problem->mu[contact], &error, worktmp);
+  fc3d_nsgs_mpi_sum(data, &error, 1);
+  error = sqrt(error);
+  if(fabs(norm_q) > DBL_EPSILON)
+    error /= norm_q;
+  return error;
+}
+
+void fc3d_nsgs_mpi(FrictionContactProblem* problem, double *reaction,
+                   double *velocity, int* info, SolverOptions* options)
+{
+  int* iparam = options->iparam;
+  double* dparam = options->dparam;
+
+  int nc = problem->numberOfContacts;
+  int n = 3 * nc;
+  int itermax = iparam[SICONOS_IPARAM_MAX_ITER];
+  double tolerance = dparam[SICONOS_DPARAM_TOL];
+  double omega = (iparam[SICONOS_FRICTION_3D_NSGS_RELAXATION] == SICONOS_FRICTION_3D_NSGS_RELAXATION_TRUE) ?
+                 dparam[SICONOS_FRICTION_3D_NSGS_RELAXATION_VALUE] : 1.0;
+
+  if(options->numberOfInternalSolvers < 1)
+  {
+    numerics_error("fc3d_nsgs_mpi",
+                   "The NSGS_MPI method needs options for the internal solvers, "
+                   "options[0].numberOfInternalSolvers should be >= 1");
+  }
+  if(problem->M->storageType != NM_SPARSE_BLOCK)
+  {
+    numerics_error("fc3d_nsgs_mpi",
+                   "The NSGS_MPI method needs a matrix M with a sparse block storage");
+  }
+  if(!(iparam[SICONOS_FRICTION_3D_IPARAM_ERROR_EVALUATION] == SICONOS_FRICTION_3D_NSGS_ERROR_EVALUATION_FULL
+       || iparam[SICONOS_FRICTION_3D_IPARAM_ERROR_EVALUATION] == SICONOS_FRICTION_3D_NSGS_ERROR_EVALUATION_LIGHT_WITH_FULL_FINAL
+       || iparam[SICONOS_FRICTION_3D_IPARAM_ERROR_EVALUATION] == SICONOS_FRICTION_3D_NSGS_ERROR_EVALUATION_LIGHT))
+  {
+    numerics_error(
+      "fc3d_nsgs_mpi", "iparam[SICONOS_FRICTION_3D_IPARAM_ERROR_EVALUATION] must be equal to "
+      "SICONOS_FRICTION_3D_NSGS_ERROR_EVALUATION_FULL (0), "
+      "SICONOS_FRICTION_3D_NSGS_ERROR_EVALUATION_LIGHT (1) or "
+      "SICONOS_FRICTION_3D_NSGS_ERROR_EVALUATION_LIGHT_WITH_FULL_FINAL (2)");
+  }
+  SolverOptions * internal_options = options->internalSolvers[0];
+
+  fc3d_nsgs_mpi_data data;
+  NumericsMatrix * A = fc3d_nsgs_mpi_setup(problem, &data);
+  if(iparam[SICONOS_FRICTION_3D_NSGS_MPI_COLORING] == 0)
+  {
+    data.color = 0;
+    data.ncolors = 1;
+  }
+
+  double * q_local = (double *)malloc((n + 1) * sizeof(double));
+  double * reaction_old = (double *)malloc((n + 1) * sizeof(double));
+  FrictionContactProblem localproblem = {3, nc, A, q_local, problem->mu};
+
+  double norm_q = 0.;
+  for(int i = 0; i < n; i++)
+    norm_q += problem->q[i] * problem->q[i];
+  fc3d_nsgs_mpi_sum(&data, &norm_q, 1);
+  norm_q = sqrt(norm_q);
+
+  int iter = 0;
+  double error = 1.;
+  int hasNotConverged = 1;
+  while((iter < itermax) && (hasNotConverged > 0))
+  {
+    ++iter;
+    /* the processes of a color solve their local problem with the last
+     * reactions of the halo, starting from their current reactions */
+    cblas_dcopy(n, reaction, 1, reaction_old, 1);
+    for(int color = 0; color < data.ncolors; color++)
+    {
+      fc3d_nsgs_mpi_local_q(problem, &data, reaction, q_local);
+      if(color != data.color)
+        continue;
+      int internal_info = -1;
+      fc3d_nsgs(&localproblem, reaction, velocity, &internal_info, internal_options);
+      if(omega != 1.0)
+      {
+        for(int i = 0; i < n; i++)
+          reaction[i] = omega * reaction[i] + (1.0 - omega) * reaction_old[i];
+      }
+    }
+
+    double sums[2] = {0., 0.};
+    for(int i = 0; i < n; i++)
+    {
+      double dr = reaction[i] - reaction_old[i];
+      sums[0] += dr * dr;
+      sums[1] += reaction[i] * reaction[i];
+    }
+
+    if(iparam[SICONOS_FRICTION_3D_IPARAM_ERROR_EVALUATION] == SICONOS_FRICTION_3D_NSGS_ERROR_EVALUATION_FULL)
+    {
+      error = fc3d_nsgs_mpi_compute_error(problem, &data, A, reaction, velocity, q_local, norm_q);
+    }
+    else
+    {
+      fc3d_nsgs_mpi_sum(&data, sums, 2);
+      error = sqrt(sums[0]);
+      if(fabs(sums[1]) > DBL_EPSILON)
+        error /= sqrt(sums[1]);
+    }
+
+    if(error < tolerance)
+    {
+      hasNotConverged = 0;
+      numerics_printf("--------------- FC3D - NSGS_MPI - Iteration %i "
+                      "Residual = %14.7e < %7.3e", iter, error, tolerance);
+      if(iparam[SICONOS_FRICTION_3D_IPARAM_ERROR_EVALUATION] == SICONOS_FRICTION_3D_NSGS_ERROR_EVALUATION_LIGHT_WITH_FULL_FINAL)
+      {
+        /* the light error is small enough: check the absolute error and
+         * decrease the incremental tolerance if it is not reached */
+        double absolute_error = fc3d_nsgs_mpi_compute_error(problem, &data, A, reaction, velocity,
+                                q_local, norm_q);
+        if(absolute_error > dparam[SICONOS_DPARAM_TOL])
+        {
+          tolerance = error / absolute_error * dparam[SICONOS_DPARAM_TOL];
+          numerics_printf("------- FC3D - NSGS_MPI - We modify the required incremental precision to reach accuracy to %e", tolerance);
+          hasNotConverged = 1;
+        }
+        error = absolute_error;
+      }
+    }
+    else
+    {
+      numerics_printf("--------------- FC3D - NSGS_MPI - Iteration %i "
+                      "Residual = %14.7e > %7.3e", iter, error, tolerance);
+    }
+  }
+
+  /* the velocity of the local contacts, from the final reactions */
+  double final_error = fc3d_nsgs_mpi_compute_error(problem, &data, A, reaction, velocity, q_local, norm_q);
+  if(iparam[SICONOS_FRICTION_3D_IPARAM_ERROR_EVALUATION] != SICONOS_FRICTION_3D_NSGS_ERROR_EVALUATION_LIGHT)
+  {
+    error = final_error;
+    hasNotConverged = error > dparam[SICONOS_DPARAM_TOL];
+  }
+
+  *info = hasNotConverged;
+  dparam[SICONOS_DPARAM_RESIDU] = error;
+  iparam[SICONOS_IPARAM_ITER_DONE] = iter;
+
+  free(q_local);
+  free(reaction_old);
+  fc3d_nsgs_mpi_free(A, &data);
+}
+
+void fc3d_nsgs_mpi_set_default(SolverOptions* options)
+{
+  options->iparam[SICONOS_FRICTION_3D_IPARAM_ERROR_EVALUATION] = SICONOS_FRICTION_3D_NSGS_ERROR_EVALUATION_LIGHT_WITH_FULL_FINAL;
+  options->iparam[SICONOS_FRICTION_3D_NSGS_RELAXATION] = SICONOS_FRICTION_3D_NSGS_RELAXATION_FALSE;
+  options->dparam[SICONOS_FRICTION_3D_NSGS_RELAXATION_VALUE] = 1.0;
+  options->iparam[SICONOS_FRICTION_3D_NSGS_MPI_COLORING] = 1;
+  assert(options->numberOfInternalSolvers == 1);
+  /* one sweep on the local contacts between two exchanges of the halo */
+  options->internalSolvers[0] = solver_options_create(SICONOS_FRICTION_3D_NSGS);
+  options->internalSolvers[0]->iparam[SICONOS_IPARAM_MAX_ITER] = 1;
+  options->internalSolvers[0]->iparam[SICONOS_FRICTION_3D_IPARAM_ERROR_EVALUATION] = SICONOS_FRICTION_3D_NSGS_ERROR_EVALUATION_LIGHT;
+}
@@ -135,7 +135,9 @@ static void fc3d_AC_initialize(FrictionContactProblem* problem,
     else if(options->solverId == SICONOS_FRICTION_3D_ONECONTACT_NSN_GP_HYBRID)
     {
       options->dWork[contact] = 1.0; // for PLI algorithm.
-      rho = &options->dWork[3*contact+nc];
+      /* dWork may be larger than 4*nc (see fc3d_AC_free), the solver
+       * finds the values of rho after the first quarter of dWork */
+      rho = &options->dWork[3*contact+options->dWorkSize/4];
     }
     numerics_printf("fc3d_AC_initialize "" compute rho for contact = %i",contact);
 
@@ -176,31 +178,34 @@ static void fc3d_AC_initialize(FrictionContactProblem* problem,
     }
     numerics_printf("fc3d_AC_initialize""contact = %i, rho[0] = %4.2e, rho[1] = %4.2e, rho[2] = %4.2e", contact, rho[0], rho[1], rho[2]);
 
-    fc3d_local_problem_fill_M(problem, localproblem, contact);
-    double m_row_norm = 0.0, sum;
-    for(int i =0; i<3; i++)
+    if(verbose > 0)
     {
-      sum =0.0;
-      for(int j =0; j<3; j++)
+      fc3d_local_problem_fill_M(problem, localproblem, contact);
+      double m_row_norm = 0.0, sum;
+      for(int i =0; i<3; i++)
       {
-        sum += fabs(localproblem->M->matrix0[i+j*3]);
+        sum =0.0;
+        for(int j =0; j<3; j++)
+        {
+          sum += fabs(localproblem->M->matrix0[i+j*3]);
+        }
+        m_row_norm = max(sum, m_row_norm);
       }
-      m_row_norm = max(sum, m_row_norm);
-    }
-    numerics_printf("fc3d_AC_initialize" " inverse of norm of M = %e", 1.0/hypot9(localproblem->M->matrix0));
-    numerics_printf("fc3d_AC_initialize" " inverse of row norm of M = %e", 1.0/m_row_norm);
+      numerics_printf("fc3d_AC_initialize" " inverse of norm of M = %e", 1.0/hypot9(localproblem->M->matrix0));
+      numerics_printf("fc3d_AC_initialize" " inverse of row norm of M = %e", 1.0/m_row_norm);
 
-    DEBUG_EXPR(NM_display(localproblem->M););
+      DEBUG_EXPR(NM_display(localproblem->M););
+    }
 
   }
   numerics_printf("fc3d_AC_initialize" " Avg. rho value = %e\t%e\t%e\t",avg_rho[0]/nc,avg_rho[1]/nc,avg_rho[2]/nc);
 
 }
 
+/* the values of rho in localsolver_options->dWork are kept for the next
+ * call, fc3d_AC_initialize reallocates it only for a larger problem. */
 static void fc3d_AC_free(FrictionContactProblem * problem, FrictionContactProblem * localproblem, SolverOptions* localsolver_options)
 {
-  free(localsolver_options->dWork);
-  localsolver_options->dWork=NULL;
 }
 
 
@@ -275,6 +275,7 @@ GlobalFrictionContactProblem* from_fclib_global(const fclib_global* fclib_proble
   problem->q = fclib_problem->f;
   problem->b = fclib_problem->w;
   problem->env = NULL;
+  problem->op = NULL;
 
   problem->numberOfContacts = fclib_problem->H->n / fclib_problem->spacedim; /* cf fclib spec */
 
@@ -102,6 +102,7 @@ void gfc3d_ACLMFixedPoint(GlobalFrictionContactProblem* restrict problem, double
   cqp->normConvexQP= norm_q;
   cqp->istheNormConvexQPset=1;
   double * w = (double *) malloc(n* sizeof(double));
+  double * error_work = (double *) malloc(2 * n * sizeof(double));
 
   GlobalFrictionContactProblem_as_ConvexQP *gfc3d_as_cqp= (GlobalFrictionContactProblem_as_ConvexQP*)malloc(sizeof(GlobalFrictionContactProblem_as_ConvexQP));
   cqp->env = gfc3d_as_cqp ;
@@ -143,7 +144,7 @@ void gfc3d_ACLMFixedPoint(GlobalFrictionContactProblem* restrict problem, double
     /* **** Criterium convergence **** */
 
     gfc3d_compute_error(problem, reaction, velocity, globalVelocity, tolerance, options,
-                        norm_q, norm_b, &error);
+                        norm_q, norm_b, &error, error_work);
 
     numerics_printf_verbose(1,"---- GFC3D - ACLMFP - Iteration %i Residual = %14.7e", iter, error);
 
@@ -158,6 +159,7 @@ void gfc3d_ACLMFixedPoint(GlobalFrictionContactProblem* restrict problem, double
   free(cqp->b);
   free(cqp->q);
   free(w);
+  free(error_work);
   free(cqp);
 
 
@@ -38,7 +38,7 @@ typedef void (* ComputeErrorGlobalPtr)(GlobalFrictionContactProblem* ,
                                       double * , double *,
                                       double* , double ,
                                       SolverOptions * ,
-                                      double, double,  double * );
+                                      double, double,  double *, double * );
 
 
 #if defined(__cplusplus) && !defined(BUILD_AS_CPP)
@@ -20,6 +20,7 @@
 #include <stdlib.h>                              // for free, malloc, calloc
 #include <string.h>                              // for memcpy
 #include "GlobalFrictionContactProblem.h"        // for GlobalFrictionContac...
+#include "GlobalFrictionContactOperator.h"       // for globalFrictionContac...
 #include "GlobalFrictionContactProblem_as_VI.h"  // for GlobalFrictionContac...
 #include "NumericsFwd.h"                         // for VariationalInequality
 #include "NumericsMatrix.h"                      // for NumericsMatrix
@@ -46,7 +47,7 @@ void gfc3d_VI_ExtraGradient(GlobalFrictionContactProblem* problem,
   int nc = problem->numberOfContacts;
   /* Dimension of the problem */
   int m = 3 * nc;
-  int n = problem->M->size0;
+  int n = globalFrictionContact_globalSize(problem);
 
   DEBUG_EXPR(NM_vector_display(reaction, m););
   DEBUG_EXPR(NM_vector_display(velocity, m););
@@ -99,7 +100,7 @@ void gfc3d_VI_ExtraGradient(GlobalFrictionContactProblem* problem,
   /* **** Criterium convergence **** */
   gfc3d_compute_error(problem, reaction, velocity, globalVelocity, options->dparam[SICONOS_DPARAM_TOL],
                       options,
-                      norm_q, norm_b, &error);
+                      norm_q, norm_b, &error, NULL);
 
   DEBUG_EXPR(NM_vector_display(reaction,m));
   DEBUG_EXPR(NM_vector_display(velocity,m));
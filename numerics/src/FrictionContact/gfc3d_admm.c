@@ -22,6 +22,7 @@
 #include "CSparseMatrix_internal.h"
 #include "Friction_cst.h"                  // for SICONOS_FRICTION_3D_ADMM_I...
 #include "GlobalFrictionContactProblem.h"  // for GlobalFrictionContactProblem
+#include "GlobalFrictionContactOperator.h" // for globalFrictionContact_H_gemv
 #include "NumericsFwd.h"                   // for SolverOptions, GlobalFrict...
 #include "NumericsMatrix.h"                // for NM_gemv, NumericsMatrix
 #include "SolverOptions.h"                 // for SolverOptions, solver_opti...
@@ -46,6 +47,7 @@ typedef struct
   double * u_old;
   double * sliding_direction;
   double * sliding_direction_old;
+  double * error_work; /* work vectors of gfc3d_compute_error (size 2n) */
 }
 Gfc3d_ADDM_data;
 
@@ -55,10 +57,11 @@ Gfc3d_ADDM_data;
 void gfc3d_ADMM_init(GlobalFrictionContactProblem* problem, SolverOptions* options)
 {
   size_t nc = problem->numberOfContacts;
-  size_t n = problem->M->size0;
+  size_t n = globalFrictionContact_globalSize(problem);
   size_t m = 3 * nc;
   if(!options->dWork || options->dWorkSize != m+n)
   {
+    free(options->dWork);
     options->dWork = (double*)calloc(m+n,sizeof(double));
     options->dWorkSize = m+n;
   }
@@ -74,6 +77,7 @@ void gfc3d_ADMM_init(GlobalFrictionContactProblem* problem, SolverOptions* optio
     data->u_k = (double*)calloc(m,sizeof(double));
     data->u = (double*)calloc(m,sizeof(double));
     data->b_full = (double*)calloc(m,sizeof(double));
+    data->error_work = (double*)calloc(2*n,sizeof(double));
     if(options->iparam[SICONOS_FRICTION_3D_ADMM_IPARAM_FULL_H] ==
         SICONOS_FRICTION_3D_ADMM_FULL_H_YES)
     {
@@ -100,6 +104,7 @@ void gfc3d_ADMM_free(GlobalFrictionContactProblem* problem, SolverOptions* optio
     free(data->reaction_k);
     free(data->u_k);
     free(data->b_full);
+    free(data->error_work);
     if(options->iparam[SICONOS_FRICTION_3D_ADMM_IPARAM_FULL_H] ==
         SICONOS_FRICTION_3D_ADMM_FULL_H_YES)
     {
@@ -248,6 +253,99 @@ static inline void gfc3d_ADMM_compute_full_H(int nc, double * u,
   /* getchar();  */
 }
 
+/* products with H and H^T, through problem->op when the problem is
+ * matrix-free (H == NULL) */
+static inline void gfc3d_ADMM_H_gemv(GlobalFrictionContactProblem* problem, NumericsMatrix* H,
+                                     double alpha, double* x, double beta, double* y)
+{
+  if(H)
+    NM_gemv(alpha, H, x, beta, y);
+  else
+    globalFrictionContact_H_gemv(problem, alpha, x, beta, y);
+}
+
+static inline void gfc3d_ADMM_Ht_gemv(GlobalFrictionContactProblem* problem, NumericsMatrix* Htrans,
+                                      double alpha, double* x, double beta, double* y)
+{
+  if(Htrans)
+    NM_gemv(alpha, Htrans, x, beta, y);
+  else
+    globalFrictionContact_Ht_gemv(problem, alpha, x, beta, y);
+}
+
+/* y = (M + rho H H^T) x through problem->op, tmp_m is a work vector of size m */
+static void gfc3d_ADMM_W_gemv(GlobalFrictionContactProblem* problem, double rho,
+                              double* x, double* y, double* tmp_m)
+{
+  globalFrictionContact_Ht_gemv(problem, 1.0, x, 0.0, tmp_m);
+  globalFrictionContact_M_gemv(problem, 1.0, x, 0.0, y);
+  globalFrictionContact_H_gemv(problem, rho, tmp_m, 1.0, y);
+}
+
+/* Solves (M + rho H H^T) x = rhs for a matrix-free problem with a conjugate
+ * gradient, preconditioned by M^{-1} when problem->op->M_solve is given.
+ * x contains the starting point on input and the solution on output,
+ * work is of size 4n+m. Returns the number of iterations. */
+static int gfc3d_ADMM_matrix_free_solve(GlobalFrictionContactProblem* problem, double rho,
+                                        double* rhs, double* x, double* work)
+{
+  size_t n = globalFrictionContact_globalSize(problem);
+  double* r = work;
+  double* z = &work[n];
+  double* p = &work[2*n];
+  double* Ap = &work[3*n];
+  double* tmp_m = &work[4*n];
+  int with_preconditioner = (problem->op->M_solve != NULL);
+
+  double norm_rhs = cblas_dnrm2(n, rhs, 1);
+  if(norm_rhs == 0.0)
+  {
+    cblas_dscal(n, 0.0, x, 1);
+    return 0;
+  }
+  double tol = 1e-12 * norm_rhs;
+  int itermax = 10 * n;
+
+  /* r = rhs - W x */
+  gfc3d_ADMM_W_gemv(problem, rho, x, Ap, tmp_m);
+  cblas_dcopy(n, rhs, 1, r, 1);
+  cblas_daxpy(n, -1.0, Ap, 1, r, 1);
+  double norm_r = cblas_dnrm2(n, r, 1);
+  if(norm_r <= tol)
+    return 0;
+
+  cblas_dcopy(n, r, 1, z, 1);
+  if(with_preconditioner)
+    globalFrictionContact_M_solve(problem, z);
+  cblas_dcopy(n, z, 1, p, 1);
+  double rz = cblas_ddot(n, r, 1, z, 1);
+
+  int iter = 0;
+  while(iter < itermax && norm_r > tol)
+  {
+    iter++;
+    gfc3d_ADMM_W_gemv(problem, rho, p, Ap, tmp_m);
+    double pAp = cblas_ddot(n, p, 1, Ap, 1);
+    if(pAp <= 0.0)
+      break;
+    double alpha = rz / pAp;
+    cblas_daxpy(n, alpha, p, 1, x, 1);
+    cblas_daxpy(n, -alpha, Ap, 1, r, 1);
+    norm_r = cblas_dnrm2(n, r, 1);
+
+    cblas_dcopy(n, r, 1, z, 1);
+    if(with_preconditioner)
+      globalFrictionContact_M_solve(problem, z);
+    double rz_new = cblas_ddot(n, r, 1, z, 1);
+    cblas_dscal(n, rz_new / rz, p, 1);
+    cblas_daxpy(n, 1.0, z, 1, p, 1);
+    rz = rz_new;
+  }
+  if(norm_r > tol)
+    numerics_printf_verbose(1, "---- GFC3D - ADMM - the conjugate gradient stops with a residual %e > %e", norm_r, tol);
+  return iter;
+}
+
 void gfc3d_ADMM(GlobalFrictionContactProblem* restrict problem, double* restrict reaction,
                 double* restrict velocity, double* restrict globalVelocity,
                 int* restrict info, SolverOptions* restrict options)
@@ -258,17 +356,28 @@ void gfc3d_ADMM(GlobalFrictionContactProblem* restrict problem, double* restrict
   double* dparam = options->dparam;
   /* Number of contacts */
   size_t nc = problem->numberOfContacts;
-  size_t n = problem->M->size0;
+  size_t n = globalFrictionContact_globalSize(problem);
   size_t m = 3 * nc;
 
 
   NumericsMatrix* M = NULL;
   NumericsMatrix* H = NULL;
 
+  /* Without assembled M and H, the products go through problem->op and
+     M + rho H H^T is inverted by a preconditioned conjugate gradient */
+  int matrix_free = globalFrictionContact_isMatrixFree(problem);
+  if(matrix_free &&
+      (iparam[SICONOS_FRICTION_3D_IPARAM_RESCALING] != SICONOS_FRICTION_3D_RESCALING_NO ||
+       iparam[SICONOS_FRICTION_3D_IPARAM_RESCALING_CONE] != SICONOS_FRICTION_3D_RESCALING_CONE_NO ||
+       iparam[SICONOS_FRICTION_3D_ADMM_IPARAM_FULL_H] != SICONOS_FRICTION_3D_ADMM_FULL_H_NO ||
+       iparam[SICONOS_FRICTION_3D_ADMM_IPARAM_INITIAL_RHO] != SICONOS_FRICTION_3D_ADMM_INITIAL_RHO_GIVEN ||
+       iparam[SICONOS_FRICTION_3D_ADMM_IPARAM_GET_PROBLEM_INFO] == SICONOS_FRICTION_3D_ADMM_GET_PROBLEM_INFO_YES))
+    numerics_error("gfc3d_ADMM", "a matrix-free problem (problem->op) supports neither rescaling, full H, computed initial rho nor problem information");
+
   /* if SICONOS_FRICTION_3D_ADMM_FORCED_SPARSE_STORAGE = SICONOS_FRICTION_3D_ADMM_FORCED_SPARSE_STORAGE,
      we force the copy into a NM_SPARSE storageType */
 
-  if(iparam[SICONOS_FRICTION_3D_ADMM_IPARAM_SPARSE_STORAGE] == SICONOS_FRICTION_3D_ADMM_FORCED_SPARSE_STORAGE
+  if(!matrix_free && iparam[SICONOS_FRICTION_3D_ADMM_IPARAM_SPARSE_STORAGE] == SICONOS_FRICTION_3D_ADMM_FORCED_SPARSE_STORAGE
       && problem->M->storageType == NM_SPARSE_BLOCK)
   {
     DEBUG_PRINT("Force a copy to sparse storage type\n");
@@ -279,7 +388,7 @@ void gfc3d_ADMM(GlobalFrictionContactProblem* restrict problem, double* restrict
   {
     M = problem->M;
   }
-  if(iparam[SICONOS_FRICTION_3D_ADMM_IPARAM_SPARSE_STORAGE] == SICONOS_FRICTION_3D_ADMM_FORCED_SPARSE_STORAGE
+  if(!matrix_free && iparam[SICONOS_FRICTION_3D_ADMM_IPARAM_SPARSE_STORAGE] == SICONOS_FRICTION_3D_ADMM_FORCED_SPARSE_STORAGE
       && problem->H->storageType == NM_SPARSE_BLOCK)
   {
     DEBUG_PRINT("Force a copy to sparse storage type\n");
@@ -295,17 +404,21 @@ void gfc3d_ADMM(GlobalFrictionContactProblem* restrict problem, double* restrict
   double* b = problem->b;
   double* mu = problem->mu;
 
-  assert((int)H->size1 == problem->numberOfContacts * problem->dimension);
-  assert((int)M->size0 == M->size1);
-  assert((int)M->size0 == H->size0); /* size(velocity) ==
+  assert(matrix_free || (int)H->size1 == problem->numberOfContacts * problem->dimension);
+  assert(matrix_free || (int)M->size0 == M->size1);
+  assert(matrix_free || (int)M->size0 == H->size0); /* size(velocity) ==
                                       * Htrans*globalVelocity */
 
 
-  NumericsMatrix *Htrans =  NM_transpose(H);
-  /* Compute M + rho H H^T (storage in W)*/
-  NumericsMatrix *W = NM_create(NM_SPARSE,n,n);
-  NM_triplet_alloc(W, n);
-  W->matrix2->origin = NSM_TRIPLET;
+  NumericsMatrix *Htrans =  H ? NM_transpose(H) : NULL;
+  /* Compute M + rho H H^T (storage in W), not assembled in matrix-free mode */
+  NumericsMatrix *W = NULL;
+  if(!matrix_free)
+  {
+    W = NM_create(NM_SPARSE,n,n);
+    NM_triplet_alloc(W, n);
+    W->matrix2->origin = NSM_TRIPLET;
+  }
 
   double alpha_r=0.0, beta_r=0.0;
   GlobalFrictionContactProblem *  rescaled_problem =  problem;
@@ -382,7 +495,8 @@ void gfc3d_ADMM(GlobalFrictionContactProblem* restrict problem, double* restrict
   {
     numerics_printf_verbose(1,"---- GFC3D - ADMM - No rescaling of the problem");
   }
-  NM_clear(W);
+  if(W)
+    NM_clear(W);
 
 
   /* Maximum number of iterations */
@@ -440,6 +554,14 @@ void gfc3d_ADMM(GlobalFrictionContactProblem* restrict problem, double* restrict
     gfc3d_ADMM_init(problem, options);
     internal_allocation = 1;
   }
+  /* starting point and work vectors of the conjugate gradient */
+  double * cg_x = NULL;
+  double * cg_work = NULL;
+  if(matrix_free)
+  {
+    cg_x = (double*)malloc(n*sizeof(double));
+    cg_work = (double*)calloc(4*n+m,sizeof(double));
+  }
   /*****  ADMM iterations *****/
   int iter = 0; /* Current iteration number */
   double error = 1.; /* Current error */
@@ -452,10 +574,14 @@ void gfc3d_ADMM(GlobalFrictionContactProblem* restrict problem, double* restrict
   if(rho <= DBL_EPSILON)
     numerics_error("gfc3d_ADMM", "dparam[SICONOS_FRICTION_3D_ADMM_RHO] must be nonzero");
 
-  /* for full Jacobian */
-  NumericsMatrix *H_full = NM_create(NM_SPARSE,n,m);
-  NM_triplet_alloc(H_full, n);
-  H_full->matrix2->origin = NSM_TRIPLET;
+  /* for full Jacobian (not available in matrix-free mode) */
+  NumericsMatrix *H_full = NULL;
+  if(!matrix_free)
+  {
+    H_full = NM_create(NM_SPARSE,n,m);
+    NM_triplet_alloc(H_full, n);
+    H_full->matrix2->origin = NSM_TRIPLET;
+  }
 
 
 
@@ -574,7 +700,7 @@ void gfc3d_ADMM(GlobalFrictionContactProblem* restrict problem, double* restrict
     /********************/
     /*  1 - Compute v */
     /********************/
-    if(with_full_Jacobian || has_rho_changed)
+    if(!matrix_free && (with_full_Jacobian || has_rho_changed))
     {
 
       if(with_full_Jacobian)
@@ -633,6 +759,9 @@ void gfc3d_ADMM(GlobalFrictionContactProblem* restrict problem, double* restrict
     }
 
     /* compute the rhs */
+    /* the previous v is the starting point of the conjugate gradient */
+    if(matrix_free)
+      cblas_dcopy(n, v, 1, cg_x, 1);
     /* q --> v */
     cblas_dcopy(n, q, 1, v, 1);
 
@@ -649,7 +778,7 @@ void gfc3d_ADMM(GlobalFrictionContactProblem* restrict problem, double* restrict
     else
     {
       cblas_daxpy(m, 1.0, reaction_hat, 1, tmp_m, 1);
-      NM_gemv(rho, H, tmp_m, 1.0, v);
+      gfc3d_ADMM_H_gemv(problem, H, rho, tmp_m, 1.0, v);
     }
 
     DEBUG_PRINT("rhs: ");
@@ -658,7 +787,13 @@ void gfc3d_ADMM(GlobalFrictionContactProblem* restrict problem, double* restrict
     /* Linear system solver */
     /* cblas_dcopy(n , w_k , 1 , v, 1); */
 
-    if(with_full_Jacobian)
+    if(matrix_free)
+    {
+      int cg_iter = gfc3d_ADMM_matrix_free_solve(problem, rho, v, cg_x, cg_work);
+      numerics_printf_verbose(2, "---- GFC3D - ADMM - %i conjugate gradient iterations", cg_iter);
+      cblas_dcopy(n, cg_x, 1, v, 1);
+    }
+    else if(with_full_Jacobian)
     {
       NM_gesv_expert(W,v,NM_KEEP_FACTORS);
     }
@@ -687,7 +822,7 @@ void gfc3d_ADMM(GlobalFrictionContactProblem* restrict problem, double* restrict
 
     cblas_dcopy(m, b_full, 1, u, 1);
     cblas_daxpy(m, -1.0, reaction_hat, 1, u, 1);
-    NM_gemv(1.0, Htrans, v, 1.0, u);
+    gfc3d_ADMM_Ht_gemv(problem, Htrans, 1.0, v, 1.0, u);
 
     DEBUG_PRINT("before projection");
     DEBUG_EXPR(NV_display(u,m));
@@ -709,7 +844,7 @@ void gfc3d_ADMM(GlobalFrictionContactProblem* restrict problem, double* restrict
 
     /* - H^T v_k + u_k -b_full ->  reaction (We use reaction for storing the residual for a while) */
     /* cblas_dscal(m, 0.0, reaction, 1);  */
-    NM_gemv(-1.0, Htrans, v, 0.0, reaction);
+    gfc3d_ADMM_Ht_gemv(problem, Htrans, -1.0, v, 0.0, reaction);
     double norm_HTv = cblas_dnrm2(m, reaction, 1);
 
     gfc3d_ADMM_compute_full_b(nc, u, mu, b, b_full, options, 0);
@@ -726,7 +861,7 @@ void gfc3d_ADMM(GlobalFrictionContactProblem* restrict problem, double* restrict
     cblas_daxpy(m, 1.0, reaction_hat, 1, reaction, 1);
 
     /* cblas_dscal(n, 0.0, tmp_n, 1); */
-    NM_gemv(1.0*rho, H, reaction, 0.0, tmp_n);
+    gfc3d_ADMM_H_gemv(problem, H, 1.0*rho, reaction, 0.0, tmp_n);
     double norm_rhoHr = cblas_dnrm2(n, tmp_n, 1);
 
     /*********************************/
@@ -743,7 +878,7 @@ void gfc3d_ADMM(GlobalFrictionContactProblem* restrict problem, double* restrict
     /* cblas_dscal(n, 0.0, tmp_n, 1); */
     double s_restart =  rho * cblas_dnrm2(m, tmp_m, 1);
 
-    NM_gemv(1.0*rho, H, tmp_m, 0.0, tmp_n);
+    gfc3d_ADMM_H_gemv(problem, H, 1.0*rho, tmp_m, 0.0, tmp_n);
     s = cblas_dnrm2(n, tmp_n, 1);
 
 
@@ -927,7 +1062,7 @@ void gfc3d_ADMM(GlobalFrictionContactProblem* restrict problem, double* restrict
         }
       }
       (*computeError)(problem,  reaction, velocity, v,  tolerance, options,
-                      norm_q, norm_b,  &error);
+                      norm_q, norm_b,  &error, data->error_work);
       numerics_printf_verbose(1,"---- GFC3D - ADMM  - Iteration %i rho = %14.7e \t full error = %14.7e", iter, rho, error);
 
 
@@ -1004,7 +1139,7 @@ void gfc3d_ADMM(GlobalFrictionContactProblem* restrict problem, double* restrict
     }
 
     (*computeError)(problem,  reaction, velocity, v,  tolerance, options,
-                    norm_q, norm_b, &error);
+                    norm_q, norm_b, &error, data->error_work);
     if(error < dparam[SICONOS_DPARAM_TOL])
     {
       *info = 0;
@@ -1016,8 +1151,12 @@ void gfc3d_ADMM(GlobalFrictionContactProblem* restrict problem, double* restrict
   iparam[SICONOS_IPARAM_ITER_DONE] = iter;
 
   /***** Free memory *****/
-  NM_clear(W);
-  NM_clear(Htrans);
+  if(W)
+    NM_clear(W);
+  if(Htrans)
+    NM_clear(Htrans);
+  free(cg_x);
+  free(cg_work);
   if(internal_allocation)
   {
     gfc3d_ADMM_free(problem,options);
@@ -19,8 +19,10 @@
 #include "gfc3d_compute_error.h"
 #include <float.h>                         // for DBL_EPSILON
 #include <math.h>                          // for fabs, sqrt
-#include <stdlib.h>                        // for NULL, calloc
+#include <stdlib.h>                        // for NULL, malloc, free
+#include <string.h>                        // for memset
 #include "GlobalFrictionContactProblem.h"  // for GlobalFrictionContactProblem
+#include "GlobalFrictionContactOperator.h" // for globalFrictionContact_M_gemv, ...
 #include "NumericsMatrix.h"                // for NM_gemv, NM_tgemv, Numeric...
 #include "SolverOptions.h"                 // for SolverOptions
 #include "debug.h"                         // for DEBUG_EXPR, DEBUG_PRINTF
@@ -41,7 +43,7 @@ int gfc3d_compute_error(GlobalFrictionContactProblem* problem,
                         double tolerance,
                         SolverOptions * options,
                         double norm_q, double norm_b,
-                        double* restrict error)
+                        double* restrict error, double* work)
 
 {
   DEBUG_BEGIN("gfc3d_compute_error(...)\n");
@@ -52,7 +54,7 @@ int gfc3d_compute_error(GlobalFrictionContactProblem* problem,
   /* Computes error = dnorm2( GlobalVelocity -M^-1( q + H reaction)*/
   int nc = problem->numberOfContacts;
   int m = nc * 3;
-  size_t n = problem->M->size0;
+  size_t n = globalFrictionContact_globalSize(problem);
   double *mu = problem->mu;
   double *q = problem->q;
 
@@ -66,22 +68,17 @@ int gfc3d_compute_error(GlobalFrictionContactProblem* problem,
   /* DEBUG_EXPR(NV_display(reaction,m)); */
   /* DEBUG_EXPR(NV_display(velocity,m)); */
 
-  NumericsMatrix *H = problem->H;
-  NumericsMatrix *M = problem->M;
-
-  if(!options->dWork || options->dWorkSize < 2*n)
-  {
-    options->dWork = (double *)calloc(2*n,sizeof(double));
-    options->dWorkSize = 2*n;
-  }
-  double* tmp = options->dWork;
-  double* tmp_1 = &options->dWork[n];
+  /* work vectors of the caller, or allocated for this call */
+  double* tmp = work ? work : (double *)malloc(2*n*sizeof(double));
+  double* tmp_1 = &tmp[n];
 
   cblas_dcopy_msan(n, q, 1, tmp_1, 1);
   if(nc >0)
   {
-    NM_gemv(1.0, H, reaction, 0.0, tmp);
+    globalFrictionContact_H_gemv(problem, 1.0, reaction, 0.0, tmp);
   }
+  else
+    memset(tmp, 0, n*sizeof(double));
   double norm_Hr = cblas_dnrm2(n,tmp,1);
   DEBUG_PRINTF("norm of H r %e\n", norm_Hr);
 
@@ -89,7 +86,7 @@ int gfc3d_compute_error(GlobalFrictionContactProblem* problem,
   cblas_daxpy(n, 1.0, tmp, 1, tmp_1, 1);
 
 
-  NM_gemv(-1.0, M, globalVelocity, 0.0, tmp);
+  globalFrictionContact_M_gemv(problem, -1.0, globalVelocity, 0.0, tmp);
   double norm_Mv = cblas_dnrm2(n,tmp,1);
   DEBUG_PRINTF("norm of M v %e\n", norm_Mv);
 
@@ -97,6 +94,8 @@ int gfc3d_compute_error(GlobalFrictionContactProblem* problem,
 
   double relative_scaling = fmax(norm_q, fmax(norm_Mv,norm_Hr));
   *error = cblas_dnrm2(n,tmp_1,1);
+  if(!work)
+    free(tmp);
   DEBUG_PRINTF("absolute error  of -M v + H R + q = %e\n", *error);
   if(fabs(relative_scaling) > DBL_EPSILON)
     *error = *error/relative_scaling;
@@ -116,7 +115,7 @@ int gfc3d_compute_error(GlobalFrictionContactProblem* problem,
   /* the error in the equation u = H^T v +b is then accuaret to machine precision */
 
   cblas_dcopy(m, problem->b, 1, velocity, 1);
-  NM_tgemv(1, H, globalVelocity, 1.0, velocity);
+  globalFrictionContact_Ht_gemv(problem, 1.0, globalVelocity, 1.0, velocity);
   double norm_u = cblas_dnrm2(m,velocity,1);
   DEBUG_PRINTF("norm of velocity %e\n", norm_u);
 
@@ -174,7 +173,7 @@ int gfc3d_compute_error_convex(GlobalFrictionContactProblem* problem,
                                double tolerance,
                                SolverOptions * options,
                                double norm_q, double norm_b,
-                               double* restrict error)
+                               double* restrict error, double* work)
 
 {
   DEBUG_BEGIN("gfc3d_compute_error_convex(...)\n");
@@ -185,7 +184,7 @@ int gfc3d_compute_error_convex(GlobalFrictionContactProblem* problem,
   /* Computes error = dnorm2( GlobalVelocity -M^-1( q + H reaction)*/
   int nc = problem->numberOfContacts;
   int m = nc * 3;
-  size_t n = problem->M->size0;
+  size_t n = globalFrictionContact_globalSize(problem);
   double *mu = problem->mu;
   double *q = problem->q;
 
@@ -199,28 +198,23 @@ int gfc3d_compute_error_convex(GlobalFrictionContactProblem* problem,
   /* DEBUG_EXPR(NV_display(reaction,m)); */
   /* DEBUG_EXPR(NV_display(velocity,m)); */
 
-  NumericsMatrix *H = problem->H;
-  NumericsMatrix *M = problem->M;
-
-  if(!options->dWork || options->dWorkSize < 2*n)
-  {
-    options->dWork = (double *)calloc(2*n,sizeof(double));
-    options->dWorkSize = 2*n;
-  }
-  double* tmp = options->dWork;
-  double* tmp_1 = &options->dWork[n];
+  /* work vectors of the caller, or allocated for this call */
+  double* tmp = work ? work : (double *)malloc(2*n*sizeof(double));
+  double* tmp_1 = &tmp[n];
 
   cblas_dcopy_msan(n, q, 1, tmp_1, 1);
   if(nc >0)
   {
-    NM_gemv(1.0, H, reaction, 0.0, tmp);
+    globalFrictionContact_H_gemv(problem, 1.0, reaction, 0.0, tmp);
   }
+  else
+    memset(tmp, 0, n*sizeof(double));
   double norm_Hr = cblas_dnrm2(n,tmp,1);
   DEBUG_PRINTF("norm of H r %e\n", norm_Hr);
 
   cblas_daxpy(n, 1.0, tmp, 1, tmp_1, 1);
 
-  NM_gemv(-1.0, M, globalVelocity, 0.0, tmp);
+  globalFrictionContact_M_gemv(problem, -1.0, globalVelocity, 0.0, tmp);
   double norm_Mv = cblas_dnrm2(n,tmp,1);
   DEBUG_PRINTF("norm of M v %e\n", norm_Mv);
 
@@ -229,6 +223,8 @@ int gfc3d_compute_error_convex(GlobalFrictionContactProblem* problem,
 
   double relative_scaling = fmax(norm_q, fmax(norm_Mv,norm_Hr));
   *error = cblas_dnrm2(n,tmp_1,1);
+  if(!work)
+    free(tmp);
   DEBUG_PRINTF("absolute error  of -M v + H R + q = %e\n", *error);
   if(fabs(relative_scaling) > DBL_EPSILON)
     *error = *error/relative_scaling;
@@ -248,7 +244,7 @@ int gfc3d_compute_error_convex(GlobalFrictionContactProblem* problem,
   /* the error in the equation u = H^T v +b is then accuaret to machine precision */
 
   cblas_dcopy(m, problem->b, 1, velocity, 1);
-  NM_tgemv(1, H, globalVelocity, 1.0, velocity);
+  globalFrictionContact_Ht_gemv(problem, 1.0, globalVelocity, 1.0, velocity);
   double norm_u = cblas_dnrm2(m,velocity,1);
   DEBUG_PRINTF("norm of velocity %e\n", norm_u);
 
@@ -42,16 +42,18 @@ extern "C"
    * \param norm_q norm of q or a normalization value
    * \param norm_b norm of b or a normalization value
    * \param[in,out] error value
+   * \param work work vector of size 2n (n the size of the global velocity),
+   * or NULL to allocate it for this call only
    * \return 0 if successfull
    */
   int gfc3d_compute_error(GlobalFrictionContactProblem* problem,
                           double *reaction , double *velocity,
                           double* globalVelocity, double tolerance,
                           SolverOptions * options,
-                          double norm_q, double norm_b,  double * error);
+                          double norm_q, double norm_b,  double * error, double * work);
   int gfc3d_compute_error_convex(GlobalFrictionContactProblem* problem, double *reaction , double *velocity,
                                  double* globalVelocity, double tolerance,  SolverOptions * options,
-                                 double norm_q, double norm_b,  double * error);
+                                 double norm_q, double norm_b,  double * error, double * work);
   
 #if defined(__cplusplus) && !defined(BUILD_AS_CPP)
 }
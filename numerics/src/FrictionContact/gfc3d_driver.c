@@ -20,6 +20,7 @@
 #include <stdlib.h>                        // for exit, EXIT_FAILURE
 #include "Friction_cst.h"                  // for SICONOS_GLOBAL_FRICTION_3D...
 #include "GlobalFrictionContactProblem.h"  // for GlobalFrictionContactProblem
+#include "GlobalFrictionContactOperator.h" // for globalFrictionContact_isMatrixFree
 #include "NonSmoothDrivers.h"              // for gfc3d_driver
 #include "NumericsFwd.h"                   // for SolverOptions, GlobalFrict...
 #include "SolverOptions.h"                 // for SolverOptions, solver_opti...
@@ -55,7 +56,7 @@ int gfc3d_driver(GlobalFrictionContactProblem* problem, double *reaction, double
                  double* globalVelocity,  SolverOptions* options)
 {
   assert(options->isSet);
-  DEBUG_EXPR(NV_display(globalVelocity,problem->M->size0););
+  DEBUG_EXPR(NV_display(globalVelocity,globalFrictionContact_globalSize(problem)););
   if(verbose > 0)
     solver_options_print(options);
 
@@ -68,8 +69,16 @@ int gfc3d_driver(GlobalFrictionContactProblem* problem, double *reaction, double
   if(problem->dimension != 3)
     numerics_error("gfc3d_driver", "Dimension of the problem : problem-> dimension is not compatible or is not set");
 
+  /* Without assembled M and H, only the solvers based on products are available */
+  if(globalFrictionContact_isMatrixFree(problem)
+     && options->solverId != SICONOS_GLOBAL_FRICTION_3D_VI_FPP
+     && options->solverId != SICONOS_GLOBAL_FRICTION_3D_VI_EG
+     && options->solverId != SICONOS_GLOBAL_FRICTION_3D_ADMM)
+    numerics_error("gfc3d_driver", "solver %s needs the assembled matrices M and H (problem->op is not supported)",
+                   solver_options_id_to_name(options->solverId));
+
   /* if there is no contact, we compute directly the global velocity as M^{-1}q */
-  int m = problem->H->size1;
+  int m = problem->numberOfContacts * problem->dimension;
   if(m ==0)
   {
     numerics_printf_verbose(1,"---- GFC3D - DRIVER . No contact case. Direct computation of global velocity");
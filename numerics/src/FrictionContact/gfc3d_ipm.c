@@ -91,6 +91,9 @@ typedef struct
 
   double **tmp_vault_nd;
   double **tmp_vault_m;
+
+  /* work vectors of gfc3d_compute_error (size 2m) */
+  double *error_work;
 }
 Gfc3d_IPM_init_data;
 
@@ -391,6 +394,7 @@ void gfc3d_IPM_init(GlobalFrictionContactProblem* problem, SolverOptions* option
 
   if(!options->dWork || options->dWorkSize != (size_t)(m + nd + nd))
   {
+    free(options->dWork);
     options->dWork = (double*)calloc(m + nd + nd, sizeof(double));
     options->dWorkSize = m + nd + nd;
   }
@@ -467,6 +471,8 @@ void gfc3d_IPM_init(GlobalFrictionContactProblem* problem, SolverOptions* option
   for(unsigned int i = 0; i < 2; ++i)
     data->tmp_vault_m[i] = (double*)calloc(m, sizeof(double));
 
+  data->error_work = (double*)calloc(2 * m, sizeof(double));
+
 }
 
 void gfc3d_IPM_free(GlobalFrictionContactProblem* problem, SolverOptions* options)
@@ -512,6 +518,9 @@ void gfc3d_IPM_free(GlobalFrictionContactProblem* problem, SolverOptions* option
     free(data->tmp_vault_m);
     data->tmp_vault_m = NULL;
 
+    free(data->error_work);
+    data->error_work = NULL;
+
     free(data->tmp_point->t_globalVelocity);
     data->tmp_point->t_globalVelocity = NULL;
 
@@ -909,7 +918,7 @@ void gfc3d_IPM(GlobalFrictionContactProblem* restrict problem, double* restrict
     (*computeError)(problem,
                     data->tmp_point->t_reaction, data->tmp_point->t_velocity, globalVelocity,
                     tol, options,
-                    norm_q, norm_b,  &err);
+                    norm_q, norm_b,  &err, data->error_work);
     numerics_printf_verbose(-1,"---- GFC3D - IPM  - Iteration %i, full error = %14.7e", iteration, err);
     // check exit condition
     if(err < tol)
@@ -935,7 +944,7 @@ void gfc3d_IPM(GlobalFrictionContactProblem* restrict problem, double* restrict
   (*computeError)(problem,
                   reaction, velocity, globalVelocity,
                   tol, options,
-                  norm_q, norm_b,  &err);
+                  norm_q, norm_b,  &err, data->error_work);
   numerics_printf_verbose(-1,"---- GFC3D - IPM  - Iteration %i, full error = %14.7e", iteration, err);
 
 
@@ -496,7 +496,8 @@ void gfc3d_nonsmooth_Newton_AlartCurnier(
                         problem_size + /* rhs */
                         problem_size + /* tmp2 */
                         problem_size + /* tmp3 */
-                        problem_size   /* solution */),
+                        problem_size + /* solution */
+                        2 * n   /* error_work */),
                        sizeof(double));
 
     /* XXX big hack here */
@@ -524,6 +525,7 @@ void gfc3d_nonsmooth_Newton_AlartCurnier(
   double * tmp2 = rhs + problem_size;
   double * tmp3 = tmp2 + problem_size;
   double * solution = tmp3 + problem_size;
+  double * error_work = solution + problem_size;
 
   /* XXX big hack --xhub*/
   CS_INT * iA = (CS_INT *)options->iWork;
@@ -772,7 +774,7 @@ void gfc3d_nonsmooth_Newton_AlartCurnier(
                           tolerance,
                           options,
                           norm_q, norm_b,
-                          &(options->dparam[SICONOS_DPARAM_RESIDU]));
+                          &(options->dparam[SICONOS_DPARAM_RESIDU]), error_work);
     }
 
 
@@ -18,7 +18,7 @@
 #include <assert.h>                        // for assert
 #include <math.h>                          // for sqrt
 #include <stdio.h>                         // for fprintf, NULL, stderr
-#include <stdlib.h>                        // for exit, EXIT_FAILURE
+#include <stdlib.h>                        // for exit, EXIT_FAILURE, malloc, free
 #include "Friction_cst.h"                  // for SICONOS_FRICTION_3D_IPARAM...
 #include "SiconosBlas.h"                         // for cblas_dcopy, cblas_dnrm2
 #include "GlobalFrictionContactProblem.h"  // for GlobalFrictionContactProblem
@@ -114,6 +114,8 @@ void gfc3d_nsgs(GlobalFrictionContactProblem* restrict problem, double* restrict
 
   double norm_q = cblas_dnrm2(n, problem->q, 1);
   double norm_b = cblas_dnrm2(m, problem->b, 1);
+  /* work vectors of the error computation */
+  double * error_work = (double *)malloc(2 * n * sizeof(double));
   /* verbose=1; */
   while((iter < itermax) && (hasNotConverged > 0))
   {
@@ -164,12 +166,12 @@ void gfc3d_nsgs(GlobalFrictionContactProblem* restrict problem, double* restrict
       if(!(iter % options->iparam[SICONOS_FRICTION_3D_IPARAM_ERROR_EVALUATION_FREQUENCY]))
       {
         /* computeGlobalVelocity(problem, reaction, globalVelocity); */
-        (computeError)(problem, reaction, velocity, globalVelocity, tolerance, options, norm_q, norm_b, &error);
+        (computeError)(problem, reaction, velocity, globalVelocity, tolerance, options, norm_q, norm_b, &error, error_work);
       }
     }
     else
     {
-      (computeError)(problem, reaction, velocity, globalVelocity, tolerance, options, norm_q, norm_b, &error);
+      (computeError)(problem, reaction, velocity, globalVelocity, tolerance, options, norm_q, norm_b, &error, error_work);
 
       numerics_printf_verbose(1,"----- GFC3D - NSGS - Iteration %i Residual = %14.7e; Tol = %g", iter, error, tolerance);
     }
@@ -180,7 +182,7 @@ void gfc3d_nsgs(GlobalFrictionContactProblem* restrict problem, double* restrict
   /*  One last error computation in case where are at the very end */
   if(iter == itermax)
   {
-    (*computeError)(problem, reaction, velocity, globalVelocity, tolerance, options, norm_q, norm_b, &error);
+    (*computeError)(problem, reaction, velocity, globalVelocity, tolerance, options, norm_q, norm_b, &error, error_work);
   }
 
   dparam[SICONOS_DPARAM_TOL] = tolerance;
@@ -188,5 +190,6 @@ void gfc3d_nsgs(GlobalFrictionContactProblem* restrict problem, double* restrict
 
 
   /***** Free memory *****/
+  free(error_work);
   (*freeSolver)(problem);
 }
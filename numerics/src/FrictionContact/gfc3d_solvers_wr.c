@@ -524,7 +524,7 @@ void  gfc3d_nsgs_wr(GlobalFrictionContactProblem* problem, double *reaction, dou
     double norm_q = cblas_dnrm2(n, problem->q, 1);
     double norm_b = cblas_dnrm2(m, problem->b, 1);
     double error;
-    gfc3d_compute_error(problem,  reaction, velocity, globalVelocity,  options->dparam[SICONOS_DPARAM_TOL], options, norm_q, norm_b, &error);
+    gfc3d_compute_error(problem,  reaction, velocity, globalVelocity,  options->dparam[SICONOS_DPARAM_TOL], options, norm_q, norm_b, &error, NULL);
 
 
     freeLocalProblem(localproblem);
@@ -34,6 +34,8 @@ const char* const  SICONOS_ROLLING_FRICTION_3D_ONECONTACT_ProjectionOnConeWithLo
 
 const char* const  SICONOS_ROLLING_FRICTION_3D_ONECONTACT_ProjectionOnCone_STR = "RFC3D_ProjectionOnCone";
 
+const char* const   SICONOS_ROLLING_FRICTION_3D_JACOBI_STR = "RFC3D_JACOBI";
+
 int rolling_fc3d_driver(RollingFrictionContactProblem* problem,
                         double *reaction, double *velocity,
                         SolverOptions* options)
@@ -81,6 +83,13 @@ int rolling_fc3d_driver(RollingFrictionContactProblem* problem,
     rolling_fc3d_nsgs(problem, reaction, velocity, &info, options);
     break;
   }
+  /* Non Smooth Jacobi, with the contacts solved in parallel */
+  case SICONOS_ROLLING_FRICTION_3D_JACOBI:
+  {
+    numerics_printf(" ========================== Call Jacobi solver for Rolling Friction-Contact 3D problem ==========================\n");
+    rolling_fc3d_jacobi(problem, reaction, velocity, &info, options);
+    break;
+  }
   default:
   {
     fprintf(stderr, "Numerics, rolling_fc3d_driver failed. Unknown solver.\n");
@@ -0,0 +1,308 @@
+/* Siconos is a program dedicated to modeling, simulation and control
+ * of non smooth dynamical systems.
+ *
+ * Copyright 2020 INRIA.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <assert.h>                            // for assert
+#include <float.h>                             // for DBL_EPSILON
+#include <math.h>                              // for sqrt, isnan, isinf
+#include <stdlib.h>                            // for malloc, free
+#include <string.h>                            // for memcpy
+#include "SiconosBlas.h"                       // for cblas_dnrm2, cblas_dcopy
+#include "Friction_cst.h"                      // for SICONOS_FRICTION_3D_NS...
+#include "NumericsFwd.h"                       // for SolverOptions, Rolling...
+#include "NumericsMatrix.h"                    // for NM_gemv_threaded, NM_e...
+#include "RollingFrictionContactProblem.h"     // for RollingFrictionContact...
+#include "SolverOptions.h"                     // for SolverOptions, SICONOS...
+#include "numerics_verbose.h"                  // for numerics_printf, numer...
+#include "rolling_fc_Solvers.h"                // for rolling_fc3d_jacobi
+#include "rolling_fc3d_compute_error.h"        // for rolling_fc3d_compute_e...
+#include "rolling_fc3d_local_problem_tools.h"  // for rolling_fc3d_local_pro...
+#ifdef _OPENMP
+#include <omp.h>                               // for omp_get_thread_num
+#endif
+
+/* Workspace of a thread: a local problem and a copy of the options of the
+ * local solver. The work arrays of the local solver are shared between the
+ * threads since they are indexed by the contact number. */
+typedef struct
+{
+  RollingFrictionContactProblem * localproblem;
+  double * localM;
+  SolverOptions localsolver_options;
+} RollingJacobiThread;
+
+static void rolling_fc3d_jacobi_threads_update_options(RollingJacobiThread * threads, int nthreads,
+                                                       SolverOptions * localsolver_options)
+{
+  for(int t = 0; t < nthreads; t++)
+  {
+    memcpy(threads[t].localsolver_options.iparam, localsolver_options->iparam,
+           localsolver_options->iSize * sizeof(int));
+    memcpy(threads[t].localsolver_options.dparam, localsolver_options->dparam,
+           localsolver_options->dSize * sizeof(double));
+  }
+}
+
+/* One Jacobi sweep: all the local problems are built from the reaction of
+ * the previous iterate, stored in reaction, and solved independently. The
+ * new reaction is written in reaction_new. Returns the square of the norm of
+ * the increment. */
+static double rolling_fc3d_jacobi_sweep(RollingFrictionContactProblem* problem,
+                                        double * reaction, double * reaction_new,
+                                        double * w, double ** diagBlocks,
+                                        RollingSolverPtr local_solver,
+                                        RollingJacobiThread * threads, int nthreads,
+                                        SolverOptions * options, int iter)
+{
+  int nc = problem->numberOfContacts;
+  int * iparam = options->iparam;
+  double omega = (iparam[SICONOS_FRICTION_3D_NSGS_RELAXATION] == SICONOS_FRICTION_3D_NSGS_RELAXATION_TRUE) ?
+                 options->dparam[SICONOS_FRICTION_3D_NSGS_RELAXATION_VALUE] : 1.0;
+  int filter = (iparam[SICONOS_FRICTION_3D_NSGS_FILTER_LOCAL_SOLUTION] == SICONOS_FRICTION_3D_NSGS_FILTER_LOCAL_SOLUTION_TRUE);
+
+  /* w = q + M reaction */
+  cblas_dcopy(5 * nc, problem->q, 1, w, 1);
+  NM_gemv_threaded(1.0, problem->M, reaction, 1.0, w, nthreads);
+
+  double light_error_sum = 0.0;
+#ifdef _OPENMP
+#pragma omp parallel for num_threads(nthreads) if(nthreads > 1) schedule(dynamic, 64) reduction(+:light_error_sum)
+#endif
+  for(int contact = 0; contact < nc; contact++)
+  {
+#ifdef _OPENMP
+    RollingJacobiThread * thread = &threads[omp_get_thread_num()];
+#else
+    RollingJacobiThread * thread = &threads[0];
+#endif
+    RollingFrictionContactProblem * localproblem = thread->localproblem;
+    SolverOptions * localsolver_options = &thread->localsolver_options;
+    double * oldreaction = &reaction[5 * contact];
+    double * MLocal = diagBlocks[contact];
+    double localreaction[5];
+
+    /* qLocal = (q + M reaction)_contact - MLocal reaction_contact */
+    localproblem->M->matrix0 = MLocal;
+    for(int i = 0; i < 5; i++)
+      localproblem->q[i] = w[5 * contact + i]
+                           - MLocal[i + 0 * 5] * oldreaction[0]
+                           - MLocal[i + 1 * 5] * oldreaction[1]
+                           - MLocal[i + 2 * 5] * oldreaction[2]
+                           - MLocal[i + 3 * 5] * oldreaction[3]
+                           - MLocal[i + 4 * 5] * oldreaction[4];
+    localproblem->mu[0] = problem->mu[contact];
+    localproblem->mu_r[0] = problem->mu_r[contact];
+    localsolver_options->iparam[SICONOS_FRICTION_3D_CURRENT_CONTACT_NUMBER] = contact;
+
+    memcpy(localreaction, oldreaction, 5 * sizeof(double));
+    (*local_solver)(localproblem, localreaction, localsolver_options);
+
+    if(filter && (isnan(localsolver_options->dparam[SICONOS_DPARAM_RESIDU])
+                  || isinf(localsolver_options->dparam[SICONOS_DPARAM_RESIDU])
+                  || localsolver_options->dparam[SICONOS_DPARAM_RESIDU] > 1.0))
+    {
+      numerics_printf("Discard local reaction for contact %i at iteration %i "
+                      "with local_error = %e",
+                      contact, iter, localsolver_options->dparam[SICONOS_DPARAM_RESIDU]);
+      memcpy(localreaction, oldreaction, 5 * sizeof(double));
+    }
+
+    for(int i = 0; i < 5; i++)
+    {
+      reaction_new[5 * contact + i] = omega * localreaction[i] + (1.0 - omega) * oldreaction[i];
+      double dr = reaction_new[5 * contact + i] - oldreaction[i];
+      light_error_sum += dr * dr;
+    }
+  }
+  return light_error_sum;
+}
+
+void rolling_fc3d_jacobi(RollingFrictionContactProblem* problem, double *reaction,
+                         double *velocity, int* info, SolverOptions* options)
+{
+  int* iparam = options->iparam;
+  double* dparam = options->dparam;
+
+  int nc = problem->numberOfContacts;
+  int n = 5 * nc;
+  int itermax = iparam[SICONOS_IPARAM_MAX_ITER];
+  double tolerance = dparam[SICONOS_DPARAM_TOL];
+  double norm_q = cblas_dnrm2(n, problem->q, 1);
+
+  if(*info == 0)
+    return;
+
+  if(options->numberOfInternalSolvers < 1)
+  {
+    numerics_error("rolling_fc3d_jacobi",
+                   "The Jacobi method needs options for the internal solvers, "
+                   "options[0].numberOfInternalSolvers should be >= 1");
+  }
+  if(!(iparam[SICONOS_FRICTION_3D_IPARAM_ERROR_EVALUATION] == SICONOS_FRICTION_3D_NSGS_ERROR_EVALUATION_FULL
+       || iparam[SICONOS_FRICTION_3D_IPARAM_ERROR_EVALUATION] == SICONOS_FRICTION_3D_NSGS_ERROR_EVALUATION_LIGHT_WITH_FULL_FINAL
+       || iparam[SICONOS_FRICTION_3D_IPARAM_ERROR_EVALUATION] == SICONOS_FRICTION_3D_NSGS_ERROR_EVALUATION_LIGHT))
+  {
+    numerics_error(
+      "rolling_fc3d_jacobi", "iparam[SICONOS_FRICTION_3D_IPARAM_ERROR_EVALUATION] must be equal to "
+      "SICONOS_FRICTION_3D_NSGS_ERROR_EVALUATION_FULL (0), "
+      "SICONOS_FRICTION_3D_NSGS_ERROR_EVALUATION_LIGHT (1) or "
+      "SICONOS_FRICTION_3D_NSGS_ERROR_EVALUATION_LIGHT_WITH_FULL_FINAL (2)");
+  }
+
+  int nthreads = iparam[SICONOS_FRICTION_3D_NSGS_NUMBER_OF_THREADS];
+#ifndef _OPENMP
+  nthreads = 1;
+#endif
+  if(nthreads < 1)
+    nthreads = 1;
+
+  SolverOptions * localsolver_options = options->internalSolvers[0];
+
+  RollingSolverPtr local_solver = NULL;
+  RollingUpdatePtr update_localproblem = NULL;
+  RollingFreeSolverNSGSPtr freeSolver = NULL;
+  RollingComputeErrorPtr computeError = NULL;
+
+  /* the first local problem is used to initialize the local solver */
+  RollingJacobiThread * threads = (RollingJacobiThread *)malloc(nthreads * sizeof(RollingJacobiThread));
+  for(int t = 0; t < nthreads; t++)
+  {
+    threads[t].localproblem = rolling_fc3d_local_problem_allocate(problem);
+    threads[t].localM = threads[t].localproblem->M->matrix0;
+  }
+  rolling_fc3d_nsgs_initialize_local_solver(&local_solver, &update_localproblem,
+      &freeSolver, &computeError,
+      problem, threads[0].localproblem, options);
+  threads[0].localproblem->M->matrix0 = threads[0].localM;
+
+  /* the options of the local solver are shared, except the parameters,
+   * written by the local solver */
+  for(int t = 0; t < nthreads; t++)
+  {
+    threads[t].localsolver_options = *localsolver_options;
+    threads[t].localsolver_options.iparam = (int *)malloc(localsolver_options->iSize * sizeof(int));
+    threads[t].localsolver_options.dparam = (double *)malloc(localsolver_options->dSize * sizeof(double));
+  }
+
+  /* the diagonal blocks are extracted once */
+  double ** diagBlocks = (double **)malloc(nc * sizeof(double *));
+  double * diagBuffer = NULL;
+  if(problem->M->storageType != NM_SPARSE_BLOCK)
+    diagBuffer = (double *)malloc(25 * nc * sizeof(double));
+  for(int contact = 0; contact < nc; contact++)
+  {
+    if(diagBuffer)
+      diagBlocks[contact] = &diagBuffer[25 * contact];
+    NM_extract_diag_block5(problem->M, contact, &diagBlocks[contact]);
+  }
+
+  double * w = (double *)malloc(n * sizeof(double));
+  double * reaction_new = (double *)malloc(n * sizeof(double));
+
+  int iter = 0;
+  double error = 1.;
+  int hasNotConverged = 1;
+  while((iter < itermax) && (hasNotConverged > 0))
+  {
+    ++iter;
+    rolling_fc3d_set_internalsolver_tolerance(problem, options, localsolver_options, error);
+    rolling_fc3d_jacobi_threads_update_options(threads, nthreads, localsolver_options);
+
+    double light_error_sum = rolling_fc3d_jacobi_sweep(problem, reaction, reaction_new, w, diagBlocks,
+                             local_solver, threads, nthreads, options, iter);
+    cblas_dcopy(n, reaction_new, 1, reaction, 1);
+
+    if(iparam[SICONOS_FRICTION_3D_IPARAM_ERROR_EVALUATION] == SICONOS_FRICTION_3D_NSGS_ERROR_EVALUATION_FULL)
+    {
+      (*computeError)(problem, reaction, velocity, tolerance, options, norm_q, &error);
+    }
+    else
+    {
+      error = sqrt(light_error_sum);
+      double norm_r = cblas_dnrm2(n, reaction, 1);
+      if(fabs(norm_r) > DBL_EPSILON)
+        error /= norm_r;
+    }
+
+    if(error < tolerance)
+    {
+      hasNotConverged = 0;
+      numerics_printf("--------------- RFC3D - JACOBI - Iteration %i "
+                      "Residual = %14.7e < %7.3e", iter, error, tolerance);
+      if(iparam[SICONOS_FRICTION_3D_IPARAM_ERROR_EVALUATION] == SICONOS_FRICTION_3D_NSGS_ERROR_EVALUATION_LIGHT_WITH_FULL_FINAL)
+      {
+        /* the light error is small enough: check the absolute error and
+         * decrease the incremental tolerance if it is not reached */
+        double absolute_error;
+        (*computeError)(problem, reaction, velocity, dparam[SICONOS_DPARAM_TOL], options, norm_q, &absolute_error);
+        if(absolute_error > dparam[SICONOS_DPARAM_TOL])
+        {
+          tolerance = error / absolute_error * dparam[SICONOS_DPARAM_TOL];
+          numerics_printf("------- RFC3D - JACOBI - We modify the required incremental precision to reach accuracy to %e", tolerance);
+          hasNotConverged = 1;
+        }
+        error = absolute_error;
+      }
+    }
+    else
+    {
+      numerics_printf("--------------- RFC3D - JACOBI - Iteration %i "
+                      "Residual = %14.7e > %7.3e", iter, error, tolerance);
+    }
+
+    if(options->callback)
+    {
+      options->callback->collectStatsIteration(options->callback->env, n,
+          reaction, velocity, error, NULL);
+    }
+  }
+
+  if(hasNotConverged && iparam[SICONOS_FRICTION_3D_IPARAM_ERROR_EVALUATION] == SICONOS_FRICTION_3D_NSGS_ERROR_EVALUATION_LIGHT_WITH_FULL_FINAL)
+  {
+    (*computeError)(problem, reaction, velocity, dparam[SICONOS_DPARAM_TOL], options, norm_q, &error);
+    hasNotConverged = error > dparam[SICONOS_DPARAM_TOL];
+  }
+
+  *info = hasNotConverged;
+  dparam[SICONOS_DPARAM_RESIDU] = error;
+  iparam[SICONOS_IPARAM_ITER_DONE] = iter;
+
+  /** Free memory **/
+  free(w);
+  free(reaction_new);
+  free(diagBuffer);
+  free(diagBlocks);
+  for(int t = 0; t < nthreads; t++)
+  {
+    free(threads[t].localsolver_options.iparam);
+    free(threads[t].localsolver_options.dparam);
+    threads[t].localproblem->M->matrix0 = threads[t].localM;
+    if(t > 0)
+      rolling_fc3d_local_problem_free(threads[t].localproblem, problem);
+  }
+  (*freeSolver)(problem, threads[0].localproblem, localsolver_options);
+  rolling_fc3d_local_problem_free(threads[0].localproblem, problem);
+  free(threads);
+}
+
+void rfc3d_jacobi_set_default(SolverOptions* options)
+{
+  rfc3d_nsgs_set_default(options);
+  /* without relaxation, the Jacobi iterations may oscillate */
+  options->iparam[SICONOS_FRICTION_3D_NSGS_RELAXATION] = SICONOS_FRICTION_3D_NSGS_RELAXATION_TRUE;
+  options->dparam[SICONOS_FRICTION_3D_NSGS_RELAXATION_VALUE] = 0.5;
+  options->iparam[SICONOS_FRICTION_3D_NSGS_NUMBER_OF_THREADS] = 1;
+}
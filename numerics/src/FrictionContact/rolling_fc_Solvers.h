@@ -108,6 +108,33 @@ extern "C"
                                                   RollingFrictionContactProblem* localproblem,
                                                   SolverOptions * options);
 
+  /** Non-Smooth Jacobi solver for Rolling friction-contact 3D problem.
+      At each iteration, all the local problems are built from the reaction
+      of the previous iterate and solved independently, in parallel with
+      OpenMP. The product with M is shared by block rows between the threads.
+      \param problem the rolling friction-contact 3D problem to solve
+      \param velocity global vector (n), in-out parameter
+      \param reaction global vector (n), in-out parameters
+      \param info return 0 if the solution is found
+      \param options the solver options :
+      [in] iparam[0] : Maximum iteration number
+      [in] iparam[SICONOS_FRICTION_3D_IPARAM_ERROR_EVALUATION (7)] : error computation method,
+           SICONOS_FRICTION_3D_NSGS_ERROR_EVALUATION_FULL,
+           SICONOS_FRICTION_3D_NSGS_ERROR_EVALUATION_LIGHT or
+           SICONOS_FRICTION_3D_NSGS_ERROR_EVALUATION_LIGHT_WITH_FULL_FINAL
+      [in] iparam[SICONOS_FRICTION_3D_NSGS_FILTER_LOCAL_SOLUTION(14)] : filter local solution if the local error is greater than 1.0
+      [in] iparam[SICONOS_FRICTION_3D_NSGS_RELAXATION(4)] : relaxation of the Jacobi update
+           with parameter dparam[8] (default : true, with 0.5)
+      [in] iparam[SICONOS_FRICTION_3D_NSGS_NUMBER_OF_THREADS(16)] : number of threads (default 1)
+      [out] iparam[SICONOS_IPARAM_ITER_DONE(1)] = iter number of performed iterations
+      [in]  dparam[SICONOS_DPARAM_TOL(0)] user tolerance on the loop
+      [in]  dparam[8]  the relaxation parameter omega
+      [out] dparam[SICONOS_DPARAM_RESIDU(1)]  reached error
+
+      The internal (local) solver must set by the SolverOptions options[1]
+  */
+  void rolling_fc3d_jacobi(RollingFrictionContactProblem* problem, double *reaction, double *velocity, int* info, SolverOptions* options);
+
   /** Check for trivial solution in the friction-contact 3D problem
       \param problem FrictionContactProblem*  the problem
       \param velocity global vector (n), in-out parameter
@@ -127,6 +154,7 @@ extern "C"
   /** \addtogroup SetSolverOptions @{
    */
   void rfc3d_nsgs_set_default(SolverOptions* options);
+  void rfc3d_jacobi_set_default(SolverOptions* options);
   void rfc3d_poc_withLocalIteration_set_default(SolverOptions* options);
   void rfc3d_poc_set_default(SolverOptions* options);
 
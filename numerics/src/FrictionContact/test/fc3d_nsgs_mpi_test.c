@@ -0,0 +1,168 @@
+/* Siconos is a program dedicated to modeling, simulation and control
+ * of non smooth dynamical systems.
+ *
+ * Copyright 2020 INRIA.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+*/
+#include <math.h>                        // for fabs
+#include <stdio.h>                       // for printf, fprintf, stderr
+#include <stdlib.h>                      // for malloc, calloc, free
+#include <string.h>                      // for memcpy, strcmp
+#include "FrictionContactProblem.h"      // for FrictionContactProblem
+#include "Friction_cst.h"                // for SICONOS_FRICTION_3D_NSGS_MPI
+#include "NonSmoothDrivers.h"            // for fc3d_driver
+#include "NumericsMatrix.h"              // for NM_create, NM_SPARSE_BLOCK
+#include "SiconosConfig.h"               // for SICONOS_HAS_MPI // IWYU pragma: keep
+#include "SolverOptions.h"               // for SolverOptions, solver_opt...
+#include "SparseBlockMatrix.h"           // for SparseBlockStructuredMatrix
+#include "fc3d_compute_error.h"          // for fc3d_compute_error
+#ifdef SICONOS_HAS_MPI
+#include "mpi.h"
+#endif
+
+/* The problem on the contacts first, ..., first + nc - 1 of a problem
+ * with a sparse block storage: the rows of these contacts and all the
+ * columns. */
+static FrictionContactProblem* local_problem(FrictionContactProblem* problem, int first, int nc)
+{
+  SparseBlockStructuredMatrix* M = problem->M->matrix1;
+  int nc_global = problem->numberOfContacts;
+  SparseBlockStructuredMatrix* A = SBM_new();
+  size_t start = M->index1_data[first];
+  size_t end = M->index1_data[first + nc];
+  A->nbblocks = (unsigned int)(end - start);
+  A->block = (double **)malloc((A->nbblocks + 1) * sizeof(double *));
+  A->blocknumber0 = nc;
+  A->blocknumber1 = nc_global;
+  A->blocksize0 = (unsigned int *)malloc(nc * sizeof(unsigned int));
+  A->blocksize1 = (unsigned int *)malloc(nc_global * sizeof(unsigned int));
+  for(int i = 0; i < nc; i++)
+    A->blocksize0[i] = 3 * (i + 1);
+  memcpy(A->blocksize1, M->blocksize1, nc_global * sizeof(unsigned int));
+  A->filled1 = nc + 1;
+  A->filled2 = A->nbblocks;
+  A->index1_data = (size_t *)malloc((nc + 1) * sizeof(size_t));
+  A->index2_data = (size_t *)malloc((A->nbblocks + 1) * sizeof(size_t));
+  for(int i = 0; i <= nc; i++)
+    A->index1_data[i] = M->index1_data[first + i] - start;
+  for(size_t k = start; k < end; k++)
+  {
+    A->index2_data[k - start] = M->index2_data[k];
+    A->block[k - start] = (double *)malloc(9 * sizeof(double));
+    memcpy(A->block[k - start], M->block[k], 9 * sizeof(double));
+  }
+
+  FrictionContactProblem* local = frictionContactProblem_new();
+  local->dimension = 3;
+  local->numberOfContacts = nc;
+  local->M = NM_create_from_data(NM_SPARSE_BLOCK, 3 * nc, 3 * nc_global, A);
+  local->q = (double *)malloc(3 * nc * sizeof(double));
+  local->mu = (double *)malloc(nc * sizeof(double));
+  memcpy(local->q, &problem->q[3 * first], 3 * nc * sizeof(double));
+  memcpy(local->mu, &problem->mu[first], nc * sizeof(double));
+  return local;
+}
+
+int main(int argc, char *argv[])
+{
+  int rank = 0;
+  int nranks = 1;
+#ifdef SICONOS_HAS_MPI
+  MPI_Init(&argc, &argv);
+  MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+  MPI_Comm_size(MPI_COMM_WORLD, &nranks);
+#endif
+
+  int info = 0;
+  const char * filename = "data/KaplasTower-i1061-4.hdf5.dat";
+  FrictionContactProblem* problem = frictionContact_new_from_filename(filename);
+  int nc_global = problem->numberOfContacts;
+  int n_global = 3 * nc_global;
+
+  /* the contacts are distributed by contiguous slices */
+  int * counts = (int *)malloc(nranks * sizeof(int));
+  int * displs = (int *)malloc(nranks * sizeof(int));
+  for(int p = 0; p < nranks; p++)
+  {
+    int first = p * nc_global / nranks;
+    counts[p] = 3 * ((p + 1) * nc_global / nranks - first);
+    displs[p] = 3 * first;
+  }
+  int first = displs[rank] / 3;
+  int nc = counts[rank] / 3;
+  FrictionContactProblem* local = local_problem(problem, first, nc);
+
+  double * reaction = (double *)calloc(3 * nc + 1, sizeof(double));
+  double * velocity = (double *)calloc(3 * nc + 1, sizeof(double));
+  SolverOptions * options = solver_options_create(SICONOS_FRICTION_3D_NSGS_MPI);
+  options->iparam[SICONOS_IPARAM_MAX_ITER] = 10000;
+  options->dparam[SICONOS_DPARAM_TOL] = 1e-8;
+  /* "jacobi" as argument: all the processes sweep at the same time, with
+   * a relaxation */
+  if(argc > 1 && !strcmp(argv[1], "jacobi"))
+  {
+    options->iparam[SICONOS_FRICTION_3D_NSGS_MPI_COLORING] = 0;
+    options->iparam[SICONOS_FRICTION_3D_NSGS_RELAXATION] = SICONOS_FRICTION_3D_NSGS_RELAXATION_TRUE;
+    options->dparam[SICONOS_FRICTION_3D_NSGS_RELAXATION_VALUE] = 0.7;
+  }
+  info = fc3d_driver(local, reaction, velocity, options);
+
+  /* the error of the gathered solution on the whole problem */
+  double * reaction_global = (double *)calloc(n_global, sizeof(double));
+  double * velocity_global = (double *)calloc(n_global, sizeof(double));
+#ifdef SICONOS_HAS_MPI
+  MPI_Allgatherv(reaction, 3 * nc, MPI_DOUBLE, reaction_global, counts, displs, MPI_DOUBLE, MPI_COMM_WORLD);
+#else
+  memcpy(reaction_global, reaction, n_global * sizeof(double));
+#endif
+  double norm_q = 0.;
+  for(int i = 0; i < n_global; i++)
+    norm_q += problem->q[i] * problem->q[i];
+  double error = 0.;
+  fc3d_compute_error(problem, reaction_global, velocity_global, 1e-8, options, sqrt(norm_q), &error);
+  if(rank == 0)
+    printf("fc3d_nsgs_mpi_test: %d processes, %s, info %d, %d iterations, residual %e, error of the whole problem %e\n",
+           nranks, options->iparam[SICONOS_FRICTION_3D_NSGS_MPI_COLORING] ? "coloring" : "jacobi",
+           info, options->iparam[SICONOS_IPARAM_ITER_DONE], options->dparam[SICONOS_DPARAM_RESIDU], error);
+  if(info || error > 1e-8 || fabs(error - options->dparam[SICONOS_DPARAM_RESIDU]) > 1e-12)
+  {
+    fprintf(stderr, "fc3d_nsgs_mpi_test: failed on process %d\n", rank);
+    info = 1;
+  }
+  /* the velocities of the local contacts */
+  for(int i = 0; i < 3 * nc; i++)
+  {
+    if(fabs(velocity[i] - velocity_global[3 * first + i]) > 1e-10)
+    {
+      fprintf(stderr, "fc3d_nsgs_mpi_test: wrong velocity on process %d\n", rank);
+      info = 1;
+      break;
+    }
+  }
+
+  solver_options_delete(options);
+  free(reaction);
+  free(velocity);
+  free(reaction_global);
+  free(velocity_global);
+  free(counts);
+  free(displs);
+  frictionContactProblem_free(local);
+  frictionContactProblem_free(problem);
+
+#ifdef SICONOS_HAS_MPI
+  MPI_Finalize();
+#endif
+  return info;
+}
@@ -0,0 +1,104 @@
+/* Siconos is a program dedicated to modeling, simulation and control
+ * of non smooth dynamical systems.
+ *
+ * Copyright 2020 INRIA.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+*/
+#include <stdio.h>                       // for printf, fprintf, stderr
+#include <stdlib.h>                      // for calloc, free
+#include "FrictionContactProblem.h"      // for FrictionContactProblem
+#include "Friction_cst.h"                // for SICONOS_FRICTION_3D_NSGS
+#include "NonSmoothDrivers.h"            // for fc3d_driver
+#include "SolverOptions.h"               // for SolverOptions, solver_opt...
+
+/* A sequence of problems of different sizes and storages is solved with
+ * the same options, which keep the workspace of fc3d_nsgs between the
+ * calls, and with new options for each problem: the results must be the
+ * same. */
+
+static void set_options(SolverOptions * options, int shuffle)
+{
+  options->iparam[SICONOS_IPARAM_MAX_ITER] = 5000;
+  options->dparam[SICONOS_DPARAM_TOL] = 1e-5;
+  if(shuffle)
+  {
+    options->iparam[SICONOS_FRICTION_3D_NSGS_SHUFFLE] = SICONOS_FRICTION_3D_NSGS_SHUFFLE_TRUE_EACH_LOOP;
+    options->iparam[SICONOS_FRICTION_3D_NSGS_FREEZING_SWEEPS] = 3;
+  }
+}
+
+static int solve(FrictionContactProblem * problem, SolverOptions * options, double ** reaction, int * iter)
+{
+  int n = 3 * problem->numberOfContacts;
+  *reaction = (double *)calloc(n, sizeof(double));
+  double * velocity = (double *)calloc(n, sizeof(double));
+  int info = fc3d_driver(problem, *reaction, velocity, options);
+  *iter = options->iparam[SICONOS_IPARAM_ITER_DONE];
+  free(velocity);
+  return info;
+}
+
+int main(void)
+{
+  const char * filenames[] = {"data/OneObject-i1028-138.hdf5.dat",
+                              "data/FC3D_Example1.dat",
+                              "data/Confeti-ex13-Fc3D-SBM.dat",
+                              "data/FC3D_Example1_SBM.dat",
+                              "data/OneObject-i1028-138.hdf5.dat"
+                             };
+  int n_files = 5;
+  int out = 0;
+
+  for(int shuffle = 0; shuffle < 2; shuffle++)
+  {
+    SolverOptions * options = solver_options_create(SICONOS_FRICTION_3D_NSGS);
+    set_options(options, shuffle);
+    for(int k = 0; k < 2 * n_files; k++)
+    {
+      /* the second sequence starts from released workspaces */
+      if(k == n_files)
+        solver_options_release_workspace(options);
+
+      FrictionContactProblem * problem = frictionContact_new_from_filename(filenames[k % n_files]);
+      int n = 3 * problem->numberOfContacts;
+
+      double * reaction = NULL;
+      int iter = 0;
+      int info = solve(problem, options, &reaction, &iter);
+
+      SolverOptions * new_options = solver_options_create(SICONOS_FRICTION_3D_NSGS);
+      set_options(new_options, shuffle);
+      double * reaction_ref = NULL;
+      int iter_ref = 0;
+      int info_ref = solve(problem, new_options, &reaction_ref, &iter_ref);
+      solver_options_delete(new_options);
+
+      int same = (info == info_ref && iter == iter_ref);
+      for(int i = 0; i < n && same; i++)
+        same = (reaction[i] == reaction_ref[i]);
+      printf("fc3d_nsgs_workspace_test: shuffle %i, %s, info %i, %i iterations, %s\n",
+             shuffle, filenames[k % n_files], info, iter, same ? "same result" : "different result");
+      if(!same || info)
+      {
+        fprintf(stderr, "fc3d_nsgs_workspace_test: failed (iterations %i and %i)\n", iter, iter_ref);
+        out = 1;
+      }
+      free(reaction);
+      free(reaction_ref);
+      frictionContactProblem_free(problem);
+    }
+    solver_options_delete(options);
+  }
+  return out;
+}
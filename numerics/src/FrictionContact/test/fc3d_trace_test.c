@@ -0,0 +1,147 @@
+/* Siconos is a program dedicated to modeling, simulation and control
+ * of non smooth dynamical systems.
+ *
+ * Copyright 2020 INRIA.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+*/
+#include <stdio.h>                   // for printf, fprintf, stderr
+#include <stdlib.h>                  // for free, malloc, calloc
+#include <string.h>                  // for memcpy, memcmp
+#include "CSparseMatrix_internal.h"  // for CSparseMatrix
+#include "FrictionContactProblem.h"  // for FrictionContactProblem, friction...
+#include "FrictionContactTrace.h"    // for frictionContactTrace_open_write
+#include "Friction_cst.h"            // for SICONOS_FRICTION_3D_NSGS
+#include "NonSmoothDrivers.h"        // for fc3d_driver
+#include "NumericsMatrix.h"          // for NumericsMatrix, NM_create, NM_...
+#include "NumericsSparseMatrix.h"    // for NSM_CSC
+#include "SolverOptions.h"           // for SolverOptions, solver_options_...
+#include "SparseBlockMatrix.h"       // for SparseBlockStructuredMatrix
+
+#define NSTEPS 10
+
+/* record a sequence of slightly modified problems, with a change of
+ * storage of M in the middle, read them back and replay them */
+int main(void)
+{
+  int info = 0;
+  const char* filename = "fc3d_trace_test.fct";
+
+  FrictionContactProblem* problem = frictionContact_new_from_filename("data/Confeti-ex03-Fc3D-SBM.dat");
+  int nc = problem->numberOfContacts;
+  int n = nc * problem->dimension;
+
+  FrictionContactProblem* recorded[NSTEPS];
+  double* guesses[NSTEPS];
+  int iterations[NSTEPS];
+  double* reaction = (double*)calloc(n, sizeof(double));
+  double* velocity = (double*)calloc(n, sizeof(double));
+
+  SolverOptions* options = solver_options_create(SICONOS_FRICTION_3D_NSGS);
+  options->dparam[SICONOS_DPARAM_TOL] = 1e-8;
+
+  FrictionContactTrace* trace = frictionContactTrace_open_write(filename, 4);
+  if(!trace)
+  {
+    fprintf(stderr, "fc3d_trace_test: unable to open %s\n", filename);
+    return 1;
+  }
+  for(int step = 0; step < NSTEPS; ++step)
+  {
+    if(step == 6)
+    {
+      NumericsMatrix* W = NM_create(NM_SPARSE, n, n);
+      NM_copy_to_sparse(problem->M, W);
+      NM_csc(W);
+      W->matrix2->origin = NSM_CSC;
+      NM_clearTriplet(W);
+      NM_clear(problem->M);
+      free(problem->M);
+      problem->M = W;
+    }
+    problem->q[(7 * step) % n] += 1e-3 * step;
+    problem->mu[step % nc] *= 1.01;
+    if(problem->M->storageType == NM_SPARSE_BLOCK)
+      problem->M->matrix1->block[step % problem->M->matrix1->filled2][0] += 1e-4;
+    else
+      NM_csc(problem->M)->x[step] += 1e-4;
+
+    recorded[step] = frictionContact_copy(problem);
+    guesses[step] = (double*)malloc(2 * n * sizeof(double));
+    memcpy(guesses[step], reaction, n * sizeof(double));
+    memcpy(guesses[step] + n, velocity, n * sizeof(double));
+
+    frictionContactTrace_record(trace, problem, reaction, velocity);
+    int solve_info = fc3d_driver(problem, reaction, velocity, options);
+    frictionContactTrace_record_result(trace, solve_info, options);
+    iterations[step] = options->iparam[SICONOS_IPARAM_ITER_DONE];
+  }
+  size_t bytes = frictionContactTrace_bytes(trace);
+  info = frictionContactTrace_close(trace);
+  printf("fc3d_trace_test: %d steps recorded in %lu bytes\n", NSTEPS, (unsigned long)bytes);
+
+  trace = frictionContactTrace_open_read(filename);
+  FrictionContactProblem* read;
+  double* r;
+  double* u;
+  FrictionContactTraceStep step_stats;
+  int step = 0;
+  int status = -1;
+  while(!info && trace && (status = frictionContactTrace_read_next(trace, &read, &r, &u, &step_stats)) == 1)
+  {
+    FrictionContactProblem* ref = recorded[step];
+    if(read->numberOfContacts != nc
+       || read->M->storageType != ref->M->storageType
+       || !NM_equal(read->M, ref->M)
+       || memcmp(read->q, ref->q, n * sizeof(double))
+       || memcmp(read->mu, ref->mu, nc * sizeof(double))
+       || memcmp(r, guesses[step], n * sizeof(double))
+       || memcmp(u, guesses[step] + n, n * sizeof(double)))
+    {
+      fprintf(stderr, "fc3d_trace_test: step %d differs from the recorded problem\n", step);
+      info = 1;
+    }
+    if(step_stats.solverId != SICONOS_FRICTION_3D_NSGS
+       || step_stats.iterations != iterations[step]
+       || step_stats.tolerance != 1e-8)
+    {
+      fprintf(stderr, "fc3d_trace_test: wrong statistics for step %d\n", step);
+      info = 1;
+    }
+    step++;
+  }
+  if(!info && (status != 0 || step != NSTEPS))
+  {
+    fprintf(stderr, "fc3d_trace_test: %d steps read instead of %d\n", step, NSTEPS);
+    info = 1;
+  }
+  frictionContactTrace_close(trace);
+
+  if(!info && frictionContactTrace_replay(filename, NULL, stdout) != NSTEPS)
+  {
+    fprintf(stderr, "fc3d_trace_test: replay failed\n");
+    info = 1;
+  }
+
+  for(int k = 0; k < NSTEPS; ++k)
+  {
+    frictionContactProblem_free(recorded[k]);
+    free(guesses[k]);
+  }
+  free(reaction);
+  free(velocity);
+  solver_options_delete(options);
+  frictionContactProblem_free(problem);
+  remove(filename);
+  return info;
+}
@@ -0,0 +1,183 @@
+/* Siconos is a program dedicated to modeling, simulation and control
+ * of non smooth dynamical systems.
+ *
+ * Copyright 2020 INRIA.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+*/
+/* Solve a small global friction-contact problem with assembled
+   matrices and with the matrix-free operators
+   (GlobalFrictionContactOperator), with VI_FPP and ADMM, and compare
+   the results. */
+
+#include <math.h>                           // for fabs
+#include <stdio.h>                          // for printf
+#include <stdlib.h>                         // for free, malloc
+#include "Friction_cst.h"                   // for SICONOS_GLOBAL_FRICTION_3D_VI_FPP
+#include "GlobalFrictionContactOperator.h"  // for GlobalFrictionContactOperator
+#include "GlobalFrictionContactProblem.h"   // for GlobalFrictionContactProblem
+#include "NonSmoothDrivers.h"               // for gfc3d_driver
+#include "NumericsMatrix.h"                 // for NM_create_from_data
+#include "SiconosBlas.h"                    // for cblas_dgemv
+#include "SolverOptions.h"                  // for solver_options_create
+
+#define N 6
+#define NC 2
+#define M_SIZE (3*NC)
+
+typedef struct
+{
+  double * M;
+  double * H;
+} DenseOperators;
+
+static void M_gemv(void* data, double alpha, const double* x, double beta, double* y)
+{
+  DenseOperators* d = (DenseOperators*)data;
+  cblas_dgemv(CblasColMajor, CblasNoTrans, N, N, alpha, d->M, N, x, 1, beta, y, 1);
+}
+
+static int M_solve(void* data, double* x)
+{
+  /* M is diagonal */
+  DenseOperators* d = (DenseOperators*)data;
+  for(int i = 0; i < N; i++)
+    x[i] /= d->M[i + i * N];
+  return 0;
+}
+
+static void H_gemv(void* data, double alpha, const double* x, double beta, double* y)
+{
+  DenseOperators* d = (DenseOperators*)data;
+  cblas_dgemv(CblasColMajor, CblasNoTrans, N, M_SIZE, alpha, d->H, N, x, 1, beta, y, 1);
+}
+
+static void Ht_gemv(void* data, double alpha, const double* x, double beta, double* y)
+{
+  DenseOperators* d = (DenseOperators*)data;
+  cblas_dgemv(CblasColMajor, CblasTrans, N, M_SIZE, alpha, d->H, N, x, 1, beta, y, 1);
+}
+
+#define N_SOLVERS 2
+static int solvers[N_SOLVERS] = {SICONOS_GLOBAL_FRICTION_3D_VI_FPP, SICONOS_GLOBAL_FRICTION_3D_ADMM};
+
+static int solve(GlobalFrictionContactProblem* problem, int solverId,
+                 double * reaction, double * velocity, double * globalVelocity)
+{
+  for(int i = 0; i < M_SIZE; i++)
+  {
+    reaction[i] = 0.0;
+    velocity[i] = 0.0;
+  }
+  for(int i = 0; i < N; i++)
+    globalVelocity[i] = 0.0;
+
+  SolverOptions * options = solver_options_create(solverId);
+  options->dparam[SICONOS_DPARAM_TOL] = 1e-12;
+  options->iparam[SICONOS_IPARAM_MAX_ITER] = 100000;
+  int info = gfc3d_driver(problem, reaction, velocity, globalVelocity, options);
+  solver_options_delete(options);
+  return info;
+}
+
+int main(void)
+{
+  int info = 0;
+
+  /* column-major dense data */
+  double M[N * N] = {0};
+  double H[N * M_SIZE] = {0};
+  for(int i = 0; i < N; i++)
+    M[i + i * N] = (i < 3) ? 2.0 : 1.0;
+  /* contact 0 on the first body, contact 1 between the two bodies */
+  for(int i = 0; i < 3; i++)
+  {
+    H[i + i * N] = 1.0;
+    H[i + (3 + i) * N] = -1.0;
+    H[(3 + i) + (3 + i) * N] = 1.0;
+  }
+  double q[N] = {-1.0, 0.5, 0.2, -3.0, -0.1, 0.3};
+  double b[M_SIZE] = {0.0, 0.0, 0.0, 0.1, 0.0, 0.0};
+  double mu[NC] = {0.3, 0.5};
+
+  GlobalFrictionContactProblem* problem = globalFrictionContactProblem_new();
+  problem->dimension = 3;
+  problem->numberOfContacts = NC;
+  problem->M = NM_create_from_data(NM_DENSE, N, N, M);
+  problem->H = NM_create_from_data(NM_DENSE, N, M_SIZE, H);
+  problem->q = q;
+  problem->b = b;
+  problem->mu = mu;
+
+  double reaction[N_SOLVERS][M_SIZE], velocity[M_SIZE], globalVelocity[N_SOLVERS][N];
+  double reaction_mf[M_SIZE], globalVelocity_mf[N];
+
+  for(int k = 0; k < N_SOLVERS; k++)
+    info += solve(problem, solvers[k], reaction[k], velocity, globalVelocity[k]);
+
+  /* same problem, without assembled matrices */
+  DenseOperators data = {M, H};
+  GlobalFrictionContactOperator* op = globalFrictionContactOperator_new();
+  op->n = N;
+  op->data = &data;
+  op->M_gemv = &M_gemv;
+  op->M_solve = &M_solve;
+  op->H_gemv = &H_gemv;
+  op->Ht_gemv = &Ht_gemv;
+
+  NumericsMatrix * Mnm = problem->M;
+  NumericsMatrix * Hnm = problem->H;
+  problem->M = NULL;
+  problem->H = NULL;
+  problem->op = op;
+
+  for(int k = 0; k < N_SOLVERS; k++)
+  {
+    info += solve(problem, solvers[k], reaction_mf, velocity, globalVelocity_mf);
+
+    double diff = 0.0;
+    for(int i = 0; i < M_SIZE; i++)
+      diff = fmax(diff, fabs(reaction[k][i] - reaction_mf[i]));
+    for(int i = 0; i < N; i++)
+      diff = fmax(diff, fabs(globalVelocity[k][i] - globalVelocity_mf[i]));
+    printf("gfc3d_matrix_free_test: %s, max difference = %e\n", solver_options_id_to_name(solvers[k]), diff);
+    if(diff > 1e-8)
+      info = 1;
+  }
+
+  /* Delassus operator W = H^T M^{-1} H applied to a unit vector */
+  double x[M_SIZE] = {1.0, 0.0, 0.0, 0.0, 0.0, 0.0};
+  double y[M_SIZE];
+  double work[N];
+  globalFrictionContact_Delassus_gemv(problem, x, y, work);
+  /* W(0,0) = 1/2, W(3,0) = -1/2 */
+  if(fabs(y[0] - 0.5) > 1e-14 || fabs(y[3] + 0.5) > 1e-14)
+    info = 1;
+
+  free(op);
+  problem->op = NULL;
+  problem->M = NULL;
+  problem->H = NULL;
+  problem->q = NULL;
+  problem->b = NULL;
+  problem->mu = NULL;
+  Mnm->matrix0 = NULL;
+  Hnm->matrix0 = NULL;
+  NM_clear(Mnm);
+  NM_clear(Hnm);
+  free(Mnm);
+  free(Hnm);
+  free(problem);
+
+  return info;
+}
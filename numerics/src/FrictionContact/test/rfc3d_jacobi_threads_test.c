@@ -0,0 +1,87 @@
+/* Siconos is a program dedicated to modeling, simulation and control
+ * of non smooth dynamical systems.
+ *
+ * Copyright 2020 INRIA.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+*/
+#include <math.h>                           // for fabs
+#include <stdio.h>                          // for printf, fprintf, stderr
+#include <stdlib.h>                         // for calloc, free
+#include "Friction_cst.h"                   // for SICONOS_ROLLING_FRICTION_3D_JACOBI
+#include "NonSmoothDrivers.h"               // for rolling_fc3d_driver
+#include "RollingFrictionContactProblem.h"  // for RollingFrictionContactProblem
+#include "SiconosConfig.h"                  // for WITH_OPENMP // IWYU pragma: keep
+#include "SolverOptions.h"                  // for SolverOptions, solver_opt...
+
+/* solve the problem with 1 and 4 threads: the local problems of a Jacobi
+ * sweep are independent, the iterates must be the same */
+static int compare_threads(const char * filename)
+{
+  int info = 0;
+  int found[2];
+  int iter[2];
+  double * r[2];
+  double * u[2];
+  int nthreads[2] = {1, 4};
+  RollingFrictionContactProblem * problem = rollingFrictionContact_new_from_filename(filename);
+  int n = 5 * problem->numberOfContacts;
+  for(int i = 0; i < 2; i++)
+  {
+    r[i] = (double *)calloc(n, sizeof(double));
+    u[i] = (double *)calloc(n, sizeof(double));
+    SolverOptions * options = solver_options_create(SICONOS_ROLLING_FRICTION_3D_JACOBI);
+    options->dparam[SICONOS_DPARAM_TOL] = 1e-10;
+    options->iparam[SICONOS_IPARAM_MAX_ITER] = 10000;
+    options->iparam[SICONOS_FRICTION_3D_NSGS_NUMBER_OF_THREADS] = nthreads[i];
+    options->internalSolvers[0]->iparam[SICONOS_IPARAM_MAX_ITER] = 50;
+    options->internalSolvers[0]->dparam[SICONOS_DPARAM_TOL] = 1e-14;
+    found[i] = rolling_fc3d_driver(problem, r[i], u[i], options);
+    iter[i] = options->iparam[SICONOS_IPARAM_ITER_DONE];
+    solver_options_delete(options);
+  }
+
+  /* the error is a sum over the contacts, computed in another order with
+   * several threads: the stopping iteration may differ by rounding */
+  double diff = 0.0;
+  for(int k = 0; k < n; k++)
+    diff = fmax(diff, fabs(r[0][k] - r[1][k]));
+  printf("rfc3d_jacobi_threads_test, %s: info %d in %d iterations with 1 thread, info %d in %d iterations with 4 threads, max difference %e\n",
+         filename, found[0], iter[0], found[1], iter[1], diff);
+  if(found[0] || found[1] || diff > 1e-8)
+  {
+    fprintf(stderr, "rfc3d_jacobi_threads_test, %s: the solutions differ\n", filename);
+    info = 1;
+  }
+  for(int i = 0; i < 2; i++)
+  {
+    free(r[i]);
+    free(u[i]);
+  }
+  rollingFrictionContactProblem_free(problem);
+  return info;
+}
+
+int main(void)
+{
+#ifndef WITH_OPENMP
+  /* one thread whatever the options: nothing to compare */
+  printf("rfc3d_jacobi_threads_test: Siconos built without OpenMP, test skipped.\n");
+  return 77;
+#endif
+  int info = 0;
+  info += compare_threads("./data/RFC3D_sphere_1.dat");
+  info += compare_threads("./data/RFC3D_sphere_2.dat");
+  info += compare_threads("./data/RFC3D_cube_1.dat");
+  return info;
+}
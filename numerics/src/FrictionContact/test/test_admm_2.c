@@ -20,12 +20,13 @@
 #include "Friction_cst.h"                // for SICONOS_FRICTION_3D_ADMM
 #include "NumericsFwd.h"                 // for SolverOptions
 #include "SolverOptions.h"               // for SolverOptions, solver_option...
+#include "fixed_point_acceleration.h"    // for SICONOS_ACCELERATION_ANDERSON
 #include "frictionContact_test_utils.h"  // for build_test_collection
 #include "test_utils.h"                  // for TestCase
 
 TestCase * build_test_collection(int n_data, const char ** data_collection, int* number_of_tests)
 {
-  int n_solvers = 4;
+  int n_solvers = 6;
   *number_of_tests = n_data * n_solvers;
   TestCase * collection = malloc((*number_of_tests) * sizeof(TestCase));
 
@@ -77,6 +78,29 @@ TestCase * build_test_collection(int n_data, const char ** data_collection, int*
     current++;
   }
 
+  for(int d =0; d <n_data; d++)
+  {
+    // Anderson acceleration
+    collection[current].filename = data_collection[d];
+    collection[current].options = solver_options_create(SICONOS_FRICTION_3D_ADMM);
+    collection[current].options->dparam[SICONOS_DPARAM_TOL] = 1e-5;
+    collection[current].options->iparam[SICONOS_IPARAM_MAX_ITER] = 10000;
+    collection[current].options->iparam[SICONOS_IPARAM_ACCELERATION] = SICONOS_ACCELERATION_ANDERSON;
+    current++;
+  }
+
+  for(int d =0; d <n_data; d++)
+  {
+    // forced asymm + Anderson acceleration
+    collection[current].filename = data_collection[d];
+    collection[current].options = solver_options_create(SICONOS_FRICTION_3D_ADMM);
+    collection[current].options->dparam[SICONOS_DPARAM_TOL] = 1e-5;
+    collection[current].options->iparam[SICONOS_IPARAM_MAX_ITER] = 10000;
+    collection[current].options->iparam[SICONOS_FRICTION_3D_ADMM_IPARAM_SYMMETRY] = SICONOS_FRICTION_3D_ADMM_FORCED_ASYMMETRY;
+    collection[current].options->iparam[SICONOS_IPARAM_ACCELERATION] = SICONOS_ACCELERATION_ANDERSON;
+    current++;
+  }
+
   *number_of_tests = current;
   return collection;
 
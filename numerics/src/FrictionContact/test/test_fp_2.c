@@ -21,13 +21,14 @@
 #include "Friction_cst.h"                // for SICONOS_FRICTION_3D_TFP, SIC...
 #include "NumericsFwd.h"                 // for SolverOptions
 #include "SolverOptions.h"               // for solver_options_create, Solve...
+#include "fixed_point_acceleration.h"    // for SICONOS_ACCELERATION_NESTEROV
 #include "frictionContact_test_utils.h"  // for build_test_collection
 #include "test_utils.h"                  // for TestCase
 
 TestCase * build_test_collection(int n_data, const char ** data_collection, int* number_of_tests)
 {
 
-  *number_of_tests = 12; //n_data * n_solvers;
+  *number_of_tests = 13; //n_data * n_solvers;
   TestCase * collection = (TestCase*)malloc((*number_of_tests) * sizeof(TestCase));
 
   int current = 0;
@@ -66,6 +67,13 @@ TestCase * build_test_collection(int n_data, const char ** data_collection, int*
   collection[current].options->internalSolvers[0]->iparam[SICONOS_CONVEXQP_PGOC_LINESEARCH_MAX_ITER] = 20;
   current++;
 
+  // Tresca FP, internal = ConvexQP, PG cylinder with Nesterov acceleration.
+  collection[current].filename = data_collection[d];
+  collection[current].options = solver_options_create(SICONOS_FRICTION_3D_TFP);
+  solver_options_update_internal(collection[current].options, 0, SICONOS_FRICTION_3D_CONVEXQP_PG_CYLINDER);
+  collection[current].options->internalSolvers[0]->iparam[SICONOS_IPARAM_ACCELERATION] = SICONOS_ACCELERATION_NESTEROV;
+  current++;
+
   // ========== Confeti-ex13-4contact-Fc3D-SBM.dat ========
   d = 2;
   // Tresca FP
@@ -25,7 +25,7 @@
 
 TestCase * build_test_collection(int n_data, const char ** data_collection, int* number_of_tests)
 {
-  *number_of_tests = 22;//n_data * n_solvers;
+  *number_of_tests = 26;//n_data * n_solvers;
   TestCase * collection = (TestCase*)malloc((*number_of_tests) * sizeof(TestCase));
 
 
@@ -387,6 +387,55 @@ TestCase * build_test_collection(int n_data, const char ** data_collection, int*
     current++;
   }
 
+  {
+    int d = 5; // Confeti-ex03-Fc3D-SBM.dat
+    // mixed precision, default values for other parameters
+    collection[current].filename = data_collection[d];
+    collection[current].options = solver_options_create(topsolver);
+    collection[current].options->dparam[SICONOS_DPARAM_TOL] = 1e-8;
+    collection[current].options->iparam[SICONOS_IPARAM_MAX_ITER] = 10000;
+    collection[current].options->iparam[SICONOS_FRICTION_3D_NSGS_MIXED_PRECISION] = SICONOS_FRICTION_3D_NSGS_MIXED_PRECISION_TRUE;
+    current++;
+  }
+
+  {
+    int d = 8; // KaplasTower-i1061-4.hdf5.dat
+    // mixed precision, the switch to double precision is due to the stagnation
+    collection[current].filename = data_collection[d];
+    collection[current].options = solver_options_create(topsolver);
+    collection[current].options->dparam[SICONOS_DPARAM_TOL] = 1e-8;
+    collection[current].options->iparam[SICONOS_IPARAM_MAX_ITER] = 5000;
+    collection[current].options->iparam[SICONOS_FRICTION_3D_NSGS_MIXED_PRECISION] = SICONOS_FRICTION_3D_NSGS_MIXED_PRECISION_TRUE;
+    collection[current].options->dparam[SICONOS_FRICTION_3D_NSGS_MIXED_PRECISION_TOL] = 1e-8;
+    current++;
+  }
+
+  {
+    int d = 8; // KaplasTower-i1061-4.hdf5.dat
+    // contacts skipped after 3 quiet sweeps, default values for other parameters
+    collection[current].filename = data_collection[d];
+    collection[current].options = solver_options_create(topsolver);
+    collection[current].options->dparam[SICONOS_DPARAM_TOL] = 1e-8;
+    collection[current].options->iparam[SICONOS_IPARAM_MAX_ITER] = 5000;
+    collection[current].options->iparam[SICONOS_FRICTION_3D_NSGS_FREEZING_SWEEPS] = 3;
+    current++;
+  }
+
+  {
+    int d = 5; // Confeti-ex03-Fc3D-SBM.dat
+    // contacts skipped, with shuffle and light error evaluation
+    collection[current].filename = data_collection[d];
+    collection[current].options = solver_options_create(topsolver);
+    collection[current].options->dparam[SICONOS_DPARAM_TOL] = 1e-8;
+    collection[current].options->iparam[SICONOS_IPARAM_MAX_ITER] = 10000;
+    collection[current].options->iparam[SICONOS_FRICTION_3D_NSGS_SHUFFLE] = SICONOS_FRICTION_3D_NSGS_SHUFFLE_TRUE;
+    collection[current].options->iparam[SICONOS_FRICTION_3D_IPARAM_ERROR_EVALUATION] = SICONOS_FRICTION_3D_NSGS_ERROR_EVALUATION_LIGHT;
+    collection[current].options->iparam[SICONOS_FRICTION_3D_NSGS_FREEZING_SWEEPS] = 2;
+    collection[current].options->iparam[SICONOS_FRICTION_3D_NSGS_FULL_SWEEP_FREQUENCY] = 5;
+    collection[current].options->dparam[SICONOS_FRICTION_3D_NSGS_FREEZING_TOL] = 1e-8;
+    current++;
+  }
+
   *number_of_tests = current;
   return collection;
 
@@ -21,13 +21,14 @@
 #include "NumericsFwd.h"                 // for SolverOptions
 #include "SolverOptions.h"               // for solver_options_create, Solve...
 #include "VI_cst.h"                      // for SICONOS_VI_DPARAM_RHO, SICON...
+#include "fixed_point_acceleration.h"    // for SICONOS_ACCELERATION_NESTEROV
 #include "frictionContact_test_utils.h"  // for build_test_collection
 #include "test_utils.h"                  // for TestCase
 
 TestCase * build_test_collection(int n_data, const char ** data_collection, int* number_of_tests)
 {
 
-  *number_of_tests = 8; //n_data * n_solvers;
+  *number_of_tests = 10; //n_data * n_solvers;
   TestCase * collection = (TestCase*)malloc((*number_of_tests) * sizeof(TestCase));
 
   int current = 0;
@@ -50,6 +51,22 @@ TestCase * build_test_collection(int n_data, const char ** data_collection, int*
   collection[current].options->iparam[SICONOS_IPARAM_MAX_ITER] = 10000;
   current++;
 
+  // FPP, Nesterov acceleration
+  collection[current].filename = data_collection[d];
+  collection[current].options = solver_options_create(SICONOS_FRICTION_3D_FPP);
+  collection[current].options->dparam[SICONOS_DPARAM_TOL] = 1e-8;
+  collection[current].options->iparam[SICONOS_IPARAM_MAX_ITER] = 10000;
+  collection[current].options->iparam[SICONOS_IPARAM_ACCELERATION] = SICONOS_ACCELERATION_NESTEROV;
+  current++;
+
+  // FPP, Anderson acceleration
+  collection[current].filename = data_collection[d];
+  collection[current].options = solver_options_create(SICONOS_FRICTION_3D_FPP);
+  collection[current].options->dparam[SICONOS_DPARAM_TOL] = 1e-8;
+  collection[current].options->iparam[SICONOS_IPARAM_MAX_ITER] = 10000;
+  collection[current].options->iparam[SICONOS_IPARAM_ACCELERATION] = SICONOS_ACCELERATION_ANDERSON;
+  current++;
+
   // ========== Confeti-ex13-4contact-Fc3D-SBM.dat ========
   d = 2;
   // EG, rho = -3e-3
@@ -41,7 +41,7 @@ extern "C"
    * \param[in,out] options structure used to define the solver(s) and their parameters
    *               option->iparam[0]:nb max of iterations
    *   option->iparam[SICONOS_GENERIC_MECHANICAL_IPARAM_WITH_LINESEARCH]:0 without 'LS' 1 with.
-   *   option->iparam[SICONOS_GENERIC_MECHANICAL_IPARAM_ISREDUCED]:0 GS block after block, 1 eliminate the equalities, 2 only one equality block, 3 solve the GMP as a MLCP.
+   *   option->iparam[SICONOS_GENERIC_MECHANICAL_IPARAM_ISREDUCED]:0 GS block after block, 1 eliminate the equalities, 2 only one equality block, 3 solve the GMP as a MLCP, 4 GS on the blocks grouped by type.
    *   option->iparam[SICONOS_IPARAM_ITER_DONE]: output, number of GS it.
    *   options->dparam[SICONOS_DPARAM_TOL]: tolerance
    * \return result (0 if successful otherwise 1).
@@ -74,6 +74,13 @@ extern "C"
    */
   void gmp_gauss_seidel(GenericMechanicalProblem* pGMP, double * reaction, double * velocity, int * info, SolverOptions* options);
 
+  /* The global Gauss-Seidel algorithm, with the blocks grouped by type:
+   * equalities, then complementarities, relays and friction contacts.
+   * Each group is swept by a kernel dedicated to its type, the matrix is
+   * never densified and the equalities are factorized once per call.
+   */
+  void gmp_gauss_seidel_by_type(GenericMechanicalProblem* pGMP, double * reaction, double * velocity, int * info, SolverOptions* options);
+
 #if defined(__cplusplus) && !defined(BUILD_AS_CPP)
 }
 #endif
@@ -52,6 +52,7 @@ enum GENERIC_MECHANICAL_ISREDUCED
    SICONOS_GENERIC_MECHANICAL_SUBS_EQUALITIES = 1, // The equalities are substituated
    SICONOS_GENERIC_MECHANICAL_ASSEMBLE_EQUALITIES = 2, // Equalities are assemblated in one block
    SICONOS_GENERIC_MECHANICAL_MLCP_LIKE = 3, // Try to solve like a MLCP (==> No FC3d)
+   SICONOS_GENERIC_MECHANICAL_GS_BY_TYPE = 4, // GS on all blocks, grouped by type
   };
 
 extern const char* const  SICONOS_GENERIC_MECHANICAL_NSGS_STR;
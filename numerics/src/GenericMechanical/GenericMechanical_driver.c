@@ -538,6 +538,11 @@ int gmp_driver(GenericMechanicalProblem* problem, double *reaction, double *velo
       numerics_printf("gmp_driver : call of mlcp\n");
       gmp_as_mlcp(problem, reaction, velocity, &info, options);
     }
+    else if(options->iparam[SICONOS_GENERIC_MECHANICAL_IPARAM_ISREDUCED] == SICONOS_GENERIC_MECHANICAL_GS_BY_TYPE)
+    {
+      numerics_printf("gmp_driver : call of gmp_gauss_seidel_by_type\n");
+      gmp_gauss_seidel_by_type(problem, reaction, velocity, &info, options);
+    }
     else
     {
       numerics_printf("gmp_driver error, options->iparam[SICONOS_GENERIC_MECHANICAL_IPARAM_ISREDUCED] wrong value.\n");
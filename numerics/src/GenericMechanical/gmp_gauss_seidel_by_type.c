@@ -0,0 +1,436 @@
+/* Siconos is a program dedicated to modeling, simulation and control
+ * of non smooth dynamical systems.
+ *
+ * Copyright 2020 INRIA.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+*/
+
+/* Gauss-Seidel on the blocks of a GenericMechanicalProblem, grouped by type.
+ *
+ * The blocks are sorted once per call in contiguous batches (equalities,
+ * then complementarities, relays and friction contacts) and each batch is
+ * swept by a kernel dedicated to its type, chosen once per batch in
+ * gmp_sweep_kernels. The matrix of the GMP is only used through its rows
+ * (NM_row_prod_no_diag) and its diagonal blocks, which are extracted once,
+ * so that a sparse block matrix is never densified. The diagonal blocks of
+ * the equalities are factorized once per call.
+ */
+
+#include <assert.h>                        // for assert
+#include <math.h>                          // for fabs, sqrt, isnan
+#ifndef __cplusplus
+#include <stdbool.h>                       // for false
+#endif
+#include <stdlib.h>                        // for free, malloc, calloc
+#include <string.h>                        // for memcpy
+#include "FrictionContactProblem.h"        // for FrictionContactProblem
+#include "GenericMechanicalProblem.h"      // for listNumericsProblem, Gener...
+#include "GenericMechanical_Solvers.h"     // for gmp_gauss_seidel_by_type
+#include "GenericMechanical_cst.h"         // for SICONOS_DPARAM_GMP_COEFF_LS
+#include "LCP_Solvers.h"                   // for lcp_compute_error_only
+#include "LinearComplementarityProblem.h"  // for LinearComplementarityProblem
+#include "NonSmoothDrivers.h"              // for fc3d_driver, linearComplem...
+#include "NumericsFwd.h"                   // for GenericMechanicalProblem
+#include "NumericsMatrix.h"                // for NM_row_prod_no_diag, NM_ex...
+#include "RelayProblem.h"                  // for RelayProblem
+#include "Relay_Solvers.h"                 // for relay_compute_error
+#include "SiconosBlas.h"                   // for cblas_dnrm2, cblas_dgemv
+#include "SiconosLapack.h"                 // for DGETRF, DGETRS, lapack_int
+#include "SolverOptions.h"                 // for SolverOptions, SICONOS_DPA...
+#include "fc3d_compute_error.h"            // for fc3d_unitary_compute_and_a...
+#include "numerics_verbose.h"              // for numerics_printf_verbose
+
+/* #define DEBUG_STDOUT */
+/* #define DEBUG_MESSAGES */
+#include "debug.h"                         // for DEBUG_PRINTF
+
+/* the order of the batches in a sweep */
+#define GMP_NUMBER_OF_BATCHES 4
+static const int gmp_batch_types[GMP_NUMBER_OF_BATCHES] =
+{
+  SICONOS_NUMERICS_PROBLEM_EQUALITY,
+  SICONOS_NUMERICS_PROBLEM_LCP,
+  SICONOS_NUMERICS_PROBLEM_RELAY,
+  SICONOS_NUMERICS_PROBLEM_FC3D
+};
+
+typedef struct
+{
+  listNumericsProblem* problem;
+  int row;             /* block row number in M */
+  int pos;             /* position of the block in reaction and velocity */
+  double* diagBlock;   /* diagonal block, LU factors for an equality */
+  lapack_int* ipiv;    /* pivots of the LU factors of an equality */
+  int singular;
+} GMPBlock;
+
+typedef struct
+{
+  GenericMechanicalProblem* pGMP;
+  SolverOptions* options;
+  GMPBlock* blocks;
+  int batchStart[GMP_NUMBER_OF_BATCHES + 1];
+  double* diagBuffer;   /* copies of the diagonal blocks (if M is not SBM) */
+  double* luBuffer;     /* LU factors of the equalities */
+  lapack_int* ipivBuffer;
+} GMPBatches;
+
+typedef int (*gmp_sweep_kernel)(GMPBatches* batches, GMPBlock* first, GMPBlock* last,
+                                double* reaction, double* velocity);
+
+/* q of the local problem: q + the products with the off-diagonal blocks.
+ * NM_row_prod_no_diag3 and NM_row_prod_no_diag1x1 cannot be used here since
+ * they assume that all the blocks of the row have the same size. */
+static inline void gmp_local_q(GMPBatches* batches, GMPBlock* blk, double* reaction)
+{
+  GenericMechanicalProblem* pGMP = batches->pGMP;
+  int size = blk->problem->size;
+  double* q = blk->problem->q;
+  memcpy(q, &pGMP->q[blk->pos], size * sizeof(double));
+  NM_row_prod_no_diag(pGMP->size, size, blk->row, blk->pos, pGMP->M, reaction, q, NULL, false);
+}
+
+static int gmp_sweep_equality(GMPBatches* batches, GMPBlock* first, GMPBlock* last,
+                              double* reaction, double* velocity)
+{
+  int failed = 0;
+  for(GMPBlock* blk = first; blk < last; ++blk)
+  {
+    if(blk->singular)
+    {
+      blk->problem->error = 1;
+      failed++;
+      continue;
+    }
+    int size = blk->problem->size;
+    double* sol = reaction + blk->pos;
+    gmp_local_q(batches, blk, reaction);
+    for(int i = 0; i < size; ++i)
+      sol[i] = -blk->problem->q[i];
+    lapack_int info = 0;
+    DGETRS(LA_NOTRANS, size, 1, blk->diagBlock, size, blk->ipiv, sol, size, &info);
+    blk->problem->error = 0;
+  }
+  return failed;
+}
+
+static int gmp_sweep_lcp(GMPBatches* batches, GMPBlock* first, GMPBlock* last,
+                         double* reaction, double* velocity)
+{
+  int failed = 0;
+  SolverOptions* localOptions = batches->options->internalSolvers[0];
+  for(GMPBlock* blk = first; blk < last; ++blk)
+  {
+    double* sol = reaction + blk->pos;
+    double* w = velocity + blk->pos;
+    gmp_local_q(batches, blk, reaction);
+    blk->problem->error = 0;
+    if(blk->problem->size == 1 && blk->diagBlock[0] > 0.)
+    {
+      /* unilateral constraint: the solution is explicit */
+      double q = blk->problem->q[0];
+      sol[0] = (q < 0.) ? -q / blk->diagBlock[0] : 0.;
+      w[0] = blk->diagBlock[0] * sol[0] + q;
+    }
+    else
+    {
+      LinearComplementarityProblem* lcpProblem = (LinearComplementarityProblem*) blk->problem->problem;
+      lcpProblem->M->matrix0 = blk->diagBlock;
+      if(linearComplementarity_driver(lcpProblem, sol, w, localOptions))
+      {
+        blk->problem->error = 1;
+        failed++;
+      }
+    }
+  }
+  return failed;
+}
+
+static int gmp_sweep_relay(GMPBatches* batches, GMPBlock* first, GMPBlock* last,
+                           double* reaction, double* velocity)
+{
+  int failed = 0;
+  SolverOptions* localOptions = batches->options->internalSolvers[2];
+  for(GMPBlock* blk = first; blk < last; ++blk)
+  {
+    RelayProblem* relayProblem = (RelayProblem*) blk->problem->problem;
+    relayProblem->M->matrix0 = blk->diagBlock;
+    gmp_local_q(batches, blk, reaction);
+    blk->problem->error = 0;
+    if(relay_driver(relayProblem, reaction + blk->pos, velocity + blk->pos, localOptions))
+    {
+      blk->problem->error = 1;
+      failed++;
+    }
+  }
+  return failed;
+}
+
+static int gmp_sweep_fc3d(GMPBatches* batches, GMPBlock* first, GMPBlock* last,
+                          double* reaction, double* velocity)
+{
+  int failed = 0;
+  SolverOptions* localOptions = batches->options->internalSolvers[1];
+  for(GMPBlock* blk = first; blk < last; ++blk)
+  {
+    FrictionContactProblem* fcProblem = (FrictionContactProblem*) blk->problem->problem;
+    fcProblem->M->matrix0 = blk->diagBlock;
+    gmp_local_q(batches, blk, reaction);
+    blk->problem->error = 0;
+    if(fc3d_driver(fcProblem, reaction + blk->pos, velocity + blk->pos, localOptions))
+    {
+      blk->problem->error = 1;
+      failed++;
+    }
+  }
+  return failed;
+}
+
+static const gmp_sweep_kernel gmp_sweep_kernels[GMP_NUMBER_OF_BATCHES] =
+{
+  gmp_sweep_equality,
+  gmp_sweep_lcp,
+  gmp_sweep_relay,
+  gmp_sweep_fc3d
+};
+
+/* Same criterion as gmp_compute_error, with velocity = M reaction + q
+ * computed with a single product */
+static int gmp_batches_compute_error(GMPBatches* batches, double* reaction, double* velocity,
+                                     double tol, double* err)
+{
+  GenericMechanicalProblem* pGMP = batches->pGMP;
+  *err = 0.;
+  memcpy(velocity, pGMP->q, pGMP->size * sizeof(double));
+  NM_gemv(1.0, pGMP->M, reaction, 1.0, velocity);
+  for(int i = 0; i < pGMP->size; ++i)
+    if(isnan(velocity[i]) || isnan(reaction[i]))
+    {
+      *err = 10;
+      return 1;
+    }
+
+  for(int b = 0; b < GMP_NUMBER_OF_BATCHES; ++b)
+  {
+    int type = gmp_batch_types[b];
+    for(GMPBlock* blk = &batches->blocks[batches->batchStart[b]];
+        blk < &batches->blocks[batches->batchStart[b + 1]]; ++blk)
+    {
+      int size = blk->problem->size;
+      double* r = reaction + blk->pos;
+      double* w = velocity + blk->pos;
+      double localError = 0.;
+      if(type == SICONOS_NUMERICS_PROBLEM_EQUALITY)
+      {
+        for(int i = 0; i < size; ++i)
+          localError = fmax(localError, fabs(w[i]));
+        *err = fmax(*err, localError);
+        continue;
+      }
+      /* local q = w - D r */
+      double* q = blk->problem->q;
+      memcpy(q, w, size * sizeof(double));
+      cblas_dgemv(CblasColMajor, CblasNoTrans, size, size, -1.0, blk->diagBlock, size, r, 1, 1.0, q, 1);
+      double normq = cblas_dnrm2(size, q, 1);
+      if(type == SICONOS_NUMERICS_PROBLEM_LCP)
+      {
+        lcp_compute_error_only(size, r, w, &localError);
+        localError /= 1 + normq;
+      }
+      else if(type == SICONOS_NUMERICS_PROBLEM_RELAY)
+      {
+        RelayProblem* relayProblem = (RelayProblem*) blk->problem->problem;
+        relayProblem->M->matrix0 = blk->diagBlock;
+        relay_compute_error(relayProblem, r, w, batches->options->dparam[SICONOS_DPARAM_TOL], &localError);
+        localError /= 1 + normq;
+      }
+      else
+      {
+        double worktmp[3];
+        FrictionContactProblem* fcProblem = (FrictionContactProblem*) blk->problem->problem;
+        fc3d_unitary_compute_and_add_error(r, w, fcProblem->mu[0], &localError, worktmp);
+        localError = sqrt(localError) / (1 + normq);
+      }
+      *err = fmax(*err, localError);
+    }
+  }
+  return *err > tol;
+}
+
+static void gmp_batches_init(GMPBatches* batches, GenericMechanicalProblem* pGMP, SolverOptions* options)
+{
+  int storageType = pGMP->M->storageType;
+  int nbBlocks = 0;
+  int count[GMP_NUMBER_OF_BATCHES] = {0};
+  size_t diagSize = 0;
+  size_t luSize = 0;
+  size_t ipivSize = 0;
+
+  batches->pGMP = pGMP;
+  batches->options = options;
+  for(listNumericsProblem* cur = pGMP->firstListElem; cur; cur = cur->nextProblem)
+  {
+    int b = 0;
+    while(b < GMP_NUMBER_OF_BATCHES && gmp_batch_types[b] != cur->type)
+      b++;
+    if(b == GMP_NUMBER_OF_BATCHES)
+      numerics_error("gmp_gauss_seidel_by_type", "unknown problem type %d", cur->type);
+    count[b]++;
+    nbBlocks++;
+    diagSize += cur->size * cur->size;
+    if(cur->type == SICONOS_NUMERICS_PROBLEM_EQUALITY)
+    {
+      luSize += cur->size * cur->size;
+      ipivSize += cur->size;
+    }
+  }
+
+  batches->batchStart[0] = 0;
+  for(int b = 0; b < GMP_NUMBER_OF_BATCHES; ++b)
+    batches->batchStart[b + 1] = batches->batchStart[b] + count[b];
+
+  batches->blocks = (GMPBlock*) malloc(nbBlocks * sizeof(GMPBlock));
+  batches->diagBuffer = (storageType != NM_SPARSE_BLOCK) ? (double*) malloc(diagSize * sizeof(double)) : NULL;
+  batches->luBuffer = luSize ? (double*) malloc(luSize * sizeof(double)) : NULL;
+  batches->ipivBuffer = ipivSize ? (lapack_int*) malloc(ipivSize * sizeof(lapack_int)) : NULL;
+
+  int next[GMP_NUMBER_OF_BATCHES];
+  for(int b = 0; b < GMP_NUMBER_OF_BATCHES; ++b)
+    next[b] = batches->batchStart[b];
+  double* diag = batches->diagBuffer;
+  double* lu = batches->luBuffer;
+  lapack_int* ipiv = batches->ipivBuffer;
+  int row = 0;
+  int pos = 0;
+  for(listNumericsProblem* cur = pGMP->firstListElem; cur; cur = cur->nextProblem)
+  {
+    int size = cur->size;
+    int b = 0;
+    while(gmp_batch_types[b] != cur->type)
+      b++;
+    GMPBlock* blk = &batches->blocks[next[b]++];
+    blk->problem = cur;
+    blk->row = row;
+    blk->pos = pos;
+    blk->ipiv = NULL;
+    blk->singular = 0;
+    if(storageType != NM_SPARSE_BLOCK)
+    {
+      NM_extract_diag_block(pGMP->M, row, pos, size, &diag);
+      blk->diagBlock = diag;
+      diag += size * size;
+    }
+    else
+      NM_extract_diag_block(pGMP->M, row, pos, size, &blk->diagBlock);
+
+    if(cur->type == SICONOS_NUMERICS_PROBLEM_EQUALITY)
+    {
+      /* the factors replace the diagonal block, which is not used elsewhere */
+      memcpy(lu, blk->diagBlock, size * size * sizeof(double));
+      lapack_int info = 0;
+      DGETRF(size, size, lu, size, ipiv, &info);
+      blk->singular = (info != 0);
+      blk->diagBlock = lu;
+      blk->ipiv = ipiv;
+      lu += size * size;
+      ipiv += size;
+    }
+    pos += size;
+    row++;
+  }
+}
+
+static void gmp_batches_free(GMPBatches* batches)
+{
+  free(batches->blocks);
+  free(batches->diagBuffer);
+  free(batches->luBuffer);
+  free(batches->ipivBuffer);
+}
+
+void gmp_gauss_seidel_by_type(GenericMechanicalProblem* pGMP, double * reaction, double * velocity, int * info,
+                              SolverOptions* options)
+{
+  DEBUG_BEGIN("gmp_gauss_seidel_by_type(...)\n");
+  int iterMax = options->iparam[SICONOS_IPARAM_MAX_ITER];
+  double tol = options->dparam[SICONOS_DPARAM_TOL];
+  double * err = &(options->dparam[SICONOS_DPARAM_RESIDU]);
+  double * errLS = &(options->dparam[SICONOS_DPARAM_GMP_ERROR_LS]);
+  int withLS = options->iparam[SICONOS_GENERIC_MECHANICAL_IPARAM_WITH_LINESEARCH];
+  double * pCoefLS = &(options->dparam[SICONOS_DPARAM_GMP_COEFF_LS]);
+  int tolViolate = 1;
+  int failed = 0;
+  int it = 0;
+
+  GMPBatches batches;
+  gmp_batches_init(&batches, pGMP, options);
+
+  double * pPrevReaction = options->dWork ? options->dWork
+                           : (double *) malloc(gmp_get_nb_dwork(pGMP, options) * sizeof(double));
+  double * pBuffVelocity = pPrevReaction + pGMP->size;
+
+  while(it < iterMax && tolViolate)
+  {
+    memcpy(pPrevReaction, reaction, pGMP->size * sizeof(double));
+    failed = 0;
+    for(int b = 0; b < GMP_NUMBER_OF_BATCHES; ++b)
+      failed += gmp_sweep_kernels[b](&batches, &batches.blocks[batches.batchStart[b]],
+                                     &batches.blocks[batches.batchStart[b + 1]], reaction, velocity);
+
+    if(withLS)
+    {
+      tolViolate = gmp_batches_compute_error(&batches, reaction, pBuffVelocity, tol, err);
+      for(int i = 0; i < pGMP->size; i++)
+        pPrevReaction[i] = reaction[i] + (*pCoefLS) * (reaction[i] - pPrevReaction[i]);
+      int tolViolateLS = gmp_batches_compute_error(&batches, pPrevReaction, velocity, tol, errLS);
+      if(*errLS < *err)
+      {
+        if((*pCoefLS) < 10.0)
+          (*pCoefLS) = 1.0 + (*pCoefLS);
+        memcpy(reaction, pPrevReaction, pGMP->size * sizeof(double));
+        tolViolate = tolViolateLS;
+        *err = *errLS;
+      }
+      else
+      {
+        *pCoefLS = 1.0;
+        memcpy(velocity, pBuffVelocity, pGMP->size * sizeof(double));
+      }
+    }
+    else
+      tolViolate = gmp_batches_compute_error(&batches, reaction, velocity, tol, err);
+
+    numerics_printf_verbose(1, "--------------- GMP - GS by type - Iteration %i Residual = %14.7e <= %7.3e",
+                            it, *err, tol);
+    it++;
+  }
+
+  options->iparam[SICONOS_IPARAM_ITER_DONE] = it;
+  if(tolViolate)
+    numerics_printf_verbose(1, "gmp_gauss_seidel_by_type failed with Iteration %i Residual = %14.7e <= %7.3e",
+                            it, *err, tol);
+  if(failed && verbose)
+  {
+    for(int k = 0; k < batches.batchStart[GMP_NUMBER_OF_BATCHES]; ++k)
+      if(batches.blocks[k].problem->error)
+        numerics_printf("gmp_gauss_seidel_by_type: local solver FAILED row %d of type %s",
+                        batches.blocks[k].row, ns_problem_id_to_name(batches.blocks[k].problem->type));
+  }
+
+  if(!options->dWork)
+    free(pPrevReaction);
+  gmp_batches_free(&batches);
+  *info = tolViolate;
+  DEBUG_END("gmp_gauss_seidel_by_type(...)\n");
+}
@@ -28,9 +28,9 @@
 TestCase * build_test_collection(int n_data, const char ** data_collection, int* number_of_tests)
 {
 #ifdef HAS_LAPACK_dgesvd
-  int n_solvers = 10;
+  int n_solvers = 11;
 #else
-  int n_solvers = 9;
+  int n_solvers = 10;
 #endif
   *number_of_tests = n_data * n_solvers;
   TestCase * collection = (TestCase*)malloc((*number_of_tests) * sizeof(TestCase));
@@ -181,6 +181,19 @@ TestCase * build_test_collection(int n_data, const char ** data_collection, int*
     current++;
   }
 
+  for(int d =0; d <n_data; d++)
+  {
+    // internal = fc3d quartic, blocks grouped by type.
+    collection[current].filename = data_collection[d];
+    collection[current].options = solver_options_create(topsolver);
+    collection[current].options->dparam[SICONOS_DPARAM_TOL] = 1e-5;
+    collection[current].options->iparam[SICONOS_IPARAM_MAX_ITER] = 10000;
+    collection[current].options->iparam[SICONOS_GENERIC_MECHANICAL_IPARAM_ISREDUCED] = SICONOS_GENERIC_MECHANICAL_GS_BY_TYPE;
+
+    solver_options_update_internal(collection[current].options, 1, SICONOS_FRICTION_3D_ONECONTACT_QUARTIC);
+    current++;
+  }
+
   *number_of_tests = current;
 
 
@@ -196,6 +209,8 @@ TestCase * build_test_collection(int n_data, const char ** data_collection, int*
   collection[58].will_fail = 1;
   collection[59].will_fail = 1;
   collection[65].will_fail = 1;
+  collection[72].will_fail = 1; // GMP5.dat, GS by type
+  collection[73].will_fail = 1; // GMP6.dat, GS by type
 #else
   collection[5].will_fail = 1;
   collection[6].will_fail = 1;
@@ -205,6 +220,8 @@ TestCase * build_test_collection(int n_data, const char ** data_collection, int*
   collection[51].will_fail = 1;
   collection[52].will_fail = 1;
   collection[58].will_fail = 1;
+  collection[65].will_fail = 1; // GMP5.dat, GS by type
+  collection[66].will_fail = 1; // GMP6.dat, GS by type
 
 #endif
 
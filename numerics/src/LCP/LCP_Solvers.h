@@ -282,6 +282,25 @@ extern "C"
   void lcp_pivot_lumod(LinearComplementarityProblem* problem, double *z, double *w, int *info, SolverOptions* options);
   void lcp_pivot_lumod_covering_vector(LinearComplementarityProblem* problem, double* u , double* s, int *info , SolverOptions* options, double* cov_vec);
 
+  /** lcp_block_pivot is a direct solver for LCP based on the block principal
+   * pivoting method of Judice and Pires. All the infeasible indices are exchanged
+   * at once as long as their number decreases, otherwise a single pivot is done
+   * on the largest infeasible index (backup rule of Judice and Pires, not Murty's
+   * least-index rule). M is never densified: principal submatrices are
+   * factorized with the sparse LU of NumericsMatrix (M may be dense, sparse or
+   * sparse block) and updated with a block-LU (Schur complement) technique
+   * between two factorizations. Suited to large sparse LCP with a P-matrix.
+   * The support of the given z is used as a starting point.
+   * \param[in] problem structure that represents the LCP (M, q...)
+   * \param[in,out] z a n-vector of doubles which contains the initial solution and returns the solution of the problem.
+   * \param[in,out] w a n-vector of doubles which returns the solution of the problem.
+   * \param[out] info an integer which returns the termination value:
+   * 0 : convergence
+   * 1 : iter = itermax or singular principal submatrix
+   * \param[in,out] options structure used to define the solver and its parameters.
+   */
+  void lcp_block_pivot(LinearComplementarityProblem* problem, double *z, double *w, int *info, SolverOptions* options);
+
   /** lcp_pathsearch is a direct solver for LCP based on the pathsearch algorithm
    * \warning this solver is available for testing purposes only! consider
    * using lcp_pivot() if you are looking for simular solvers
@@ -400,6 +419,7 @@ extern "C"
   void lcp_pivot_set_default(SolverOptions* options);
   void lcp_pathsearch_set_default(SolverOptions* options);
   void lcp_pivot_lumod_set_default(SolverOptions* options);
+  void lcp_block_pivot_set_default(SolverOptions* options);
   /** @} */
   
   
@@ -53,6 +53,7 @@ const char* const   SICONOS_LCP_PATHSEARCH_STR = "For testing only: solver used
 const char* const   SICONOS_LCP_PIVOT_LUMOD_STR = "Pivot based method with BLU updates using LUMOD";
 const char* const   SICONOS_LCP_GAMS_STR = "Using GAMS solvers";
 const char* const   SICONOS_LCP_CONVEXQP_PG_STR = "Convex QP Projected Gradient";
+const char* const   SICONOS_LCP_BLOCK_PIVOT_STR = "Block principal pivoting method with sparse LU and BLU updates";
 
 static int lcp_driver_SparseBlockMatrix(LinearComplementarityProblem* problem, double *z, double *w, SolverOptions* options);
 
@@ -113,6 +114,9 @@ int lcp_driver_SparseBlockMatrix(LinearComplementarityProblem* problem, double *
   /****** Gauss Seidel block solver ******/
   if((options->solverId) == SICONOS_LCP_NSGS_SBM)
     lcp_nsgs_SBM(problem, z, w, &info, options);
+  /****** Block principal pivoting, on the sparse matrix ******/
+  else if((options->solverId) == SICONOS_LCP_BLOCK_PIVOT)
+    lcp_block_pivot(problem, z, w, &info, options);
   else
   {
     fprintf(stderr, "LCP_driver_SparseBlockMatrix error: unknown solver named: %s\n", solver_options_id_to_name(options->solverId));
@@ -326,6 +330,9 @@ int lcp_driver_DenseMatrix(LinearComplementarityProblem* problem, double *z, dou
   case SICONOS_LCP_CONVEXQP_PG:
     lcp_ConvexQP_ProjectedGradient(problem, z, w, &info, options);
     break;
+  case SICONOS_LCP_BLOCK_PIVOT:
+    lcp_block_pivot(problem, z, w, &info, options);
+    break;
   default:
   {
     fprintf(stderr, "lcp_driver_DenseMatrix error: unknown solver name: %s\n", solver_options_id_to_name(options->solverId));
@@ -0,0 +1,450 @@
+/* Siconos is a program dedicated to modeling, simulation and control
+ * of non smooth dynamical systems.
+ *
+ * Copyright 2020 INRIA.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+*/
+
+/* Block principal pivoting method for the LCP, in the spirit of
+ * J.J. Júdice and F.M. Pires, "A block principal pivoting algorithm for
+ * large-scale strictly monotone linear complementarity problems",
+ * Computers & Operations Research 21(5), 1994.
+ *
+ * At each iteration, the set of indices F where z may be nonzero defines
+ * the complementary basic solution
+ *
+ *   M_FF z_F = -q_F, z_G = 0, w_F = 0, w_G = M_GF z_F + q_G.
+ *
+ * All the infeasible indices (z_i < 0 for i in F, w_i < 0 for i in G) are
+ * exchanged between F and G as long as their number decreases, with a
+ * limited number of trials. Otherwise, a single pivot is done on the
+ * largest infeasible index (backup rule of Judice and Pires), which ensures
+ * the finite termination for P-matrices.
+ *
+ * The matrix M is never densified. M_{B0B0} is factorized with the sparse LU
+ * of NumericsMatrix for a base set B0 and the current set F is handled as in
+ * the block-LU update of LUMOD: the indices added to B0 and removed from it
+ * form the border of the bordered system
+ *
+ *  | M_{B0B0}  B | | x0 |   | -q_{B0} |
+ *  |           | |    | = |         |
+ *  |    C      D | | x1 |   |   r1    |
+ *
+ * where, for an added index a, B e_a = M_{B0,a}, C^T e_a = M_{a,B0},
+ * D_{aa'} = M_{aa'} and r1_a = -q_a and, for a removed index d,
+ * B e_d = e_d (z_d becomes the multiplier of the equation d, which is
+ * relaxed), C^T e_d = e_d and r1_d = 0. This system is solved with the
+ * Schur complement S = D - C M_{B0B0}^{-1} B, which is small and dense.
+ * The columns of M_{B0B0}^{-1} B are kept from one iteration to the next,
+ * so that each change of F costs one sparse solve. When the border is
+ * larger than iparam[SICONOS_LCP_IPARAM_BLOCK_PIVOT_MAX_UPDATES], M_FF is
+ * factorized and becomes the new base.
+ */
+
+#include <assert.h>                        // for assert
+#include <float.h>                         // for DBL_EPSILON
+#include <math.h>                          // for fabs
+#include <stdlib.h>                        // for free, malloc, calloc
+#include <string.h>                        // for memcpy
+#include "CSparseMatrix_internal.h"        // for CSparseMatrix, CS_INT
+#include "LCP_Solvers.h"                   // for lcp_compute_error, lcp_blo...
+#include "LinearComplementarityProblem.h"  // for LinearComplementarityProblem
+#include "NumericsFwd.h"                   // for SolverOptions, LinearCompl...
+#include "NumericsMatrix.h"                // for NumericsMatrix, NM_create
+#include "NumericsSparseMatrix.h"          // for NSM_CSC, NumericsSparseMatrix
+#include "SiconosBlas.h"                   // for cblas_dgemv, CblasColMajor
+#include "SiconosLapack.h"                 // for DGESV, lapack_int
+#include "SolverOptions.h"                 // for SolverOptions, SICONOS_DPA...
+#include "lcp_cst.h"                       // for SICONOS_LCP_IPARAM_BLOCK_P...
+#include "numerics_verbose.h"              // for numerics_printf_verbose
+//#define DEBUG_STDOUT
+//#define DEBUG_MESSAGES
+#include "debug.h"                         // for DEBUG_PRINTF
+
+typedef struct
+{
+  int n;
+  CSparseMatrix* M;   /* M in csc format (columns of M) */
+  CSparseMatrix* Mt;  /* M^T in csc format (rows of M) */
+  /* base set B0 and the factorized M_{B0B0} */
+  int n0;
+  int* base;          /* base[k] : k-th index of B0 */
+  int* pos0;          /* pos0[i] : position of i in B0 or -1 */
+  NumericsMatrix* A0;
+  /* border: indices added to B0 or removed from it */
+  int k;
+  int kmax;
+  int* border;        /* border[l] : l-th index of the border */
+  int* borderPos;     /* borderPos[i] : position of i in the border or -1 */
+  double* W;          /* M_{B0B0}^{-1} B, n0 x kmax */
+  double* S;          /* Schur complement, kmax x kmax */
+  lapack_int* ipiv;
+  double* x1;         /* kmax */
+  double* y;          /* n0 */
+  int nfact;
+} LCPBlockPivotLU;
+
+/* M_ij, read in the row i of M */
+static double bp_Mij(LCPBlockPivotLU* lu, int i, int j)
+{
+  CSparseMatrix* Mt = lu->Mt;
+  for(CS_INT p = Mt->p[i]; p < Mt->p[i + 1]; ++p)
+    if(Mt->i[p] == j)
+      return Mt->x[p];
+  return 0.;
+}
+
+/* C_l . v where l is the position of i in the border and v a n0-vector */
+static double bp_Cdot(LCPBlockPivotLU* lu, int i, double* v)
+{
+  if(lu->pos0[i] >= 0)
+    return v[lu->pos0[i]];
+  double s = 0.;
+  CSparseMatrix* Mt = lu->Mt;
+  for(CS_INT p = Mt->p[i]; p < Mt->p[i + 1]; ++p)
+  {
+    int pj = lu->pos0[Mt->i[p]];
+    if(pj >= 0)
+      s += Mt->x[p] * v[pj];
+  }
+  return s;
+}
+
+/* y = M_{B0B0}^{-1} y, with the factors kept in A0 */
+static int bp_base_solve(LCPBlockPivotLU* lu, double* y)
+{
+  if(lu->n0 == 0)
+    return 0;
+  return NM_gesv_expert(lu->A0, y, NM_KEEP_FACTORS);
+}
+
+/* set the base B0 to the indices i such that inF[i] is true and
+ * factorize M_{B0B0}. The border is emptied. */
+static int bp_factorize(LCPBlockPivotLU* lu, int* inF)
+{
+  int n = lu->n;
+  CSparseMatrix* M = lu->M;
+
+  if(lu->A0)
+  {
+    NM_clear(lu->A0);
+    free(lu->A0);
+    lu->A0 = NULL;
+  }
+  for(int l = 0; l < lu->k; ++l)
+    lu->borderPos[lu->border[l]] = -1;
+  lu->k = 0;
+
+  int n0 = 0;
+  for(int i = 0; i < n; ++i)
+  {
+    if(inF[i])
+    {
+      lu->pos0[i] = n0;
+      lu->base[n0++] = i;
+    }
+    else
+      lu->pos0[i] = -1;
+  }
+  lu->n0 = n0;
+  if(n0 == 0)
+    return 0;
+
+  CS_INT nnz = 0;
+  for(int c = 0; c < n0; ++c)
+  {
+    int j = lu->base[c];
+    for(CS_INT p = M->p[j]; p < M->p[j + 1]; ++p)
+      if(lu->pos0[M->i[p]] >= 0)
+        nnz++;
+  }
+
+  lu->A0 = NM_create(NM_SPARSE, n0, n0);
+  NM_csc_alloc(lu->A0, nnz);
+  lu->A0->matrix2->origin = NSM_CSC;
+  CSparseMatrix* A0 = lu->A0->matrix2->csc;
+  nnz = 0;
+  for(int c = 0; c < n0; ++c)
+  {
+    int j = lu->base[c];
+    A0->p[c] = nnz;
+    for(CS_INT p = M->p[j]; p < M->p[j + 1]; ++p)
+    {
+      int r = lu->pos0[M->i[p]];
+      if(r >= 0)
+      {
+        A0->i[nnz] = r;
+        A0->x[nnz++] = M->x[p];
+      }
+    }
+  }
+  A0->p[n0] = nnz;
+  lu->nfact++;
+
+  /* the factorization is done and kept at the first solve */
+  for(int c = 0; c < n0; ++c)
+    lu->y[c] = 0.;
+  return bp_base_solve(lu, lu->y);
+}
+
+/* add the index i to the border or remove it */
+static int bp_toggle(LCPBlockPivotLU* lu, int i)
+{
+  int n0 = lu->n0;
+  int l = lu->borderPos[i];
+  if(l >= 0)
+  {
+    /* i comes back to its state in B0: the last element of the border
+     * takes its place */
+    int last = --lu->k;
+    if(l != last)
+    {
+      lu->border[l] = lu->border[last];
+      lu->borderPos[lu->border[l]] = l;
+      memcpy(&lu->W[l * n0], &lu->W[last * n0], n0 * sizeof(double));
+    }
+    lu->borderPos[i] = -1;
+    return 0;
+  }
+
+  assert(lu->k < lu->kmax);
+  l = lu->k++;
+  lu->border[l] = i;
+  lu->borderPos[i] = l;
+  if(n0 == 0)
+    return 0;
+
+  double* w = &lu->W[l * n0];
+  for(int c = 0; c < n0; ++c)
+    w[c] = 0.;
+  if(lu->pos0[i] >= 0)
+    w[lu->pos0[i]] = 1.;
+  else
+  {
+    CSparseMatrix* M = lu->M;
+    for(CS_INT p = M->p[i]; p < M->p[i + 1]; ++p)
+    {
+      int r = lu->pos0[M->i[p]];
+      if(r >= 0)
+        w[r] = M->x[p];
+    }
+  }
+  return bp_base_solve(lu, w);
+}
+
+/* solve the current bordered system, z is set on all indices */
+static int bp_solve(LCPBlockPivotLU* lu, double* q, double* z)
+{
+  int n0 = lu->n0;
+  int k = lu->k;
+  double* y = lu->y;
+
+  for(int c = 0; c < n0; ++c)
+    y[c] = -q[lu->base[c]];
+  if(bp_base_solve(lu, y))
+    return 1;
+
+  if(k > 0)
+  {
+    double* S = lu->S;
+    double* x1 = lu->x1;
+    for(int l = 0; l < k; ++l)
+    {
+      int i = lu->border[l];
+      for(int m = 0; m < k; ++m)
+      {
+        int j = lu->border[m];
+        double d = (lu->pos0[i] < 0 && lu->pos0[j] < 0) ? bp_Mij(lu, i, j) : 0.;
+        S[l + m * k] = d - ((n0 > 0) ? bp_Cdot(lu, i, &lu->W[m * n0]) : 0.);
+      }
+      x1[l] = ((lu->pos0[i] < 0) ? -q[i] : 0.) - ((n0 > 0) ? bp_Cdot(lu, i, y) : 0.);
+    }
+    lapack_int infoLA = 0;
+    DGESV(k, 1, S, k, lu->ipiv, x1, k, &infoLA);
+    if(infoLA)
+      return 1;
+    if(n0 > 0)
+      cblas_dgemv(CblasColMajor, CblasNoTrans, n0, k, -1.0, lu->W, n0, x1, 1, 1.0, y, 1);
+  }
+
+  for(int i = 0; i < lu->n; ++i)
+    z[i] = 0.;
+  for(int c = 0; c < n0; ++c)
+    if(lu->borderPos[lu->base[c]] < 0)
+      z[lu->base[c]] = y[c];
+  for(int l = 0; l < k; ++l)
+    if(lu->pos0[lu->border[l]] < 0)
+      z[lu->border[l]] = lu->x1[l];
+  return 0;
+}
+
+void lcp_block_pivot(LinearComplementarityProblem* problem, double *z, double *w, int *info, SolverOptions* options)
+{
+  int n = problem->size;
+  double* q = problem->q;
+  int itermax = options->iparam[SICONOS_IPARAM_MAX_ITER];
+  double tol = options->dparam[SICONOS_DPARAM_TOL];
+  int pmax = options->iparam[SICONOS_LCP_IPARAM_BLOCK_PIVOT_MAX_TRIALS];
+  int kmax = options->iparam[SICONOS_LCP_IPARAM_BLOCK_PIVOT_MAX_UPDATES];
+  if(kmax < 1)
+    kmax = 1;
+
+  *info = 1;
+  options->iparam[SICONOS_IPARAM_ITER_DONE] = 0;
+  options->iparam[SICONOS_LCP_IPARAM_BLOCK_PIVOT_FACTORIZATIONS] = 0;
+  if(n == 0)
+  {
+    *info = 0;
+    return;
+  }
+
+  /* M in csc format. For dense or sparse block storages, a copy is built at
+   * each call, since the values of M may change between two calls */
+  NumericsMatrix* Msparse = problem->M;
+  if(problem->M->storageType != NM_SPARSE)
+  {
+    Msparse = NM_create(NM_SPARSE, n, n);
+    NM_copy_to_sparse(problem->M, Msparse);
+  }
+
+  LCPBlockPivotLU lu;
+  lu.n = n;
+  lu.M = NM_csc(Msparse);
+  lu.Mt = NM_csc_trans(Msparse);
+  lu.n0 = 0;
+  lu.base = (int*)malloc(n * sizeof(int));
+  lu.pos0 = (int*)malloc(n * sizeof(int));
+  lu.A0 = NULL;
+  lu.k = 0;
+  lu.kmax = kmax;
+  lu.border = (int*)malloc(kmax * sizeof(int));
+  lu.borderPos = (int*)malloc(n * sizeof(int));
+  lu.W = (double*)malloc((size_t)n * kmax * sizeof(double));
+  lu.S = (double*)malloc((size_t)kmax * kmax * sizeof(double));
+  lu.ipiv = (lapack_int*)malloc(kmax * sizeof(lapack_int));
+  lu.x1 = (double*)malloc(kmax * sizeof(double));
+  lu.y = (double*)malloc(n * sizeof(double));
+  lu.nfact = 0;
+  for(int i = 0; i < n; ++i)
+    lu.borderPos[i] = -1;
+
+  int* inF = (int*)malloc(n * sizeof(int));
+  int* infeasible = (int*)malloc(n * sizeof(int));
+
+  /* warm start from the support of the given z */
+  for(int i = 0; i < n; ++i)
+    inF[i] = (z[i] > 0.);
+
+  int failed = bp_factorize(&lu, inF);
+  int iter = 0;
+  int p = pmax;
+  int ninfBest = n + 1;
+  while(!failed && iter < itermax)
+  {
+    failed = bp_solve(&lu, q, z);
+    if(failed)
+      break;
+
+    /* w = M z + q, with w_F = 0 */
+    memcpy(w, q, n * sizeof(double));
+    NM_gemv(1.0, Msparse, z, 1.0, w);
+
+    int ninf = 0;
+    for(int i = 0; i < n; ++i)
+    {
+      if(inF[i])
+      {
+        w[i] = 0.;
+        if(z[i] < -tol)
+          infeasible[ninf++] = i;
+      }
+      else if(w[i] < -tol)
+        infeasible[ninf++] = i;
+    }
+    DEBUG_PRINTF("lcp_block_pivot: iteration %i, %i infeasibilities\n", iter, ninf);
+    numerics_printf_verbose(2, "lcp_block_pivot: iteration %i, %i infeasibilities, base of size %i, border of size %i",
+                            iter, ninf, lu.n0, lu.k);
+    if(ninf == 0)
+    {
+      *info = 0;
+      break;
+    }
+    iter++;
+
+    int nexchange = ninf;
+    if(ninf < ninfBest)
+    {
+      ninfBest = ninf;
+      p = pmax;
+    }
+    else if(p > 0)
+      p--;
+    else
+    {
+      /* single pivot on the largest infeasible index */
+      infeasible[0] = infeasible[ninf - 1];
+      nexchange = 1;
+    }
+
+    int newk = lu.k;
+    for(int e = 0; e < nexchange; ++e)
+    {
+      int i = infeasible[e];
+      inF[i] = !inF[i];
+      newk += (lu.borderPos[i] >= 0) ? -1 : 1;
+    }
+    if(newk > kmax)
+      failed = bp_factorize(&lu, inF);
+    else
+      for(int e = 0; e < nexchange && !failed; ++e)
+        failed = bp_toggle(&lu, infeasible[e]);
+  }
+
+  if(failed)
+    numerics_printf_verbose(1, "lcp_block_pivot: the factorization of a principal submatrix of M failed");
+
+  options->iparam[SICONOS_IPARAM_ITER_DONE] = iter;
+  options->iparam[SICONOS_LCP_IPARAM_BLOCK_PIVOT_FACTORIZATIONS] = lu.nfact;
+  lcp_compute_error(problem, z, w, tol, &options->dparam[SICONOS_DPARAM_RESIDU]);
+  numerics_printf_verbose(1, "lcp_block_pivot: %i iterations, %i factorizations, error = %e",
+                          iter, lu.nfact, options->dparam[SICONOS_DPARAM_RESIDU]);
+
+  if(lu.A0)
+  {
+    NM_clear(lu.A0);
+    free(lu.A0);
+  }
+  free(lu.base);
+  free(lu.pos0);
+  free(lu.border);
+  free(lu.borderPos);
+  free(lu.W);
+  free(lu.S);
+  free(lu.ipiv);
+  free(lu.x1);
+  free(lu.y);
+  free(inF);
+  free(infeasible);
+  if(Msparse != problem->M)
+  {
+    NM_clear(Msparse);
+    free(Msparse);
+  }
+}
+
+void lcp_block_pivot_set_default(SolverOptions* options)
+{
+  options->iparam[SICONOS_LCP_IPARAM_BLOCK_PIVOT_MAX_TRIALS] = 10;
+  options->iparam[SICONOS_LCP_IPARAM_BLOCK_PIVOT_MAX_UPDATES] = 32;
+}
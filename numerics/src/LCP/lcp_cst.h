@@ -51,7 +51,8 @@ enum LCP_SOLVER
   SICONOS_LCP_PATHSEARCH = 219,
   SICONOS_LCP_PIVOT_LUMOD = 220,
   SICONOS_LCP_GAMS = 221,
-  SICONOS_LCP_CONVEXQP_PG = 222
+  SICONOS_LCP_CONVEXQP_PG = 222,
+  SICONOS_LCP_BLOCK_PIVOT = 223
 };
 
 
@@ -73,6 +74,16 @@ enum SICONOS_LCP_IPARAM
    SICONOS_LCP_IPARAM_ENUM_USE_DGELS =10,
    /** index in iparam to store to activate multiple solutions search */
    SICONOS_LCP_IPARAM_ENUM_MULTIPLE_SOLUTIONS =11,
+   /** index in iparam to store the number of threads of the enumeration (needs OpenMP) */
+   SICONOS_LCP_IPARAM_ENUM_NUMBER_OF_THREADS =12,
+   /** index in iparam to store the number of block pivots allowed without decrease
+    * of the number of infeasibilities (block pivoting) */
+   SICONOS_LCP_IPARAM_BLOCK_PIVOT_MAX_TRIALS =13,
+   /** index in iparam to store the maximal number of updates of the factorization
+    * before a new one (block pivoting) */
+   SICONOS_LCP_IPARAM_BLOCK_PIVOT_MAX_UPDATES =14,
+   /** index in iparam to store the number of factorizations done (block pivoting, out) */
+   SICONOS_LCP_IPARAM_BLOCK_PIVOT_FACTORIZATIONS =15,
    /** **/
    
   };
@@ -126,4 +137,5 @@ extern const char* const   SICONOS_LCP_PATHSEARCH_STR;
 extern const char* const   SICONOS_LCP_PIVOT_LUMOD_STR;
 extern const char* const   SICONOS_LCP_GAMS_STR;
 extern const char* const   SICONOS_LCP_CONVEXQP_PG_STR;
+extern const char* const   SICONOS_LCP_BLOCK_PIVOT_STR;
 #endif
@@ -120,6 +120,80 @@ void lcp_enum_reset(LinearComplementarityProblem* problem, SolverOptions* option
 }
 
 
+/* Workspace of a thread of the enumeration */
+typedef struct
+{
+  double * M_linear_system;
+  double * q_linear_system;
+  int * zw_indices;
+  lapack_int * ipiv;
+} LCPEnumWorkspace;
+
+typedef struct
+{
+  LinearComplementarityProblem* problem;
+  double * q_linear_systemref;
+  double * column_of_zero;
+  double tol;
+  int useDGELS;
+  unsigned long long int seed;
+  LCPEnumWorkspace * workspaces;
+} LCPEnumData;
+
+/* try the case seed + k of the enumeration with the workspace of thread */
+static int lcp_enum_try_case(void * data, int thread, unsigned long long int k)
+{
+  LCPEnumData * d = (LCPEnumData *) data;
+  LCPEnumWorkspace * ws = &d->workspaces[thread];
+  int size = d->problem->size;
+  int NRHS = 1;
+  lapack_int LAinfo = 0;
+
+  enum_case(ws->zw_indices, size, d->seed + k);
+  lcp_buildM(ws->zw_indices, ws->M_linear_system, d->problem->M->matrix0, size, d->column_of_zero);
+  memcpy(ws->q_linear_system, d->q_linear_systemref, (size)*sizeof(double));
+  if(d->useDGELS)
+  {
+    DGELS(LA_NOTRANS, size, size, NRHS, ws->M_linear_system, size, ws->q_linear_system, size, &LAinfo);
+    if(verbose)
+    {
+      numerics_printf("Solution of dgels (info=%i)", LAinfo);
+      NM_dense_display(ws->q_linear_system, size, 1, 0);
+    }
+  }
+  else
+  {
+    DGESV(size, NRHS, ws->M_linear_system, size, ws->ipiv, ws->q_linear_system, size, &LAinfo);
+  }
+  if(LAinfo)
+    return 0;
+
+  if(d->useDGELS)
+  {
+    numerics_printf("DGELS LAInfo=%i", LAinfo);
+    for(int ii = 0; ii < size; ii++)
+    {
+      if(isnan(ws->q_linear_system[ii]) || isinf(ws->q_linear_system[ii]))
+      {
+        numerics_printf("DGELS FAILED");
+        return 0;
+      }
+    }
+  }
+
+  if(verbose)
+  {
+    numerics_printf("lcp_enum LU factorization succeeded:");
+  }
+
+  for(int row  = 0 ; row < size; row++)
+  {
+    if(ws->q_linear_system[row] < - d->tol)
+      return 0; /*out of the cone!*/
+  }
+  return 1;
+}
+
 void lcp_enum(LinearComplementarityProblem* problem, double *z, double *w, int *info, SolverOptions* options)
 {
   *info = 1;
@@ -132,11 +206,6 @@ void lcp_enum(LinearComplementarityProblem* problem, double *z, double *w, int *
   int * workingInt = options->iWork;
 
   int size = problem->size;
-  int NRHS = 1;
-  lapack_int * ipiv;
-  int check;
-  lapack_int LAinfo = 0;
-  int useDGELS = options->iparam[SICONOS_LCP_IPARAM_ENUM_USE_DGELS];
 
   /*OUTPUT param*/
 
@@ -154,103 +223,83 @@ void lcp_enum(LinearComplementarityProblem* problem, double *z, double *w, int *
   if(verbose)
     numerics_printf("lcp_enum begin, size %d tol %e", size, tol);
 
+  LCPEnumData data;
+  data.problem = problem;
+  data.tol = tol;
+  data.useDGELS = options->iparam[SICONOS_LCP_IPARAM_ENUM_USE_DGELS];
+
   double * M_linear_system = workingFloat;
   double * q_linear_system =  M_linear_system + size * size;
-  double * column_of_zero = q_linear_system + size;
-  double * q_linear_systemref = column_of_zero + size;
+  data.column_of_zero = q_linear_system + size;
+  data.q_linear_systemref = data.column_of_zero + size;
 
   for(int row = 0; row < size; row++)
   {
-    q_linear_systemref[row] =  - problem->q[row];
-    column_of_zero[row] = 0;
+    data.q_linear_systemref[row] =  - problem->q[row];
+    data.column_of_zero[row] = 0;
   }
-  //sWZ = workingInt;
-  int * zw_indices  =  workingInt;
-  ipiv = zw_indices + size;
-  *info = 0;
-  EnumerationStruct * enum_struct = enum_init(size);
-  enum_struct->current = options->iparam[SICONOS_LCP_IPARAM_ENUM_SEED];
-  while(enum_next(zw_indices, size, enum_struct))
+
+  unsigned long long int nb_cases = enum_compute_nb_cases(size);
+  data.seed = (unsigned long long int) options->iparam[SICONOS_LCP_IPARAM_ENUM_SEED];
+  if(data.seed >= nb_cases)
+    data.seed = 0;
+
+  /* the first workspace is the one of options, the other threads have their own one */
+  int nthreads = multipleSolutions ? 1 : enum_number_of_threads(options->iparam[SICONOS_LCP_IPARAM_ENUM_NUMBER_OF_THREADS]);
+  LCPEnumWorkspace * workspaces = (LCPEnumWorkspace *) malloc(nthreads * sizeof(LCPEnumWorkspace));
+  workspaces[0].M_linear_system = M_linear_system;
+  workspaces[0].q_linear_system = q_linear_system;
+  workspaces[0].zw_indices = workingInt;
+  workspaces[0].ipiv = workingInt + size;
+  for(int t = 1; t < nthreads; t++)
   {
-    lcp_buildM(zw_indices,  M_linear_system, problem->M->matrix0, size, column_of_zero);
-    memcpy(q_linear_system, q_linear_systemref, (size)*sizeof(double));
-    /*     if (verbose) */
-    /*       printCurrentSystem(); */
-    if(useDGELS)
-    {
-      /* if (verbose) */
-      /*   { */
-      /*     numerics_printf("call dgels on ||AX-B||\n"); */
-      /*     numerics_printf("A\n"); */
-      /*     NM_dense_display( M_linear_system,sSize,sSize,0); */
-      /*     numerics_printf("B\n"); */
-      /*     NM_dense_display(q_linear_system,sSize,1,0); */
-      /*   } */
-
-      DGELS(LA_NOTRANS, size, size, NRHS,  M_linear_system, size, q_linear_system, size, &LAinfo);
-      if(verbose)
-      {
-        numerics_printf("Solution of dgels (info=%i)", LAinfo);
-        NM_dense_display(q_linear_system, size, 1, 0);
-      }
-    }
-    else
+    workspaces[t].M_linear_system = (double *) malloc((size * size + size) * sizeof(double));
+    workspaces[t].q_linear_system = workspaces[t].M_linear_system + size * size;
+    workspaces[t].zw_indices = (int *) malloc(2 * size * sizeof(int));
+    workspaces[t].ipiv = workspaces[t].zw_indices + size;
+  }
+  data.workspaces = workspaces;
+
+  if(multipleSolutions)
+  {
+    for(unsigned long long int k = 0; k < nb_cases; k++)
     {
-      DGESV(size, NRHS,  M_linear_system, size, ipiv, q_linear_system, size, &LAinfo);
+      if(!lcp_enum_try_case(&data, 0, k))
+        continue;
+      numberofSolutions++;
+      numerics_printf("lcp_enum find %i solution with scurrent = %ld!", numberofSolutions, (data.seed + k) % nb_cases);
+      *info = 0;
+      lcp_fillSolution(z, w, size, workspaces[0].zw_indices, workspaces[0].q_linear_system);
+      options->iparam[SICONOS_LCP_IPARAM_ENUM_CURRENT_ENUM ] = (int)((data.seed + k) % nb_cases);
+      options->iparam[SICONOS_LCP_IPARAM_ENUM_NUMBER_OF_SOLUTIONS] = numberofSolutions;
     }
-    if(!LAinfo)
+    *info = 1;
+  }
+  else
+  {
+    int thread;
+    unsigned long long int k = enum_search(nb_cases, nthreads, lcp_enum_try_case, &data, &thread);
+    if(k < nb_cases)
     {
-      if(useDGELS)
-      {
-        int cc = 0;
-        int ii;
-        numerics_printf("DGELS LAInfo=%i", LAinfo);
-        for(ii = 0; ii < size; ii++)
-        {
-          if(isnan(q_linear_system[ii]) || isinf(q_linear_system[ii]))
-          {
-            numerics_printf("DGELS FAILED");
-            cc = 1;
-            break;
-          }
-        }
-        if(cc)
-          continue;
-      }
-
       if(verbose)
-      {
-        numerics_printf("lcp_enum LU factorization succeeded:");
-      }
-
-      check = 1;
-      for(int row  = 0 ; row < size; row++)
-      {
-        if(q_linear_system[row] < - tol)
-        {
-          check = 0;
-          break;/*out of the cone!*/
-        }
-      }
-      if(!check)
-        continue;
-      else
-      {
-        numberofSolutions++;
-        if(verbose || multipleSolutions)
-        {
-          numerics_printf("lcp_enum find %i solution with scurrent = %ld!", numberofSolutions, enum_struct->current - 1);
-        }
-        *info = 0;
-        lcp_fillSolution(z, w, size, zw_indices, q_linear_system);
-        options->iparam[SICONOS_LCP_IPARAM_ENUM_CURRENT_ENUM ] = (int) enum_struct->current - 1;
-        options->iparam[SICONOS_LCP_IPARAM_ENUM_NUMBER_OF_SOLUTIONS] = numberofSolutions;
-        if(!multipleSolutions)  return;
-      }
+        numerics_printf("lcp_enum find 1 solution with scurrent = %ld!", (data.seed + k) % nb_cases);
+      *info = 0;
+      lcp_fillSolution(z, w, size, workspaces[thread].zw_indices, workspaces[thread].q_linear_system);
+      options->iparam[SICONOS_LCP_IPARAM_ENUM_CURRENT_ENUM ] = (int)((data.seed + k) % nb_cases);
+      options->iparam[SICONOS_LCP_IPARAM_ENUM_NUMBER_OF_SOLUTIONS] = 1;
     }
+    else
+      *info = 1;
   }
-  *info = 1;
-  if(verbose)
+
+  for(int t = 1; t < nthreads; t++)
+  {
+    free(workspaces[t].M_linear_system);
+    free(workspaces[t].zw_indices);
+  }
+  free(workspaces);
+
+  if(*info && verbose)
     numerics_printf("lcp_enum has not found a solution!\n");
 }
 
@@ -259,6 +308,7 @@ void lcp_enum_set_default(SolverOptions* options)
   options->iparam[SICONOS_LCP_IPARAM_ENUM_USE_DGELS] = 0;
   options->iparam[SICONOS_LCP_IPARAM_ENUM_SEED] = 0;
   options->iparam[SICONOS_LCP_IPARAM_ENUM_MULTIPLE_SOLUTIONS] = 0;
+  options->iparam[SICONOS_LCP_IPARAM_ENUM_NUMBER_OF_THREADS] = 1;
   // SICONOS_LCP_IPARAM_ENUM_CURRENT_ENUM (out)
   // SICONOS_LCP_IPARAM_ENUM_NUMBER_OF_SOLUTIONS (out)
 
@@ -31,7 +31,7 @@ int main(void)
                    SICONOS_LCP_PSOR, SICONOS_LCP_RPGS, SICONOS_LCP_PATH, SICONOS_LCP_ENUM,
                    SICONOS_LCP_AVI_CAOFERRIS, SICONOS_LCP_PIVOT, SICONOS_LCP_BARD, SICONOS_LCP_MURTY,
                    SICONOS_LCP_NEWTON_MIN_FBLSA, SICONOS_LCP_PATHSEARCH, SICONOS_LCP_PIVOT_LUMOD, SICONOS_LCP_GAMS,
-                   SICONOS_LCP_CONVEXQP_PG
+                   SICONOS_LCP_CONVEXQP_PG, SICONOS_LCP_BLOCK_PIVOT
                   };
   int n_solvers = (int)(sizeof(solvers) / sizeof(solvers[0]));
   SolverOptions * options = NULL;
@@ -0,0 +1,163 @@
+/* Siconos is a program dedicated to modeling, simulation and control
+ * of non smooth dynamical systems.
+ *
+ * Copyright 2020 INRIA.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+*/
+#include <math.h>                          // for sin, cos, fabs
+#include <stdio.h>                         // for printf, fprintf, stderr
+#include <stdlib.h>                        // for malloc, calloc, free
+#include "LCP_Solvers.h"                   // for lcp_compute_error
+#include "LinearComplementarityProblem.h"  // for LinearComplementarityProblem
+#include "NonSmoothDrivers.h"              // for linearComplementarity_driver
+#include "NumericsMatrix.h"                // for NM_create, NM_zentry
+#include "SolverOptions.h"                 // for SolverOptions, solver_opt...
+#include "SparseBlockMatrix.h"             // for SBM_from_csparse
+#include "lcp_cst.h"                       // for SICONOS_LCP_BLOCK_PIVOT
+
+/* grid of the obstacle problem */
+#define N 60
+#define SIZE 12
+
+static int solve(LinearComplementarityProblem* problem, int maxUpdates, double* z, const char * name)
+{
+  int n = problem->size;
+  double * w = (double *)calloc(n, sizeof(double));
+  SolverOptions * options = solver_options_create(SICONOS_LCP_BLOCK_PIVOT);
+  options->iparam[SICONOS_LCP_IPARAM_BLOCK_PIVOT_MAX_UPDATES] = maxUpdates;
+  int info = linearComplementarity_driver(problem, z, w, options);
+  double error = 0.;
+  info = info || lcp_compute_error(problem, z, w, 1e-10, &error);
+  printf("lcp_block_pivot_test, %s: info %d, %d iterations, %d factorizations, error %e\n",
+         name, info, options->iparam[SICONOS_IPARAM_ITER_DONE],
+         options->iparam[SICONOS_LCP_IPARAM_BLOCK_PIVOT_FACTORIZATIONS], error);
+  if(info)
+    fprintf(stderr, "lcp_block_pivot_test, %s: failed\n", name);
+  solver_options_delete(options);
+  free(w);
+  return info;
+}
+
+static double max_diff(double* a, double* b, int n)
+{
+  double d = 0.;
+  for(int i = 0; i < n; i++)
+    d = fmax(d, fabs(a[i] - b[i]));
+  return d;
+}
+
+int main(void)
+{
+  int info = 0;
+  int n = N * N;
+
+  /* obstacle problem: discrete laplacian on a N x N grid, in sparse storage */
+  LinearComplementarityProblem* problem = (LinearComplementarityProblem*)malloc(sizeof(LinearComplementarityProblem));
+  problem->size = n;
+  problem->M = NM_create(NM_SPARSE, n, n);
+  NM_triplet_alloc(problem->M, 5 * n);
+  problem->q = (double *)malloc(n * sizeof(double));
+  for(int i = 0; i < N; i++)
+  {
+    for(int j = 0; j < N; j++)
+    {
+      int k = i * N + j;
+      NM_zentry(problem->M, k, k, 4.1);
+      if(i > 0) NM_zentry(problem->M, k, k - N, -1.);
+      if(i < N - 1) NM_zentry(problem->M, k, k + N, -1.);
+      if(j > 0) NM_zentry(problem->M, k, k - 1, -1.);
+      if(j < N - 1) NM_zentry(problem->M, k, k + 1, -1.);
+      problem->q[k] = sin(0.3 * i) * cos(0.2 * j) - 0.2;
+    }
+  }
+
+  double * z = (double *)calloc(n, sizeof(double));
+  double * zref = (double *)calloc(n, sizeof(double));
+  info += solve(problem, 32, zref, "sparse");
+  info += solve(problem, 4, z, "sparse, 4 updates");
+  if(max_diff(z, zref, n) > 1e-10)
+  {
+    fprintf(stderr, "lcp_block_pivot_test: the solutions differ with 4 updates\n");
+    info += 1;
+  }
+
+  /* warm start from the solution */
+  info += solve(problem, 32, z, "sparse, warm start");
+
+  /* the same problem with a sparse block storage */
+  NumericsMatrix * Msparse = problem->M;
+  problem->M = NM_create(NM_SPARSE_BLOCK, n, n);
+  SBM_from_csparse(2, NM_csc(Msparse), problem->M->matrix1);
+  for(int i = 0; i < n; i++)
+    z[i] = 0.;
+  info += solve(problem, 32, z, "sparse block");
+  if(max_diff(z, zref, n) > 1e-10)
+  {
+    fprintf(stderr, "lcp_block_pivot_test: the solutions differ with a sparse block storage\n");
+    info += 1;
+  }
+
+  /* a small change of q, solved from the previous solution: the first
+   * factorization is updated */
+  for(int k = 0; k < N; k++)
+    problem->q[(N / 2) * N + k] += 0.5 * cos(0.4 * k);
+  double * zcold = (double *)calloc(n, sizeof(double));
+  info += solve(problem, 32, zcold, "sparse block, new q");
+  info += solve(problem, 32, z, "sparse block, new q, warm start");
+  if(max_diff(z, zcold, n) > 1e-10)
+  {
+    fprintf(stderr, "lcp_block_pivot_test: the solutions differ with a warm start\n");
+    info += 1;
+  }
+  free(zcold);
+  NM_clear(problem->M);
+  free(problem->M);
+  NM_clear(Msparse);
+  free(Msparse);
+  free(problem->q);
+  free(z);
+  free(zref);
+
+  /* a small nonsymmetric P-matrix, in dense storage, compared with Lemke */
+  problem->size = SIZE;
+  problem->M = NM_create(NM_DENSE, SIZE, SIZE);
+  problem->q = (double *)malloc(SIZE * sizeof(double));
+  double * M = problem->M->matrix0;
+  for(int i = 0; i < SIZE; i++)
+  {
+    for(int j = 0; j < SIZE; j++)
+      M[i + j * SIZE] = (i == j) ? SIZE : 0.3 * ((i * 7 + j * 3) % 5 - 2);
+    problem->q[i] = ((i * 5) % 7) - 3.;
+  }
+  z = (double *)calloc(SIZE, sizeof(double));
+  zref = (double *)calloc(SIZE, sizeof(double));
+  double * w = (double *)calloc(SIZE, sizeof(double));
+  SolverOptions * options = solver_options_create(SICONOS_LCP_LEMKE);
+  info += linearComplementarity_driver(problem, zref, w, options);
+  solver_options_delete(options);
+  info += solve(problem, 2, z, "dense");
+  if(max_diff(z, zref, SIZE) > 1e-10)
+  {
+    fprintf(stderr, "lcp_block_pivot_test: the solution differs from the one of Lemke\n");
+    info += 1;
+  }
+  free(w);
+  free(z);
+  free(zref);
+  NM_clear(problem->M);
+  free(problem->M);
+  free(problem->q);
+  free(problem);
+  return info;
+}
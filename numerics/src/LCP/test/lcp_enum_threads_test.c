@@ -0,0 +1,112 @@
+/* Siconos is a program dedicated to modeling, simulation and control
+ * of non smooth dynamical systems.
+ *
+ * Copyright 2020 INRIA.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+*/
+#include <stdio.h>                         // for printf, fprintf, stderr
+#include <stdlib.h>                        // for malloc, calloc, free
+#include <string.h>                        // for memcmp
+#include "LCP_Solvers.h"                   // for lcp_enum
+#include "LinearComplementarityProblem.h"  // for LinearComplementarityProblem
+#include "NonSmoothDrivers.h"              // for linearComplementarity_driver
+#include "NumericsMatrix.h"                // for NM_create, NM_DENSE
+#include "SiconosConfig.h"                 // for WITH_OPENMP // IWYU pragma: keep
+#include "SolverOptions.h"                 // for SolverOptions, solver_opt...
+#include "lcp_cst.h"                       // for SICONOS_LCP_ENUM, SICONOS_...
+
+#define SIZE 12
+
+/* solve the problem with 1 and 4 threads: the enumeration must give
+ * the same case, hence the same solution */
+static int compare_threads(LinearComplementarityProblem* problem, int seed, const char * name)
+{
+  int info = 0;
+  int found[2];
+  int current[2];
+  double * z[2];
+  double * w[2];
+  int nthreads[2] = {1, 4};
+  for(int i = 0; i < 2; i++)
+  {
+    z[i] = (double *)calloc(SIZE, sizeof(double));
+    w[i] = (double *)calloc(SIZE, sizeof(double));
+    SolverOptions * options = solver_options_create(SICONOS_LCP_ENUM);
+    options->iparam[SICONOS_LCP_IPARAM_ENUM_SEED] = seed;
+    options->iparam[SICONOS_LCP_IPARAM_ENUM_NUMBER_OF_THREADS] = nthreads[i];
+    found[i] = linearComplementarity_driver(problem, z[i], w[i], options);
+    current[i] = options->iparam[SICONOS_LCP_IPARAM_ENUM_CURRENT_ENUM];
+    solver_options_delete(options);
+  }
+  printf("lcp_enum_threads_test, %s: info %d, case %d with 1 thread, info %d, case %d with 4 threads\n",
+         name, found[0], current[0], found[1], current[1]);
+  if(found[0] || found[1] || current[0] != current[1]
+     || memcmp(z[0], z[1], SIZE * sizeof(double)) || memcmp(w[0], w[1], SIZE * sizeof(double)))
+  {
+    fprintf(stderr, "lcp_enum_threads_test, %s: the solutions differ\n", name);
+    info = 1;
+  }
+  for(int i = 0; i < 2; i++)
+  {
+    free(z[i]);
+    free(w[i]);
+  }
+  return info;
+}
+
+int main(void)
+{
+#ifndef WITH_OPENMP
+  /* one thread whatever the options: nothing to compare */
+  printf("lcp_enum_threads_test: Siconos built without OpenMP, test skipped.\n");
+  return 77;
+#endif
+  int info = 0;
+  LinearComplementarityProblem* problem = (LinearComplementarityProblem*)malloc(sizeof(LinearComplementarityProblem));
+  problem->size = SIZE;
+  problem->M = NM_create(NM_DENSE, SIZE, SIZE);
+  problem->q = (double *)malloc(SIZE * sizeof(double));
+  double * M = problem->M->matrix0;
+
+  /* a P-matrix: a unique solution */
+  for(int i = 0; i < SIZE; i++)
+  {
+    for(int j = 0; j < SIZE; j++)
+      M[i + j * SIZE] = (i == j) ? SIZE : 0.3 * ((i * 7 + j * 3) % 5 - 2);
+    problem->q[i] = (i * 5) % 7 - 3;
+  }
+  info += compare_threads(problem, 0, "P-matrix");
+  info += compare_threads(problem, 1000, "P-matrix, with a seed");
+
+  /* the same P-matrix for the first 8 unknowns, followed by 2 blocks
+   * [1 2; 2 1] with q = (-1, -1), that have 3 solutions each */
+  for(int i = 0; i < SIZE; i++)
+  {
+    for(int j = 0; j < SIZE; j++)
+    {
+      if(i < 8 && j < 8)
+        M[i + j * SIZE] = (i == j) ? SIZE : 0.3 * ((i * 7 + j * 3) % 5 - 2);
+      else if(i >= 8 && j >= 8)
+        M[i + j * SIZE] = (i == j) ? 1.0 : ((i / 2 == j / 2) ? 2.0 : 0.0);
+      else
+        M[i + j * SIZE] = 0.0;
+    }
+    problem->q[i] = (i < 8) ? (i * 5) % 7 - 3 : -1.0;
+  }
+  info += compare_threads(problem, 0, "multiple solutions");
+  info += compare_threads(problem, 2021, "multiple solutions, with a seed");
+
+  freeLinearComplementarityProblem(problem);
+  return info;
+}
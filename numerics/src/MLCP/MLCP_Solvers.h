@@ -136,7 +136,11 @@ extern "C"
   */
   void mlcp_path(MixedLinearComplementarityProblem* problem, double *z, double *w, int *info, SolverOptions* options);
 
-  /** enum solver
+  /** enum solver. Each enumerated configuration is factorized from
+   * scratch: mlcp_enum keeps no configuration cache. The cache of the
+   * solved configurations and their rank-one updates are done by the
+   * direct solvers (see mlcp_direct_enum()), which call mlcp_enum only
+   * when no stored configuration or neighbour fits.
    * \param[in] problem structure that represents the MLCP (n,mM, q...)
    * \param[out] z a m+n-vector of doubles which contains the initial solution and returns the solution of the problem.
    * \param[out] w a m+n-vector of doubles which returns the solution of the problem.
@@ -27,7 +27,9 @@ enum SICONOS_IPARAM_MLCP
    SICONOS_IPARAM_MLCP_PGS_SUM_ITER = 3,
    SICONOS_IPARAM_MLCP_ENUM_USE_DGELS = 4, // activate to use dgels rather than dgesv in mlcp driver (enum only indeed)
    SICONOS_IPARAM_MLCP_NUMBER_OF_CONFIGURATIONS = 5, // number of possible configurations
+   SICONOS_IPARAM_MLCP_DIRECT_NEIGHBOURS = 6, // direct solvers: number of stored configurations whose neighbours are tried by rank-one updates (0: none)
    SICONOS_IPARAM_MLCP_UPDATE_REQUIRED = 8, // true if the problem needs update
+   SICONOS_IPARAM_MLCP_ENUM_NUMBER_OF_THREADS = 9, // number of threads of the enumeration (needs OpenMP)
   };
 
 enum SICONOS_DPARAM_MLCP
@@ -31,14 +31,27 @@ dim(v)=nn
 * 1) The complementarity constraints hold --> Success.
 * 2) The complementarity constraints don't hold --> Failed.
 *
+* The precomputed configurations are kept in a list ordered from the most recently used one
+* to the least recently used one, which is replaced when the list is full. A configuration is
+* also referenced in a hash table with the active set (zw) as key, so that a configuration is
+* never stored twice and a configuration can be found without trying it.
+*
+* If iparam[SICONOS_IPARAM_MLCP_DIRECT_NEIGHBOURS] = k > 0 and no stored configuration fits,
+* the neighbours (one complementarity condition switched) of the k most recently used
+* configurations are tried before failing. The inverse of the system of a neighbour is a
+* rank-one update of the inverse of the stored one (Sherman-Morrison formula), hence a
+* neighbour costs O((n+m)^2) instead of a new factorization.
+*
 **************************************************************************/
 
 #include "mlcp_direct.h"
 #ifndef __cplusplus
 #include <stdbool.h>                       // for false
 #endif
+#include <math.h>                               // for fabs
 #include <stdio.h>                              // for printf
 #include <stdlib.h>                             // for malloc, exit, free
+#include <string.h>                             // for memset
 #include "MLCP_Solvers.h"                       // for mlcp_direct, mlcp_dir...
 #include "MixedLinearComplementarityProblem.h"  // for MixedLinearComplement...
 #include "NumericsMatrix.h"                     // for NM_dense_display, Num...
@@ -58,12 +71,19 @@ dim(v)=nn
 #define DIRECT_SOLVER_USE_DGETRI
 double * sVBuf;
 
+/* maximal number of successive rank-one updates of the inverse of a configuration,
+   before it is computed again from a factorization */
+#define MLCP_DIRECT_MAX_RANK_UPDATES 8
+
 struct dataComplementarityConf
 {
   int * zw; /*zw[i] == 0 means w null and z >=0*/
   double * M;
   struct dataComplementarityConf * next;
   struct dataComplementarityConf * prev;
+  struct dataComplementarityConf * hashNext; /* next configuration in the same hash bucket */
+  unsigned int key; /* hash of zw */
+  int rankUpdates; /* number of rank-one updates since the last factorization */
   int Usable;
   int used;
   lapack_int* IPV;
@@ -84,12 +104,19 @@ static int s_nbLines;
 static int s_npM;
 static int* spIntBuf;
 static int sProblemChanged = 0;
+static struct dataComplementarityConf ** spHashTable = 0;
+static unsigned int s_hashSize = 0;
+static int s_neighbours = 0;
+static double * sUBuf;
+static double * sMinvUBuf;
+static int * spNeighbourZw;
 
 static double * mydMalloc(int n);
 static int * myiMalloc(int n);
-static int internalPrecompute(MixedLinearComplementarityProblem* problem);
+static int internalPrecompute(MixedLinearComplementarityProblem* problem, struct dataComplementarityConf * cc);
 static int internalAddConfig(MixedLinearComplementarityProblem* problem, int * zw, int init);
 static int solveWithCurConfig(MixedLinearComplementarityProblem* problem);
+static struct dataComplementarityConf * newSlot(int * init);
 //static int nbConfig(struct dataComplementarityConf * pC);
 
 double * mydMalloc(int n)
@@ -115,14 +142,75 @@ static lapack_int * myiMalloc2(int n)
 int mlcp_direct_getNbIWork(MixedLinearComplementarityProblem* problem, SolverOptions* options)
 {
   return (problem->n + problem->m) * (options->iparam[SICONOS_IPARAM_MLCP_NUMBER_OF_CONFIGURATIONS] + 1)
-    + options->iparam[SICONOS_IPARAM_MLCP_NUMBER_OF_CONFIGURATIONS] * problem->m;
+    + (options->iparam[SICONOS_IPARAM_MLCP_NUMBER_OF_CONFIGURATIONS] + 1) * problem->m;
 }
 
 int mlcp_direct_getNbDWork(MixedLinearComplementarityProblem* problem, SolverOptions* options)
 {
   return  problem->n + problem->m
     + (options->iparam[SICONOS_IPARAM_MLCP_NUMBER_OF_CONFIGURATIONS]) * ((problem->n + problem->m) * (problem->n + problem->m))
-    + (problem->n + problem->m);
+    + 3 * (problem->n + problem->m);
+}
+
+/* hash of a configuration (FNV-1a on the bits of zw) */
+static unsigned int configurationKey(int * zw)
+{
+  unsigned int key = 2166136261u;
+  for(int i = 0; i < s_m; i++)
+  {
+    key ^= (zw[i] ? 1u : 0u);
+    key *= 16777619u;
+  }
+  return key;
+}
+
+static struct dataComplementarityConf * hashFind(int * zw, unsigned int key)
+{
+  if(!spHashTable)
+    return 0;
+  struct dataComplementarityConf * cc = spHashTable[key & (s_hashSize - 1)];
+  for(; cc; cc = cc->hashNext)
+  {
+    if(cc->key != key)
+      continue;
+    int i = 0;
+    while(i < s_m && (!cc->zw[i]) == (!zw[i]))
+      i++;
+    if(i == s_m)
+      return cc;
+  }
+  return 0;
+}
+
+static void hashInsert(struct dataComplementarityConf * cc)
+{
+  unsigned int bucket = cc->key & (s_hashSize - 1);
+  cc->hashNext = spHashTable[bucket];
+  spHashTable[bucket] = cc;
+}
+
+static void hashRemove(struct dataComplementarityConf * cc)
+{
+  struct dataComplementarityConf ** p = &spHashTable[cc->key & (s_hashSize - 1)];
+  while(*p && *p != cc)
+    p = &(*p)->hashNext;
+  if(*p)
+    *p = cc->hashNext;
+  cc->hashNext = 0;
+}
+
+/* move a configuration at the beginning of the list (most recently used) */
+static void moveToFront(struct dataComplementarityConf * cc)
+{
+  if(cc == spFirstCC)
+    return;
+  cc->prev->next = cc->next;
+  if(cc->next)
+    cc->next->prev = cc->prev;
+  spFirstCC->prev = cc;
+  cc->next = spFirstCC;
+  spFirstCC = cc;
+  spFirstCC->prev = 0;
 }
 
 void mlcp_direct_init(MixedLinearComplementarityProblem* problem, SolverOptions* options)
@@ -158,9 +246,29 @@ void mlcp_direct_init(MixedLinearComplementarityProblem* problem, SolverOptions*
     s_numberOfCC = 0;
   }
 
+  /* hash table of the configurations, with at least twice as many buckets as configurations */
+  unsigned int hashSize = 1;
+  while(hashSize < 2 * (unsigned int)s_maxNumberOfCC)
+    hashSize *= 2;
+  if(!spHashTable || hashSize != s_hashSize)
+  {
+    free(spHashTable);
+    spHashTable = (struct dataComplementarityConf **)calloc(hashSize, sizeof(struct dataComplementarityConf *));
+    s_hashSize = hashSize;
+    for(struct dataComplementarityConf * cc = spFirstCC; cc; cc = cc->next)
+      hashInsert(cc);
+  }
+  else if(!spFirstCC)
+    memset(spHashTable, 0, s_hashSize * sizeof(struct dataComplementarityConf *));
+
+  s_neighbours = options->iparam[SICONOS_IPARAM_MLCP_DIRECT_NEIGHBOURS];
+
   sQ = mydMalloc(s_npM);
   sVBuf = mydMalloc(s_npM);
+  sUBuf = mydMalloc(s_npM);
+  sMinvUBuf = mydMalloc(s_npM);
   spIntBuf = myiMalloc(s_npM);
+  spNeighbourZw = myiMalloc(s_m);
 }
 
 void mlcp_direct_reset()
@@ -172,31 +280,35 @@ void mlcp_direct_reset()
     spFirstCC = spFirstCC->next;
     free(aux);
   }
+  free(spHashTable);
+  spHashTable = 0;
+  s_hashSize = 0;
 }
 
-int internalPrecompute(MixedLinearComplementarityProblem* problem)
+int internalPrecompute(MixedLinearComplementarityProblem* problem, struct dataComplementarityConf * cc)
 {
   lapack_int INFO = 0;
-  mlcp_enum_build_M(spFirstCC->zw, spFirstCC->M, problem->M->matrix0, s_n, s_m, s_nbLines);
+  mlcp_enum_build_M(cc->zw, cc->M, problem->M->matrix0, s_n, s_m, s_nbLines);
   if(verbose)
   {
     printf("mlcp_direct, precomputed M :\n");
-    NM_dense_display(spFirstCC->M, s_npM, s_npM, 0);
+    NM_dense_display(cc->M, s_npM, s_npM, 0);
   }
-  if(!(spFirstCC->Usable))
+  if(!(cc->Usable))
     return 0;
-  DGETRF(s_npM, s_npM, spFirstCC->M, s_npM, spFirstCC->IPV, &INFO);
+  cc->rankUpdates = 0;
+  DGETRF(s_npM, s_npM, cc->M, s_npM, cc->IPV, &INFO);
   if(INFO)
   {
-    spFirstCC->Usable = 0;
+    cc->Usable = 0;
     printf("mlcp_direct, internalPrecompute  error, LU impossible\n");
     return 0;
   }
 #ifdef DIRECT_SOLVER_USE_DGETRI
-  DGETRI(s_npM, spFirstCC->M, s_npM, spFirstCC->IPV, &INFO);
+  DGETRI(s_npM, cc->M, s_npM, cc->IPV, &INFO);
   if(INFO)
   {
-    spFirstCC->Usable = 1;
+    cc->Usable = 1;
     printf("mlcp_direct error, internalPrecompute  DGETRI impossible\n");
     return 0;
   }
@@ -205,6 +317,12 @@ int internalPrecompute(MixedLinearComplementarityProblem* problem)
 }
 
 /*memory management about floatWorkingMem and intWorkingMem*/
+static void allocateConfig(struct dataComplementarityConf * cc)
+{
+  cc->zw = myiMalloc(s_m);
+  cc->IPV = myiMalloc2(s_npM);
+  cc->M = mydMalloc(s_npM * s_npM);
+}
 int internalAddConfig(MixedLinearComplementarityProblem* problem, int * zw, int init)
 {
   if(verbose)
@@ -216,19 +334,19 @@ int internalAddConfig(MixedLinearComplementarityProblem* problem, int * zw, int
     printf("\n");
   }
   if(init)
-  {
-    spFirstCC->zw = myiMalloc(s_m);
-    spFirstCC->IPV = myiMalloc2(s_npM);
-    spFirstCC->M = mydMalloc(s_npM * s_npM);
-  }
+    allocateConfig(spFirstCC);
   for(int i = 0; i < s_m; i++)
   {
     spFirstCC->zw[i] = zw[i];
   }
-  return internalPrecompute(problem);
+  spFirstCC->key = configurationKey(zw);
+  hashInsert(spFirstCC);
+  return internalPrecompute(problem, spFirstCC);
 }
-/*memory management about dataComplementarityConf*/
-void mlcp_direct_addConfig(MixedLinearComplementarityProblem* problem, int * zw)
+/*memory management about dataComplementarityConf:
+  returns the first configuration of the list, either a new one or the least recently used one
+  (removed from the hash table). init is set to 1 if its memory has to be allocated. */
+struct dataComplementarityConf * newSlot(int * init)
 {
   if(s_numberOfCC < s_maxNumberOfCC)  /*Add a configuration*/
   {
@@ -249,12 +367,14 @@ void mlcp_direct_addConfig(MixedLinearComplementarityProblem* problem, int * zw)
       spFirstCC = spFirstCC->prev;
       spFirstCC->prev = 0;
     }
-    internalAddConfig(problem, zw, 1);
+    spFirstCC->hashNext = 0;
+    *init = 1;
   }
   else /*Replace an old one*/
   {
     struct dataComplementarityConf * aux = spFirstCC;
     while(aux->next) aux = aux->next;
+    hashRemove(aux);
     if(aux->prev)
     {
       aux->prev->next = 0;
@@ -264,8 +384,23 @@ void mlcp_direct_addConfig(MixedLinearComplementarityProblem* problem, int * zw)
       spFirstCC = aux;
       spFirstCC->Usable = 1;
     }
-    internalAddConfig(problem, zw, 0);
+    *init = 0;
+  }
+  return spFirstCC;
+}
+void mlcp_direct_addConfig(MixedLinearComplementarityProblem* problem, int * zw)
+{
+  struct dataComplementarityConf * cc = hashFind(zw, configurationKey(zw));
+  if(cc)  /*Already known, it becomes the most recently used one*/
+  {
+    moveToFront(cc);
+    cc->Usable = 1;
+    internalPrecompute(problem, cc);
+    return;
   }
+  int init;
+  newSlot(&init);
+  internalAddConfig(problem, zw, init);
 }
 void mlcp_direct_addConfigFromWSolution(MixedLinearComplementarityProblem* problem, double * wSol)
 {
@@ -300,7 +435,7 @@ int solveWithCurConfig(MixedLinearComplementarityProblem* problem)
       printf("0");
       printf("\n");*/
   if(sProblemChanged)
-    internalPrecompute(problem);
+    internalPrecompute(problem, sp_curCC);
   if(!sp_curCC->Usable)
   {
     if(verbose)
@@ -339,6 +474,93 @@ int solveWithCurConfig(MixedLinearComplementarityProblem* problem)
   return 1;
 }
 
+#ifdef DIRECT_SOLVER_USE_DGETRI
+/* Store the configuration spNeighbourZw, obtained by switching the condition of the column c
+   of the configuration parent. Its inverse is parent->M - (Minv u)(e_c^T parent->M)/denom,
+   with Minv u in sMinvUBuf. */
+static void addNeighbourConfig(MixedLinearComplementarityProblem* problem,
+                               struct dataComplementarityConf * parent, int c, double denom)
+{
+  int rankUpdates = parent->rankUpdates + 1;
+  double * parentM = parent->M;
+  /* row c of the inverse of the parent configuration (sVBuf is free) */
+  cblas_dcopy(s_npM, parentM + c, s_npM, sVBuf, 1);
+
+  int init;
+  struct dataComplementarityConf * cc = newSlot(&init);
+  if(init)
+    allocateConfig(cc);
+  memcpy(cc->zw, spNeighbourZw, s_m * sizeof(int));
+  cc->key = configurationKey(cc->zw);
+  hashInsert(cc);
+  cc->Usable = 1;
+  if(rankUpdates > MLCP_DIRECT_MAX_RANK_UPDATES)
+  {
+    internalPrecompute(problem, cc);
+    return;
+  }
+  if(cc->M != parentM)  /* the parent itself may have been replaced */
+    memcpy(cc->M, parentM, s_npM * s_npM * sizeof(double));
+  cblas_dger(CblasColMajor, s_npM, s_npM, -1.0 / denom, sMinvUBuf, 1, sVBuf, 1, cc->M, s_npM);
+  cc->rankUpdates = rankUpdates;
+}
+
+/* Try the neighbours (one complementarity condition switched) of the s_neighbours most
+   recently used configurations, sQ containing -q. The condition switched is one of the
+   conditions that are violated by the solution of the configuration. If a neighbour fits, it
+   is stored as the most recently used configuration, (z, w) is filled and 1 is returned. */
+static int solveWithNeighbours(MixedLinearComplementarityProblem* problem, double *z, double *w)
+{
+  double * Mref = problem->M->matrix0;
+  int k = 0;
+  for(struct dataComplementarityConf * cc = spFirstCC; cc && k < s_neighbours; cc = cc->next, k++)
+  {
+    if(!cc->Usable)
+      continue;
+    /* solution with the configuration */
+    cblas_dgemv(CblasColMajor, CblasNoTrans, s_npM, s_npM, 1.0, cc->M, s_npM, sQ, 1, 0.0, sVBuf, 1);
+    for(int j = 0; j < s_m; j++)
+    {
+      int c = s_n + j;
+      if(sVBuf[c] >= - sTolneg)
+        continue;
+      memcpy(spNeighbourZw, cc->zw, s_m * sizeof(int));
+      spNeighbourZw[j] = !cc->zw[j];
+      if(hashFind(spNeighbourZw, configurationKey(spNeighbourZw)))
+        continue; /* stored, hence already tried */
+
+      /* the column c of the system is Mref(:,c) if zw[j] == 0, -e_c otherwise.
+         u = new column - old column */
+      double sign = cc->zw[j] ? 1.0 : -1.0;
+      for(int i = 0; i < s_npM; i++)
+        sUBuf[i] = sign * Mref[c * s_npM + i];
+      sUBuf[c] += sign;
+      cblas_dgemv(CblasColMajor, CblasNoTrans, s_npM, s_npM, 1.0, cc->M, s_npM, sUBuf, 1, 0.0, sMinvUBuf, 1);
+      double denom = 1.0 + sMinvUBuf[c];
+      if(fabs(denom) < 1e-12)
+        continue; /* singular system */
+
+      /* Sherman-Morrison: x' = x - (Minv u) x_c / denom */
+      double alpha = sVBuf[c] / denom;
+      int fits = 1;
+      for(int i = 0; i < s_npM; i++)
+        sUBuf[i] = sVBuf[i] - alpha * sMinvUBuf[i];
+      for(int i = 0; i < s_m && fits; i++)
+        fits = (sUBuf[s_n + i] >= - sTolneg);
+      if(!fits)
+        continue;
+
+      if(verbose)
+        printf("mlcp_direct, neighbour of a stored configuration found (condition %d switched)\n", j);
+      addNeighbourConfig(problem, cc, c, denom);
+      mlcp_enum_fill_solution(z, z + s_n, w, w + s_n, s_n, s_m, s_nbLines, spFirstCC->zw, sUBuf);
+      return 1;
+    }
+  }
+  return 0;
+}
+#endif
+
 void mlcp_direct(MixedLinearComplementarityProblem* problem, double *z, double *w, int *info, SolverOptions* options)
 {
   int find = 0;
@@ -365,20 +587,7 @@ void mlcp_direct(MixedLinearComplementarityProblem* problem, double *z, double *
         mlcp_enum_fill_solution(z, z + s_n, w, w + s_n, s_n, s_m, s_nbLines, sp_curCC->zw, sQ);
 #endif
         /*Current becomes first for the next step.*/
-        if(sp_curCC != spFirstCC)
-        {
-          /*    nbConfig(spFirstCC);
-          nbConfig(sp_curCC);
-          printf("bidouille pour devenir 1\n");*/
-          sp_curCC->prev->next = sp_curCC->next;
-          if(sp_curCC->next)
-            sp_curCC->next->prev = sp_curCC->prev;
-          spFirstCC->prev = sp_curCC;
-          sp_curCC->next = spFirstCC;
-          spFirstCC = sp_curCC;
-          spFirstCC->prev = 0;
-          /*    nbConfig(spFirstCC);*/
-        }
+        moveToFront(sp_curCC);
       }
       else
       {
@@ -387,6 +596,11 @@ void mlcp_direct(MixedLinearComplementarityProblem* problem, double *z, double *
     }
     while(sp_curCC && !find);
 
+#ifdef DIRECT_SOLVER_USE_DGETRI
+    if(!find && s_neighbours > 0)
+      find = solveWithNeighbours(problem, z, w);
+#endif
+
     if(find)
     {
       *info = 0;
@@ -404,6 +618,7 @@ void mlcp_direct_set_default(SolverOptions* options)
   options->dparam[SICONOS_DPARAM_MLCP_SIGN_TOL_POS] = 1e-12;
   options->dparam[SICONOS_DPARAM_MLCP_SIGN_TOL_NEG] = 1e-12;
   options->iparam[SICONOS_IPARAM_MLCP_NUMBER_OF_CONFIGURATIONS] = 3;
+  options->iparam[SICONOS_IPARAM_MLCP_DIRECT_NEIGHBOURS] = 0;
   options->iparam[SICONOS_IPARAM_MLCP_UPDATE_REQUIRED] = 0;
   options->filterOn = false;
 }
@@ -109,7 +109,9 @@ void mlcp_direct_enum_set_default(SolverOptions* options)
   options->dparam[SICONOS_DPARAM_MLCP_SIGN_TOL_POS] = 1e-12;
   options->dparam[SICONOS_DPARAM_MLCP_SIGN_TOL_NEG] = 1e-12;
   options->iparam[SICONOS_IPARAM_MLCP_NUMBER_OF_CONFIGURATIONS] = 3;
+  options->iparam[SICONOS_IPARAM_MLCP_DIRECT_NEIGHBOURS] = 0;
   options->iparam[SICONOS_IPARAM_MLCP_UPDATE_REQUIRED] = 0;
+  options->iparam[SICONOS_IPARAM_MLCP_ENUM_NUMBER_OF_THREADS] = 1;
   options->filterOn = false;
 
 }
@@ -33,6 +33,7 @@ dim(v)=nn
 #include <stdbool.h>                       // for false
 #endif
 #include <stdio.h>                              // for printf
+#include <stdlib.h>                             // for malloc, free
 #include <string.h>                             // for memcpy
 
 #include "MLCP_Solvers.h"                       // for mlcp_compute_error
@@ -69,188 +70,123 @@ static void print_current_system(MixedLinearComplementarityProblem* problem,
   NM_dense_display(q_linear_system, n_row, 1, 0);
 }
 
-/* An adaptation of the enum algorithm, to manage the case of MLCP-block formalization
- */
-static void mlcp_enum_block(MixedLinearComplementarityProblem* problem, double *z, double *w, int *info, SolverOptions* options)
+/* Workspace of a thread of the enumeration */
+typedef struct
 {
-  DEBUG_BEGIN(" mlcp_enum_block(...)\n");
-
-  int npm = (problem->n) + (problem->m);
-
-
-  int NRHS = 1;
-  int check;
-  lapack_int LAinfo = 0;
-
-  *info = 0;
-
-  assert(problem->M);
-  assert(problem->M->matrix0);
-  assert(problem->q);
-
-  int n_row = problem->M->size0;
-  int n_col = problem->M->size1;
+  double * M_linear_system;
+  double * q_linear_system;
+  int * zw_indices;
+  lapack_int * ipiv;
+  double * z;
+  double * w;
+} MLCPEnumWorkspace;
 
+typedef struct
+{
+  MixedLinearComplementarityProblem* problem;
+  double * q_linear_system_ref;
+  int * indexInBlock; /* NULL if the problem is not given by blocks */
+  double tol;
+  int useDGELS;
+  MLCPEnumWorkspace * workspaces;
+} MLCPEnumData;
+
+/* Try the case k of the enumeration with the workspace of thread. If the case gives a
+   solution, it is stored in the z and w of the workspace and 1 is returned. */
+static int mlcp_enum_try_case(void * data, int thread, unsigned long long int k)
+{
+  MLCPEnumData * d = (MLCPEnumData *) data;
+  MLCPEnumWorkspace * ws = &d->workspaces[thread];
+  MixedLinearComplementarityProblem* problem = d->problem;
   int n = problem->n;
   int m = problem->m;
+  int npm = n + m;
+  int n_row = problem->M->size0;
+  int NRHS = 1;
+  lapack_int LAinfo = 0;
+  double * M_linear_system = ws->M_linear_system;
+  double * q_linear_system = ws->q_linear_system;
 
-  assert(n_col == n+m);
-
-  double * w_e  = w;
-  double * u = z;
-
-
-  double tol = options->dparam[SICONOS_DPARAM_TOL];
-  int itermax = options->iparam[SICONOS_IPARAM_MAX_ITER];
-  int useDGELS = options->iparam[SICONOS_IPARAM_MLCP_ENUM_USE_DGELS];
-
-  /*  LWORK = 2*npm; LWORK >= max( 1, MN + max( MN, NRHS ) ) where MN = min(M,N)*/
-  //verbose=1;
-  numerics_printf_verbose(1,"mlcp_enum_block BEGIN, n %d m %d tol %lf", n, m, tol);
-
-  double * M_linear_system = options->dWork;
-  /*  q_linear_system = M_linear_system + npm*npm;*/
-  double * q_linear_system = M_linear_system + (n + m) * n_row;
-  /*  q_linear_system_ref = q_linear_system  + m + n;*/
-  double * q_linear_system_ref = q_linear_system  + n_row;
-
-  double * work_DGELS = q_linear_system_ref + n_row;
-
-  for(int row = 0; row < n_row; row++)
-    q_linear_system_ref[row] =  - problem->q[row];
-
-  int * zw_indices = options->iWork;
-  lapack_int * ipiv = zw_indices + m;
-  int * indexInBlock = ipiv + m + n;
-  if(m == 0)
-    indexInBlock = 0;
-  *info = 0;
-  mlcp_enum_build_indexInBlock(problem, indexInBlock);
+  enum_case(ws->zw_indices, m, k);
+  if(d->indexInBlock)
+    mlcp_enum_build_M_Block(ws->zw_indices, M_linear_system, problem->M->matrix0, n, m, n_row, d->indexInBlock);
+  else
+    mlcp_enum_build_M(ws->zw_indices, M_linear_system, problem->M->matrix0, n, m, n_row);
 
-  EnumerationStruct * enum_struct = enum_init(problem->m);
+  /* copy q_ref in q */
+  memcpy(q_linear_system, d->q_linear_system_ref, n_row * sizeof(double));
 
-  unsigned long long int nbCase =  enum_compute_nb_cases(problem->m);
+  if(verbose > 1)
+    print_current_system(problem, M_linear_system, q_linear_system);
 
-  if(itermax < (int)nbCase)
+  if(d->useDGELS)
   {
-    numerics_warning("mlcp_enum_block", "all the cases will not be enumerated since itermax < nbCase)");
+    DGELS(LA_NOTRANS,n_row, npm, NRHS, M_linear_system, n_row, q_linear_system, n_row, &LAinfo);
+    numerics_printf_verbose(1,"Solution of dgels");
   }
-
-  while(enum_next(zw_indices, problem->m, enum_struct) && itermax-- > 0)
+  else
   {
-    mlcp_enum_build_M_Block(zw_indices, M_linear_system, problem->M->matrix0, n, m, n_row, indexInBlock);
-
-    /* copy q_ref in q */
-    memcpy(q_linear_system, q_linear_system_ref, n_row * sizeof(double));
+    DGESV(npm, NRHS, M_linear_system, npm, ws->ipiv, q_linear_system, npm, &LAinfo);
+    numerics_printf_verbose(1,"Solution of dgesv");
+  }
+  if(verbose > 1)
+  {
+    NM_dense_display(q_linear_system, n_row, 1, 0);
+  }
+  if(LAinfo)
+  {
+    numerics_printf_verbose(1,"LU factorization failed:\n");
+    return 0;
+  }
 
-    if(verbose >1)
-      print_current_system(problem, M_linear_system, q_linear_system);
-    if(useDGELS)
+  if(d->useDGELS)
+  {
+    for(int ii = 0; ii < npm; ii++)
     {
-      DGELS(LA_NOTRANS,n_row, npm, NRHS, M_linear_system, n_row, q_linear_system, n_row,&LAinfo);
-      numerics_printf_verbose(1,"Solution of dgels");
+      if(isnan(q_linear_system[ii]) || isinf(q_linear_system[ii]))
       {
-        NM_dense_display(q_linear_system, n_row, 1, 0);
+        numerics_printf_verbose(1,"DGELS FAILED");
+        return 0;
       }
     }
-    else
-    {
-      DGESV(npm, NRHS, M_linear_system, npm, ipiv, q_linear_system, npm, &LAinfo);
-      numerics_printf_verbose(1,"Solution of dgesv");
-      if(LAinfo != 0)
-        numerics_printf_verbose(1,"DGESV FAILED");
-      else
-        numerics_printf_verbose(1,"DGESV SUCCEED");
 
-      if(verbose > 1)
-      {
-        NM_dense_display(q_linear_system, n_row, 1, 0);
-      }
-    }
-    if(!LAinfo)
+    if(n_row > npm)
     {
-      if(useDGELS)
-      {
-        int cc = 0;
-        int ii;
-
-        for(ii = 0; ii < npm; ii++)
-        {
-          if(isnan(q_linear_system[ii]) || isinf(q_linear_system[ii]))
-          {
-            numerics_printf_verbose(1,"DGELS FAILED");
-            cc = 1;
-            break;
-          }
-        }
-        if(cc)
-          continue;
-
-        if(n_row > npm)
-        {
-          double residual = cblas_dnrm2(n_row - npm, q_linear_system + npm, 1);
-
-          if(residual > tol || isnan(residual) || isinf(residual))
-          {
-            numerics_printf_verbose(1,"DGELS, optimal point doesn't satisfy AX=b, residual = %e", residual);
-            continue;
-          }
-          numerics_printf_verbose(1,"DGELS, optimal point residual = %e", residual);
-        }
-      }
+      double residual = cblas_dnrm2(n_row - npm, q_linear_system + npm, 1);
 
-
-      numerics_printf_verbose(1,"Solving linear system success, solution in cone?");
-      if(verbose > 1)
-      {
-        NM_dense_display(q_linear_system, n_row, 1, 0);
-      }
-
-      check = 1;
-      for(int row = 0 ; row < m; row++)
-      {
-        if(q_linear_system[indexInBlock[row]] < - tol)
-        {
-          check = 0;
-          break;/*out of the cone!*/
-        }
-      }
-      if(!check)
-        continue;
-      else
+      if(residual > d->tol || isnan(residual) || isinf(residual))
       {
-        double err;
-        mlcp_enum_fill_solution_Block(u, w_e, n, m, n_row, zw_indices, q_linear_system, indexInBlock);
-        mlcp_compute_error(problem, z, w, tol, &err);
-        /*because it happens the LU leads to an wrong solution witout raise any error.*/
-        if(err > 10 * tol)
-        {
-          numerics_printf_verbose(1,"LU no-error, but mlcp_compute_error out of tol: %e!", err);
-          continue;
-        }
-        numerics_printf_verbose(1,"mlcp_enum_block find a solution err = %e!", err);
-        if(verbose)
-        {
-          mlcp_enum_display_solution_Block(u, w_e, n, m, n_row, indexInBlock);
-        }
-        // options->iparam[1]=scurrent-1;
-        numerics_printf_verbose(1,"mlcp_enum_block END");
-        options->dparam[SICONOS_DPARAM_RESIDU] = err;
-        return;
+        numerics_printf_verbose(1,"DGELS, optimal point doesn't satisfy AX=b, residual = %e", residual);
+        return 0;
       }
+      numerics_printf_verbose(1,"DGELS, optimal point residual = %e", residual);
     }
-    else
-    {
+  }
 
-      numerics_printf_verbose(1,"LU factorization failed:\n");
+  numerics_printf_verbose(1,"Solving linear system success, solution in cone?");
 
-    }
+  for(int row = 0 ; row < m; row++)
+  {
+    int index = d->indexInBlock ? d->indexInBlock[row] : n + row;
+    if(q_linear_system[index] < - d->tol)
+      return 0; /*out of the cone!*/
   }
-  *info = 1;
-  numerics_printf_verbose(1,"mlcp_enum_block failed!\n");
-  DEBUG_END(" mlcp_enum_block(...)\n");
-}
 
+  double err;
+  if(d->indexInBlock)
+    mlcp_enum_fill_solution_Block(ws->z, ws->w, n, m, n_row, ws->zw_indices, q_linear_system, d->indexInBlock);
+  else
+    mlcp_enum_fill_solution(ws->z, ws->z + n, ws->w, ws->w + (n_row - m), n, m, n_row, ws->zw_indices, q_linear_system);
+  mlcp_compute_error(problem, ws->z, ws->w, d->tol, &err);
+  /*because it happens the LU leads to an wrong solution witout raise any error.*/
+  if(err > 10 * d->tol)
+  {
+    numerics_printf_verbose(1,"LU no-error, but mlcp_compute_error out of tol: %e!", err);
+    return 0;
+  }
+  numerics_printf_verbose(1,"mlcp_enum find a solution, err=%e !", err);
+  return 1;
+}
 
 /** End of static functions **/
 
@@ -280,168 +216,119 @@ int mlcp_enum_getNbDWork(MixedLinearComplementarityProblem* problem, SolverOptio
 
 void mlcp_enum(MixedLinearComplementarityProblem* problem, double *z, double *w, int *info, SolverOptions* options)
 {
-  /* verbose=1; */
-  int nbSol = 0;
-  if(problem->blocksRows)
-  {
-    mlcp_enum_block(problem, z, w, info, options);
-    return;
-  }
-
-  int * workingInt = options->iWork;
-  int npm = (problem->n) + (problem->m);
-  int NRHS = 1;
-  lapack_int * ipiv;
-  int check;
-  lapack_int LAinfo = 0;
-  *info = 0;
+  assert(problem->M);
+  assert(problem->M->matrix0);
+  assert(problem->q);
 
   /* sizes of the problem */
   int n_row = problem->M->size0;
   int n  = problem->n;
   int m = problem->m;
+  int npm = n + m;
+
+  assert(problem->M->size1 == npm);
 
   /* user parameters */
   double tol = options->dparam[SICONOS_DPARAM_TOL];
   int itermax = options->iparam[SICONOS_IPARAM_MAX_ITER];
-  int useDGELS = options->iparam[SICONOS_IPARAM_MLCP_ENUM_USE_DGELS];
-
 
-  /*OUTPUT param*/
-  double * w_e = w;
-  double * w_i = w + (n_row - problem->m); /*sW2 size :m */
-  double * u = z;
-  double * v = z + problem->n;
+  MLCPEnumData data;
+  data.problem = problem;
+  data.tol = tol;
+  data.useDGELS = options->iparam[SICONOS_IPARAM_MLCP_ENUM_USE_DGELS];
 
   /*  LWORK = 2*npm; LWORK >= max( 1, MN + max( MN, NRHS ) ) where MN = min(M,N)*/
-  //  verbose=1;
   numerics_printf_verbose(1,"mlcp_enum BEGIN, n %d m %d tol %lf\n", n, m, tol);
 
   double * M_linear_system = options->dWork;
   /*  q_linear_system = M_linear_system + npm*npm;*/
   double * q_linear_system = M_linear_system + (n + m) * n_row;
   /*  q_linear_system_ref = q_linear_system + m + n;*/
-  double * q_linear_system_ref = q_linear_system + n_row;
-
-  double * work_DGELS = q_linear_system_ref + n_row;
+  data.q_linear_system_ref = q_linear_system + n_row;
 
   for(int row = 0; row < n_row; row++)
-    q_linear_system_ref[row] =  - problem->q[row];
-
-  int * zw_indices = workingInt;
-  ipiv = zw_indices + m;
-  EnumerationStruct * enum_struct = enum_init(problem->m);
+    data.q_linear_system_ref[row] =  - problem->q[row];
 
-  while(enum_next(zw_indices, problem->m, enum_struct) && itermax-- > 0)
+  int * zw_indices = options->iWork;
+  lapack_int * ipiv = zw_indices + m;
+  data.indexInBlock = NULL;
+  if(problem->blocksRows && m > 0)
   {
-    mlcp_enum_build_M(zw_indices, M_linear_system, problem->M->matrix0, n, m, n_row);
+    data.indexInBlock = ipiv + m + n;
+    mlcp_enum_build_indexInBlock(problem, data.indexInBlock);
+  }
 
-    /* copy q_ref in q */
-    memcpy(q_linear_system, q_linear_system_ref, n_row * sizeof(double));
+  unsigned long long int nbCase = enum_compute_nb_cases(m);
+  unsigned long long int nbTries = nbCase;
+  if(itermax < 0)
+    nbTries = 0;
+  else if((unsigned long long int)itermax < nbCase)
+  {
+    if(problem->blocksRows)
+      numerics_warning("mlcp_enum_block", "all the cases will not be enumerated since itermax < nbCase)");
+    nbTries = (unsigned long long int)itermax;
+  }
 
-    if(verbose > 1)
-      print_current_system(problem, M_linear_system, q_linear_system);
+  /* the first workspace is the one of options, the other threads have their own one */
+  int nthreads = enum_number_of_threads(options->iparam[SICONOS_IPARAM_MLCP_ENUM_NUMBER_OF_THREADS]);
+  int w_size = n_row > npm ? n_row : npm;
+  MLCPEnumWorkspace * workspaces = (MLCPEnumWorkspace *) malloc(nthreads * sizeof(MLCPEnumWorkspace));
+  workspaces[0].M_linear_system = M_linear_system;
+  workspaces[0].q_linear_system = q_linear_system;
+  workspaces[0].zw_indices = zw_indices;
+  workspaces[0].ipiv = ipiv;
+  workspaces[0].z = z;
+  workspaces[0].w = w;
+  for(int t = 1; t < nthreads; t++)
+  {
+    workspaces[t].M_linear_system = (double *) malloc((npm * n_row + n_row + npm + w_size) * sizeof(double));
+    workspaces[t].q_linear_system = workspaces[t].M_linear_system + npm * n_row;
+    workspaces[t].z = workspaces[t].q_linear_system + n_row;
+    workspaces[t].w = workspaces[t].z + npm;
+    workspaces[t].zw_indices = (int *) malloc((m + npm) * sizeof(int));
+    workspaces[t].ipiv = workspaces[t].zw_indices + m;
+  }
+  data.workspaces = workspaces;
 
-    if(useDGELS)
-    {
-      DGELS(LA_NOTRANS,n_row, npm, NRHS, M_linear_system, n_row, q_linear_system, n_row, &LAinfo);
-      numerics_printf_verbose(1,"Solution of dgels\n");
-      if(verbose > 1)
-      {
-        NM_dense_display(q_linear_system, n_row, 1, 0);
-      }
-    }
-    else
+  int thread;
+  unsigned long long int k = enum_search(nbTries, nthreads, mlcp_enum_try_case, &data, &thread);
+  if(k < nbTries)
+  {
+    *info = 0;
+    if(thread)
     {
-      DGESV(npm, NRHS, M_linear_system, npm, ipiv, q_linear_system, npm, &LAinfo);
-      numerics_printf_verbose(1,"Solution of dgesv\n");
-      if(verbose > 1)
-      {
-        NM_dense_display(q_linear_system, n_row, 1, 0);
-      }
+      memcpy(z, workspaces[thread].z, npm * sizeof(double));
+      memcpy(w, workspaces[thread].w, w_size * sizeof(double));
     }
-    if(!LAinfo)
+    mlcp_compute_error(problem, z, w, tol, &options->dparam[SICONOS_DPARAM_RESIDU]);
+    if(verbose > 1)
     {
-      if(useDGELS)
-      {
-        int cc = 0;
-        int ii;
-        for(ii = 0; ii < npm; ii++)
-        {
-          if(isnan(q_linear_system[ii]) || isinf(q_linear_system[ii]))
-          {
-            numerics_printf_verbose(1,"DGELS FAILED\n");
-            cc = 1;
-            break;
-          }
-        }
-        if(cc)
-          continue;
-
-        if(n_row > npm)
-        {
-          double residual = cblas_dnrm2(n_row - npm, q_linear_system + npm, 1);
-
-          if(residual > tol || isnan(residual) || isinf(residual))
-          {
-            numerics_printf_verbose(1,"DGELS, optimal point doesn't satisfy AX=b, residual = %e\n", residual);
-            continue;
-          }
-          numerics_printf_verbose(1,"DGELS, optimal point residual = %e\n", residual);
-        }
-      }
-
-      numerics_printf_verbose(1,"Solving linear system success, solution in cone?\n");
-      if(verbose > 1)
-      {
-        NM_dense_display(q_linear_system, n_row, 1, 0);
-      }
-
-      check = 1;
-      for(int row = 0 ; row < m; row++)
-      {
-        if(q_linear_system[n + row] < - tol)
-        {
-          check = 0;
-          break;/*out of the cone!*/
-        }
-      }
-      if(!check)
-        continue;
+      if(data.indexInBlock)
+        mlcp_enum_display_solution_Block(z, w, n, m, n_row, data.indexInBlock);
       else
-      {
-        double err;
-        mlcp_enum_fill_solution(u, v, w_e, w_i, n, m, n_row, zw_indices, q_linear_system);
-        mlcp_compute_error(problem, z, w, tol, &err);
-        /*because it happens the LU leads to an wrong solution witout raise any error.*/
-        if(err > 10 * tol)
-        {
-          numerics_printf_verbose(1,"LU no-error, but mlcp_compute_error out of tol: %e!\n", err);
-          continue;
-        }
-        nbSol++;
-        numerics_printf_verbose(1,"mlcp_enum find a solution, err=%e !\n", err);
-        if(verbose >1)
-        {
-          mlcp_enum_display_solution(u, v, w_e, w_i, n, m, n_row);
-        }
-        numerics_printf_verbose(1,"mlcp_enum END");
-        return;
-      }
-    }
-    else
-    {
-      numerics_printf_verbose(1,"LU factorization failed:\n");
+        mlcp_enum_display_solution(z, z + n, w, w + (n_row - m), n, m, n_row);
     }
+    numerics_printf_verbose(1,"mlcp_enum END");
+  }
+  else
+  {
+    *info = 1;
+    numerics_printf_verbose(1,"mlcp_enum failed!\n");
+  }
+
+  for(int t = 1; t < nthreads; t++)
+  {
+    free(workspaces[t].M_linear_system);
+    free(workspaces[t].zw_indices);
   }
-  *info = 1;
-  numerics_printf_verbose(1,"mlcp_enum failed nbSol=%i!\n", nbSol);
+  free(workspaces);
 }
 
 void mlcp_enum_set_default(SolverOptions* options)
 {
   options->iparam[SICONOS_IPARAM_MAX_ITER] = 10000000;
   options->dparam[SICONOS_IPARAM_MLCP_ENUM_USE_DGELS] = 0;
+  options->iparam[SICONOS_IPARAM_MLCP_ENUM_NUMBER_OF_THREADS] = 1;
   options->filterOn = false;
 
 }
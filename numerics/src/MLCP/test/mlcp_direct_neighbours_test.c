@@ -0,0 +1,96 @@
+/* Siconos is a program dedicated to modeling, simulation and control
+ * of non smooth dynamical systems.
+ *
+ * Copyright 2020 INRIA.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+*/
+#include <math.h>                               // for sin
+#include <stdio.h>                              // for printf, fprintf, stderr
+#include <stdlib.h>                             // for free, malloc, calloc
+#include <string.h>                             // for memcpy
+#include "MLCP_Solvers.h"                       // for mlcp_compute_error
+#include "MixedLinearComplementarityProblem.h"  // for MixedLinearComplement...
+#include "NonSmoothDrivers.h"                   // for mlcp_driver
+#include "SolverOptions.h"                      // for SolverOptions, solver...
+#include "mlcp_cst.h"                           // for SICONOS_MLCP_DIRECT_ENUM
+
+#define NSTEPS 40
+
+/* solve a sequence of problems with a varying q with the direct solver,
+ * without and with the search of the neighbours of the stored
+ * configurations, and check the solutions */
+static int solve_sequence(MixedLinearComplementarityProblem* problem, double * q0,
+                          int neighbours, int * failures)
+{
+  int info = 0;
+  int size = problem->n + problem->m;
+  double * z = (double *)calloc(size, sizeof(double));
+  double * w = (double *)calloc(size, sizeof(double));
+  SolverOptions * options = solver_options_create(SICONOS_MLCP_DIRECT_ENUM);
+  options->iparam[SICONOS_IPARAM_MLCP_DIRECT_NEIGHBOURS] = neighbours;
+
+  mlcp_driver_init(problem, options);
+  for(int step = 0; step < NSTEPS && !info; step++)
+  {
+    /* slow variation of q, the active set changes from time to time */
+    for(int i = 0; i < size; i++)
+      problem->q[i] = q0[i] * (1.0 + 0.5 * sin(0.1 * step + i));
+    info = mlcp_driver(problem, z, w, options);
+    double error = 0.;
+    if(!info && mlcp_compute_error(problem, z, w, 1e-9, &error))
+    {
+      fprintf(stderr, "mlcp_direct_neighbours_test: wrong solution at step %d, error %e\n", step, error);
+      info = 1;
+    }
+  }
+  /* number of calls where no stored configuration fits */
+  *failures = options->iparam[7];
+  mlcp_driver_reset(problem, options);
+  memcpy(problem->q, q0, size * sizeof(double));
+
+  solver_options_delete(options);
+  free(z);
+  free(w);
+  return info;
+}
+
+int main(void)
+{
+  MixedLinearComplementarityProblem* problem = (MixedLinearComplementarityProblem *)malloc(sizeof(MixedLinearComplementarityProblem));
+  int info = mixedLinearComplementarity_newFromFilename(problem, "./data/BuckConverter_mlcp.dat");
+  if(info)
+  {
+    fprintf(stderr, "mlcp_direct_neighbours_test: unable to read the problem\n");
+    return info;
+  }
+  int size = problem->n + problem->m;
+  double * q0 = (double *)malloc(size * sizeof(double));
+  memcpy(q0, problem->q, size * sizeof(double));
+
+  int failures = 0, failuresWithNeighbours = 0;
+  info = solve_sequence(problem, q0, 0, &failures);
+  if(!info)
+    info = solve_sequence(problem, q0, 3, &failuresWithNeighbours);
+  printf("mlcp_direct_neighbours_test: %d enumerations without neighbours, %d with neighbours\n",
+         failures, failuresWithNeighbours);
+  if(!info && failuresWithNeighbours >= failures)
+  {
+    fprintf(stderr, "mlcp_direct_neighbours_test: the search of the neighbours should reduce the number of enumerations\n");
+    info = 1;
+  }
+
+  free(q0);
+  mixedLinearComplementarity_free(problem);
+  return info;
+}
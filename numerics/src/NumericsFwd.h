@@ -47,6 +47,7 @@ TYPEDEF_STRUCT(MixedComplementarityProblem)
 TYPEDEF_STRUCT(LinearComplementarityProblem)
 TYPEDEF_STRUCT(LinearComplementarityProblem_as_ConvexQP)
 TYPEDEF_STRUCT(GlobalFrictionContactProblem)
+TYPEDEF_STRUCT(GlobalFrictionContactOperator)
 TYPEDEF_STRUCT(RollingFrictionContactProblem)
 TYPEDEF_STRUCT(GenericMechanicalProblem)
 TYPEDEF_STRUCT(listNumericsProblem)
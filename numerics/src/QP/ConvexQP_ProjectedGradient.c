@@ -26,6 +26,7 @@
 #include "NumericsMatrix.h"         // for NM_gemv
 #include "SolverOptions.h"          // for SolverOptions, solver_options_nul...
 #include "debug.h"                  // for DEBUG_PRINTF
+#include "fixed_point_acceleration.h" // for fixed_point_acceleration_update
 #include "numerics_verbose.h"       // for numerics_error, verbose, numerics...
 #include "SiconosBlas.h"                  // for cblas_dcopy, cblas_daxpy, cblas_ddot
 
@@ -106,6 +107,9 @@ void convexQP_ProjectedGradient(ConvexQP* problem, double *z, double *w, int* in
   double alpha = 1.0;
   double beta = 1.0;
 
+  fixed_point_acceleration * acc = fixed_point_acceleration_new(n, options);
+  double * z_prev = acc ? (double *)malloc(n * sizeof(double)) : NULL;
+
   if(!isVariable)
   {
     double minusrho  = -1.0*rho;
@@ -120,12 +124,22 @@ void convexQP_ProjectedGradient(ConvexQP* problem, double *z, double *w, int* in
       /* M z + q --> w */
       NM_gemv(alpha, M, z, beta, w);
 
+      if(acc)
+        cblas_dcopy(n, z, 1, z_prev, 1);
+
       /* projection for each contact of z - rho * w  */
       cblas_daxpy(n, minusrho, w, 1, z, 1);
 
       cblas_dcopy(n, z, 1, z_tmp, 1);
       problem->ProjectionOnC(problem,z_tmp,z);
 
+      /* the extrapolated iterate is projected again */
+      if(fixed_point_acceleration_update(acc, z_prev, z))
+      {
+        cblas_dcopy(n, z, 1, z_tmp, 1);
+        problem->ProjectionOnC(problem,z_tmp,z);
+      }
+
       /* **** Criterium convergence **** */
       // Warning : options->dWork required in the function below !
       convexQP_compute_error_reduced(problem, z, w, tolerance, options, norm_q, &error);
@@ -223,6 +237,12 @@ void convexQP_ProjectedGradient(ConvexQP* problem, double *z, double *w, int* in
         if(rho < rhomin)
           break;
       }
+      /* the extrapolated iterate is projected again */
+      if(fixed_point_acceleration_update(acc, z_k, z))
+      {
+        cblas_dcopy(n, z, 1, z_tmp, 1);
+        problem->ProjectionOnC(problem,z_tmp,z);
+      }
       /* store the old z */
       cblas_dcopy(n, z, 1, z_k, 1);
       /* Compute the value fo the cost function (we use w as tmp) */
@@ -266,6 +286,8 @@ void convexQP_ProjectedGradient(ConvexQP* problem, double *z, double *w, int* in
   if(z_tmp)
     free(z_tmp);
   z_tmp = NULL;
+  free(z_prev);
+  fixed_point_acceleration_free(acc);
   if(isVariable)
   {
     free(z_k);
@@ -282,4 +304,5 @@ void convexQP_ProjectedGradient_set_default(SolverOptions* options)
   options->dparam[SICONOS_CONVEXQP_PGOC_RHOMIN] = 1e-9;
   options->dparam[SICONOS_CONVEXQP_PGOC_LINESEARCH_MU] =0.9;
   options->dparam[SICONOS_CONVEXQP_PGOC_LINESEARCH_TAU]  = 2.0/3.0;
+  fixed_point_acceleration_set_default(options);
 }
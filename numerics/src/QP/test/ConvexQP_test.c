@@ -1,10 +1,12 @@
 #include "ConvexQP.h"
+#include <math.h>                  // for fabs
 #include <stdlib.h>                // for malloc, free
 #include "ConvexQP_Solvers.h"      // for convexQP_ADMM, convexQP_ADMM_setDe...
 #include "ConvexQP_cst.h"          // for SICONOS_CONVEXQP_ADMM_RHO, SICONOS...
 #include "NumericsMatrix.h"        // for NM_create, NM_triplet_alloc, NM_ze...
 #include "NumericsSparseMatrix.h"  // for NSM_TRIPLET, NumericsSparseMatrix
 #include "SolverOptions.h"         // for SolverOptions, solver_options_delete
+#include "fixed_point_acceleration.h" // for SICONOS_ACCELERATION_NESTEROV
 
 
 static void PXtest_0(void *cqpIn, double *x, double *PX)
@@ -600,6 +602,69 @@ static int test_5(void)
   return info;
 }
 
+/* the problem of test_1, solved by the projected gradient with the
+ * acceleration strategy and the step rho (rho < 0: line search).
+ * The solution is x[i] = max(3, i+1). */
+static int test_PG_acceleration(int strategy, double rho)
+{
+
+  ConvexQP cqp;
+
+  convexQP_clear(&cqp);
+  cqp.size=10;
+  cqp.m=10;
+  cqp.env = &cqp;
+
+  NumericsMatrix * M  = NM_create(NM_SPARSE,cqp.size, cqp.size);
+  NM_triplet_alloc(M,0);
+  M->matrix2->origin= NSM_TRIPLET;
+
+  for(int k =0; k< cqp.size; k++)
+  {
+    NM_zentry(M, k, k, 1);
+  }
+
+  double * q = (double *) malloc(cqp.size*sizeof(double));
+  for(int k =0; k< cqp.size; k++)
+  {
+    q[k]=-k-1;
+  }
+
+  cqp.M = M;
+  cqp.ProjectionOnC = &PXtest_1 ;
+  cqp.q = q;
+
+  double x[10], w[10];
+  int i, n=cqp.size;
+  for(i =0; i< n ; i++)
+  {
+    x[i] = i-5;
+  }
+
+  SolverOptions * options = solver_options_create(SICONOS_CONVEXQP_PG);
+  options->dparam[SICONOS_DPARAM_TOL] = 1e-12;
+  options->dparam[SICONOS_CONVEXQP_PGOC_RHO] = rho;
+  options->iparam[SICONOS_IPARAM_ACCELERATION] = strategy;
+  int info;
+  convexQP_ProjectedGradient(&cqp, x, w, &info, options);
+  printf("iterations = %i, error = %e\n",
+         options->iparam[SICONOS_IPARAM_ITER_DONE], options->dparam[SICONOS_DPARAM_RESIDU]);
+
+  for(i =0; i< n ; i++)
+  {
+    double expected = (i+1 > 3) ? i+1 : 3;
+    printf("x[%i]=%f\texpected %f\n",i,x[i],expected);
+    if(fabs(x[i] - expected) > 1e-8)
+      info = 1;
+  }
+
+  solver_options_delete(options);
+  NM_clear(M);
+  free(M);
+  free(q);
+  return info;
+}
+
 int main(int argc, char *argv[])
 {
 
@@ -695,6 +760,32 @@ int main(int argc, char *argv[])
     printf("end test #%i  not  successful\n",i);
   }
 
+  i++;
+  printf("start test #%i ConvexQP_PG_NESTEROV\n",i);
+  info_test = test_PG_acceleration(SICONOS_ACCELERATION_NESTEROV, 0.2);
+  info += info_test;
+  if(!info_test)
+  {
+    printf("end test #%i successful\n",i);
+  }
+  else
+  {
+    printf("end test #%i  not  successful\n",i);
+  }
+
+  i++;
+  printf("start test #%i ConvexQP_PG_ANDERSON\n",i);
+  info_test = test_PG_acceleration(SICONOS_ACCELERATION_ANDERSON, -1.0);
+  info += info_test;
+  if(!info_test)
+  {
+    printf("end test #%i successful\n",i);
+  }
+  else
+  {
+    printf("end test #%i  not  successful\n",i);
+  }
+
 #ifdef SICONOS_HAS_MPI
   MPI_Finalize();
 #endif
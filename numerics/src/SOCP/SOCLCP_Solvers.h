@@ -134,6 +134,17 @@ extern "C"
 /* *\/ */
 /* void soclcp_ProjectedGradientOnCylinder(SecondOrderConeLinearComplementarityProblem* problem, double *r, double *v, int* info, SolverOptions* options); */
 
+/** Fixed Point Projection solver (VI_FPP) for SOCLCP problem based on a VI reformulation
+    \param problem the SOCLCP problem to solve
+    \param v global vector (n), in-out parameter
+    \param r global vector (n), in-out parameters
+    \param info return 0 if the solution is found
+    \param options the solver options :
+    iparam[0] : Maximum iteration number
+    iparam[SICONOS_IPARAM_SOCLCP_VI_NUMBER_OF_THREADS] : number of threads used for
+    the products with M and the projections on the cones (OpenMP, default 1)
+    dparam[3] : rho >0
+*/
 void soclcp_VI_FixedPointProjection(SecondOrderConeLinearComplementarityProblem* problem, double *r, double *v, int* info, SolverOptions* options);
 
 /**Extra Gradient solver (VI_EG) for SOCLCP problem based on a VI reformulation
@@ -143,6 +154,8 @@ void soclcp_VI_FixedPointProjection(SecondOrderConeLinearComplementarityProblem*
     \param info return 0 if the solution is found
     \param options the solver options :
     iparam[0] : Maximum iteration number
+    iparam[SICONOS_IPARAM_SOCLCP_VI_NUMBER_OF_THREADS] : number of threads used for
+    the products with M and the projections on the cones (OpenMP, default 1)
     dparam[3] : rho >0
 */
 void soclcp_VI_ExtraGradient(SecondOrderConeLinearComplementarityProblem* problem, double *r, double *v, int* info, SolverOptions* options);
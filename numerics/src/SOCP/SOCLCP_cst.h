@@ -60,6 +60,8 @@ enum SICONOS_IPARAM_SOCLCP
 {
  SICONOS_IPARAM_SOCLCP_NSGS_WITH_RELAXATION = 8,
  SICONOS_IPARAM_SOCLCP_PROJECTION_CONE_INDEX = 4,
+ /** number of threads of the function and projection evaluations in the VI solvers */
+ SICONOS_IPARAM_SOCLCP_VI_NUMBER_OF_THREADS = 11,
 };
 
 
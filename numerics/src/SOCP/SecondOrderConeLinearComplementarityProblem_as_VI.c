@@ -16,7 +16,7 @@
  * limitations under the License.
 */
 #include "SecondOrderConeLinearComplementarityProblem_as_VI.h"
-#include "NumericsMatrix.h"                               // for NM_gemv
+#include "NumericsMatrix.h"                               // for NM_gemv_threaded
 #include "SecondOrderConeLinearComplementarityProblem.h"  // for SecondOrder...
 #include "VariationalInequality.h"                        // for Variational...
 /* #define DEBUG_STDOUT */
@@ -36,7 +36,7 @@ void Function_VI_SOCLCP(void * self, int n_notused, double *x, double *F)
   int n =   soclcp->n;
 
   cblas_dcopy(n, soclcp->q, 1, F, 1);
-  NM_gemv(1.0, soclcp->M, x, 1.0, F);
+  NM_gemv_threaded(1.0, soclcp->M, x, 1.0, F, pb->nthreads);
 }
 
 
@@ -49,13 +49,16 @@ void Projection_VI_SOCLCP(void *viIn, double *x, double *PX)
   SecondOrderConeLinearComplementarityProblem * soclcp = pb->soclcp;
   //SecondOrderConeLinearComplementarityProblem_display(soclcp);
 
-  int cone =0;
   int n = soclcp->n;
+  int nc = soclcp->nc;
   cblas_dcopy(n, x, 1, PX, 1);
-  int dim;
-  for(cone = 0 ; cone < soclcp->nc  ; ++cone)
+  /* the cones are disjoint: they are projected independently */
+#ifdef _OPENMP
+#pragma omp parallel for num_threads(pb->nthreads) if(pb->nthreads > 1) schedule(dynamic, 64)
+#endif
+  for(int cone = 0 ; cone < nc  ; ++cone)
   {
-    dim=soclcp->coneIndex[cone+1]-soclcp->coneIndex[cone];
+    int dim=soclcp->coneIndex[cone+1]-soclcp->coneIndex[cone];
     projectionOnSecondOrderCone(&PX[soclcp->coneIndex[cone]], soclcp->tau[cone], dim);
   }
 }
@@ -34,6 +34,8 @@ struct SecondOrderConeLinearComplementarityProblem_as_VI
   VariationalInequality * vi;
   /* the SOCLCP associated with the VI  */
   SecondOrderConeLinearComplementarityProblem * soclcp;
+  /* number of threads of Function_VI_SOCLCP and Projection_VI_SOCLCP */
+  int nthreads;
 };
 
 
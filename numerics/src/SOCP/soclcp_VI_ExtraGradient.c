@@ -56,6 +56,8 @@ void soclcp_VI_ExtraGradient(SecondOrderConeLinearComplementarityProblem* proble
 
   soclcp_as_vi->vi = vi;
   soclcp_as_vi->soclcp = problem;
+  soclcp_as_vi->nthreads = options->iparam[SICONOS_IPARAM_SOCLCP_VI_NUMBER_OF_THREADS] > 1 ?
+                           options->iparam[SICONOS_IPARAM_SOCLCP_VI_NUMBER_OF_THREADS] : 1;
   /* soclcp_display(fc3d_as_vi->fc3d); */
 
   variationalInequality_ExtraGradient(vi, reaction, velocity, info, options);
@@ -0,0 +1,86 @@
+/* Siconos is a program dedicated to modeling, simulation and control
+ * of non smooth dynamical systems.
+ *
+ * Copyright 2020 INRIA.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+*/
+#include <stdio.h>                                        // for printf, fprintf
+#include <stdlib.h>                                       // for calloc, free
+#include <string.h>                                       // for memcmp
+#include "NonSmoothDrivers.h"                             // for soclcp_driver
+#include "SOCLCP_cst.h"                                   // for SICONOS_SOCLCP_VI_FPP
+#include "SecondOrderConeLinearComplementarityProblem.h"  // for SecondOrderCo...
+#include "SiconosConfig.h"                                // for WITH_OPENMP // IWYU pragma: keep
+#include "SolverOptions.h"                                // for SolverOptions
+
+/* solve the problem with 1 and 2 threads: the threaded product and
+ * projections give the same values, hence the same iterates */
+static int compare_threads(SecondOrderConeLinearComplementarityProblem* problem,
+                           int solverId, const char * name)
+{
+  int info = 0;
+  int found[2];
+  int iter[2];
+  double * r[2];
+  double * v[2];
+  int nthreads[2] = {1, 2};
+  int n = problem->n;
+  for(int i = 0; i < 2; i++)
+  {
+    r[i] = (double *)calloc(n, sizeof(double));
+    v[i] = (double *)calloc(n, sizeof(double));
+    SolverOptions * options = solver_options_create(solverId);
+    options->dparam[SICONOS_DPARAM_TOL] = 1e-8;
+    options->iparam[SICONOS_IPARAM_MAX_ITER] = 100000;
+    options->iparam[SICONOS_IPARAM_SOCLCP_VI_NUMBER_OF_THREADS] = nthreads[i];
+    found[i] = soclcp_driver(problem, r[i], v[i], options);
+    iter[i] = options->iparam[SICONOS_IPARAM_ITER_DONE];
+    solver_options_delete(options);
+  }
+  printf("soclcp_vi_threads_test, %s: info %d in %d iterations with 1 thread, info %d in %d iterations with 2 threads\n",
+         name, found[0], iter[0], found[1], iter[1]);
+  if(found[0] || found[1] || iter[0] != iter[1]
+     || memcmp(r[0], r[1], n * sizeof(double)) || memcmp(v[0], v[1], n * sizeof(double)))
+  {
+    fprintf(stderr, "soclcp_vi_threads_test, %s: the solutions differ\n", name);
+    info = 1;
+  }
+  for(int i = 0; i < 2; i++)
+  {
+    free(r[i]);
+    free(v[i]);
+  }
+  return info;
+}
+
+int main(void)
+{
+#ifndef WITH_OPENMP
+  /* one thread whatever the options: nothing to compare */
+  printf("soclcp_vi_threads_test: Siconos built without OpenMP, test skipped.\n");
+  return 77;
+#endif
+  int info = 0;
+  SecondOrderConeLinearComplementarityProblem* problem =
+    (SecondOrderConeLinearComplementarityProblem *)malloc(sizeof(SecondOrderConeLinearComplementarityProblem));
+  FILE * finput = fopen("./data/Example1_SOCLCP_SBM.dat", "r");
+  secondOrderConeLinearComplementarityProblem_newFromFile(problem, finput);
+  fclose(finput);
+
+  info += compare_threads(problem, SICONOS_SOCLCP_VI_FPP, "VI_FPP");
+  info += compare_threads(problem, SICONOS_SOCLCP_VI_EG, "VI_EG");
+
+  freeSecondOrderConeLinearComplementarityProblem(problem);
+  return info;
+}
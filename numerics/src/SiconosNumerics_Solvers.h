@@ -53,6 +53,7 @@ SICONOS_SOLVER_MACRO(SICONOS_LCP_PATHSEARCH); \
 SICONOS_SOLVER_MACRO(SICONOS_LCP_PIVOT_LUMOD); \
 SICONOS_SOLVER_MACRO(SICONOS_LCP_GAMS); \
 SICONOS_SOLVER_MACRO(SICONOS_LCP_CONVEXQP_PG); \
+SICONOS_SOLVER_MACRO(SICONOS_LCP_BLOCK_PIVOT); \
 SICONOS_SOLVER_MACRO(SICONOS_MCP_OLD_FB); \
 SICONOS_SOLVER_MACRO(SICONOS_MCP_NEWTON_FB_FBLSA); \
 SICONOS_SOLVER_MACRO(SICONOS_MCP_NEWTON_MIN_FBLSA); \
@@ -129,8 +130,10 @@ SICONOS_SOLVER_MACRO(SICONOS_FRICTION_3D_ACLMFP);\
 SICONOS_SOLVER_MACRO(SICONOS_FRICTION_3D_ONECONTACT_QUARTIC);\
 SICONOS_SOLVER_MACRO(SICONOS_FRICTION_3D_ONECONTACT_QUARTIC_NU);\
 SICONOS_SOLVER_MACRO(SICONOS_FRICTION_3D_ADMM);\
+SICONOS_SOLVER_MACRO(SICONOS_FRICTION_3D_NSGS_MPI);\
 SICONOS_SOLVER_MACRO(SICONOS_ROLLING_FRICTION_3D_NSGS);\
 SICONOS_SOLVER_MACRO(SICONOS_ROLLING_FRICTION_3D_ONECONTACT_ProjectionOnConeWithLocalIteration);\
+SICONOS_SOLVER_MACRO(SICONOS_ROLLING_FRICTION_3D_JACOBI);\
 SICONOS_SOLVER_MACRO(SICONOS_ROLLING_FRICTION_2D_NSGS);\
 SICONOS_SOLVER_MACRO(SICONOS_ROLLING_FRICTION_2D_ONECONTACT_ProjectionOnConeWithLocalIteration);\
 SICONOS_SOLVER_MACRO(SICONOS_GLOBAL_FRICTION_3D_NSGS_WR);\
@@ -37,7 +37,7 @@
 static int determine_convergence(double error, double *tolerance, int iter,
                                  SolverOptions *options,
                                  VariationalInequality* problem,
-                                 double *z, double *w, double rho)
+                                 double *z, double *w, double rho, double *work)
 
 {
   int hasNotConverged = 1;
@@ -47,7 +47,7 @@ static int determine_convergence(double error, double *tolerance, int iter,
       printf("--------------- VI - Extra Gradient (EG) - Iteration %i "
              "Residual = %14.7e < %7.3e\n", iter, error, *tolerance);
     double absolute_error =0.0;
-    variationalInequality_computeError(problem, z, w, *tolerance, options, &absolute_error);
+    variationalInequality_computeError(problem, z, w, *tolerance, options, &absolute_error, work);
     if(verbose > 0)
       printf("--------------  VI - Extra Gradient (EG)- Full error criterion =  %e\n", absolute_error);
 
@@ -91,12 +91,12 @@ static
 double compute_error(VariationalInequality* problem,
                      double *z, double *w, double norm_z_z_k,
                      double tolerance,
-                     SolverOptions * options)
+                     SolverOptions * options, double * work)
 {
 
   double error;
   if(options->iparam[SICONOS_VI_IPARAM_ERROR_EVALUATION]==SICONOS_VI_ERROR_EVALUATION_FULL)
-    variationalInequality_computeError(problem, z, w, tolerance, options, &error);
+    variationalInequality_computeError(problem, z, w, tolerance, options, &error, work);
   else if(options->iparam[SICONOS_VI_IPARAM_ERROR_EVALUATION]==SICONOS_VI_ERROR_EVALUATION_LIGHT ||
           options->iparam[SICONOS_VI_IPARAM_ERROR_EVALUATION]==SICONOS_VI_ERROR_EVALUATION_LIGHT_WITH_FULL_FINAL)
   {
@@ -140,6 +140,7 @@ void variationalInequality_ExtraGradient(VariationalInequality* problem, double
 
   double * xtmp = (double *)calloc(n,sizeof(double));
   double * wtmp = (double *)calloc(n,sizeof(double));
+  double * error_work = (double *)calloc(2 * n, sizeof(double));
 
   double rho = 0.0, rho_k =0.0;
   int isVariable = 0;
@@ -227,9 +228,9 @@ void variationalInequality_ExtraGradient(VariationalInequality* problem, double
         cblas_daxpy(n, -1.0, x_k, 1, xtmp, 1) ;
         light_error_sum = cblas_dnrm2(n,xtmp,1);
       }
-      error = compute_error(problem, x, w, light_error_sum,  tolerance, options);
+      error = compute_error(problem, x, w, light_error_sum,  tolerance, options, error_work);
       hasNotConverged = determine_convergence(error, &tolerance, iter, options,
-                                              problem, x, w, rho);
+                                              problem, x, w, rho, error_work);
 
 
       if(options->callback)
@@ -335,9 +336,9 @@ void variationalInequality_ExtraGradient(VariationalInequality* problem, double
         DEBUG_EXPR(NV_display(w,n););
 
         /* **** Criterium convergence **** */
-        error = compute_error(problem, x, w, a1,  tolerance, options);
+        error = compute_error(problem, x, w, a1,  tolerance, options, error_work);
         hasNotConverged = determine_convergence(error, &tolerance, iter, options,
-                                                problem, x, w, rho);
+                                                problem, x, w, rho, error_work);
 
         DEBUG_PRINTF("error = %12.8e\t error_k = %12.8e\n",error,error_k);
         /*Update rho*/
@@ -443,9 +444,9 @@ void variationalInequality_ExtraGradient(VariationalInequality* problem, double
 
 
         /* **** Criterium convergence **** */
-        error = compute_error(problem, x, w, a1,  tolerance, options);
+        error = compute_error(problem, x, w, a1,  tolerance, options, error_work);
         hasNotConverged = determine_convergence(error, &tolerance, iter, options,
-                                                problem, x, w, rho);
+                                                problem, x, w, rho, error_work);
 
 
 
@@ -480,6 +481,7 @@ void variationalInequality_ExtraGradient(VariationalInequality* problem, double
   iparam[SICONOS_IPARAM_ITER_DONE] = iter;
   free(xtmp);
   free(wtmp);
+  free(error_work);
   DEBUG_END("variationalInequality_ExtraGradient(VariationalInequality* problem, ...)\n")
 
 }
@@ -34,7 +34,7 @@ static
 int determine_convergence(double error, double *tolerance, int iter,
                           SolverOptions *options,
                           VariationalInequality* problem,
-                          double *z, double *w, double rho)
+                          double *z, double *w, double rho, double *work)
 
 {
   int hasNotConverged = 1;
@@ -44,7 +44,7 @@ int determine_convergence(double error, double *tolerance, int iter,
       printf("--------------- VI - Fixed Point Projection (FPP) - Iteration %i "
              "Residual = %14.7e < %7.3e\n", iter, error, *tolerance);
     double absolute_error =0.0;
-    variationalInequality_computeError(problem, z, w, *tolerance, options, &absolute_error);
+    variationalInequality_computeError(problem, z, w, *tolerance, options, &absolute_error, work);
     if(verbose > 0)
       printf("--------------  VI - Fixed Point Projection (FPP)- Full error criterion =  %e\n", absolute_error);
 
@@ -80,12 +80,12 @@ static
 double compute_error(VariationalInequality* problem,
                      double *z, double *w, double norm_z_z_k,
                      double tolerance,
-                     SolverOptions * options)
+                     SolverOptions * options, double * work)
 {
 
   double error;
   if(options->iparam[SICONOS_VI_IPARAM_ERROR_EVALUATION]==SICONOS_VI_ERROR_EVALUATION_FULL)
-    variationalInequality_computeError(problem, z, w, tolerance, options, &error);
+    variationalInequality_computeError(problem, z, w, tolerance, options, &error, work);
   else if(options->iparam[SICONOS_VI_IPARAM_ERROR_EVALUATION]==SICONOS_VI_ERROR_EVALUATION_LIGHT ||
           options->iparam[SICONOS_VI_IPARAM_ERROR_EVALUATION]==SICONOS_VI_ERROR_EVALUATION_LIGHT_WITH_FULL_FINAL)
   {
@@ -129,6 +129,7 @@ void variationalInequality_FixedPointProjection(VariationalInequality* problem,
 
   double * xtmp = (double *)calloc(n, sizeof(double));
   double * wtmp = (double *)calloc(n, sizeof(double));
+  double * error_work = (double *)calloc(2 * n, sizeof(double));
 
   double rho = 0.0, rho_k =0.0;
   int isVariable = 0;
@@ -192,10 +193,10 @@ void variationalInequality_FixedPointProjection(VariationalInequality* problem,
 
       /* **** Criterium convergence **** */
 
-      variationalInequality_computeError(problem, x, w, tolerance, options, &error);
+      variationalInequality_computeError(problem, x, w, tolerance, options, &error, error_work);
 
       hasNotConverged = determine_convergence(error, &tolerance, iter, options,
-                                              problem, x, w, rho);
+                                              problem, x, w, rho, error_work);
 
       if(options->callback)
       {
@@ -289,10 +290,10 @@ void variationalInequality_FixedPointProjection(VariationalInequality* problem,
         /* **** Criterium convergence **** */
         /* variationalInequality_computeError(problem, x , w, tolerance, options, &error); */
 
-        error = compute_error(problem, x, w, a2,  tolerance, options);
+        error = compute_error(problem, x, w, a2,  tolerance, options, error_work);
 
         hasNotConverged = determine_convergence(error, &tolerance, iter, options,
-                                                problem, x, w, rho);
+                                                problem, x, w, rho, error_work);
 
         DEBUG_EXPR_WE(
           if((error < error_k))
@@ -396,10 +397,10 @@ void variationalInequality_FixedPointProjection(VariationalInequality* problem,
 
         /* **** Criterium convergence **** */
 
-        error = compute_error(problem, x, w, a2,  tolerance, options);
+        error = compute_error(problem, x, w, a2,  tolerance, options, error_work);
 
         hasNotConverged = determine_convergence(error, &tolerance, iter, options,
-                                                problem, x, w, rho);
+                                                problem, x, w, rho, error_work);
         DEBUG_EXPR_WE(
           if((error < error_k))
       {
@@ -501,9 +502,9 @@ void variationalInequality_FixedPointProjection(VariationalInequality* problem,
 
         /* **** Criterium convergence **** */
 
-        error = compute_error(problem, x, w, a1,  tolerance, options);
+        error = compute_error(problem, x, w, a1,  tolerance, options, error_work);
         hasNotConverged = determine_convergence(error, &tolerance, iter, options,
-                                                problem, x, w, rho);
+                                                problem, x, w, rho, error_work);
 
         DEBUG_EXPR_WE(
           if((error < error_k))
@@ -548,6 +549,7 @@ void variationalInequality_FixedPointProjection(VariationalInequality* problem,
   iparam[SICONOS_IPARAM_ITER_DONE] = iter;
   free(xtmp);
   free(wtmp);
+  free(error_work);
 
 }
 
@@ -54,6 +54,7 @@ void variationalInequality_HyperplaneProjection(VariationalInequality* problem,
   double * wtmp = (double *)calloc(n, sizeof(double));
   double * xtmp2 = (double *)calloc(n, sizeof(double));
   double * xtmp3 = (double *)calloc(n, sizeof(double));
+  double * error_work = (double *)calloc(2 * n, sizeof(double));
 
   int isVariable = 0;
 
@@ -172,7 +173,7 @@ void variationalInequality_HyperplaneProjection(VariationalInequality* problem,
 
 
       /* **** Criterium convergence **** */
-      variationalInequality_computeError(problem, x, w, tolerance, options, &error);
+      variationalInequality_computeError(problem, x, w, tolerance, options, &error, error_work);
       DEBUG_EXPR_WE(
         for(int i =0; i< n ; i++)
     {
@@ -208,6 +209,7 @@ void variationalInequality_HyperplaneProjection(VariationalInequality* problem,
   free(xtmp2);
   free(xtmp3);
   free(wtmp);
+  free(error_work);
 
 }
 
@@ -21,7 +21,7 @@
 #include <float.h>                  // for DBL_EPSILON
 #include <math.h>                   // for fabs, sqrt
 #include <stdio.h>                  // for printf
-#include <stdlib.h>                 // for calloc
+#include <stdlib.h>                 // for malloc, free
 #include "SiconosBlas.h"                  // for cblas_daxpy, cblas_dnrm2, cblas_d...
 #include "SiconosSets.h"            // for box_constraints
 #include "SolverOptions.h"          // for SolverOptions
@@ -32,7 +32,7 @@
 int variationalInequality_computeError(
   VariationalInequality* problem,
   double *z, double *w, double tolerance,
-  SolverOptions * options, double * error)
+  SolverOptions * options, double * error, double * work)
 {
 
   assert(problem);
@@ -44,12 +44,9 @@ int variationalInequality_computeError(
   int n = problem->size;
 
   *error = 0.;
-  if(!options->dWork)
-  {
-    options->dWork = (double*)calloc(2*n,sizeof(double));
-  }
-  double *ztmp =  options->dWork;
-  double *wtmp =  &(options->dWork[n]);
+  /* work vectors of the caller, or allocated for this call */
+  double *ztmp = work ? work : (double*)malloc(2*n*sizeof(double));
+  double *wtmp =  &ztmp[n];
 
 
   if(!problem->istheNormVIset)
@@ -76,6 +73,8 @@ int variationalInequality_computeError(
 
   cblas_daxpy(n, -1.0, z, 1, wtmp, 1) ;
   *error = cblas_dnrm2(n, wtmp, incx);
+  if(!work)
+    free(ztmp);
 
   /* Computes error */
   if(fabs(norm_q) > DBL_EPSILON)
@@ -37,17 +37,18 @@ extern "C"
 {
 #endif
 
-  /** Error computation for a VI problem. This function requires dWork to point to
-   * at least 2*n double of allocated memory or it malloc this memory
+  /** Error computation for a VI problem
       \param problem the structure which defines the VI problem
       \param z vector
       \param w vector
       \param tolerance value for error computation
       \param options solver options
       \param[in,out] error value
+      \param work work vector of size 2n (n the size of the problem), or NULL
+      to allocate it for this call only
       \return 0 if ok
    */
-  int variationalInequality_computeError(VariationalInequality* problem, double *z , double *w, double tolerance, SolverOptions * options, double * error);
+  int variationalInequality_computeError(VariationalInequality* problem, double *z , double *w, double tolerance, SolverOptions * options, double * error, double * work);
 
   /** Error computation for a box VI problem, that is\f$ \Pi_box(x-F(x)) - x\f$
       \param problem the structure which defines the VI problem
@@ -59,7 +59,7 @@ int variationalInequality_driver(VariationalInequality* problem,
   if(info == 0)
   {
     double error;
-    variationalInequality_computeError(problem, x, w, options->dparam[SICONOS_DPARAM_TOL], options, &error);
+    variationalInequality_computeError(problem, x, w, options->dparam[SICONOS_DPARAM_TOL], options, &error, NULL);
     printf("variationalInequality_driver. error = %8.4e\n", error);
     return info;
   }
@@ -2611,6 +2611,54 @@ void NM_gemv(const double alpha, NumericsMatrix* A, const double *x,
   }
 }
 
+void NM_gemv_threaded(const double alpha, NumericsMatrix* A, const double *x,
+                      const double beta, double *y, int nthreads)
+{
+  assert(A);
+  assert(x);
+  assert(y);
+
+#ifndef _OPENMP
+  nthreads = 1;
+#endif
+  if(nthreads <= 1)
+  {
+    NM_gemv(alpha, A, x, beta, y);
+    return;
+  }
+
+  switch(A->storageType)
+  {
+  case NM_DENSE:
+  {
+    /* each thread computes a contiguous set of rows */
+    int chunk = (A->size0 + nthreads - 1) / nthreads;
+#ifdef _OPENMP
+#pragma omp parallel for num_threads(nthreads)
+#endif
+    for(int t = 0; t < nthreads; t++)
+    {
+      int start = t * chunk;
+      int size = A->size0 - start < chunk ? A->size0 - start : chunk;
+      if(size > 0)
+        cblas_dgemv(CblasColMajor, CblasNoTrans, size, A->size1,
+                    alpha, A->matrix0 + start, A->size0, x, 1, beta, &y[start], 1);
+    }
+    break;
+  }
+  case NM_SPARSE_BLOCK:
+  {
+    SBM_gemv_threaded(A->size1, A->size0, alpha, A->matrix1, x, beta, y, nthreads);
+    break;
+  }
+  default:
+  {
+    /* the compressed column storage cannot be split by rows */
+    NM_gemv(alpha, A, x, beta, y);
+  }
+  }
+}
+
 /* Numerics Matrix wrapper  for y <- alpha trans(A) x + beta y */
 void NM_tgemv(const double alpha, NumericsMatrix* A, const double *x,
               const double beta, double *y)
@@ -424,6 +424,19 @@ extern "C"
                const double beta,
                double *y);
 
+  /** Matrix vector multiplication y = alpha A x + beta y, with the rows of
+   * y shared between nthreads threads (OpenMP) for the dense and the sparse
+   * block storages. Falls back to NM_gemv otherwise.
+   * \param[in] alpha scalar
+   * \param[in] A a NumericsMatrix
+   * \param[in] x pointer on a dense vector of size A->size1
+   * \param[in] beta scalar
+   * \param[in,out] y pointer on a dense vector of size A->size0
+   * \param[in] nthreads the number of threads
+   */
+  void NM_gemv_threaded(const double alpha, NumericsMatrix* A, const double *x,
+                        const double beta, double *y, int nthreads);
+
   /** Matrix matrix multiplication : C = alpha A B + beta C
    * \param[in] alpha scalar
    * \param[in] A a NumericsMatrix
@@ -186,10 +186,39 @@ void solver_options_print(SolverOptions* options)
 
 
 
+void solver_options_release_workspace(SolverOptions* options)
+{
+  if(!options)
+    return;
+  switch(options->solverId)
+  {
+  case SICONOS_FRICTION_3D_NSGS:
+  case SICONOS_GLOBAL_FRICTION_3D_NSGS_WR:
+    fc3d_nsgs_free_workspace(options);
+    break;
+  /* the values of rho of the local Newton solvers */
+  case SICONOS_FRICTION_3D_ONECONTACT_NSN:
+  case SICONOS_FRICTION_3D_ONECONTACT_NSN_GP:
+  case SICONOS_FRICTION_3D_ONECONTACT_NSN_GP_HYBRID:
+    free(options->dWork);
+    options->dWork = NULL;
+    options->dWorkSize = 0;
+    break;
+  default:
+    break;
+  }
+  if(options->internalSolvers)
+    for(size_t i = 0; i < options->numberOfInternalSolvers; i++)
+      solver_options_release_workspace(options->internalSolvers[i]);
+}
+
 void solver_options_delete(SolverOptions* op)
 {
   if(op)
   {
+    // Workspaces kept between the calls of the solvers.
+    solver_options_release_workspace(op);
+
     // Clear solverParameters and solverData, before anything.
     // Remark : these are specific data. And so, alloc/release
     // memory operations should be handled inside each
@@ -276,7 +305,9 @@ SolverOptions * solver_options_copy(SolverOptions* source)
   if(source->callback)
     options->callback = source->callback; // Note FP: is it really safe to create pointer link here?
 
-  if(source->solverData)
+  // The workspace of fc3d_nsgs is owned by source.
+  if(source->solverData && source->solverId != SICONOS_FRICTION_3D_NSGS
+      && source->solverId != SICONOS_GLOBAL_FRICTION_3D_NSGS_WR)
     options->solverData =source->solverData;
 
   if(source->solverParameters)
@@ -501,6 +532,13 @@ SolverOptions * solver_options_create(int solverId)
     break;
   }
 
+  case SICONOS_LCP_BLOCK_PIVOT:
+  {
+    options = solver_options_initialize(solverId, 10000, 1e-12, 0);
+    lcp_block_pivot_set_default(options);
+    break;
+  }
+
   case SICONOS_LCP_GAMS:
   {
     options = solver_options_initialize(solverId, 10000, 1e-12, 0);
@@ -697,6 +735,12 @@ SolverOptions * solver_options_create(int solverId)
     rfc3d_nsgs_set_default(options);
     break;
   }
+  case SICONOS_ROLLING_FRICTION_3D_JACOBI:
+  {
+    options = solver_options_initialize(solverId, 1000, 1e-4, 1);
+    rfc3d_jacobi_set_default(options);
+    break;
+  }
   case SICONOS_ROLLING_FRICTION_2D_NSGS:
   {
     options = solver_options_initialize(solverId, 1000, 1e-4, 1);
@@ -704,6 +748,12 @@ SolverOptions * solver_options_create(int solverId)
     break;
   }
 
+  case SICONOS_FRICTION_3D_NSGS_MPI:
+  {
+    options = solver_options_initialize(solverId, 1000, 1e-4, 1);
+    fc3d_nsgs_mpi_set_default(options);
+    break;
+  }
   case SICONOS_FRICTION_3D_NSGSV:
   case SICONOS_GLOBAL_FRICTION_3D_NSGSV_WR:
   {
@@ -55,6 +55,8 @@ typedef struct
 
     :func:`solver_options_delete`
 
+    :func:`solver_options_release_workspace`
+
     Details: :ref:`solver_options`
     \endrst
 
@@ -91,6 +93,10 @@ enum SICONOS_IPARAM
   SICONOS_IPARAM_PREALLOC = 2,
   SICONOS_IPARAM_NSGS_SHUFFLE = 5,
   SICONOS_IPARAM_ERROR_EVALUATION = 3, // CHECK IF THERE ARE NO CONFLICT WITH THIS !!
+  /** memory of the Anderson acceleration (see fixed_point_acceleration.h) */
+  SICONOS_IPARAM_ACCELERATION_MEMORY = 16,
+  /** acceleration of the fixed point iterations (see fixed_point_acceleration.h) */
+  SICONOS_IPARAM_ACCELERATION = 18,
   SICONOS_IPARAM_PATHSEARCH_STACKSIZE = 19
 };
 
@@ -111,6 +117,9 @@ enum SICONOS_DPARAM
   {
    SICONOS_DPARAM_TOL = 0,
    SICONOS_DPARAM_RESIDU = 1,
+   /** restart ratio of the residuals of the accelerated fixed point
+       iterations (see fixed_point_acceleration.h) */
+   SICONOS_DPARAM_ACCELERATION_RESTART = 16,
   };
 
 #if defined(__cplusplus) && !defined(BUILD_AS_CPP)
@@ -129,6 +138,14 @@ extern "C"
   */
   void solver_options_delete(SolverOptions * options);
 
+  /** Release the workspaces that some solvers keep in their options
+      between two calls (for instance the local problem of
+      fc3d_nsgs()), in options and in its internal solvers. The options
+      remain valid: the next call of the solver allocates them again.
+      \param options the options of the solver
+  */
+  void solver_options_release_workspace(SolverOptions * options);
+
   /** Create and initialize a SolverOptions struct:
       allocate internal memories, set default values
       depending on the id.
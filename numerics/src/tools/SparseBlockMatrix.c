@@ -371,6 +371,56 @@ void SBM_gemv(unsigned int sizeX, unsigned int sizeY, double alpha, const Sparse
     }
   }
 }
+void SBM_gemv_threaded(unsigned int sizeX, unsigned int sizeY, double alpha, const SparseBlockStructuredMatrix* const restrict A, const double* restrict x, double beta, double* restrict y, int nthreads)
+{
+  /* Product SparseMat - vector, y = alpha*A*x + beta*y, each row of blocks
+     being computed by one thread */
+
+  assert(A);
+  assert(x);
+  assert(y);
+  assert(sizeX == A->blocksize1[A->blocknumber1 - 1]);
+  assert(sizeY == A->blocksize0[A->blocknumber0 - 1]);
+
+#ifndef _OPENMP
+  nthreads = 1;
+#endif
+  if(nthreads <= 1)
+  {
+    SBM_gemv(sizeX, sizeY, alpha, A, x, beta, y);
+    return;
+  }
+
+  int nbRowBlocks = (int)A->blocknumber0;
+#ifdef _OPENMP
+#pragma omp parallel for num_threads(nthreads) schedule(dynamic, 16)
+#endif
+  for(int currentRowNumber = 0; currentRowNumber < nbRowBlocks; ++currentRowNumber)
+  {
+    unsigned int posInY = currentRowNumber ? A->blocksize0[currentRowNumber - 1] : 0;
+    unsigned int nbRows = A->blocksize0[currentRowNumber] - posInY;
+    cblas_dscal(nbRows, beta, &y[posInY], 1);
+    if((size_t)currentRowNumber + 1 >= A->filled1)
+      continue;
+    for(size_t blockNum = A->index1_data[currentRowNumber];
+        blockNum < A->index1_data[currentRowNumber + 1]; ++blockNum)
+    {
+      size_t colNumber = A->index2_data[blockNum];
+      unsigned int posInX = colNumber ? A->blocksize1[colNumber - 1] : 0;
+      unsigned int nbColumns = A->blocksize1[colNumber] - posInX;
+      if(nbRows == 3 && nbColumns == 3)
+      {
+        mvp_alpha3x3(alpha, A->block[blockNum], &x[posInX], &y[posInY]);
+      }
+      else
+      {
+        cblas_dgemv(CblasColMajor, CblasNoTrans, nbRows, nbColumns, alpha, A->block[blockNum],
+                    nbRows, &x[posInX], 1, 1.0, &y[posInY], 1);
+      }
+    }
+  }
+}
+
 void SBM_gemv_3x3(unsigned int sizeX, unsigned int sizeY, const SparseBlockStructuredMatrix* const restrict A,  double* const restrict x, double* restrict y)
 {
   /* Product SparseMat - vector, y = vector product y += alpha*A*x  for block of size 3x3 */
@@ -220,6 +220,22 @@ extern "C"
                double alpha, const SparseBlockStructuredMatrix* const A,
                const double* x, double beta, double* y);
 
+  /** SparseMatrix - vector product y = alpha*A*x + beta*y, the rows of
+      blocks being shared between nthreads threads (OpenMP). Same as
+      SBM_gemv() with one thread or without OpenMP.
+      \param[in] sizeX dim of the vectors x
+      \param[in] sizeY dim of the vectors y
+      \param[in] alpha coefficient
+      \param[in] A the matrix to be multiplied
+      \param[in] x the vector to be multiplied
+      \param[in] beta coefficient
+      \param[in,out] y the resulting vector
+      \param[in] nthreads the number of threads
+  */
+  void SBM_gemv_threaded(unsigned int sizeX, unsigned int sizeY,
+                         double alpha, const SparseBlockStructuredMatrix* const A,
+                         const double* x, double beta, double* y, int nthreads);
+
   /** SparseMatrix - vector product y = A*x + y for block of size 3x3
       \param[in] sizeX dim of the vectors x
       \param[in] sizeY dim of the vectors y
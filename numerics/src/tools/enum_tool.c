@@ -2,6 +2,12 @@
 #include "numerics_verbose.h"                   // for verbose
 #include <stdio.h>                              // for printf
 #include <stdlib.h>                              // for printf
+#ifdef _OPENMP
+#include <omp.h>                                 // for omp_get_thread_num
+#endif
+
+/* number of consecutive cases given to a thread by enum_search */
+#define ENUM_SEARCH_CHUNK 16
 unsigned long long int enum_compute_nb_cases(int M)
 {
   unsigned long long int nbCase = 1;
@@ -65,3 +71,84 @@ int enum_next(int * zw, int size, EnumerationStruct * enum_struct)
 
   return 1;
 }
+
+void enum_case(int * zw, int size, unsigned long long int k)
+{
+  unsigned long long int aux = k;
+  for(int i = 0; i < size; i++)
+  {
+    zw[i] = aux & 1;
+    aux = aux >> 1;
+  }
+}
+
+int enum_number_of_threads(int nthreads)
+{
+#ifdef _OPENMP
+  return nthreads > 1 ? nthreads : 1;
+#else
+  return 1;
+#endif
+}
+
+unsigned long long int enum_search(unsigned long long int nb, int nthreads,
+                                   enum_try_case try_case, void * data, int * thread)
+{
+  *thread = 0;
+  nthreads = enum_number_of_threads(nthreads);
+#ifdef _OPENMP
+  if(nthreads > 1 && nb > ENUM_SEARCH_CHUNK)
+  {
+    unsigned long long int best = nb;
+    int best_thread = 0;
+    unsigned long long int next_chunk = 0;
+#pragma omp parallel num_threads(nthreads)
+    {
+      int t = omp_get_thread_num();
+      int found = 0;
+      while(!found)
+      {
+        unsigned long long int chunk, current_best;
+#pragma omp atomic capture
+        chunk = next_chunk++;
+        unsigned long long int k = chunk * ENUM_SEARCH_CHUNK;
+        unsigned long long int end = k + ENUM_SEARCH_CHUNK < nb ? k + ENUM_SEARCH_CHUNK : nb;
+#pragma omp atomic read
+        current_best = best;
+        if(k >= end || k >= current_best)
+          break;
+        for(; k < end; k++)
+        {
+#pragma omp atomic read
+          current_best = best;
+          if(k >= current_best)
+            break;
+          if(try_case(data, t, k))
+          {
+            /* the workspace of the thread holds the solution: the thread stops */
+#pragma omp critical(enum_search)
+            {
+              if(k < best)
+              {
+#pragma omp atomic write
+                best = k;
+                best_thread = t;
+              }
+            }
+            found = 1;
+            break;
+          }
+        }
+      }
+    }
+    *thread = best_thread;
+    return best;
+  }
+#endif
+  for(unsigned long long int k = 0; k < nb; k++)
+  {
+    if(try_case(data, 0, k))
+      return k;
+  }
+  return nb;
+}
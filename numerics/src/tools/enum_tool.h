@@ -31,6 +31,44 @@ typedef struct EnumerationStruct
 EnumerationStruct * enum_init(int M);
 int enum_next(int * zw, int size, EnumerationStruct * enum_struct);
 
+/** Set zw to the configuration of the case k of the enumeration (the one
+ * given by enum_next when enum_struct->current is k).
+ * \param[out] zw the configuration
+ * \param size the size of the MCLP problem.
+ * \param k the case, taken modulo the number of cases
+ */
+void enum_case(int * zw, int size, unsigned long long int k);
+
+/** Function trying a case of the enumeration, used by enum_search.
+ * \param data the data of the solver
+ * \param thread the number of the calling thread, in [0, nthreads)
+ * \param k the number of the case tried
+ * \return 1 if the case gives a solution, 0 otherwise
+ */
+typedef int (*enum_try_case)(void * data, int thread, unsigned long long int k);
+
+/** Search the first case k in 0, ..., nb - 1 for which try_case succeeds.
+ * With nthreads > 1 (and OpenMP), the cases are split into ranges processed
+ * by nthreads threads. A thread stops at its first solution and all of
+ * them stop when the remaining cases are after the best solution found, so
+ * that the result is the one of the sequential search: the thread that
+ * found it still holds it in its workspace.
+ * \param nb the number of cases to try
+ * \param nthreads the number of threads
+ * \param try_case the function trying a case
+ * \param data the data given to try_case
+ * \param[out] thread the thread that found the solution
+ * \return the first case giving a solution, nb if there is none
+ */
+unsigned long long int enum_search(unsigned long long int nb, int nthreads,
+                                   enum_try_case try_case, void * data, int * thread);
+
+/** Number of threads used by enum_search.
+ * \param nthreads the requested number of threads
+ * \return nthreads if it is greater than 1 and OpenMP is available, 1 otherwise
+ */
+int enum_number_of_threads(int nthreads);
+
 
 
 /** Compute the total number of cases that should be enumerated
@@ -0,0 +1,205 @@
+/* Siconos is a program dedicated to modeling, simulation and control
+ * of non smooth dynamical systems.
+ *
+ * Copyright 2020 INRIA.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+*/
+#include "fixed_point_acceleration.h"
+#include <math.h>               // for sqrt, INFINITY
+#include <stdlib.h>             // for free, malloc
+#include "SiconosBlas.h"        // for cblas_ddot, cblas_daxpy, cblas_dcopy
+#include "SiconosLapack.h"      // for DPOSV, lapack_int, LA_UP
+#include "SolverOptions.h"      // for SolverOptions, SICONOS_IPARAM_ACCE...
+#include "numerics_verbose.h"   // for numerics_error, numerics_printf_verbose
+
+void fixed_point_acceleration_set_default(SolverOptions * options)
+{
+  options->iparam[SICONOS_IPARAM_ACCELERATION] = SICONOS_ACCELERATION_NONE;
+  options->iparam[SICONOS_IPARAM_ACCELERATION_MEMORY] = 5;
+  options->dparam[SICONOS_DPARAM_ACCELERATION_RESTART] = 1.0;
+}
+
+fixed_point_acceleration * fixed_point_acceleration_new(int n, SolverOptions * options)
+{
+  int strategy = options->iparam[SICONOS_IPARAM_ACCELERATION];
+  if(strategy == SICONOS_ACCELERATION_NONE)
+    return NULL;
+  if(strategy != SICONOS_ACCELERATION_NESTEROV && strategy != SICONOS_ACCELERATION_ANDERSON)
+    numerics_error("fixed_point_acceleration_new", "unknown value of iparam[SICONOS_IPARAM_ACCELERATION]");
+
+  fixed_point_acceleration * acc = (fixed_point_acceleration *)malloc(sizeof(fixed_point_acceleration));
+  acc->strategy = strategy;
+  acc->n = n;
+  acc->memory = options->iparam[SICONOS_IPARAM_ACCELERATION_MEMORY] > 0 ?
+                options->iparam[SICONOS_IPARAM_ACCELERATION_MEMORY] : 5;
+  acc->eta = options->dparam[SICONOS_DPARAM_ACCELERATION_RESTART] > 0.0 ?
+             options->dparam[SICONOS_DPARAM_ACCELERATION_RESTART] : 1.0;
+  acc->g_k = (double *)malloc(n * sizeof(double));
+  acc->f_k = NULL;
+  acc->dF = NULL;
+  acc->dG = NULL;
+  acc->gram = NULL;
+  acc->work = NULL;
+  if(strategy == SICONOS_ACCELERATION_ANDERSON)
+  {
+    int m = acc->memory;
+    acc->f_k = (double *)malloc(n * sizeof(double));
+    acc->dF = (double *)malloc(n * m * sizeof(double));
+    acc->dG = (double *)malloc(n * m * sizeof(double));
+    acc->gram = (double *)malloc(m * m * sizeof(double));
+    acc->work = (double *)malloc(m * (m + 1) * sizeof(double));
+  }
+  fixed_point_acceleration_reset(acc);
+  return acc;
+}
+
+void fixed_point_acceleration_reset(fixed_point_acceleration * acc)
+{
+  if(!acc)
+    return;
+  acc->iter = 0;
+  acc->residual_k = INFINITY;
+  acc->t_k = 1.0;
+  acc->size = 0;
+  acc->head = -1;
+}
+
+/* Nesterov momentum on the images: y_{k+1} = G(x_k) and
+ * x_{k+1} = y_{k+1} + (t_k - 1) / t_{k+1} (y_{k+1} - y_k) */
+static int fixed_point_acceleration_nesterov(fixed_point_acceleration * acc, double * x, int restart)
+{
+  int n = acc->n;
+  if(acc->iter == 0 || restart)
+  {
+    acc->t_k = 1.0;
+    cblas_dcopy(n, x, 1, acc->g_k, 1);
+    return 0;
+  }
+  double t = 0.5 * (1.0 + sqrt(1.0 + 4.0 * acc->t_k * acc->t_k));
+  double beta = (acc->t_k - 1.0) / t;
+  for(int i = 0; i < n; i++)
+  {
+    double g = x[i];
+    x[i] = g + beta * (g - acc->g_k[i]);
+    acc->g_k[i] = g;
+  }
+  acc->t_k = t;
+  return 1;
+}
+
+/* Anderson mixing (type II): with f = G(x) - x and the differences dF, dG
+ * of the last residuals and images, x_{k+1} = G(x_k) - dG gamma where gamma
+ * minimizes |f_k - dF gamma|, solved with the regularized normal equations. */
+static int fixed_point_acceleration_anderson(fixed_point_acceleration * acc, const double * x_k,
+                                             double * x, int restart)
+{
+  int n = acc->n;
+  int m = acc->memory;
+  if(restart)
+  {
+    acc->size = 0;
+    acc->head = -1;
+  }
+  else if(acc->iter > 0)
+  {
+    /* new differences in the oldest column */
+    acc->head = (acc->head + 1) % m;
+    double * dF = &acc->dF[acc->head * n];
+    double * dG = &acc->dG[acc->head * n];
+    for(int i = 0; i < n; i++)
+    {
+      dF[i] = (x[i] - x_k[i]) - acc->f_k[i];
+      dG[i] = x[i] - acc->g_k[i];
+    }
+    if(acc->size < m)
+      acc->size++;
+    for(int j = 0; j < acc->size; j++)
+    {
+      double d = cblas_ddot(n, dF, 1, &acc->dF[j * n], 1);
+      acc->gram[acc->head + j * m] = d;
+      acc->gram[j + acc->head * m] = d;
+    }
+  }
+  for(int i = 0; i < n; i++)
+  {
+    acc->f_k[i] = x[i] - x_k[i];
+    acc->g_k[i] = x[i];
+  }
+  int size = acc->size;
+  if(size == 0)
+    return 0;
+
+  double * A = acc->work;
+  double * gamma = &acc->work[m * m];
+  double diag_max = 0.0;
+  for(int j = 0; j < size; j++)
+  {
+    for(int i = 0; i < size; i++)
+      A[i + j * size] = acc->gram[i + j * m];
+    if(A[j + j * size] > diag_max)
+      diag_max = A[j + j * size];
+    gamma[j] = cblas_ddot(n, &acc->dF[j * n], 1, acc->f_k, 1);
+  }
+  for(int j = 0; j < size; j++)
+    A[j + j * size] += 1e-10 * diag_max + 1e-300;
+
+  lapack_int info = 0;
+  DPOSV(LA_UP, size, 1, A, size, gamma, size, &info);
+  if(info != 0)
+  {
+    numerics_printf_verbose(2, "fixed_point_acceleration, Anderson: singular least squares, reset");
+    acc->size = 0;
+    acc->head = -1;
+    return 0;
+  }
+  for(int j = 0; j < size; j++)
+    cblas_daxpy(n, -gamma[j], &acc->dG[j * n], 1, x, 1);
+  return 1;
+}
+
+int fixed_point_acceleration_update(fixed_point_acceleration * acc, const double * x_k, double * x)
+{
+  if(!acc)
+    return 0;
+  double residual = 0.0;
+  for(int i = 0; i < acc->n; i++)
+    residual += (x[i] - x_k[i]) * (x[i] - x_k[i]);
+  residual = sqrt(residual);
+  int restart = (acc->iter > 0 && residual > acc->eta * acc->residual_k);
+  if(restart)
+    numerics_printf_verbose(2, "fixed_point_acceleration: restart, residual = %e > %e", residual, acc->eta * acc->residual_k);
+
+  int accelerated = 0;
+  if(acc->strategy == SICONOS_ACCELERATION_NESTEROV)
+    accelerated = fixed_point_acceleration_nesterov(acc, x, restart);
+  else
+    accelerated = fixed_point_acceleration_anderson(acc, x_k, x, restart);
+
+  acc->residual_k = residual;
+  acc->iter++;
+  return accelerated;
+}
+
+void fixed_point_acceleration_free(fixed_point_acceleration * acc)
+{
+  if(!acc)
+    return;
+  free(acc->g_k);
+  free(acc->f_k);
+  free(acc->dF);
+  free(acc->dG);
+  free(acc->gram);
+  free(acc->work);
+  free(acc);
+}
@@ -0,0 +1,115 @@
+/* Siconos is a program dedicated to modeling, simulation and control
+ * of non smooth dynamical systems.
+ *
+ * Copyright 2020 INRIA.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+*/
+
+#ifndef FIXED_POINT_ACCELERATION_H
+#define FIXED_POINT_ACCELERATION_H
+
+/*!\file fixed_point_acceleration.h
+ * \brief Acceleration of the fixed point iterations \f$x_{k+1} = G(x_k)\f$
+ * of the projection and splitting solvers.
+ *
+ * The strategy is chosen with iparam[SICONOS_IPARAM_ACCELERATION]:
+ * - Nesterov momentum, restarted when the fixed point residual
+ *   \f$\|G(x_k) - x_k\|\f$ does not decrease enough;
+ * - Anderson mixing of the last iparam[SICONOS_IPARAM_ACCELERATION_MEMORY]
+ *   iterates, reset under the same condition.
+ *
+ * The restart condition is \f$\|G(x_k) - x_k\| > \eta \|G(x_{k-1}) - x_{k-1}\|\f$
+ * with \f$\eta\f$ = dparam[SICONOS_DPARAM_ACCELERATION_RESTART]. The
+ * accelerated iterate may leave the feasible set: the solvers project it
+ * again when needed.
+ */
+
+#include "NumericsFwd.h"    // for SolverOptions
+#include "SiconosConfig.h"  // for BUILD_AS_CPP // IWYU pragma: keep
+
+/** allowed values for iparam[SICONOS_IPARAM_ACCELERATION] */
+enum SICONOS_ACCELERATION_ENUM
+{
+  /** plain fixed point iterations */
+  SICONOS_ACCELERATION_NONE = 0,
+  /** Nesterov momentum with restart */
+  SICONOS_ACCELERATION_NESTEROV = 1,
+  /** Anderson mixing with restart */
+  SICONOS_ACCELERATION_ANDERSON = 2
+};
+
+/** \struct fixed_point_acceleration fixed_point_acceleration.h
+ * Data of the acceleration of fixed point iterations of size n
+ */
+typedef struct
+{
+  int strategy;       /**< one of SICONOS_ACCELERATION_ENUM */
+  int n;              /**< size of the iterates */
+  int memory;         /**< maximal number of differences of the Anderson mixing */
+  double eta;         /**< restart ratio of the residuals */
+  int iter;           /**< number of updates since the last restart */
+  double residual_k;  /**< residual of the previous update */
+  double t_k;         /**< Nesterov sequence */
+  double * g_k;       /**< previous image G(x_{k-1}) */
+  double * f_k;       /**< previous residual G(x_{k-1}) - x_{k-1} (Anderson) */
+  int size;           /**< number of stored differences (Anderson) */
+  int head;           /**< position of the last stored difference (Anderson) */
+  double * dF;        /**< differences of the residuals, column-major n x memory */
+  double * dG;        /**< differences of the images, column-major n x memory */
+  double * gram;      /**< Gram matrix of the differences of the residuals */
+  double * work;      /**< workspace of size memory * (memory + 1) */
+} fixed_point_acceleration;
+
+#if defined(__cplusplus) && !defined(BUILD_AS_CPP)
+extern "C"
+{
+#endif
+
+  /** set the default values of the acceleration parameters:
+      no acceleration, a memory of 5 and a restart ratio of 1.
+      \param options the options of the solver
+  */
+  void fixed_point_acceleration_set_default(SolverOptions * options);
+
+  /** create the acceleration data from the options of the solver
+      \param n size of the iterates
+      \param options the options of the solver
+      \return the acceleration data, NULL without acceleration
+  */
+  fixed_point_acceleration * fixed_point_acceleration_new(int n, SolverOptions * options);
+
+  /** forget the previous iterates, for instance when the fixed point map
+      changes
+      \param acc the acceleration data (may be NULL)
+  */
+  void fixed_point_acceleration_reset(fixed_point_acceleration * acc);
+
+  /** compute the next iterate from the current one and its image
+      \param acc the acceleration data (may be NULL, x is then unchanged)
+      \param x_k the current iterate
+      \param[in,out] x in: the image G(x_k), out: the next iterate
+      \return 1 if x has been extrapolated, 0 otherwise
+  */
+  int fixed_point_acceleration_update(fixed_point_acceleration * acc, const double * x_k, double * x);
+
+  /** free the acceleration data
+      \param acc the acceleration data (may be NULL)
+  */
+  void fixed_point_acceleration_free(fixed_point_acceleration * acc);
+
+#if defined(__cplusplus) && !defined(BUILD_AS_CPP)
+}
+#endif
+
+#endif
@@ -2,6 +2,7 @@
 #include "fc3d_Solvers.h"
 #include "Friction_cst.h"
 #include "FrictionContactProblem.h"
+#include "FrictionContactTrace.h"
 #include "fc3d_compute_error.h"
 #ifdef WITH_FCLIB
 // avoid a conflict with old csparse.h in case fclib.h includes it
@@ -16,6 +17,7 @@
 %}
 
 %include "FrictionContactProblem.h"
+%include "FrictionContactTrace.h"
 #ifdef WITH_FCLIB
 // avoid a conflict with old csparse.h in case fclib.h includes it
 #define _CS_H
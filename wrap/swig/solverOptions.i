@@ -354,3 +354,9 @@ static int convert_darray(PyObject *input, double *ptr) {
 %}
 
 %include "SolverOptions.h"
+
+%{
+#include "fixed_point_acceleration.h"
+%}
+
+%include "fixed_point_acceleration.h"